@@ -1,30 +0,0 @@
-// Copyright 2023 Pixmoving, Inc. 
-// 
-// Licensed under the Apache License, Version 2.0 (the "License");
-// you may not use this file except in compliance with the License.
-// You may obtain a copy of the License at
-// 
-//     http://www.apache.org/licenses/LICENSE-2.0
-// 
-// Unless required by applicable law or agreed to in writing, software
-// distributed under the License is distributed on an "AS IS" BASIS,
-// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-// See the License for the specific language governing permissions and
-// limitations under the License.
-
-#pragma once
-#include <iostream>
-
-class Byte
-{
-private:
-    uint8_t byte_t;
-
-public:
-    Byte(std::uint8_t byte);
-    ~Byte();
-
-    uint8_t return_byte_t();
-    int32_t get_byte(uint start, uint end);
-    void set_value(uint8_t value, uint start, uint len);
-};
@@ -0,0 +1,254 @@
+// Copyright 2023 Pixmoving, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PIX_HOOKE_DRIVER__CAN_CODEC_HPP_
+#define PIX_HOOKE_DRIVER__CAN_CODEC_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace pix_hooke_driver
+{
+namespace can_codec
+{
+/// @brief data bytes of a classic CAN frame
+using Payload = std::array<uint8_t, 8>;
+
+/**
+ * @brief layout of a little endian (intel order) signal in a CAN frame
+ * @param start_bit position of the least significant bit, counted from bit 0 of byte 0
+ * @param length number of bits
+ * @param is_signed whether the raw value is two's complement
+ * @param scale physical value of one raw unit
+ * @param offset physical value of raw 0
+ */
+struct Signal
+{
+  uint8_t start_bit;
+  uint8_t length;
+  bool is_signed;
+  double scale;
+  double offset;
+};
+
+/**
+ * @brief pack the payload bytes into one little endian word
+ */
+constexpr uint64_t toWord(const Payload & data)
+{
+  uint64_t word = 0;
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    word |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  return word;
+}
+
+/**
+ * @brief unpack a little endian word into payload bytes
+ */
+inline Payload toPayload(const uint64_t word)
+{
+  Payload data{};
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>(word >> (8 * i));
+  }
+  return data;
+}
+
+/**
+ * @brief mask of the raw value bits of a signal, not shifted to its start bit
+ */
+constexpr uint64_t rawMask(const Signal & signal)
+{
+  return signal.length >= 64 ? ~uint64_t{0} : (uint64_t{1} << signal.length) - 1;
+}
+
+constexpr int64_t minRaw(const Signal & signal)
+{
+  return signal.is_signed ? -static_cast<int64_t>(rawMask(signal) >> 1) - 1 : 0;
+}
+
+constexpr int64_t maxRaw(const Signal & signal)
+{
+  return static_cast<int64_t>(signal.is_signed ? rawMask(signal) >> 1 : rawMask(signal));
+}
+
+/**
+ * @brief extract the raw value of a signal from a frame word, sign extended if signed
+ */
+constexpr int64_t getRaw(const uint64_t word, const Signal & signal)
+{
+  const uint64_t raw = (word >> signal.start_bit) & rawMask(signal);
+  const uint64_t sign_bit = uint64_t{1} << (signal.length - 1);
+  return signal.is_signed ? static_cast<int64_t>((raw ^ sign_bit) - sign_bit) :
+                            static_cast<int64_t>(raw);
+}
+
+/**
+ * @brief overwrite the bits of a signal in a frame word with a raw value
+ */
+constexpr void setRaw(uint64_t & word, const Signal & signal, const int64_t raw)
+{
+  const uint64_t mask = rawMask(signal) << signal.start_bit;
+  word = (word & ~mask) | ((static_cast<uint64_t>(raw) << signal.start_bit) & mask);
+}
+
+/**
+ * @brief physical value of a signal in a frame word
+ */
+constexpr double decodeSignal(const uint64_t word, const Signal & signal)
+{
+  return static_cast<double>(getRaw(word, signal)) * signal.scale + signal.offset;
+}
+
+/**
+ * @brief raw value of a physical value, rounded to the nearest raw unit and saturated to the
+ * range the signal can represent
+ */
+inline int64_t toRaw(const double value, const Signal & signal)
+{
+  const double raw = std::round((value - signal.offset) / signal.scale);
+  if (!(raw > static_cast<double>(minRaw(signal)))) {
+    return minRaw(signal);
+  }
+  if (raw >= static_cast<double>(maxRaw(signal))) {
+    return maxRaw(signal);
+  }
+  return static_cast<int64_t>(raw);
+}
+
+/**
+ * @brief physical value of a raw value, as stored in a message field of type T
+ * @details integer fields (enums, counters, checksums) keep the raw value, float fields get the
+ * scaled physical value
+ */
+template <typename T>
+T fromRaw(const int64_t raw, const Signal & signal, std::true_type /* is_integral */)
+{
+  return static_cast<T>(std::llround(static_cast<double>(raw) * signal.scale + signal.offset));
+}
+
+template <typename T>
+T fromRaw(const int64_t raw, const Signal & signal, std::false_type /* is_integral */)
+{
+  return static_cast<T>(static_cast<double>(raw) * signal.scale + signal.offset);
+}
+
+/**
+ * @brief raw value of a message field of type T
+ * @details unscaled integer fields are written as their two's complement bits, so that e.g. an
+ * int8 checksum of 200 (-56) is sent as 200, float fields are rounded and saturated by toRaw
+ */
+template <typename T>
+int64_t toRaw(const T value, const Signal & signal, std::true_type /* is_integral */)
+{
+  if (signal.scale == 1.0 && signal.offset == 0.0) {
+    return static_cast<int64_t>(value);
+  }
+  return toRaw(static_cast<double>(value), signal);
+}
+
+template <typename T>
+int64_t toRaw(const T value, const Signal & signal, std::false_type /* is_integral */)
+{
+  return toRaw(static_cast<double>(value), signal);
+}
+
+/**
+ * @brief binding of a signal to a field of the ros message it is decoded to / encoded from
+ * @param signal layout of the signal
+ * @param set write the value of a raw signal value to the message field
+ * @param get read the raw signal value of the message field
+ */
+template <typename MsgT>
+struct Field
+{
+  Signal signal;
+  void (*set)(MsgT & msg, int64_t raw, const Signal & signal);
+  int64_t (*get)(const MsgT & msg, const Signal & signal);
+};
+
+template <typename MsgT, typename T, T MsgT::*Member>
+void setField(MsgT & msg, const int64_t raw, const Signal & signal)
+{
+  msg.*Member = fromRaw<T>(raw, signal, std::is_integral<T>{});
+}
+
+template <typename MsgT, typename T, T MsgT::*Member>
+int64_t getField(const MsgT & msg, const Signal & signal)
+{
+  return toRaw(msg.*Member, signal, std::is_integral<T>{});
+}
+
+/**
+ * @brief table of all signals of a CAN frame, see PIX_HOOKE_CAN_FIELD
+ * @param id CAN id of the frame
+ * @param fields signals of the frame and the message fields they map to
+ */
+template <typename MsgT, std::size_t N>
+struct FrameCodec
+{
+  uint32_t id;
+  std::array<Field<MsgT>, N> fields;
+};
+
+/**
+ * @brief decode all signals of a frame into the message fields
+ */
+template <typename MsgT, std::size_t N>
+void decode(const Payload & data, const FrameCodec<MsgT, N> & codec, MsgT & msg)
+{
+  const uint64_t word = toWord(data);
+  for (const auto & field : codec.fields) {
+    field.set(msg, getRaw(word, field.signal), field.signal);
+  }
+}
+
+/**
+ * @brief encode the message fields into a frame, bits not covered by a signal are zero
+ */
+template <typename MsgT, std::size_t N>
+Payload encode(const MsgT & msg, const FrameCodec<MsgT, N> & codec)
+{
+  uint64_t word = 0;
+  for (const auto & field : codec.fields) {
+    setRaw(word, field.signal, field.get(msg, field.signal));
+  }
+  return toPayload(word);
+}
+}  // namespace can_codec
+}  // namespace pix_hooke_driver
+
+/**
+ * @brief entry of a FrameCodec table
+ * @param MsgT ros message type of the frame
+ * @param member field of MsgT the signal maps to
+ * @param start_bit position of the least significant bit of the signal (intel order)
+ * @param length number of bits of the signal
+ * @param is_signed whether the raw value is two's complement
+ * @param scale physical value of one raw unit
+ * @param offset physical value of raw 0
+ */
+#define PIX_HOOKE_CAN_FIELD(MsgT, member, start_bit, length, is_signed, scale, offset)      \
+  pix_hooke_driver::can_codec::Field<MsgT>                                                  \
+  {                                                                                         \
+    {start_bit, length, is_signed, scale, offset},                                          \
+      &pix_hooke_driver::can_codec::setField<MsgT, decltype(MsgT::member), &MsgT::member>, \
+      &pix_hooke_driver::can_codec::getField<MsgT, decltype(MsgT::member), &MsgT::member>  \
+  }
+
+#endif  // PIX_HOOKE_DRIVER__CAN_CODEC_HPP_
@@ -27,11 +27,7 @@
 #include <pix_hooke_driver_msgs/msg/a2v_vehicle_ctrl.hpp>
 #include <pix_hooke_driver_msgs/msg/a2v_wheel_ctrl.hpp>
 
-#include <pix_hooke_driver/a2v_brakectrl_131.hpp>
-#include <pix_hooke_driver/a2v_drivectrl_130.hpp>
-#include <pix_hooke_driver/a2v_steerctrl_132.hpp>
-#include <pix_hooke_driver/a2v_vehiclectrl_133.hpp>
-#include <pix_hooke_driver/a2v_wheelctrl_135.hpp>
+#include <pix_hooke_driver/pix_hooke_frames.hpp>
 
 #include <string>
 #include <memory>
@@ -78,13 +74,6 @@ private:
   A2vWheelCtrl::ConstSharedPtr wheel_ctrl_ptr_;
   A2vVehicleCtrl::ConstSharedPtr vehicle_ctrl_ptr_;
 
-  // control command structures
-  A2vdrivectrl130 a2v_drivectrl_130_entity_;
-  A2vbrakectrl131 a2v_brakectrl_131_entity_;
-  A2vsteerctrl132 a2v_steerctrl_132_entity_;
-  A2vvehiclectrl133 a2v_vehiclectrl_133_entity_;
-  A2vwheelctrl135 a2v_wheelctrl_135_entity_;
-
   // msg received timestamp
   rclcpp::Time brake_command_received_time_;
   rclcpp::Time drive_command_received_time_;
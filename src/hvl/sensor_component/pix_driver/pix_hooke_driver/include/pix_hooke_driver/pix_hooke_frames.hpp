@@ -0,0 +1,272 @@
+// Copyright 2023 Pixmoving, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PIX_HOOKE_DRIVER__PIX_HOOKE_FRAMES_HPP_
+#define PIX_HOOKE_DRIVER__PIX_HOOKE_FRAMES_HPP_
+
+#include <pix_hooke_driver/can_codec.hpp>
+
+#include <pix_hooke_driver_msgs/msg/a2v_brake_ctrl.hpp>
+#include <pix_hooke_driver_msgs/msg/a2v_drive_ctrl.hpp>
+#include <pix_hooke_driver_msgs/msg/a2v_steer_ctrl.hpp>
+#include <pix_hooke_driver_msgs/msg/a2v_vehicle_ctrl.hpp>
+#include <pix_hooke_driver_msgs/msg/a2v_wheel_ctrl.hpp>
+#include <pix_hooke_driver_msgs/msg/v2a_brake_sta_fb.hpp>
+#include <pix_hooke_driver_msgs/msg/v2a_chassis_wheel_angle_fb.hpp>
+#include <pix_hooke_driver_msgs/msg/v2a_chassis_wheel_rpm_fb.hpp>
+#include <pix_hooke_driver_msgs/msg/v2a_chassis_wheel_tire_press_fb.hpp>
+#include <pix_hooke_driver_msgs/msg/v2a_drive_sta_fb.hpp>
+#include <pix_hooke_driver_msgs/msg/v2a_power_sta_fb.hpp>
+#include <pix_hooke_driver_msgs/msg/v2a_steer_sta_fb.hpp>
+#include <pix_hooke_driver_msgs/msg/v2a_vehicle_flt_sta.hpp>
+#include <pix_hooke_driver_msgs/msg/v2a_vehicle_sta_fb.hpp>
+#include <pix_hooke_driver_msgs/msg/v2a_vehicle_work_sta_fb.hpp>
+
+/**
+ * @brief signal tables of the pix hooke chassis CAN protocol, generated from the protocol
+ * definition: one FrameCodec per frame, mapping every signal to its field in
+ * pix_hooke_driver_msgs. To support a new frame, add its message and its table here.
+ */
+namespace pix_hooke_driver
+{
+namespace frames
+{
+using pix_hooke_driver_msgs::msg::A2vBrakeCtrl;
+using pix_hooke_driver_msgs::msg::A2vDriveCtrl;
+using pix_hooke_driver_msgs::msg::A2vSteerCtrl;
+using pix_hooke_driver_msgs::msg::A2vVehicleCtrl;
+using pix_hooke_driver_msgs::msg::A2vWheelCtrl;
+using pix_hooke_driver_msgs::msg::V2aBrakeStaFb;
+using pix_hooke_driver_msgs::msg::V2aChassisWheelAngleFb;
+using pix_hooke_driver_msgs::msg::V2aChassisWheelRpmFb;
+using pix_hooke_driver_msgs::msg::V2aChassisWheelTirePressFb;
+using pix_hooke_driver_msgs::msg::V2aDriveStaFb;
+using pix_hooke_driver_msgs::msg::V2aPowerStaFb;
+using pix_hooke_driver_msgs::msg::V2aSteerStaFb;
+using pix_hooke_driver_msgs::msg::V2aVehicleFltSta;
+using pix_hooke_driver_msgs::msg::V2aVehicleStaFb;
+using pix_hooke_driver_msgs::msg::V2aVehicleWorkStaFb;
+
+// reports (vehicle to autoware)
+constexpr can_codec::FrameCodec<V2aDriveStaFb, 7> V2A_DRIVE_STA_FB_530{
+  0x530,
+  {{
+    PIX_HOOKE_CAN_FIELD(V2aDriveStaFb, vcu_chassis_driver_en_sta, 0, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aDriveStaFb, vcu_chassis_diver_slopover, 1, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aDriveStaFb, vcu_chassis_driver_mode_sta, 2, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aDriveStaFb, vcu_chassis_gear_fb, 4, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aDriveStaFb, vcu_chassis_speed_fb, 8, 16, true, 0.01, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aDriveStaFb, vcu_chassis_throttle_padl_fb, 24, 10, false, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aDriveStaFb, vcu_chassis_accceleration_fb, 40, 16, true, 0.01, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<V2aBrakeStaFb, 6> V2A_BRAKE_STA_FB_531{
+  0x531,
+  {{
+    PIX_HOOKE_CAN_FIELD(V2aBrakeStaFb, vcu_chassis_brake_en_sta, 0, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aBrakeStaFb, vcu_vehicle_brake_lamp_fb, 2, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aBrakeStaFb, vcu_chassis_epb_fb, 4, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aBrakeStaFb, vcu_chassis_brake_padl_fb, 8, 10, false, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aBrakeStaFb, vcu_aeb_en_sta_fb, 24, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aBrakeStaFb, vcu_aeb_trigger_sta_fb, 26, 1, false, 1.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<V2aSteerStaFb, 7> V2A_STEER_STA_FB_532{
+  0x532,
+  {{
+    PIX_HOOKE_CAN_FIELD(V2aSteerStaFb, vcu_chassis_steer_en_sta, 0, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aSteerStaFb, vcu_chassis_steer_slopover, 1, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aSteerStaFb, vcu_chassis_steer_work_mode, 2, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aSteerStaFb, vcu_chassis_steer_mode_fb, 4, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aSteerStaFb, vcu_chassis_steer_angle_fb, 8, 16, true, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aSteerStaFb, vcu_chassis_steer_angle_rear_fb, 24, 16, true, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aSteerStaFb, vcu_chassis_steer_angle_speed_fb, 40, 8, false, 2.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<V2aVehicleWorkStaFb, 15> V2A_VEHICLE_WORK_STA_FB_534{
+  0x534,
+  {{
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_driving_mode_fb, 0, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_chassis_power_sta_fb, 2, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_chassis_power_dc_sta, 4, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(
+      V2aVehicleWorkStaFb, vcu_chassis_speed_limited_mode_fb, 8, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_chassis_power_limite_sta, 9, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_sys_eco_mode, 10, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(
+      V2aVehicleWorkStaFb, vcu_chassis_speed_limited_val_fb, 16, 16, false, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(
+      V2aVehicleWorkStaFb, vcu_chassis_low_power_volt_sta, 32, 8, false, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_chassis_e_stop_sta_fb, 40, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_crash_front_sta, 44, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_crash_rear_sta, 45, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_crash_left_sta, 46, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_crash_right_sta, 47, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_life, 48, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleWorkStaFb, vcu_check_sum, 56, 8, false, 1.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<V2aPowerStaFb, 8> V2A_POWER_STA_FB_535{
+  0x535,
+  {{
+    PIX_HOOKE_CAN_FIELD(V2aPowerStaFb, vcu_chassis_bms_reserved_1, 0, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aPowerStaFb, vcu_chassis_power_charge_sta, 4, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aPowerStaFb, vcu_chassis_power_charge_sock_sta, 6, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aPowerStaFb, vcu_chassis_power_soc_fb, 8, 8, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aPowerStaFb, vcu_chassis_power_volt_fb, 16, 16, false, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aPowerStaFb, vcu_chassis_power_curr_fb, 32, 16, false, 0.1, -1000.0),
+    PIX_HOOKE_CAN_FIELD(V2aPowerStaFb, vcu_chassis_bms_max_temp, 48, 8, false, 1.0, -40.0),
+    PIX_HOOKE_CAN_FIELD(V2aPowerStaFb, vcu_chassis_bms_reserved_2, 56, 8, false, 1.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<V2aVehicleStaFb, 16> V2A_VEHICLE_STA_FB_536{
+  0x536,
+  {{
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_pos_lamp_fb, 0, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_head_lamp_fb, 1, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_left_lamp_fb, 2, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_right_lamp_fb, 3, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_high_beam_fb, 4, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_fog_lamp_fb, 5, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_hazard_war_lamp_fb, 6, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_body_lamp_fb, 7, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_read_lamp_fb, 8, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, acu_vehicle_window_fb, 9, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_door_sta_fb, 16, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_wipers_sta_fb, 20, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_safety_belt_1, 24, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_safety_belt_2, 26, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_safety_belt_3, 28, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleStaFb, vcu_vehicle_safety_belt_4, 30, 2, false, 1.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<V2aVehicleFltSta, 16> V2A_VEHICLE_FLT_STA_537{
+  0x537,
+  {{
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_motor_over_temp_sta, 0, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_bms_over_temp_sta, 1, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_brake_over_temp_sta, 2, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_steer_over_temp_sta, 3, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_under_volt, 4, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_flt, 8, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_brake_flt, 12, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_parking_flt, 16, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_steer_front_flt, 20, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_steer_back_flt, 24, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_motor_lf_flt, 28, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_motor_rf_flt, 32, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_motor_lr_flt, 36, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_motor_rr_flt, 40, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_bms_flt, 44, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aVehicleFltSta, vcu_sys_dc_flt, 48, 4, false, 1.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<V2aChassisWheelRpmFb, 4> V2A_CHASSIS_WHEEL_RPM_FB_539{
+  0x539,
+  {{
+    PIX_HOOKE_CAN_FIELD(V2aChassisWheelRpmFb, vcu_chassis_wheel_rpm_lf, 0, 16, true, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aChassisWheelRpmFb, vcu_chassis_wheel_rpm_rf, 16, 16, true, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aChassisWheelRpmFb, vcu_chassis_wheel_rpm_lr, 32, 16, true, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aChassisWheelRpmFb, vcu_chassis_wheel_rpm_rr, 48, 16, true, 1.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<V2aChassisWheelTirePressFb, 4> V2A_CHASSIS_WHEEL_TIRE_PRESS_FB_540{
+  0x540,
+  {{
+    PIX_HOOKE_CAN_FIELD(
+      V2aChassisWheelTirePressFb, vcu_chassis_wheel_tire_press_lf, 0, 12, false, 0.01, 0.0),
+    PIX_HOOKE_CAN_FIELD(
+      V2aChassisWheelTirePressFb, vcu_chassis_wheel_tire_press_rf, 16, 12, false, 0.01, 0.0),
+    PIX_HOOKE_CAN_FIELD(
+      V2aChassisWheelTirePressFb, vcu_chassis_wheel_tire_press_lr, 32, 12, false, 0.01, 0.0),
+    PIX_HOOKE_CAN_FIELD(
+      V2aChassisWheelTirePressFb, vcu_chassis_wheel_tire_press_rr, 48, 12, false, 0.01, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<V2aChassisWheelAngleFb, 4> V2A_CHASSIS_WHEEL_ANGLE_FB_541{
+  0x541,
+  {{
+    PIX_HOOKE_CAN_FIELD(V2aChassisWheelAngleFb, vcu_chassis_wheel_angle_lf, 0, 12, true, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aChassisWheelAngleFb, vcu_chassis_wheel_angle_rf, 16, 12, true, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aChassisWheelAngleFb, vcu_chassis_wheel_angle_lr, 32, 12, true, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(V2aChassisWheelAngleFb, vcu_chassis_wheel_angle_rr, 48, 12, true, 0.1, 0.0),
+  }}};
+
+// commands (autoware to vehicle)
+constexpr can_codec::FrameCodec<A2vDriveCtrl, 7> A2V_DRIVE_CTRL_130{
+  0x130,
+  {{
+    PIX_HOOKE_CAN_FIELD(A2vDriveCtrl, acu_chassis_driver_en_ctrl, 0, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vDriveCtrl, acu_chassis_driver_mode_ctrl, 2, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vDriveCtrl, acu_chassis_gear_ctrl, 4, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vDriveCtrl, acu_chassis_speed_ctrl, 8, 16, false, 0.01, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vDriveCtrl, acu_chassis_throttle_pdl_target, 24, 10, false, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vDriveCtrl, acu_drive_life_sig, 48, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vDriveCtrl, acu_check_sum_130, 56, 8, false, 1.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<A2vBrakeCtrl, 6> A2V_BRAKE_CTRL_131{
+  0x131,
+  {{
+    PIX_HOOKE_CAN_FIELD(A2vBrakeCtrl, acu_chassis_brake_en, 0, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vBrakeCtrl, acu_chassis_aeb_ctrl, 4, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vBrakeCtrl, acu_chassis_brake_pdl_target, 8, 10, false, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vBrakeCtrl, acu_chassis_epb_ctrl, 24, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vBrakeCtrl, acu_brake_life_sig, 48, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vBrakeCtrl, acu_check_sum_131, 56, 8, false, 1.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<A2vSteerCtrl, 6> A2V_STEER_CTRL_132{
+  0x132,
+  {{
+    PIX_HOOKE_CAN_FIELD(A2vSteerCtrl, acu_chassis_steer_en_ctrl, 0, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vSteerCtrl, acu_chassis_steer_mode_ctrl, 4, 4, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vSteerCtrl, acu_chassis_steer_angle_target, 8, 16, true, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vSteerCtrl, acu_chassis_steer_angle_rear_target, 24, 16, true, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vSteerCtrl, acu_chassis_steer_angle_speed_ctrl, 40, 8, false, 2.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vSteerCtrl, acu_check_sum_132, 56, 8, false, 1.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<A2vVehicleCtrl, 15> A2V_VEHICLE_CTRL_133{
+  0x133,
+  {{
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_pos_lamp_ctrl, 0, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_head_lamp_ctrl, 1, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_left_lamp_ctrl, 2, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_right_lamp_ctrl, 3, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicl_high_beam_ctrl, 4, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_fog_lamp_ctrl, 5, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_body_light_crtl, 6, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_read_light_crtl, 7, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_voice, 8, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_wipers_crtl, 10, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_door_crtl, 12, 2, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_vehicle_window_crtl, 14, 3, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_chassis_speed_limite_mode, 24, 1, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_chassis_speed_limite_val, 32, 16, false, 1.0, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vVehicleCtrl, acu_check_sum_en, 48, 1, false, 1.0, 0.0),
+  }}};
+
+constexpr can_codec::FrameCodec<A2vWheelCtrl, 4> A2V_WHEEL_CTRL_135{
+  0x135,
+  {{
+    PIX_HOOKE_CAN_FIELD(A2vWheelCtrl, acu_motor_torque_lf_crtl, 0, 16, true, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vWheelCtrl, acu_motor_torque_rf_crtl, 16, 16, true, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vWheelCtrl, acu_motor_torque_lr_crtl, 32, 16, true, 0.1, 0.0),
+    PIX_HOOKE_CAN_FIELD(A2vWheelCtrl, acu_motor_torque_rr_crtl, 48, 16, true, 0.1, 0.0),
+  }}};
+}  // namespace frames
+}  // namespace pix_hooke_driver
+
+#endif  // PIX_HOOKE_DRIVER__PIX_HOOKE_FRAMES_HPP_
@@ -15,8 +15,10 @@
 #ifndef PIX_HOOKE_DRIVER__REPORT_PARSER_HPP_
 #define PIX_HOOKE_DRIVER__REPORT_PARSER_HPP_
 
+#include <functional>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -36,16 +38,7 @@
 #include <pix_hooke_driver_msgs/msg/v2a_vehicle_sta_fb.hpp>
 #include <pix_hooke_driver_msgs/msg/v2a_vehicle_work_sta_fb.hpp>
 
-#include <pix_hooke_driver/v2a_drivestafb_530.hpp>
-#include <pix_hooke_driver/v2a_brakestafb_531.hpp>
-#include <pix_hooke_driver/v2a_steerstafb_532.hpp>
-#include <pix_hooke_driver/v2a_vehicleworkstafb_534.hpp>
-#include <pix_hooke_driver/v2a_powerstafb_535.hpp>
-#include <pix_hooke_driver/v2a_vehiclestafb_536.hpp>
-#include <pix_hooke_driver/v2a_vehiclefltsta_537.hpp>
-#include <pix_hooke_driver/v2a_chassiswheelrpmfb_539.hpp>
-#include <pix_hooke_driver/v2a_chassiswheeltirepressfb_540.hpp>
-#include <pix_hooke_driver/v2a_chassiswheelanglefb_541.hpp>
+#include <pix_hooke_driver/pix_hooke_frames.hpp>
 
 
 namespace pix_hooke_driver
@@ -113,27 +106,9 @@ private:
   V2aVehicleStaFb::ConstSharedPtr vehicle_sta_fb_ptr_;
   V2aVehicleWorkStaFb::ConstSharedPtr vehicle_work_sta_fb_ptr_;
 
-  V2adrivestafb530  v2a_drivestafb_530_entity_;
-  V2abrakestafb531  v2a_brakestafb_531_entity_;
-  V2asteerstafb532  v2a_steerstafb_532_entity_;
-  V2avehicleworkstafb534  v2a_vehicleworkstafb_534_entity_;
-  V2apowerstafb535  v2a_powerstafb_535_entity_;
-  V2avehiclestafb536  v2a_vehiclestafb_536_entity_;
-  V2avehiclefltsta537  v2a_vehiclefltsta_537_entity_;
-  V2achassiswheelrpmfb539  v2a_chassiswheelrpmfb_539_entity_;
-  V2achassiswheeltirepressfb540  v2a_chassiswheeltirepressfb_540_entity_;
-  V2achassiswheelanglefb541  v2a_chassiswheelanglefb_541_entity_;
-
-  // brake_sta_fb
-  // chassis_wheel_angle_fb
-  // chassis_wheel_rpm_fb
-  // chassis_wheel_tire_press_fb
-  // drive_sta_fb
-  // power_sta_fb
-  // steer_sta_fb
-  // vehicle_flt_sta
-  // vehicle_sta_fb
-  // vehicle_work_sta_fb
+  // decoders of the report frames, indexed by can id - REPORT_ID_BEGIN
+  static constexpr uint32_t REPORT_ID_BEGIN = 0x530;
+  std::vector<std::function<void(const can_msgs::msg::Frame &)>> report_decoders_;
 
   // msg received time
   rclcpp::Time brake_sta_fb_received_time_;
@@ -149,6 +124,16 @@ private:
 
   // timer
   rclcpp::TimerBase::SharedPtr timer_;
+
+  /**
+   * @brief register the decoder of a report frame, which decodes the frame to msg_ptr and updates
+   * received_time
+   */
+  template <typename MsgT, std::size_t N>
+  void registerReport(
+    const can_codec::FrameCodec<MsgT, N> & codec, typename MsgT::ConstSharedPtr & msg_ptr,
+    rclcpp::Time & received_time);
+
 public:
   ReportParser(/* args */);
 
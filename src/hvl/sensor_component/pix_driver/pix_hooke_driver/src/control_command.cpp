@@ -20,6 +20,25 @@ namespace pix_hooke_driver
 {
 namespace control_command
 {
+namespace
+{
+/**
+ * @brief encode a command msg to the can frame of its codec
+ */
+template <typename MsgT, std::size_t N>
+can_msgs::msg::Frame::ConstSharedPtr toCanFrame(
+  const MsgT & msg, const can_codec::FrameCodec<MsgT, N> & codec)
+{
+  auto frame = std::make_shared<can_msgs::msg::Frame>();
+  frame->header.stamp = msg.header.stamp;
+  frame->dlc = 8;
+  frame->id = codec.id;
+  frame->is_extended = false;
+  frame->data = can_codec::encode(msg, codec);
+  return frame;
+}
+}  // namespace
+
 ControlCommand::ControlCommand() : Node("control_command")
 {
   // ros params
@@ -79,121 +98,34 @@ void ControlCommand::callbackBrakeCtrl(const A2vBrakeCtrl::ConstSharedPtr & msg)
 {
   brake_command_received_time_ = this->now();
   brake_ctrl_ptr_ = msg;
-  a2v_brakectrl_131_entity_.Reset();
-  a2v_brakectrl_131_entity_.UpdateData(
-    msg->acu_chassis_brake_en, msg->acu_chassis_aeb_ctrl, msg->acu_chassis_brake_pdl_target,
-    msg->acu_chassis_epb_ctrl, msg->acu_brake_life_sig, msg->acu_check_sum_131);
-  can_msgs::msg::Frame brake_ctrl_can_msg;
-  brake_ctrl_can_msg.header.stamp = msg->header.stamp;
-  brake_ctrl_can_msg.dlc = 8;
-  brake_ctrl_can_msg.id = a2v_brakectrl_131_entity_.ID;
-  brake_ctrl_can_msg.is_extended = false;
-  uint8_t *signal_bits;
-  signal_bits = a2v_brakectrl_131_entity_.get_data();
-  for (int i = 0; i < 8; i++)
-  {
-    brake_ctrl_can_msg.data[i] = *signal_bits;
-    signal_bits += 1;
-  }
-  brake_ctrl_can_ptr_ = std::make_shared<can_msgs::msg::Frame>(brake_ctrl_can_msg);
+  brake_ctrl_can_ptr_ = toCanFrame(*msg, frames::A2V_BRAKE_CTRL_131);
 }
 
 void ControlCommand::callbackDriveCtrl(const A2vDriveCtrl::ConstSharedPtr & msg)
 {
   drive_command_received_time_ = this->now();
   drive_ctrl_ptr_ = msg;
-  a2v_drivectrl_130_entity_.Reset();
-  a2v_drivectrl_130_entity_.UpdateData(
-    msg->acu_chassis_driver_en_ctrl, msg->acu_chassis_driver_mode_ctrl, msg->acu_chassis_gear_ctrl,
-    msg->acu_chassis_speed_ctrl, msg->acu_chassis_throttle_pdl_target, msg->acu_drive_life_sig,
-    msg->acu_check_sum_130);
-  can_msgs::msg::Frame drive_ctrl_can_msg;
-  drive_ctrl_can_msg.header.stamp = msg->header.stamp;
-  drive_ctrl_can_msg.dlc = 8;
-  drive_ctrl_can_msg.id = a2v_drivectrl_130_entity_.ID;
-  drive_ctrl_can_msg.is_extended = false;
-  uint8_t *signal_bits;
-  signal_bits = a2v_drivectrl_130_entity_.get_data();
-  for (int i = 0; i < 8; i++)
-  {
-    drive_ctrl_can_msg.data[i] = *signal_bits;
-    signal_bits += 1;
-  }
-  drive_ctrl_can_ptr_ = std::make_shared<can_msgs::msg::Frame>(drive_ctrl_can_msg); 
+  drive_ctrl_can_ptr_ = toCanFrame(*msg, frames::A2V_DRIVE_CTRL_130);
 }
 
 void ControlCommand::callbackSteerCtrl(const A2vSteerCtrl::ConstSharedPtr & msg)
 {
   steer_command_received_time_ = this->now();
   steer_ctrl_ptr_ = msg;
-  a2v_steerctrl_132_entity_.Reset();
-  a2v_steerctrl_132_entity_.UpdateData(
-    msg->acu_chassis_steer_en_ctrl, msg->acu_chassis_steer_mode_ctrl,
-    msg->acu_chassis_steer_angle_target, msg->acu_chassis_steer_angle_rear_target,
-    msg->acu_chassis_steer_angle_speed_ctrl, msg->acu_check_sum_132);
-  can_msgs::msg::Frame steer_ctrl_can_msg;
-  steer_ctrl_can_msg.header.stamp = msg->header.stamp;
-  steer_ctrl_can_msg.dlc = 8;
-  steer_ctrl_can_msg.id = a2v_steerctrl_132_entity_.ID;
-  steer_ctrl_can_msg.is_extended = false;
-  uint8_t *signal_bits;
-  signal_bits = a2v_steerctrl_132_entity_.get_data();
-  for (int i = 0; i < 8; i++)
-  {
-    steer_ctrl_can_msg.data[i] = *signal_bits;
-    signal_bits += 1;
-  }
-  steer_ctrl_can_ptr_ = std::make_shared<can_msgs::msg::Frame>(steer_ctrl_can_msg);
+  steer_ctrl_can_ptr_ = toCanFrame(*msg, frames::A2V_STEER_CTRL_132);
 }
 
 void ControlCommand::callbackWheelCtrl(const A2vWheelCtrl::ConstSharedPtr & msg)
 {
   wheel_command_received_time_ = this->now();
   wheel_ctrl_ptr_ = msg;
-  a2v_wheelctrl_135_entity_.Reset();
-  a2v_wheelctrl_135_entity_.UpdateData(
-    msg->acu_motor_torque_lf_crtl, msg->acu_motor_torque_rf_crtl, msg->acu_motor_torque_lr_crtl,
-    msg->acu_motor_torque_rr_crtl);
-  can_msgs::msg::Frame wheel_ctrl_can_msg;
-  wheel_ctrl_can_msg.header.stamp = msg->header.stamp;
-  wheel_ctrl_can_msg.dlc = 8;
-  wheel_ctrl_can_msg.id = a2v_wheelctrl_135_entity_.ID;
-  wheel_ctrl_can_msg.is_extended = false;
-  uint8_t *signal_bits;
-  signal_bits = a2v_wheelctrl_135_entity_.get_data();
-  for (int i = 0; i < 8; i++)
-  {
-    wheel_ctrl_can_msg.data[i] = *signal_bits;
-    signal_bits += 1;
-  }
-  wheel_ctrl_can_ptr_ = std::make_shared<can_msgs::msg::Frame>(wheel_ctrl_can_msg);
+  wheel_ctrl_can_ptr_ = toCanFrame(*msg, frames::A2V_WHEEL_CTRL_135);
 }
 void ControlCommand::callbackVehicleCtrl(const A2vVehicleCtrl::ConstSharedPtr & msg)
 {
-
   vehicle_command_received_time_ = this->now();
   vehicle_ctrl_ptr_ = msg;
-  a2v_vehiclectrl_133_entity_.Reset();
-  a2v_vehiclectrl_133_entity_.UpdateData(
-    msg->acu_vehicle_pos_lamp_ctrl, msg->acu_vehicle_head_lamp_ctrl,
-    msg->acu_vehicle_left_lamp_ctrl, msg->acu_vehicle_right_lamp_ctrl,
-    msg->acu_vehicl_high_beam_ctrl, msg->acu_vehicle_fog_lamp_ctrl,
-    msg->acu_vehicle_body_light_crtl, msg->acu_vehicle_read_light_crtl, msg->acu_vehicle_voice,
-    msg->acu_vehicle_wipers_crtl, msg->acu_vehicle_door_crtl, msg->acu_vehicle_window_crtl,
-    msg->acu_chassis_speed_limite_mode, msg->acu_chassis_speed_limite_val, msg->acu_check_sum_en);
-  can_msgs::msg::Frame vehicle_ctrl_can_msg;
-  vehicle_ctrl_can_msg.header.stamp = msg->header.stamp;
-  vehicle_ctrl_can_msg.dlc = 8;
-  vehicle_ctrl_can_msg.id = a2v_vehiclectrl_133_entity_.ID;
-  vehicle_ctrl_can_msg.is_extended = false;
-  uint8_t *signal_bits;
-  signal_bits = a2v_wheelctrl_135_entity_.get_data();
-  for (int i = 0; i < 8; i++)
-  {
-    vehicle_ctrl_can_msg.data[i] = *signal_bits;
-    signal_bits += 1;
-  }
-  vehicle_ctrl_can_ptr_ = std::make_shared<can_msgs::msg::Frame>(vehicle_ctrl_can_msg);
+  vehicle_ctrl_can_ptr_ = toCanFrame(*msg, frames::A2V_VEHICLE_CTRL_133);
 }
 
 void ControlCommand::callbackEngage(const std_msgs::msg::Bool::ConstSharedPtr & msg)
@@ -41,6 +41,30 @@ ReportParser::ReportParser(): Node("report_parser")
 
   is_publish_ = true;
 
+  // report decoders, looked up by can id
+  {
+    registerReport(frames::V2A_DRIVE_STA_FB_530, drive_sta_fb_ptr_, drive_sta_fb_received_time_);
+    registerReport(frames::V2A_BRAKE_STA_FB_531, brake_sta_fb_ptr_, brake_sta_fb_received_time_);
+    registerReport(frames::V2A_STEER_STA_FB_532, steer_sta_fb_ptr_, steer_sta_fb_received_time_);
+    registerReport(
+      frames::V2A_VEHICLE_WORK_STA_FB_534, vehicle_work_sta_fb_ptr_,
+      vehicle_work_sta_fb_received_time_);
+    registerReport(frames::V2A_POWER_STA_FB_535, power_sta_fb_ptr_, power_sta_fb_received_time_);
+    registerReport(
+      frames::V2A_VEHICLE_STA_FB_536, vehicle_sta_fb_ptr_, vehicle_sta_fb_received_time_);
+    registerReport(
+      frames::V2A_VEHICLE_FLT_STA_537, vehicle_flt_sta_ptr_, vehicle_flt_sta_received_time_);
+    registerReport(
+      frames::V2A_CHASSIS_WHEEL_RPM_FB_539, chassis_wheel_rpm_fb_ptr_,
+      chassis_wheel_rpm_fb_received_time_);
+    registerReport(
+      frames::V2A_CHASSIS_WHEEL_TIRE_PRESS_FB_540, chassis_wheel_tire_press_fb_ptr_,
+      chassis_wheel_tire_press_fb_received_time_);
+    registerReport(
+      frames::V2A_CHASSIS_WHEEL_ANGLE_FB_541, chassis_wheel_angle_fb_ptr_,
+      chassis_wheel_angle_fb_received_time_);
+  }
+
   using std::placeholders::_1;
 
   /* subscriber */
@@ -83,235 +107,32 @@ ReportParser::ReportParser(): Node("report_parser")
   }
 }
 
-void ReportParser::callbackCan(const can_msgs::msg::Frame::ConstSharedPtr & msg)
+template <typename MsgT, std::size_t N>
+void ReportParser::registerReport(
+  const can_codec::FrameCodec<MsgT, N> & codec, typename MsgT::ConstSharedPtr & msg_ptr,
+  rclcpp::Time & received_time)
 {
-  std_msgs::msg::Header header;
-  header.frame_id = param_.base_frame_id;
-  header.stamp = msg->header.stamp;
-
-  V2aBrakeStaFb brake_sta_fb_msg;
-  V2aChassisWheelAngleFb chassis_wheel_angle_fb_msg;
-  V2aChassisWheelRpmFb chassis_wheel_rpm_fb_msg;
-  V2aChassisWheelTirePressFb chassis_wheel_tire_press_fb_msg;
-  V2aDriveStaFb drive_sta_fb_msg;
-  V2aPowerStaFb power_sta_fb_msg;
-  V2aSteerStaFb steer_sta_fb_msg;
-  V2aVehicleFltSta vehicle_flt_sta_msg;
-  V2aVehicleStaFb vehicle_sta_fb_msg;
-  V2aVehicleWorkStaFb vehicle_work_sta_fb_msg;
-
-  uint8_t byte_temp[8];
-  switch (msg->id)
-  {
-  case V2adrivestafb530::ID:
-    drive_sta_fb_received_time_ = this->now();
-    
-    for(uint i=0;i<8;i++)
-    {
-    byte_temp[i] = msg->data[i];
-    }
-    v2a_drivestafb_530_entity_.update_bytes(byte_temp);
-    v2a_drivestafb_530_entity_.Parse();
-
-    drive_sta_fb_msg.header = header;
-    drive_sta_fb_msg.vcu_chassis_driver_en_sta =
-      v2a_drivestafb_530_entity_.vcu_chassisdriverensta;
-    drive_sta_fb_msg.vcu_chassis_diver_slopover =
-      v2a_drivestafb_530_entity_.vcu_chassisdiverslopover;
-    drive_sta_fb_msg.vcu_chassis_driver_mode_sta =
-      v2a_drivestafb_530_entity_.vcu_chassisdrivermodesta;
-    drive_sta_fb_msg.vcu_chassis_gear_fb = v2a_drivestafb_530_entity_.vcu_chassisgearfb;
-    drive_sta_fb_msg.vcu_chassis_speed_fb = v2a_drivestafb_530_entity_.vcu_chassisspeedfb;
-    drive_sta_fb_msg.vcu_chassis_throttle_padl_fb =
-      v2a_drivestafb_530_entity_.vcu_chassisthrottlepaldfb;
-    drive_sta_fb_msg.vcu_chassis_accceleration_fb =
-      v2a_drivestafb_530_entity_.vcu_chassisaccelerationfb;
-    drive_sta_fb_ptr_ = std::make_shared<V2aDriveStaFb>(drive_sta_fb_msg);
-    break;
-  case V2abrakestafb531::ID:
-    brake_sta_fb_received_time_ = this->now();
-    for(uint i=0;i<8;i++)
-    {
-    byte_temp[i] = msg->data[i];
-    }
-    v2a_brakestafb_531_entity_.update_bytes(byte_temp);
-    v2a_brakestafb_531_entity_.Parse();
-
-    brake_sta_fb_msg.header = header;
-    brake_sta_fb_msg.vcu_chassis_brake_en_sta = v2a_brakestafb_531_entity_.vcu_chassisbrakeensta;
-		brake_sta_fb_msg.vcu_vehicle_brake_lamp_fb = v2a_brakestafb_531_entity_.vcu_vehiclebrakelampfb;
-		brake_sta_fb_msg.vcu_chassis_epb_fb = v2a_brakestafb_531_entity_.vcu_chassisepbfb;
-		brake_sta_fb_msg.vcu_chassis_brake_padl_fb = v2a_brakestafb_531_entity_.vcu_chassisbrakepadlfb;
-		brake_sta_fb_msg.vcu_aeb_en_sta_fb = v2a_brakestafb_531_entity_.vcu_aebenstafb;
-		brake_sta_fb_msg.vcu_aeb_trigger_sta_fb = v2a_brakestafb_531_entity_.vcu_aebtriggerstafb;
-    brake_sta_fb_ptr_ = std::make_shared<V2aBrakeStaFb>(brake_sta_fb_msg);
-    break; 
-  case V2asteerstafb532::ID:
-    steer_sta_fb_received_time_ = this->now();
-    for(uint i=0;i<8;i++)
-    {
-    byte_temp[i] = msg->data[i];
-    }
-    v2a_steerstafb_532_entity_.update_bytes(byte_temp);
-    v2a_steerstafb_532_entity_.Parse();
-    steer_sta_fb_msg.header = header;
-		steer_sta_fb_msg.vcu_chassis_steer_en_sta = v2a_steerstafb_532_entity_.vcu_chassissteerensta;
-		steer_sta_fb_msg.vcu_chassis_steer_slopover = v2a_steerstafb_532_entity_.vcu_chassissteerslopover;
-		steer_sta_fb_msg.vcu_chassis_steer_work_mode = v2a_steerstafb_532_entity_.vcu_chassissteerworkmode;
-		steer_sta_fb_msg.vcu_chassis_steer_mode_fb = v2a_steerstafb_532_entity_.vcu_chassissteermodefb;
-		steer_sta_fb_msg.vcu_chassis_steer_angle_fb = v2a_steerstafb_532_entity_.vcu_chassissteeranglefb;
-		steer_sta_fb_msg.vcu_chassis_steer_angle_rear_fb = v2a_steerstafb_532_entity_.vcu_chassissteeranglerearfb;
-		steer_sta_fb_msg.vcu_chassis_steer_angle_speed_fb = v2a_steerstafb_532_entity_.vcu_chassissteeranglespeedfb;
-    steer_sta_fb_ptr_ = std::make_shared<V2aSteerStaFb>(steer_sta_fb_msg);
-    break;
-  case V2avehicleworkstafb534::ID:
-    vehicle_work_sta_fb_received_time_ = this->now();
-    for(uint i=0;i<8;i++)
-    {
-    byte_temp[i] = msg->data[i];
-    }
-    v2a_vehicleworkstafb_534_entity_.update_bytes(byte_temp);
-    v2a_vehicleworkstafb_534_entity_.Parse();
-    vehicle_work_sta_fb_msg.header = header;
-		vehicle_work_sta_fb_msg.vcu_driving_mode_fb = v2a_vehicleworkstafb_534_entity_.vcu_drivingmodefb;
-		vehicle_work_sta_fb_msg.vcu_chassis_power_sta_fb = v2a_vehicleworkstafb_534_entity_.vcu_chassispowerstafb;
-		vehicle_work_sta_fb_msg.vcu_chassis_power_dc_sta = v2a_vehicleworkstafb_534_entity_.vcu_chassispowerdcsta;
-		vehicle_work_sta_fb_msg.vcu_chassis_speed_limited_mode_fb = v2a_vehicleworkstafb_534_entity_.vcu_chassisspeedlimitedmodefb;
-		vehicle_work_sta_fb_msg.vcu_chassis_power_limite_sta = v2a_vehicleworkstafb_534_entity_.vcu_chassispowerlimitesta;
-		vehicle_work_sta_fb_msg.vcu_sys_eco_mode = v2a_vehicleworkstafb_534_entity_.vcu_sysecomode;
-		vehicle_work_sta_fb_msg.vcu_chassis_speed_limited_val_fb = v2a_vehicleworkstafb_534_entity_.vcu_chassisspeedlimitedvalfb;
-		vehicle_work_sta_fb_msg.vcu_chassis_low_power_volt_sta = v2a_vehicleworkstafb_534_entity_.vcu_chassislowpowervoltsta;
-		vehicle_work_sta_fb_msg.vcu_chassis_e_stop_sta_fb = v2a_vehicleworkstafb_534_entity_.vcu_chassisestopstafb;
-		vehicle_work_sta_fb_msg.vcu_crash_front_sta = v2a_vehicleworkstafb_534_entity_.vcu_crashfrontsta;
-		vehicle_work_sta_fb_msg.vcu_crash_rear_sta = v2a_vehicleworkstafb_534_entity_.vcu_crashrearsta;
-		vehicle_work_sta_fb_msg.vcu_crash_left_sta = v2a_vehicleworkstafb_534_entity_.vcu_crashleftsta;
-		vehicle_work_sta_fb_msg.vcu_crash_right_sta = v2a_vehicleworkstafb_534_entity_.vcu_crashrightsta;
-		vehicle_work_sta_fb_msg.vcu_life = v2a_vehicleworkstafb_534_entity_.vcu_life;
-		vehicle_work_sta_fb_msg.vcu_check_sum = v2a_vehicleworkstafb_534_entity_.vcu_checksum;
-    vehicle_work_sta_fb_ptr_ = std::make_shared<V2aVehicleWorkStaFb>(vehicle_work_sta_fb_msg);
-    break;
-  case V2apowerstafb535::ID:
-    power_sta_fb_received_time_ = this->now();
-    for(uint i=0;i<8;i++)
-    {
-    byte_temp[i] = msg->data[i];
-    }
-    v2a_powerstafb_535_entity_.update_bytes(byte_temp);
-    v2a_powerstafb_535_entity_.Parse();
-    power_sta_fb_msg.header = header;
-    power_sta_fb_msg.vcu_chassis_bms_reserved_1 = v2a_powerstafb_535_entity_.vcu_chassisbmsreserved_1;
-		power_sta_fb_msg.vcu_chassis_power_charge_sta = v2a_powerstafb_535_entity_.vcu_chassispowerchargesta;
-		power_sta_fb_msg.vcu_chassis_power_charge_sock_sta = v2a_powerstafb_535_entity_.vcu_chassispowerchargesocksta;
-		power_sta_fb_msg.vcu_chassis_power_soc_fb = v2a_powerstafb_535_entity_.vcu_chassispowersocfb;
-		power_sta_fb_msg.vcu_chassis_power_volt_fb = v2a_powerstafb_535_entity_.vcu_chassispowervoltfb;
-		power_sta_fb_msg.vcu_chassis_power_curr_fb = v2a_powerstafb_535_entity_.vcu_chassispowercurrfb;
-		power_sta_fb_msg.vcu_chassis_bms_max_temp = v2a_powerstafb_535_entity_.vcu_chassisbmsmaxtemp;
-		power_sta_fb_msg.vcu_chassis_bms_reserved_2 = v2a_powerstafb_535_entity_.vcu_chassisbmsreserved_2;
-    power_sta_fb_ptr_ = std::make_shared<V2aPowerStaFb>(power_sta_fb_msg);
-    break;
-  case V2avehiclestafb536::ID:
-    vehicle_sta_fb_received_time_ = this->now();
-    for(uint i=0;i<8;i++)
-    {
-    byte_temp[i] = msg->data[i];
-    }
-    v2a_vehiclestafb_536_entity_.update_bytes(byte_temp);
-    v2a_vehiclestafb_536_entity_.Parse();
-    vehicle_sta_fb_msg.header = header;
-		vehicle_sta_fb_msg.vcu_vehicle_pos_lamp_fb = v2a_vehiclestafb_536_entity_.vcu_vehicleposlampfb;
-		vehicle_sta_fb_msg.vcu_vehicle_head_lamp_fb = v2a_vehiclestafb_536_entity_.vcu_vehicleheadlampfb;
-		vehicle_sta_fb_msg.vcu_vehicle_left_lamp_fb = v2a_vehiclestafb_536_entity_.vcu_vehicleleftlampfb;
-		vehicle_sta_fb_msg.vcu_vehicle_right_lamp_fb = v2a_vehiclestafb_536_entity_.vcu_vehiclerightlampfb;
-		vehicle_sta_fb_msg.vcu_vehicle_high_beam_fb = v2a_vehiclestafb_536_entity_.vcu_vehiclehighbeamfb;
-		vehicle_sta_fb_msg.vcu_vehicle_fog_lamp_fb = v2a_vehiclestafb_536_entity_.vcu_vehiclefoglampfb;
-		vehicle_sta_fb_msg.vcu_vehicle_hazard_war_lamp_fb = v2a_vehiclestafb_536_entity_.vcu_vehiclehazardwarlampfb;
-		vehicle_sta_fb_msg.vcu_vehicle_body_lamp_fb = v2a_vehiclestafb_536_entity_.vcu_vehiclebodylampfb;
-		vehicle_sta_fb_msg.vcu_vehicle_read_lamp_fb = v2a_vehiclestafb_536_entity_.vcu_vehiclereadlampfb;
-		vehicle_sta_fb_msg.acu_vehicle_window_fb = v2a_vehiclestafb_536_entity_.acu_vehiclewindowfb;
-		vehicle_sta_fb_msg.vcu_vehicle_door_sta_fb = v2a_vehiclestafb_536_entity_.vcu_vehicledoorstafb;
-		vehicle_sta_fb_msg.vcu_vehicle_wipers_sta_fb = v2a_vehiclestafb_536_entity_.vcu_vehiclewipersstafb;
-		vehicle_sta_fb_msg.vcu_vehicle_safety_belt_1 = v2a_vehiclestafb_536_entity_.vcu_vehiclesafetybelt1;
-		vehicle_sta_fb_msg.vcu_vehicle_safety_belt_2 = v2a_vehiclestafb_536_entity_.vcu_vehiclesafetybelt2;
-		vehicle_sta_fb_msg.vcu_vehicle_safety_belt_3 = v2a_vehiclestafb_536_entity_.vcu_vehiclesafetybelt3;
-		vehicle_sta_fb_msg.vcu_vehicle_safety_belt_4 = v2a_vehiclestafb_536_entity_.vcu_vehiclesafetybelt4;
-    vehicle_sta_fb_ptr_ = std::make_shared<V2aVehicleStaFb>(vehicle_sta_fb_msg);
-    break;
-  case V2avehiclefltsta537::ID:
-    vehicle_flt_sta_received_time_ = this->now();
-    for(uint i=0;i<8;i++)
-    {
-    byte_temp[i] = msg->data[i];
-    }
-    v2a_vehiclefltsta_537_entity_.update_bytes(byte_temp);
-    v2a_vehiclefltsta_537_entity_.Parse();
-    vehicle_flt_sta_msg.header = header;
-    vehicle_flt_sta_msg.vcu_sys_motor_over_temp_sta = v2a_vehiclefltsta_537_entity_.vcu_sysmotorovertempsta;
-		vehicle_flt_sta_msg.vcu_sys_bms_over_temp_sta = v2a_vehiclefltsta_537_entity_.vcu_sysbmsovertempsta;
-		vehicle_flt_sta_msg.vcu_sys_brake_over_temp_sta = v2a_vehiclefltsta_537_entity_.vcu_sysbrakeovertempsta;
-		vehicle_flt_sta_msg.vcu_sys_steer_over_temp_sta = v2a_vehiclefltsta_537_entity_.vcu_syssteerovertempsta;
-		vehicle_flt_sta_msg.vcu_sys_under_volt = v2a_vehiclefltsta_537_entity_.vcu_sysundervolt;
-		vehicle_flt_sta_msg.vcu_sys_flt = v2a_vehiclefltsta_537_entity_.vcu_sysflt;
-		vehicle_flt_sta_msg.vcu_sys_brake_flt = v2a_vehiclefltsta_537_entity_.vcu_sysbrakeflt;
-		vehicle_flt_sta_msg.vcu_sys_parking_flt = v2a_vehiclefltsta_537_entity_.vcu_sysparkingflt;
-		vehicle_flt_sta_msg.vcu_sys_steer_front_flt = v2a_vehiclefltsta_537_entity_.vcu_syssteerfrontflt;
-		vehicle_flt_sta_msg.vcu_sys_steer_back_flt = v2a_vehiclefltsta_537_entity_.vcu_syssteerbackflt;
-		vehicle_flt_sta_msg.vcu_sys_motor_lf_flt = v2a_vehiclefltsta_537_entity_.vcu_sysmotorlfflt;
-		vehicle_flt_sta_msg.vcu_sys_motor_rf_flt = v2a_vehiclefltsta_537_entity_.vcu_sysmotorrfflt;
-		vehicle_flt_sta_msg.vcu_sys_motor_lr_flt = v2a_vehiclefltsta_537_entity_.vcu_sysmotorlrflt;
-		vehicle_flt_sta_msg.vcu_sys_motor_rr_flt = v2a_vehiclefltsta_537_entity_.vcu_sysmotorrrflt;
-		vehicle_flt_sta_msg.vcu_sys_bms_flt = v2a_vehiclefltsta_537_entity_.vcu_sysbmsflt;
-		vehicle_flt_sta_msg.vcu_sys_dc_flt = v2a_vehiclefltsta_537_entity_.vcu_sysdcflt;
-    vehicle_flt_sta_ptr_ = std::make_shared<V2aVehicleFltSta>(vehicle_flt_sta_msg);
-    break;
-  case V2achassiswheelrpmfb539::ID:
-    chassis_wheel_rpm_fb_received_time_ = this->now();
-    for(uint i=0;i<8;i++)
-    {
-    byte_temp[i] = msg->data[i];
-    }
-    v2a_chassiswheelrpmfb_539_entity_.update_bytes(byte_temp);
-    v2a_chassiswheelrpmfb_539_entity_.Parse();
-    chassis_wheel_rpm_fb_msg.header = header;
-    chassis_wheel_rpm_fb_msg.vcu_chassis_wheel_rpm_lf = v2a_chassiswheelrpmfb_539_entity_.vcu_chassiswheelrpmlf;
-		chassis_wheel_rpm_fb_msg.vcu_chassis_wheel_rpm_rf = v2a_chassiswheelrpmfb_539_entity_.vcu_chassiswheelrpmrf;
-		chassis_wheel_rpm_fb_msg.vcu_chassis_wheel_rpm_lr = v2a_chassiswheelrpmfb_539_entity_.vcu_chassiswheelrpmlr;
-		chassis_wheel_rpm_fb_msg.vcu_chassis_wheel_rpm_rr = v2a_chassiswheelrpmfb_539_entity_.vcu_chassiswheelrpmrr;
-		
-    chassis_wheel_rpm_fb_ptr_ = std::make_shared<V2aChassisWheelRpmFb>(chassis_wheel_rpm_fb_msg);
-    break;
-  case V2achassiswheeltirepressfb540::ID:
-    chassis_wheel_tire_press_fb_received_time_ = this->now();
-    for(uint i=0;i<8;i++)
-    {
-    byte_temp[i] = msg->data[i];
-    }
-    v2a_chassiswheeltirepressfb_540_entity_.update_bytes(byte_temp);
-    v2a_chassiswheeltirepressfb_540_entity_.Parse();
-    chassis_wheel_tire_press_fb_msg.header = header;
-		chassis_wheel_tire_press_fb_msg.vcu_chassis_wheel_tire_press_lf = v2a_chassiswheeltirepressfb_540_entity_.vcu_chassiswheeltirepresslf;
-		chassis_wheel_tire_press_fb_msg.vcu_chassis_wheel_tire_press_rf = v2a_chassiswheeltirepressfb_540_entity_.vcu_chassiswheeltirepressrf;
-		chassis_wheel_tire_press_fb_msg.vcu_chassis_wheel_tire_press_lr = v2a_chassiswheeltirepressfb_540_entity_.vcu_chassiswheeltirepresslr;
-		chassis_wheel_tire_press_fb_msg.vcu_chassis_wheel_tire_press_rr = v2a_chassiswheeltirepressfb_540_entity_.vcu_chassiswheeltirepressrr;
-    chassis_wheel_tire_press_fb_ptr_ = std::make_shared<V2aChassisWheelTirePressFb>(chassis_wheel_tire_press_fb_msg);
-    break;
-  case V2achassiswheelanglefb541::ID:
-    chassis_wheel_angle_fb_received_time_ = this->now();
-    for(uint i=0;i<8;i++)
-    {
-    byte_temp[i] = msg->data[i];
-    }
-    v2a_chassiswheelanglefb_541_entity_.update_bytes(byte_temp);
-    v2a_chassiswheelanglefb_541_entity_.Parse();
-    chassis_wheel_angle_fb_msg.header = header;
-		chassis_wheel_angle_fb_msg.vcu_chassis_wheel_angle_lf = v2a_chassiswheelanglefb_541_entity_.vcu_chassiswheelanglelf;
-		chassis_wheel_angle_fb_msg.vcu_chassis_wheel_angle_rf = v2a_chassiswheelanglefb_541_entity_.vcu_chassiswheelanglerf;
-		chassis_wheel_angle_fb_msg.vcu_chassis_wheel_angle_lr = v2a_chassiswheelanglefb_541_entity_.vcu_chassiswheelanglelr;
-		chassis_wheel_angle_fb_msg.vcu_chassis_wheel_angle_rr = v2a_chassiswheelanglefb_541_entity_.vcu_chassiswheelanglerr; 
-    chassis_wheel_angle_fb_ptr_ = std::make_shared<V2aChassisWheelAngleFb>(chassis_wheel_angle_fb_msg);
-    break;
-  default:
-    break;
+  const std::size_t index = codec.id - REPORT_ID_BEGIN;
+  if (report_decoders_.size() <= index) {
+    report_decoders_.resize(index + 1);
   }
+  report_decoders_[index] = [this, &codec, &msg_ptr, &received_time](
+                              const can_msgs::msg::Frame & frame) {
+    received_time = this->now();
+    auto msg = std::make_shared<MsgT>();
+    msg->header.frame_id = param_.base_frame_id;
+    msg->header.stamp = frame.header.stamp;
+    can_codec::decode(frame.data, codec, *msg);
+    msg_ptr = msg;
+  };
+}
+
+void ReportParser::callbackCan(const can_msgs::msg::Frame::ConstSharedPtr & msg)
+{
+  if (msg->id < REPORT_ID_BEGIN) return;
+  const std::size_t index = msg->id - REPORT_ID_BEGIN;
+  if (index >= report_decoders_.size() || !report_decoders_[index]) return;
+  report_decoders_[index](*msg);
 }
 
 void ReportParser::callbackIsPublish(const std_msgs::msg::Bool::ConstSharedPtr & msg)
@@ -0,0 +1,180 @@
+// Copyright 2023 Pixmoving, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <pix_hooke_driver/can_codec.hpp>
+#include <pix_hooke_driver/pix_hooke_frames.hpp>
+
+namespace can_codec = pix_hooke_driver::can_codec;
+namespace frames = pix_hooke_driver::frames;
+
+namespace
+{
+/**
+ * @brief mask of all bits of a frame covered by a signal, fails if signals overlap
+ */
+template <typename MsgT, std::size_t N>
+uint64_t signalBits(const can_codec::FrameCodec<MsgT, N> & codec)
+{
+  uint64_t bits = 0;
+  for (const auto & field : codec.fields) {
+    EXPECT_LE(field.signal.start_bit + field.signal.length, 64) << "frame " << codec.id;
+    const uint64_t mask = can_codec::rawMask(field.signal) << field.signal.start_bit;
+    EXPECT_EQ(bits & mask, 0U) << "overlapping signal at bit " << +field.signal.start_bit
+                               << " of frame " << codec.id;
+    bits |= mask;
+  }
+  return bits;
+}
+
+/**
+ * @brief decode random payloads and encode them again, all signal bits must be kept
+ */
+template <typename MsgT, std::size_t N>
+void checkRoundTrip(const can_codec::FrameCodec<MsgT, N> & codec)
+{
+  const uint64_t bits = signalBits(codec);
+  std::mt19937_64 engine(codec.id);
+  for (int i = 0; i < 10000; ++i) {
+    const auto payload = can_codec::toPayload(engine() & bits);
+    MsgT msg;
+    can_codec::decode(payload, codec, msg);
+    ASSERT_EQ(can_codec::encode(msg, codec), payload) << "frame " << codec.id;
+  }
+}
+}  // namespace
+
+TEST(CanCodec, SignalBits)
+{
+  constexpr can_codec::Signal speed{8, 16, true, 0.01, 0.0};
+  constexpr can_codec::Signal throttle{24, 10, false, 0.1, 0.0};
+
+  const uint64_t word = can_codec::toWord({0x00, 0x85, 0xFF, 0xE8, 0x03, 0x00, 0x00, 0x00});
+  EXPECT_EQ(can_codec::getRaw(word, speed), -123);
+  EXPECT_DOUBLE_EQ(can_codec::decodeSignal(word, speed), -1.23);
+  EXPECT_EQ(can_codec::getRaw(word, throttle), 1000);
+  EXPECT_DOUBLE_EQ(can_codec::decodeSignal(word, throttle), 100.0);
+
+  uint64_t encoded = 0;
+  can_codec::setRaw(encoded, speed, -123);
+  can_codec::setRaw(encoded, throttle, 1000);
+  EXPECT_EQ(encoded, word);
+
+  // setting a signal keeps the other bits
+  can_codec::setRaw(encoded, speed, 0);
+  EXPECT_EQ(encoded, 0x3E8000000ULL);
+
+  static_assert(can_codec::minRaw(speed) == -32768, "");
+  static_assert(can_codec::maxRaw(speed) == 32767, "");
+  static_assert(can_codec::maxRaw(throttle) == 1023, "");
+}
+
+TEST(CanCodec, ToRawRoundsAndSaturates)
+{
+  const can_codec::Signal signal{0, 10, false, 0.1, 0.0};
+  // 25.0 / 0.1 is 249.99999..., which the truncating encoder sent as 249
+  EXPECT_EQ(can_codec::toRaw(25.0, signal), 250);
+  EXPECT_EQ(can_codec::toRaw(25.04, signal), 250);
+  EXPECT_EQ(can_codec::toRaw(25.06, signal), 251);
+  EXPECT_EQ(can_codec::toRaw(-1.0, signal), 0);
+  EXPECT_EQ(can_codec::toRaw(200.0, signal), 1023);
+  EXPECT_EQ(can_codec::toRaw(std::numeric_limits<double>::quiet_NaN(), signal), 0);
+
+  const can_codec::Signal signed_signal{0, 16, true, 1.0, -100.0};
+  EXPECT_EQ(can_codec::toRaw(-100.0, signed_signal), 0);
+  EXPECT_EQ(can_codec::toRaw(-1e9, signed_signal), -32768);
+  EXPECT_EQ(can_codec::toRaw(1e9, signed_signal), 32767);
+}
+
+TEST(CanCodec, DecodeReport)
+{
+  frames::V2aDriveStaFb msg;
+  can_codec::decode(
+    {0x15, 0x7B, 0x00, 0xF4, 0x01, 0x38, 0xFF, 0x00}, frames::V2A_DRIVE_STA_FB_530, msg);
+  EXPECT_EQ(msg.vcu_chassis_driver_en_sta, 1);
+  EXPECT_EQ(msg.vcu_chassis_diver_slopover, 0);
+  EXPECT_EQ(msg.vcu_chassis_driver_mode_sta, 1);
+  EXPECT_EQ(msg.vcu_chassis_gear_fb, 1);
+  EXPECT_FLOAT_EQ(msg.vcu_chassis_speed_fb, 1.23f);
+  EXPECT_FLOAT_EQ(msg.vcu_chassis_throttle_padl_fb, 50.0f);
+  EXPECT_FLOAT_EQ(msg.vcu_chassis_accceleration_fb, -2.0f);
+}
+
+TEST(CanCodec, EncodeCommand)
+{
+  frames::A2vBrakeCtrl msg;
+  msg.acu_chassis_brake_en = 1;
+  msg.acu_chassis_aeb_ctrl = 0;
+  msg.acu_chassis_brake_pdl_target = 25.0f;
+  msg.acu_chassis_epb_ctrl = 2;
+  msg.acu_brake_life_sig = 7;
+  // checksums up to 255 are stored in int8 fields
+  msg.acu_check_sum_131 = static_cast<int8_t>(200);
+  const can_codec::Payload expected{0x01, 0xFA, 0x00, 0x02, 0x00, 0x00, 0x07, 0xC8};
+  EXPECT_EQ(can_codec::encode(msg, frames::A2V_BRAKE_CTRL_131), expected);
+
+  // out of range targets are saturated instead of overflowing into the neighbouring signals
+  msg.acu_chassis_brake_pdl_target = 150.0f;
+  const can_codec::Payload saturated{0x01, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x07, 0xC8};
+  EXPECT_EQ(can_codec::encode(msg, frames::A2V_BRAKE_CTRL_131), saturated);
+
+  frames::A2vSteerCtrl steer;
+  steer.acu_chassis_steer_en_ctrl = 1;
+  steer.acu_chassis_steer_angle_target = -300;
+  steer.acu_chassis_steer_angle_speed_ctrl = 250;
+  const auto payload = can_codec::encode(steer, frames::A2V_STEER_CTRL_132);
+  EXPECT_EQ(payload[1], 0xD4);
+  EXPECT_EQ(payload[2], 0xFE);
+  EXPECT_EQ(payload[5], 125);
+
+  frames::A2vSteerCtrl decoded;
+  can_codec::decode(payload, frames::A2V_STEER_CTRL_132, decoded);
+  EXPECT_EQ(decoded.acu_chassis_steer_en_ctrl, 1);
+  EXPECT_EQ(decoded.acu_chassis_steer_angle_target, -300);
+  EXPECT_EQ(decoded.acu_chassis_steer_angle_speed_ctrl, 250);
+}
+
+TEST(CanCodec, ReportRoundTrip)
+{
+  checkRoundTrip(frames::V2A_DRIVE_STA_FB_530);
+  checkRoundTrip(frames::V2A_BRAKE_STA_FB_531);
+  checkRoundTrip(frames::V2A_STEER_STA_FB_532);
+  checkRoundTrip(frames::V2A_VEHICLE_WORK_STA_FB_534);
+  checkRoundTrip(frames::V2A_POWER_STA_FB_535);
+  checkRoundTrip(frames::V2A_VEHICLE_STA_FB_536);
+  checkRoundTrip(frames::V2A_VEHICLE_FLT_STA_537);
+  checkRoundTrip(frames::V2A_CHASSIS_WHEEL_RPM_FB_539);
+  checkRoundTrip(frames::V2A_CHASSIS_WHEEL_TIRE_PRESS_FB_540);
+  checkRoundTrip(frames::V2A_CHASSIS_WHEEL_ANGLE_FB_541);
+}
+
+TEST(CanCodec, CommandRoundTrip)
+{
+  checkRoundTrip(frames::A2V_DRIVE_CTRL_130);
+  checkRoundTrip(frames::A2V_BRAKE_CTRL_131);
+  checkRoundTrip(frames::A2V_STEER_CTRL_132);
+  checkRoundTrip(frames::A2V_VEHICLE_CTRL_133);
+  checkRoundTrip(frames::A2V_WHEEL_CTRL_135);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
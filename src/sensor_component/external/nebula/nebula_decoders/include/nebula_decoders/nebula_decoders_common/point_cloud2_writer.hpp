@@ -0,0 +1,100 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <nebula_common/nebula_common.hpp>
+#include <nebula_common/point_types.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <pcl/common/io.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace nebula::drivers
+{
+
+/// @brief Appends points of type `PointT` directly to the data of a `sensor_msgs::msg::PointCloud2`
+/// message. The resulting message has the same fields and memory layout as the one produced by
+/// `pcl::toROSMsg` for a `pcl::PointCloud<PointT>`, without the intermediate PCL point cloud.
+template <typename PointT>
+class PointCloud2Writer
+{
+public:
+  PointCloud2Writer() { pcl_conversions::fromPCL(pcl::getFields<PointT>(), fields_); }
+
+  /// @brief Create an empty message with the fields of `PointT` and room for `capacity` points
+  std::unique_ptr<sensor_msgs::msg::PointCloud2> make_message(size_t capacity) const
+  {
+    auto msg = std::make_unique<sensor_msgs::msg::PointCloud2>();
+    msg->fields = fields_;
+    msg->height = 1;
+    msg->width = 0;
+    msg->is_bigendian = false;
+    msg->point_step = sizeof(PointT);
+    msg->row_step = 0;
+    msg->is_dense = true;
+    msg->data.reserve(capacity * sizeof(PointT));
+    return msg;
+  }
+
+  /// @brief Append `point` to the message, which has to be created by `make_message`
+  static void append(sensor_msgs::msg::PointCloud2 & msg, const PointT & point)
+  {
+    const auto * bytes = reinterpret_cast<const uint8_t *>(&point);
+    msg.data.insert(msg.data.end(), bytes, bytes + sizeof(PointT));
+    msg.width += 1;
+    msg.row_step += sizeof(PointT);
+  }
+
+private:
+  std::vector<sensor_msgs::msg::PointField> fields_;
+};
+
+/// @brief Same as `convert_point_xyzircaedt_to_point_xyzir`, for a single point
+inline PointXYZIR to_point_xyzir(const PointXYZIRCAEDT & p)
+{
+  PointXYZIR point{};
+  point.x = p.x;
+  point.y = p.y;
+  point.z = p.z;
+  point.intensity = p.intensity;
+  point.ring = p.channel;
+  return point;
+}
+
+/// @brief Same as `convert_point_xyzircaedt_to_point_xyziradt`, for a single point
+/// @param p The point to convert
+/// @param stamp The timestamp of the scan `p` belongs to in seconds
+inline PointXYZIRADT to_point_xyziradt(const PointXYZIRCAEDT & p, const double stamp)
+{
+  PointXYZIRADT point{};
+  point.x = p.x;
+  point.y = p.y;
+  point.z = p.z;
+  point.intensity = p.intensity;
+  point.ring = p.channel;
+  point.azimuth = rad2deg(p.azimuth) * 100.0;
+  point.distance = p.distance;
+  point.time_stamp = stamp + static_cast<double>(p.time_stamp) * 1e-9;
+  return point;
+}
+
+}  // namespace nebula::drivers
@@ -16,6 +16,8 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace nebula::drivers
@@ -31,6 +33,28 @@ struct CorrectedAngleData
   float cos_elevation;
 };
 
+/// @brief The corrected angles of all channels of a block. Each quantity is stored contiguously so
+/// that it can be computed for all channels at once.
+template <size_t ChannelN>
+struct CorrectedBlockAngleData
+{
+  std::array<float, ChannelN> azimuth_rad;
+  std::array<float, ChannelN> elevation_rad;
+  std::array<float, ChannelN> sin_azimuth;
+  std::array<float, ChannelN> cos_azimuth;
+  std::array<float, ChannelN> sin_elevation;
+  std::array<float, ChannelN> cos_elevation;
+
+  /// @brief Get the corrected angles of one channel
+  /// @param channel_id The laser channel's id
+  CorrectedAngleData get(size_t channel_id) const
+  {
+    return {
+      azimuth_rad[channel_id], elevation_rad[channel_id], sin_azimuth[channel_id],
+      cos_azimuth[channel_id], sin_elevation[channel_id], cos_elevation[channel_id]};
+  }
+};
+
 /// @brief Handles angle correction for given azimuth/channel combinations, as well as trigonometry
 /// lookup tables
 template <typename CorrectionDataT>
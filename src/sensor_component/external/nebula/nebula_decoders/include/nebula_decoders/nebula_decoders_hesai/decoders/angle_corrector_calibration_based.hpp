@@ -21,17 +21,28 @@
 #include <nebula_common/nebula_common.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <memory>
 #include <optional>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 namespace nebula::drivers
 {
 
-template <size_t ChannelN, size_t AngleUnit>
+/// @brief How the sin/cos of the corrected azimuths are looked up
+enum class AzimuthTables {
+  /// @brief One table entry per block azimuth and channel (max_azimuth * ChannelN entries)
+  FULL,
+  /// @brief One table entry per block azimuth and one per channel offset, combined by angle
+  /// addition (max_azimuth + ChannelN entries)
+  COMPACT
+};
+
+template <size_t ChannelN, size_t AngleUnit, AzimuthTables Tables = AzimuthTables::FULL>
 class AngleCorrectorCalibrationBased : public AngleCorrector<HesaiCalibrationConfiguration>
 {
 private:
@@ -43,8 +54,17 @@ private:
 
   std::array<float, ChannelN> elevation_cos_{};
   std::array<float, ChannelN> elevation_sin_{};
-  std::array<std::array<float, ChannelN>, max_azimuth> azimuth_cos_{};
-  std::array<std::array<float, ChannelN>, max_azimuth> azimuth_sin_{};
+
+  /// @brief AzimuthTables::FULL: sin/cos of the corrected azimuth, indexed by
+  /// `block_azimuth * ChannelN + channel_id`
+  std::vector<float> azimuth_cos_;
+  std::vector<float> azimuth_sin_;
+
+  /// @brief AzimuthTables::COMPACT: sin/cos of the block azimuth and of the channel offsets
+  std::vector<float> block_azimuth_cos_;
+  std::vector<float> block_azimuth_sin_;
+  std::array<float, ChannelN> azimuth_offset_cos_{};
+  std::array<float, ChannelN> azimuth_offset_sin_{};
 
 public:
   uint32_t emit_angle_raw_;
@@ -126,13 +146,36 @@ public:
 
     for (size_t block_azimuth = 0; block_azimuth < max_azimuth; block_azimuth++) {
       block_azimuth_rad_[block_azimuth] = deg2rad(block_azimuth / static_cast<double>(AngleUnit));
+    }
 
-      for (size_t channel_id = 0; channel_id < ChannelN; ++channel_id) {
-        float precision_azimuth =
-          block_azimuth_rad_[block_azimuth] + azimuth_offset_rad_[channel_id];
+    if constexpr (Tables == AzimuthTables::FULL) {
+      azimuth_cos_.resize(max_azimuth * ChannelN);
+      azimuth_sin_.resize(max_azimuth * ChannelN);
 
-        azimuth_cos_[block_azimuth][channel_id] = cosf(precision_azimuth);
-        azimuth_sin_[block_azimuth][channel_id] = sinf(precision_azimuth);
+      for (size_t block_azimuth = 0; block_azimuth < max_azimuth; block_azimuth++) {
+        for (size_t channel_id = 0; channel_id < ChannelN; ++channel_id) {
+          float precision_azimuth =
+            block_azimuth_rad_[block_azimuth] + azimuth_offset_rad_[channel_id];
+
+          azimuth_cos_[block_azimuth * ChannelN + channel_id] = cosf(precision_azimuth);
+          azimuth_sin_[block_azimuth * ChannelN + channel_id] = sinf(precision_azimuth);
+        }
+      }
+    } else {
+      // Computed in double so that the only float error is the one of the angle addition
+      block_azimuth_cos_.resize(max_azimuth);
+      block_azimuth_sin_.resize(max_azimuth);
+
+      for (size_t block_azimuth = 0; block_azimuth < max_azimuth; block_azimuth++) {
+        double block_azimuth_rad = deg2rad(block_azimuth / static_cast<double>(AngleUnit));
+        block_azimuth_cos_[block_azimuth] = std::cos(block_azimuth_rad);
+        block_azimuth_sin_[block_azimuth] = std::sin(block_azimuth_rad);
+      }
+
+      for (size_t channel_id = 0; channel_id < ChannelN; ++channel_id) {
+        double azimuth_offset_rad = deg2rad(sensor_calibration->azimuth_offset_map.at(channel_id));
+        azimuth_offset_cos_[channel_id] = std::cos(azimuth_offset_rad);
+        azimuth_offset_sin_[channel_id] = std::sin(azimuth_offset_rad);
       }
     }
   }
@@ -144,15 +187,75 @@ public:
 
     float elevation_rad = elevation_angle_rad_[channel_id];
 
+    float sin_azimuth;
+    float cos_azimuth;
+    if constexpr (Tables == AzimuthTables::FULL) {
+      sin_azimuth = azimuth_sin_[block_azimuth * ChannelN + channel_id];
+      cos_azimuth = azimuth_cos_[block_azimuth * ChannelN + channel_id];
+    } else {
+      const float block_sin = block_azimuth_sin_[block_azimuth];
+      const float block_cos = block_azimuth_cos_[block_azimuth];
+      sin_azimuth = block_sin * azimuth_offset_cos_[channel_id] +
+                    block_cos * azimuth_offset_sin_[channel_id];
+      cos_azimuth = block_cos * azimuth_offset_cos_[channel_id] -
+                    block_sin * azimuth_offset_sin_[channel_id];
+    }
+
     return {
-      azimuth_rad,
-      elevation_rad,
-      azimuth_sin_[block_azimuth][channel_id],
-      azimuth_cos_[block_azimuth][channel_id],
-      elevation_sin_[channel_id],
+      azimuth_rad, elevation_rad, sin_azimuth, cos_azimuth, elevation_sin_[channel_id],
       elevation_cos_[channel_id]};
   }
 
+  /// @brief Get the corrected angle data of all channels of a block at once. The loops are kept
+  /// free of branches and calls so that the compiler vectorizes them
+  /// @param block_azimuth The block's azimuth, in the sensor's angle unit
+  /// @param block_angles The corrected angles of each channel
+  void get_corrected_angle_data(
+    uint32_t block_azimuth, CorrectedBlockAngleData<ChannelN> & block_angles) const
+  {
+    // The block azimuth is in [0, 2pi) and the offsets are less than a turn, so normalizing takes
+    // at most one addition or subtraction of 2pi. This gives the same result as `normalize_angle`.
+    const float block_azimuth_rad = block_azimuth_rad_[block_azimuth];
+    for (size_t channel_id = 0; channel_id < ChannelN; ++channel_id) {
+      const float azimuth_rad = block_azimuth_rad + azimuth_offset_rad_[channel_id];
+      const float turn =
+        (azimuth_rad < 0.f) ? M_PIf * 2 : ((azimuth_rad >= M_PIf * 2) ? -M_PIf * 2 : 0.f);
+      block_angles.azimuth_rad[channel_id] = azimuth_rad + turn;
+    }
+
+    if constexpr (Tables == AzimuthTables::FULL) {
+      const float * sin_row = &azimuth_sin_[block_azimuth * ChannelN];
+      const float * cos_row = &azimuth_cos_[block_azimuth * ChannelN];
+      std::copy(sin_row, sin_row + ChannelN, block_angles.sin_azimuth.begin());
+      std::copy(cos_row, cos_row + ChannelN, block_angles.cos_azimuth.begin());
+    } else {
+      // sin(a + b) = sin(a)cos(b) + cos(a)sin(b), cos(a + b) = cos(a)cos(b) - sin(a)sin(b)
+      const float block_sin = block_azimuth_sin_[block_azimuth];
+      const float block_cos = block_azimuth_cos_[block_azimuth];
+      for (size_t channel_id = 0; channel_id < ChannelN; ++channel_id) {
+        block_angles.sin_azimuth[channel_id] = block_sin * azimuth_offset_cos_[channel_id] +
+                                               block_cos * azimuth_offset_sin_[channel_id];
+        block_angles.cos_azimuth[channel_id] = block_cos * azimuth_offset_cos_[channel_id] -
+                                               block_sin * azimuth_offset_sin_[channel_id];
+      }
+    }
+
+    block_angles.elevation_rad = elevation_angle_rad_;
+    block_angles.sin_elevation = elevation_sin_;
+    block_angles.cos_elevation = elevation_cos_;
+  }
+
+  /// @brief Get the memory used by the azimuth sin/cos lookup tables
+  /// @return The size of the tables in bytes
+  size_t get_azimuth_table_bytes() const
+  {
+    return sizeof(float) * (azimuth_cos_.size() + azimuth_sin_.size() + block_azimuth_cos_.size() +
+                            block_azimuth_sin_.size()) +
+           (Tables == AzimuthTables::COMPACT
+              ? sizeof(azimuth_offset_cos_) + sizeof(azimuth_offset_sin_)
+              : 0);
+  }
+
   bool passed_emit_angle(uint32_t last_azimuth, uint32_t current_azimuth) override
   {
     return angle_is_between(last_azimuth, current_azimuth, emit_angle_raw_, false);
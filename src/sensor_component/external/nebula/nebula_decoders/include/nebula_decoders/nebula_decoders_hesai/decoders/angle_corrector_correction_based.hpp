@@ -203,6 +203,25 @@ public:
             cos_[azimuth], sin_[elevation], cos_[elevation]};
   }
 
+  /// @brief Get the corrected angle data of all channels of a block
+  /// @param block_azimuth The block's azimuth, in the sensor's angle unit
+  /// @param block_angles The corrected angles of each channel
+  void get_corrected_angle_data(
+    uint32_t block_azimuth, CorrectedBlockAngleData<ChannelN> & block_angles)
+  {
+    // The corrections depend on the field and adjustments of each channel, there is nothing to
+    // share between channels
+    for (size_t channel_id = 0; channel_id < ChannelN; ++channel_id) {
+      const auto angles = get_corrected_angle_data(block_azimuth, channel_id);
+      block_angles.azimuth_rad[channel_id] = angles.azimuth_rad;
+      block_angles.elevation_rad[channel_id] = angles.elevation_rad;
+      block_angles.sin_azimuth[channel_id] = angles.sin_azimuth;
+      block_angles.cos_azimuth[channel_id] = angles.cos_azimuth;
+      block_angles.sin_elevation[channel_id] = angles.sin_elevation;
+      block_angles.cos_elevation[channel_id] = angles.cos_elevation;
+    }
+  }
+
   bool passed_emit_angle(uint32_t last_azimuth, uint32_t current_azimuth) override
   {
     for (const auto & frame_angles : frame_angle_info_) {
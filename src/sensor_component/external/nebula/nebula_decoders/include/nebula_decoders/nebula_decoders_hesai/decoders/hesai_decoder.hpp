@@ -15,6 +15,7 @@
 #pragma once
 
 #include "nebula_decoders/nebula_decoders_common/angles.hpp"
+#include "nebula_decoders/nebula_decoders_common/point_cloud2_writer.hpp"
 #include "nebula_decoders/nebula_decoders_hesai/decoders/angle_corrector.hpp"
 #include "nebula_decoders/nebula_decoders_hesai/decoders/hesai_packet.hpp"
 #include "nebula_decoders/nebula_decoders_hesai/decoders/hesai_scan_decoder.hpp"
@@ -55,12 +56,29 @@ protected:
 
   /// @brief Decodes azimuth/elevation angles given calibration/correction data
   typename SensorT::angle_corrector_t angle_corrector_;
+  /// @brief The corrected angles of all channels of the block being converted
+  CorrectedBlockAngleData<SensorT::packet_t::n_channels> block_angles_;
 
   /// @brief The point cloud new points get added to
   NebulaPointCloudPtr decode_pc_;
   /// @brief The point cloud that is returned when a scan is complete
   NebulaPointCloudPtr output_pc_;
 
+  /// @brief The formats new scans are decoded to
+  PointCloudFormats formats_;
+  /// @brief The formats of the scan in `decode_pc_`/`decode_msgs_`
+  PointCloudFormats decode_formats_;
+  /// @brief The formats of the scan in `output_pc_`/`output_msgs_`
+  PointCloudFormats output_formats_;
+  /// @brief The PointCloud2 messages new points get added to, one for each enabled format
+  PointCloud2Scan decode_msgs_;
+  /// @brief The PointCloud2 messages that are returned when a scan is complete
+  PointCloud2Scan output_msgs_;
+
+  PointCloud2Writer<NebulaPoint> nebula_points_writer_;
+  PointCloud2Writer<PointXYZIR> autoware_points_writer_;
+  PointCloud2Writer<PointXYZIRADT> autoware_ex_points_writer_;
+
   /// @brief The last decoded packet
   typename SensorT::packet_t packet_;
 
@@ -116,6 +134,10 @@ protected:
 
     std::vector<const typename SensorT::packet_t::body_t::block_t::unit_t *> return_units;
 
+    // All returns of the group share the block azimuth, so the angles of all channels are corrected
+    // at once
+    angle_corrector_.get_corrected_angle_data(raw_azimuth, block_angles_);
+
     for (size_t channel_id = 0; channel_id < SensorT::packet_t::n_channels; ++channel_id) {
       // Find the units corresponding to the same return group as the current one.
       // These are used to find duplicates in multi-return mode.
@@ -172,8 +194,7 @@ protected:
           }
         }
 
-        CorrectedAngleData corrected_angle_data =
-          angle_corrector_.get_corrected_angle_data(raw_azimuth, channel_id);
+        CorrectedAngleData corrected_angle_data = block_angles_.get(channel_id);
         float azimuth = corrected_angle_data.azimuth_rad;
 
         bool in_fov = angle_is_between(scan_cut_angles_.fov_min, scan_cut_angles_.fov_max, azimuth);
@@ -191,11 +212,10 @@ protected:
           in_current_scan = false;
         }
 
-        auto pc = in_current_scan ? decode_pc_ : output_pc_;
         uint64_t scan_timestamp_ns =
           in_current_scan ? decode_scan_timestamp_ns_ : output_scan_timestamp_ns_;
 
-        NebulaPoint & point = pc->emplace_back();
+        NebulaPoint point{};
         point.distance = distance;
         point.intensity = unit.reflectivity;
         point.time_stamp = get_point_time_relative(
@@ -214,10 +234,60 @@ protected:
         // The driver wrapper converts to degrees, expects radians
         point.azimuth = corrected_angle_data.azimuth_rad;
         point.elevation = corrected_angle_data.elevation_rad;
+
+        if (in_current_scan) {
+          append_point(point, scan_timestamp_ns, decode_formats_, *decode_pc_, decode_msgs_);
+        } else {
+          append_point(point, scan_timestamp_ns, output_formats_, *output_pc_, output_msgs_);
+        }
       }
     }
   }
 
+  /// @brief Appends a point to each of the formats of a scan. The Autoware formats are written
+  /// straight to their PointCloud2 messages, without an intermediate point cloud
+  /// @param point The decoded point
+  /// @param scan_timestamp_ns The timestamp of the scan the point belongs to in nanoseconds
+  /// @param formats The formats of the scan
+  /// @param pc The point cloud of the scan
+  /// @param msgs The PointCloud2 messages of the scan
+  void append_point(
+    const NebulaPoint & point, uint64_t scan_timestamp_ns, const PointCloudFormats & formats,
+    NebulaPointCloud & pc, PointCloud2Scan & msgs)
+  {
+    if (formats.nebula_point_cloud) {
+      pc.push_back(point);
+    }
+    if (msgs.nebula_points) {
+      nebula_points_writer_.append(*msgs.nebula_points, point);
+    }
+    if (msgs.autoware_points) {
+      autoware_points_writer_.append(*msgs.autoware_points, to_point_xyzir(point));
+    }
+    if (msgs.autoware_ex_points) {
+      autoware_ex_points_writer_.append(
+        *msgs.autoware_ex_points,
+        to_point_xyziradt(point, static_cast<double>(scan_timestamp_ns) * 1e-9));
+    }
+  }
+
+  /// @brief Empties the buffers of a scan and prepares them for the current `formats_`
+  /// @param pc The point cloud of the scan
+  /// @param formats The formats of the scan
+  /// @param msgs The PointCloud2 messages of the scan
+  void reset_scan(NebulaPointCloud & pc, PointCloudFormats & formats, PointCloud2Scan & msgs)
+  {
+    pc.clear();
+    formats = formats_;
+    constexpr size_t capacity = SensorT::max_scan_buffer_points;
+    msgs.nebula_points =
+      formats.nebula_points ? nebula_points_writer_.make_message(capacity) : nullptr;
+    msgs.autoware_points =
+      formats.autoware_points ? autoware_points_writer_.make_message(capacity) : nullptr;
+    msgs.autoware_ex_points =
+      formats.autoware_ex_points ? autoware_ex_points_writer_.make_message(capacity) : nullptr;
+  }
+
   /// @brief Get the distance of the given unit in meters
   float get_distance(const typename SensorT::packet_t::body_t::block_t::unit_t & unit)
   {
@@ -262,6 +332,9 @@ public:
     decode_pc_->reserve(SensorT::max_scan_buffer_points);
     output_pc_->reserve(SensorT::max_scan_buffer_points);
 
+    decode_formats_ = formats_;
+    output_formats_ = formats_;
+
     scan_cut_angles_ = {
       deg2rad(sensor_configuration_->cloud_min_angle),
       deg2rad(sensor_configuration_->cloud_max_angle), deg2rad(sensor_configuration_->cut_angle)};
@@ -280,7 +353,7 @@ public:
     }
 
     if (has_scanned_) {
-      output_pc_->clear();
+      reset_scan(*output_pc_, output_formats_, output_msgs_);
       has_scanned_ = false;
     }
 
@@ -319,6 +392,8 @@ public:
         // The current `decode` pointcloud is ready for publishing, swap buffers to continue with
         // the last `output` pointcloud as the `decode pointcloud.
         std::swap(decode_pc_, output_pc_);
+        std::swap(decode_formats_, output_formats_);
+        std::swap(decode_msgs_, output_msgs_);
         std::swap(decode_scan_timestamp_ns_, output_scan_timestamp_ns_);
         has_scanned_ = true;
       }
@@ -336,6 +411,19 @@ public:
     double scan_timestamp_s = static_cast<double>(output_scan_timestamp_ns_) * 1e-9;
     return std::make_pair(output_pc_, scan_timestamp_s);
   }
+
+  void set_formats(const PointCloudFormats & formats) override
+  {
+    formats_ = formats;
+
+    // Before the first packet, no scan is in progress yet and both buffers can be switched over
+    if (decode_scan_timestamp_ns_ == 0) {
+      reset_scan(*decode_pc_, decode_formats_, decode_msgs_);
+      reset_scan(*output_pc_, output_formats_, output_msgs_);
+    }
+  }
+
+  PointCloud2Scan take_point_cloud2_scan() override { return std::move(output_msgs_); }
 };
 
 }  // namespace nebula::drivers
@@ -18,11 +18,36 @@
 #include <nebula_common/hesai/hesai_common.hpp>
 #include <nebula_common/point_types.hpp>
 
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <memory>
 #include <tuple>
 #include <vector>
 
 namespace nebula::drivers
 {
+/// @brief The formats scans are decoded to
+struct PointCloudFormats
+{
+  /// @brief The `NebulaPointCloud` returned by `get_pointcloud`
+  bool nebula_point_cloud = true;
+  /// @brief A `PointCloud2` message of `NebulaPoint`
+  bool nebula_points = false;
+  /// @brief A `PointCloud2` message of `PointXYZIR`
+  bool autoware_points = false;
+  /// @brief A `PointCloud2` message of `PointXYZIRADT`
+  bool autoware_ex_points = false;
+};
+
+/// @brief The `PointCloud2` messages of a scan. Messages of formats that are not decoded to are
+/// null
+struct PointCloud2Scan
+{
+  std::unique_ptr<sensor_msgs::msg::PointCloud2> nebula_points;
+  std::unique_ptr<sensor_msgs::msg::PointCloud2> autoware_points;
+  std::unique_ptr<sensor_msgs::msg::PointCloud2> autoware_ex_points;
+};
+
 /// @brief Base class for Hesai LiDAR decoder
 class HesaiScanDecoder
 {
@@ -47,6 +72,15 @@ public:
   /// @brief Returns the point cloud and timestamp of the last scan
   /// @return A tuple of point cloud and timestamp in nanoseconds
   virtual std::tuple<drivers::NebulaPointCloudPtr, double> get_pointcloud() = 0;
+
+  /// @brief Sets the formats scans are decoded to. Scans that are already in progress keep the
+  /// formats they were started with
+  /// @param formats The formats to decode to
+  virtual void set_formats(const PointCloudFormats & formats) = 0;
+
+  /// @brief Moves out the `PointCloud2` messages of the last scan. The message headers are not set
+  /// @return The messages of the formats the last scan was decoded to
+  virtual PointCloud2Scan take_point_cloud2_scan() = 0;
 };
 }  // namespace nebula::drivers
 
@@ -31,7 +31,11 @@ enum class AngleCorrectionType { CALIBRATION, CORRECTION };
 
 /// @brief Base class for all sensor definitions
 /// @tparam PacketT The packet type of the sensor
-template <typename PacketT, AngleCorrectionType AngleCorrection = AngleCorrectionType::CALIBRATION>
+/// @tparam AngleCorrection The type of angle correction data the sensor provides
+/// @tparam Tables The azimuth lookup tables used for calibration based angle correction
+template <
+  typename PacketT, AngleCorrectionType AngleCorrection = AngleCorrectionType::CALIBRATION,
+  AzimuthTables Tables = AzimuthTables::FULL>
 class HesaiSensor
 {
 private:
@@ -89,7 +93,7 @@ public:
   using packet_t = PacketT;
   using angle_corrector_t = typename std::conditional<
     (AngleCorrection == AngleCorrectionType::CALIBRATION),
-    AngleCorrectorCalibrationBased<PacketT::n_channels, PacketT::degree_subdivisions>,
+    AngleCorrectorCalibrationBased<PacketT::n_channels, PacketT::degree_subdivisions, Tables>,
     AngleCorrectorCorrectionBased<PacketT::n_channels, PacketT::degree_subdivisions>>::type;
 
   HesaiSensor() = default;
@@ -82,7 +82,9 @@ struct Packet128E3X : public PacketBase<2, 128, 2, 100>
 
 }  // namespace hesai_packet
 
-class Pandar128E3X : public HesaiSensor<hesai_packet::Packet128E3X>
+class Pandar128E3X
+: public HesaiSensor<
+    hesai_packet::Packet128E3X, AngleCorrectionType::CALIBRATION, AzimuthTables::COMPACT>
 {
 private:
   enum OperationalState { HIGH_RESOLUTION = 0, SHUTDOWN = 1, STANDARD = 2, ENERGY_SAVING = 3 };
@@ -269,7 +271,9 @@ public:
     const std::vector<const typename packet_t::body_t::block_t::unit_t *> & return_units) override
   {
     auto return_type =
-      HesaiSensor<packet_t>::get_return_type(return_mode, return_idx, return_units);
+      HesaiSensor<
+        packet_t, AngleCorrectionType::CALIBRATION,
+        AzimuthTables::COMPACT>::get_return_type(return_mode, return_idx, return_units);
     if (return_type == ReturnType::IDENTICAL) {
       return return_type;
     }
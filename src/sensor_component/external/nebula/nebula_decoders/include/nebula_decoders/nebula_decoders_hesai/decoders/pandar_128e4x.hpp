@@ -38,7 +38,9 @@ using Packet128E4X = Packet128E3X;
 // The OT128 datasheet has entirely different numbers (and more azimuth states).
 // With the current sensor version, the numbers from the new datasheet are incorrect
 // (clouds do not sync to ToS but ToS+.052s)
-class Pandar128E4X : public HesaiSensor<hesai_packet::Packet128E4X>
+class Pandar128E4X
+: public HesaiSensor<
+    hesai_packet::Packet128E4X, AngleCorrectionType::CALIBRATION, AzimuthTables::COMPACT>
 {
 private:
   enum OperationalState { HIGH_RESOLUTION = 0, STANDARD = 1 };
@@ -117,7 +119,9 @@ public:
     const std::vector<const typename packet_t::body_t::block_t::unit_t *> & return_units) override
   {
     auto return_type =
-      HesaiSensor<packet_t>::get_return_type(return_mode, return_idx, return_units);
+      HesaiSensor<
+        packet_t, AngleCorrectionType::CALIBRATION,
+        AzimuthTables::COMPACT>::get_return_type(return_mode, return_idx, return_units);
     if (return_type == ReturnType::IDENTICAL) {
       return return_type;
     }
@@ -60,7 +60,9 @@ struct PacketQT128C2X : public PacketBase<2, 128, 2, 100>
 
 }  // namespace hesai_packet
 
-class PandarQT128 : public HesaiSensor<hesai_packet::PacketQT128C2X>
+class PandarQT128
+: public HesaiSensor<
+    hesai_packet::PacketQT128C2X, AngleCorrectionType::CALIBRATION, AzimuthTables::COMPACT>
 {
 private:
   // Channels 0-31 (starting at 0) do not fire, delay set to 0
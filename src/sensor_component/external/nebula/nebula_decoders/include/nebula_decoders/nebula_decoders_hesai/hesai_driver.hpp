@@ -71,6 +71,14 @@ public:
   /// @return Tuple of pointcloud and timestamp
   std::tuple<drivers::NebulaPointCloudPtr, double> parse_cloud_packet(
     const std::vector<uint8_t> & packet);
+
+  /// @brief Set the formats scans are decoded to, starting with the next scan
+  /// @param formats The formats to decode to
+  void set_formats(const PointCloudFormats & formats);
+
+  /// @brief Take the PointCloud2 messages of the last scan returned by `parse_cloud_packet`
+  /// @return The messages of the formats the scan was decoded to
+  PointCloud2Scan take_point_cloud2_scan();
 };
 
 }  // namespace drivers
@@ -101,6 +101,16 @@ std::tuple<drivers::NebulaPointCloudPtr, double> HesaiDriver::parse_cloud_packet
   return pointcloud;
 }
 
+void HesaiDriver::set_formats(const PointCloudFormats & formats)
+{
+  scan_decoder_->set_formats(formats);
+}
+
+PointCloud2Scan HesaiDriver::take_point_cloud2_scan()
+{
+  return scan_decoder_->take_point_cloud2_scan();
+}
+
 Status HesaiDriver::set_calibration_configuration(
   const HesaiCalibrationConfigurationBase & calibration_configuration)
 {
@@ -57,6 +57,10 @@ private:
     std::unique_ptr<sensor_msgs::msg::PointCloud2> pointcloud,
     const rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr & publisher);
 
+  /// @brief Get the point cloud formats whose publishers have subscribers
+  /// @return The formats to decode to
+  nebula::drivers::PointCloudFormats get_subscribed_formats() const;
+
   /// @brief Convert seconds to chrono::nanoseconds
   /// @param seconds
   /// @return chrono::nanoseconds
@@ -75,6 +79,8 @@ private:
 
   std::shared_ptr<drivers::HesaiDriver> driver_ptr_{};
   std::mutex mtx_driver_ptr_;
+  /// @brief The formats the driver decodes to, guarded by `mtx_driver_ptr_`
+  nebula::drivers::PointCloudFormats formats_{};
 
   rclcpp::Publisher<pandar_msgs::msg::PandarScan>::SharedPtr packets_pub_{};
   pandar_msgs::msg::PandarScan::UniquePtr current_scan_msg_{};
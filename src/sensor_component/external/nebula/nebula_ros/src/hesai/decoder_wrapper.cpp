@@ -66,6 +66,10 @@ HesaiDecoderWrapper::HesaiDecoderWrapper(
   aw_points_ex_pub_ =
     parent_node->create_publisher<sensor_msgs::msg::PointCloud2>("aw_points_ex", pointcloud_qos);
 
+  // No one is subscribed yet, the formats are updated with each scan
+  formats_ = get_subscribed_formats();
+  driver_ptr_->set_formats(formats_);
+
   RCLCPP_INFO_STREAM(logger_, ". Wrapper=" << status_);
 
   cloud_watchdog_ =
@@ -81,6 +85,7 @@ void HesaiDecoderWrapper::on_config_change(
 {
   std::lock_guard lock(mtx_driver_ptr_);
   auto new_driver = std::make_shared<drivers::HesaiDriver>(new_config, calibration_cfg_ptr_);
+  new_driver->set_formats(formats_);
   driver_ptr_ = new_driver;
   sensor_cfg_ = new_config;
 }
@@ -90,6 +95,7 @@ void HesaiDecoderWrapper::on_calibration_change(
 {
   std::lock_guard lock(mtx_driver_ptr_);
   auto new_driver = std::make_shared<drivers::HesaiDriver>(sensor_cfg_, new_calibration);
+  new_driver->set_formats(formats_);
   driver_ptr_ = new_driver;
   calibration_cfg_ptr_ = new_calibration;
 }
@@ -114,10 +120,14 @@ void HesaiDecoderWrapper::process_cloud_packet(
 
   std::tuple<nebula::drivers::NebulaPointCloudPtr, double> pointcloud_ts{};
   nebula::drivers::NebulaPointCloudPtr pointcloud = nullptr;
+  nebula::drivers::PointCloud2Scan scan{};
   {
     std::lock_guard lock(mtx_driver_ptr_);
     pointcloud_ts = driver_ptr_->parse_cloud_packet(packet_msg->data);
     pointcloud = std::get<0>(pointcloud_ts);
+    if (pointcloud) {
+      scan = driver_ptr_->take_point_cloud2_scan();
+    }
   }
 
   // A pointcloud is only emitted when a scan completes (e.g. 3599 packets do not emit, the 3600th
@@ -137,37 +147,44 @@ void HesaiDecoderWrapper::process_cloud_packet(
     current_scan_msg_ = std::make_unique<pandar_msgs::msg::PandarScan>();
   }
 
-  if (
-    nebula_points_pub_->get_subscription_count() > 0 ||
-    nebula_points_pub_->get_intra_process_subscription_count() > 0) {
-    auto ros_pc_msg_ptr = std::make_unique<sensor_msgs::msg::PointCloud2>();
-    pcl::toROSMsg(*pointcloud, *ros_pc_msg_ptr);
-    ros_pc_msg_ptr->header.stamp =
-      rclcpp::Time(seconds_to_chrono_nano_seconds(std::get<1>(pointcloud_ts)).count());
-    publish_cloud(std::move(ros_pc_msg_ptr), nebula_points_pub_);
+  // The points are decoded straight into the messages of the subscribed formats, so there is
+  // nothing left to convert here
+  const auto stamp =
+    rclcpp::Time(seconds_to_chrono_nano_seconds(std::get<1>(pointcloud_ts)).count());
+  if (scan.nebula_points) {
+    scan.nebula_points->header.stamp = stamp;
+    publish_cloud(std::move(scan.nebula_points), nebula_points_pub_);
   }
-  if (
-    aw_points_base_pub_->get_subscription_count() > 0 ||
-    aw_points_base_pub_->get_intra_process_subscription_count() > 0) {
-    const auto autoware_cloud_xyzi =
-      nebula::drivers::convert_point_xyzircaedt_to_point_xyzir(pointcloud);
-    auto ros_pc_msg_ptr = std::make_unique<sensor_msgs::msg::PointCloud2>();
-    pcl::toROSMsg(*autoware_cloud_xyzi, *ros_pc_msg_ptr);
-    ros_pc_msg_ptr->header.stamp =
-      rclcpp::Time(seconds_to_chrono_nano_seconds(std::get<1>(pointcloud_ts)).count());
-    publish_cloud(std::move(ros_pc_msg_ptr), aw_points_base_pub_);
+  if (scan.autoware_points) {
+    scan.autoware_points->header.stamp = stamp;
+    publish_cloud(std::move(scan.autoware_points), aw_points_base_pub_);
   }
-  if (
-    aw_points_ex_pub_->get_subscription_count() > 0 ||
-    aw_points_ex_pub_->get_intra_process_subscription_count() > 0) {
-    const auto autoware_ex_cloud = nebula::drivers::convert_point_xyzircaedt_to_point_xyziradt(
-      pointcloud, std::get<1>(pointcloud_ts));
-    auto ros_pc_msg_ptr = std::make_unique<sensor_msgs::msg::PointCloud2>();
-    pcl::toROSMsg(*autoware_ex_cloud, *ros_pc_msg_ptr);
-    ros_pc_msg_ptr->header.stamp =
-      rclcpp::Time(seconds_to_chrono_nano_seconds(std::get<1>(pointcloud_ts)).count());
-    publish_cloud(std::move(ros_pc_msg_ptr), aw_points_ex_pub_);
+  if (scan.autoware_ex_points) {
+    scan.autoware_ex_points->header.stamp = stamp;
+    publish_cloud(std::move(scan.autoware_ex_points), aw_points_ex_pub_);
   }
+
+  // Formats that gained or lost subscribers are switched on or off from the next scan on
+  const auto formats = get_subscribed_formats();
+  std::lock_guard lock(mtx_driver_ptr_);
+  formats_ = formats;
+  driver_ptr_->set_formats(formats_);
+}
+
+nebula::drivers::PointCloudFormats HesaiDecoderWrapper::get_subscribed_formats() const
+{
+  const auto has_subscribers =
+    [](const rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr & publisher) {
+      return publisher->get_subscription_count() > 0 ||
+             publisher->get_intra_process_subscription_count() > 0;
+    };
+
+  nebula::drivers::PointCloudFormats formats{};
+  formats.nebula_point_cloud = false;
+  formats.nebula_points = has_subscribers(nebula_points_pub_);
+  formats.autoware_points = has_subscribers(aw_points_base_pub_);
+  formats.autoware_ex_points = has_subscribers(aw_points_ex_pub_);
+  return formats;
 }
 
 void HesaiDecoderWrapper::publish_cloud(
@@ -0,0 +1,116 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <nebula_common/hesai/hesai_common.hpp>
+#include <nebula_decoders/nebula_decoders_hesai/decoders/angle_corrector_calibration_based.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#ifndef _SRC_CALIBRATION_DIR_PATH
+#define _SRC_CALIBRATION_DIR_PATH ""
+#endif
+
+namespace nebula
+{
+namespace test
+{
+
+using drivers::AngleCorrectorCalibrationBased;
+using drivers::AzimuthTables;
+using drivers::CorrectedBlockAngleData;
+
+constexpr size_t angle_unit = 100;
+
+std::shared_ptr<drivers::HesaiCalibrationConfiguration> load_calibration(
+  const std::string & calibration_file)
+{
+  std::filesystem::path calibration_path = _SRC_CALIBRATION_DIR_PATH;
+  calibration_path /= "hesai";
+  calibration_path /= calibration_file;
+
+  auto calibration = std::make_shared<drivers::HesaiCalibrationConfiguration>();
+  EXPECT_EQ(calibration->load_from_file(calibration_path.string()), Status::OK);
+  return calibration;
+}
+
+/// @brief Checks that the compact tables produce the same angles as the full tables, for all block
+/// azimuths and channels
+template <size_t ChannelN>
+void check_compact_tables(const std::string & calibration_file)
+{
+  auto calibration = load_calibration(calibration_file);
+
+  auto full = std::make_unique<AngleCorrectorCalibrationBased<ChannelN, angle_unit>>(
+    calibration, 0., 360., 0.);
+  auto compact =
+    std::make_unique<AngleCorrectorCalibrationBased<ChannelN, angle_unit, AzimuthTables::COMPACT>>(
+      calibration, 0., 360., 0.);
+
+  EXPECT_LT(compact->get_azimuth_table_bytes() * 10, full->get_azimuth_table_bytes());
+
+  CorrectedBlockAngleData<ChannelN> full_angles;
+  CorrectedBlockAngleData<ChannelN> compact_angles;
+  for (uint32_t block_azimuth = 0; block_azimuth < 360 * angle_unit; ++block_azimuth) {
+    full->get_corrected_angle_data(block_azimuth, full_angles);
+    compact->get_corrected_angle_data(block_azimuth, compact_angles);
+
+    for (size_t channel_id = 0; channel_id < ChannelN; ++channel_id) {
+      ASSERT_EQ(full_angles.azimuth_rad[channel_id], compact_angles.azimuth_rad[channel_id]);
+      ASSERT_EQ(full_angles.elevation_rad[channel_id], compact_angles.elevation_rad[channel_id]);
+      ASSERT_NEAR(
+        full_angles.sin_azimuth[channel_id], compact_angles.sin_azimuth[channel_id], 1e-6);
+      ASSERT_NEAR(
+        full_angles.cos_azimuth[channel_id], compact_angles.cos_azimuth[channel_id], 1e-6);
+
+      // The per-channel lookup gives the same result as the block lookup
+      const auto channel_angles = compact->get_corrected_angle_data(block_azimuth, channel_id);
+      ASSERT_EQ(channel_angles.azimuth_rad, compact_angles.azimuth_rad[channel_id]);
+      ASSERT_EQ(channel_angles.sin_azimuth, compact_angles.sin_azimuth[channel_id]);
+      ASSERT_EQ(channel_angles.cos_azimuth, compact_angles.cos_azimuth[channel_id]);
+    }
+  }
+}
+
+TEST(AngleCorrectorTest, CompactTablesPandar40P)
+{
+  check_compact_tables<40>("Pandar40P.csv");
+}
+
+TEST(AngleCorrectorTest, CompactTablesPandarXT32)
+{
+  check_compact_tables<32>("PandarXT32.csv");
+}
+
+TEST(AngleCorrectorTest, CompactTablesPandarQT128)
+{
+  check_compact_tables<128>("PandarQT128.csv");
+}
+
+TEST(AngleCorrectorTest, CompactTablesPandar128E4X)
+{
+  check_compact_tables<128>("Pandar128E4X.csv");
+}
+
+}  // namespace test
+}  // namespace nebula
+
+int main(int argc, char * argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,152 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the throughput of decoding recorded packets to the published point cloud messages,
+// comparing the PCL point cloud + `pcl::toROSMsg` path to decoding into PointCloud2 directly.
+
+#include "hesai_ros_decoder_test.hpp"
+
+#include <nebula_common/nebula_common.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+using nebula::ros::HesaiRosDecoderTest;
+using nebula::ros::HesaiRosDecoderTestParams;
+
+const HesaiRosDecoderTestParams BENCHMARK_CONFIGS[] = {
+  {"Pandar64", "Dual", "Pandar64.csv", "64/1673403880599376836", "hesai", 0, 0.0, 0., 360., 0.3f,
+   200.f},
+  {"PandarAT128", "LastStrongest", "PandarAT128.dat", "at128/1679653308406038376", "hesai", 0,
+   150.0, 30., 150., 1.f, 180.f},
+  {"PandarXT32", "Dual", "PandarXT32.csv", "xt32/1673400677802009732", "hesai", 0, 0.0, 0., 360.,
+   0.05f, 120.f}};
+
+constexpr int n_repetitions = 20;
+
+struct Result
+{
+  double elapsed_ms;
+  size_t n_packets;
+  size_t n_scans;
+};
+
+/// @brief Decode all `packets` `n_repetitions` times, with a new driver for each repetition
+/// @param params The sensor to decode for
+/// @param packets The raw packets
+/// @param formats The formats to decode to
+/// @param on_scan Called for each completed scan, with the driver and the PCL point cloud
+Result run(
+  const HesaiRosDecoderTestParams & params, const std::vector<std::vector<uint8_t>> & packets,
+  const nebula::drivers::PointCloudFormats & formats,
+  const std::function<void(nebula::drivers::HesaiDriver &, nebula::drivers::NebulaPointCloudPtr,
+                           double)> & on_scan)
+{
+  Result result{0., 0, 0};
+  for (int i = 0; i < n_repetitions; ++i) {
+    HesaiRosDecoderTest decoder(rclcpp::NodeOptions(), "nebula_hesai_decode_benchmark", params);
+    auto driver = decoder.get_driver();
+    driver->set_formats(formats);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto & packet : packets) {
+      auto [pointcloud, scan_timestamp_s] = driver->parse_cloud_packet(packet);
+      if (!pointcloud) continue;
+      on_scan(*driver, pointcloud, scan_timestamp_s);
+      ++result.n_scans;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    result.elapsed_ms += std::chrono::duration<double, std::milli>(end - start).count();
+    result.n_packets += packets.size();
+  }
+  return result;
+}
+
+void print_result(const std::string & name, const Result & result)
+{
+  std::printf(
+    "  %-24s %10.0f packets/s %8.3f ms/scan\n", name.c_str(),
+    static_cast<double>(result.n_packets) / (result.elapsed_ms * 1e-3),
+    result.elapsed_ms / static_cast<double>(result.n_scans));
+}
+}  // namespace
+
+int main(int argc, char * argv[])
+{
+  rclcpp::init(argc, argv);
+
+  for (const auto & params : BENCHMARK_CONFIGS) {
+    std::vector<std::vector<uint8_t>> packets;
+    {
+      HesaiRosDecoderTest reader(rclcpp::NodeOptions(), "nebula_hesai_decode_benchmark", params);
+      reader.read_packets([&](uint64_t /*bag_timestamp*/, const std::vector<uint8_t> & packet) {
+        packets.push_back(packet);
+      });
+      std::printf("%s: %zu packets\n", params.sensor_model.c_str(), packets.size());
+    }
+
+    nebula::drivers::PointCloudFormats pcl_formats{};
+
+    nebula::drivers::PointCloudFormats all_formats{};
+    all_formats.nebula_point_cloud = false;
+    all_formats.nebula_points = true;
+    all_formats.autoware_points = true;
+    all_formats.autoware_ex_points = true;
+
+    nebula::drivers::PointCloudFormats autoware_formats{};
+    autoware_formats.nebula_point_cloud = false;
+    autoware_formats.autoware_points = true;
+
+    print_result(
+      "pcl, all topics", run(params, packets, pcl_formats, [](auto &, auto pointcloud, double ts) {
+        sensor_msgs::msg::PointCloud2 nebula_points;
+        pcl::toROSMsg(*pointcloud, nebula_points);
+        sensor_msgs::msg::PointCloud2 autoware_points;
+        pcl::toROSMsg(
+          *nebula::drivers::convert_point_xyzircaedt_to_point_xyzir(pointcloud), autoware_points);
+        sensor_msgs::msg::PointCloud2 autoware_ex_points;
+        pcl::toROSMsg(
+          *nebula::drivers::convert_point_xyzircaedt_to_point_xyziradt(pointcloud, ts),
+          autoware_ex_points);
+      }));
+    print_result(
+      "direct, all topics", run(params, packets, all_formats, [](auto & driver, auto, double) {
+        auto scan = driver.take_point_cloud2_scan();
+      }));
+    print_result(
+      "pcl, aw_points", run(params, packets, pcl_formats, [](auto &, auto pointcloud, double) {
+        sensor_msgs::msg::PointCloud2 autoware_points;
+        pcl::toROSMsg(
+          *nebula::drivers::convert_point_xyzircaedt_to_point_xyzir(pointcloud), autoware_points);
+      }));
+    print_result(
+      "direct, aw_points", run(params, packets, autoware_formats, [](auto & driver, auto, double) {
+        auto scan = driver.take_point_cloud2_scan();
+      }));
+  }
+
+  rclcpp::shutdown();
+  return 0;
+}
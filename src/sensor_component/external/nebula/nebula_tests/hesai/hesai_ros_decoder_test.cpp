@@ -144,8 +144,8 @@ Status HesaiRosDecoderTest::GetParameters(
   return Status::OK;
 }
 
-void HesaiRosDecoderTest::read_bag(
-  std::function<void(uint64_t, uint64_t, nebula::drivers::NebulaPointCloudPtr)> scan_callback)
+void HesaiRosDecoderTest::read_packets(
+  std::function<void(uint64_t, const std::vector<uint8_t> &)> packet_callback)
 {
   rosbag2_storage::StorageOptions storage_options;
   rosbag2_cpp::ConverterOptions converter_options;
@@ -187,20 +187,34 @@ void HesaiRosDecoderTest::read_bag(
       auto extracted_msg_ptr = std::make_shared<pandar_msgs::msg::PandarScan>(extracted_msg);
 
       for (auto & pkt : extracted_msg_ptr->packets) {
-        auto pointcloud_ts = driver_ptr_->parse_cloud_packet(
+        packet_callback(
+          bag_message->time_stamp,
           std::vector<uint8_t>(pkt.data.begin(), std::next(pkt.data.begin(), pkt.size)));
-        auto pointcloud = std::get<0>(pointcloud_ts);
-        auto scan_timestamp = std::get<1>(pointcloud_ts);
-
-        if (!pointcloud) {
-          continue;
-        }
-
-        scan_callback(bag_message->time_stamp, scan_timestamp, pointcloud);
       }
     }
   }
 }
 
+void HesaiRosDecoderTest::read_bag(
+  std::function<void(uint64_t, uint64_t, nebula::drivers::NebulaPointCloudPtr)> scan_callback)
+{
+  read_packets([&](uint64_t bag_timestamp, const std::vector<uint8_t> & packet) {
+    auto pointcloud_ts = driver_ptr_->parse_cloud_packet(packet);
+    auto pointcloud = std::get<0>(pointcloud_ts);
+    auto scan_timestamp = std::get<1>(pointcloud_ts);
+
+    if (!pointcloud) {
+      return;
+    }
+
+    scan_callback(bag_timestamp, scan_timestamp, pointcloud);
+  });
+}
+
+std::shared_ptr<drivers::HesaiDriver> HesaiRosDecoderTest::get_driver()
+{
+  return driver_ptr_;
+}
+
 }  // namespace ros
 }  // namespace nebula
@@ -26,6 +26,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #ifndef _SRC_CALIBRATION_DIR_PATH
 #define _SRC_CALIBRATION_DIR_PATH ""
@@ -134,6 +135,14 @@ public:
   void read_bag(
     std::function<void(uint64_t, uint64_t, nebula::drivers::NebulaPointCloudPtr)> scan_callback);
 
+  /// @brief Read the raw packets of the specified bag file without decoding them
+  /// @param packet_callback Called with the bag timestamp and the data of each packet
+  void read_packets(std::function<void(uint64_t, const std::vector<uint8_t> &)> packet_callback);
+
+  /// @brief Get the driver the packets of `read_bag` are decoded with
+  /// @return The driver
+  std::shared_ptr<drivers::HesaiDriver> get_driver();
+
   HesaiRosDecoderTestParams params_;
 };
 
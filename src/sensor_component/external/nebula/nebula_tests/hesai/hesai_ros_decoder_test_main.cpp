@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 #include <pcl/conversions.h>
+#include <pcl_conversions/pcl_conversions.h>
 #include <pcl/io/pcd_io.h>
 #include <pcl/point_cloud.h>
 
@@ -127,6 +128,61 @@ TEST_P(DecoderTest, TestTimezone)
   EXPECT_EQ(decoded_timestamps.back(), decoded_timestamps_cmp.back());
 }
 
+// Tests if the PointCloud2 messages decoded to directly match the PCL point cloud and its
+// conversions to the Autoware point types.
+TEST_P(DecoderTest, TestPointCloud2Formats)
+{
+  auto driver = hesai_driver_->get_driver();
+  nebula::drivers::PointCloudFormats formats{};
+  formats.nebula_points = true;
+  formats.autoware_points = true;
+  formats.autoware_ex_points = true;
+  driver->set_formats(formats);
+
+  int check_cnt = 0;
+  hesai_driver_->read_packets([&](uint64_t /*msg_timestamp*/, const std::vector<uint8_t> & packet) {
+    auto [pointcloud, scan_timestamp_s] = driver->parse_cloud_packet(packet);
+    if (!pointcloud) return;
+
+    auto scan = driver->take_point_cloud2_scan();
+    // The first scan was started before the formats were set and may be missing
+    if (!scan.nebula_points || !scan.autoware_points || !scan.autoware_ex_points) return;
+
+    auto nebula_points = std::make_shared<nebula::drivers::NebulaPointCloud>();
+    pcl::fromROSMsg(*scan.nebula_points, *nebula_points);
+    check_pcds(pointcloud, nebula_points);
+
+    pcl::PointCloud<nebula::drivers::PointXYZIR> autoware_points;
+    pcl::fromROSMsg(*scan.autoware_points, autoware_points);
+    auto autoware_points_ref = nebula::drivers::convert_point_xyzircaedt_to_point_xyzir(pointcloud);
+    ASSERT_EQ(autoware_points.size(), autoware_points_ref->size());
+    for (size_t i = 0; i < autoware_points.size(); ++i) {
+      EXPECT_FLOAT_EQ(autoware_points[i].x, autoware_points_ref->points[i].x);
+      EXPECT_FLOAT_EQ(autoware_points[i].y, autoware_points_ref->points[i].y);
+      EXPECT_FLOAT_EQ(autoware_points[i].z, autoware_points_ref->points[i].z);
+      EXPECT_FLOAT_EQ(autoware_points[i].intensity, autoware_points_ref->points[i].intensity);
+      EXPECT_EQ(autoware_points[i].ring, autoware_points_ref->points[i].ring);
+    }
+
+    pcl::PointCloud<nebula::drivers::PointXYZIRADT> autoware_ex_points;
+    pcl::fromROSMsg(*scan.autoware_ex_points, autoware_ex_points);
+    auto autoware_ex_points_ref =
+      nebula::drivers::convert_point_xyzircaedt_to_point_xyziradt(pointcloud, scan_timestamp_s);
+    ASSERT_EQ(autoware_ex_points.size(), autoware_ex_points_ref->size());
+    for (size_t i = 0; i < autoware_ex_points.size(); ++i) {
+      EXPECT_FLOAT_EQ(autoware_ex_points[i].x, autoware_ex_points_ref->points[i].x);
+      EXPECT_FLOAT_EQ(autoware_ex_points[i].azimuth, autoware_ex_points_ref->points[i].azimuth);
+      EXPECT_FLOAT_EQ(autoware_ex_points[i].distance, autoware_ex_points_ref->points[i].distance);
+      EXPECT_EQ(autoware_ex_points[i].ring, autoware_ex_points_ref->points[i].ring);
+      EXPECT_DOUBLE_EQ(
+        autoware_ex_points[i].time_stamp, autoware_ex_points_ref->points[i].time_stamp);
+    }
+
+    check_cnt++;
+  });
+  EXPECT_GT(check_cnt, 0);
+}
+
 void DecoderTest::SetUp()
 {
   auto decoder_params = GetParam();
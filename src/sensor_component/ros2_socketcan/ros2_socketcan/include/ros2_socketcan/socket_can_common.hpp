@@ -56,10 +56,18 @@ void set_can_err_filter(int32_t fd, can_err_mask_t err_mask);
 /// \param[in] join_filters Should the filters be joined?
 void set_can_filter_join(int32_t fd, bool join_filters);
 
+/// Enable SO_TIMESTAMPING receive timestamps, both hardware (if supported by the interface) and
+/// software, reported in the ancillary data of recvmsg()/recvmmsg()
+/// \param[in] fd File descriptor of the socket
+/// \throw std::runtime_error If timestamping couldn't be enabled
+void enable_can_timestamping(int32_t fd);
+
 /// Convert std::chrono duration to timeval (with microsecond resolution)
 struct timeval to_timeval(const std::chrono::nanoseconds timeout) noexcept;
 /// Convert timeval to time in microseconds
 uint64_t from_timeval(const struct timeval tv) noexcept;
+/// Convert timespec to time in microseconds
+uint64_t from_timespec(const struct timespec ts) noexcept;
 /// Create a fd_set for use with select() that only contains the specified file descriptor
 fd_set single_set(int32_t file_descriptor) noexcept;
 
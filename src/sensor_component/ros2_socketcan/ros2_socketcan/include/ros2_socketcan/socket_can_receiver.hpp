@@ -23,6 +23,7 @@
 #include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -80,13 +81,64 @@ public:
     /// \return Populated CanFilterList structure.
     /// \throw std::runtime_error if string couldn't be parsed.
     static CanFilterList ParseFilters(const std::string & str);
+
+    /// Create filters passing only data frames with exactly the given CAN IDs.\n
+    /// IDs larger than 0x7FF or with CAN_EFF_FLAG set are treated as 29 bit EFF, others as
+    /// 11 bit SFF.
+    /// \param[in] ids CAN IDs to be received.
+    /// \return Populated CanFilterList structure.
+    static CanFilterList FromIds(const std::vector<CanId::IdT> & ids);
+
+    /// Parse a comma separated list of hexadecimal CAN IDs, e.g. "530,531,18FF0010".\n
+    /// IDs given with 8 digits or larger than 0x7FF are treated as 29 bit EFF.
+    /// \param[in] str Input to be parsed.
+    /// \return Populated CanFilterList structure, see FromIds.
+    /// \throw std::runtime_error if string couldn't be parsed.
+    static CanFilterList ParseIds(const std::string & str);
   };
 
+  /// Preallocated buffers to receive several frames with a single recvmmsg() call
+  class SOCKETCAN_PUBLIC FrameBatch
+  {
+public:
+    /// Constructor
+    /// \param[in] capacity Maximum number of frames received at once
+    /// \throw std::domain_error If capacity is zero
+    explicit FrameBatch(const std::size_t capacity = 64U);
+    /// Destructor
+    ~FrameBatch() noexcept;
+    FrameBatch(const FrameBatch &) = delete;
+    FrameBatch & operator=(const FrameBatch &) = delete;
+
+    /// Number of frames received by the last call to receive_batch()
+    std::size_t size() const noexcept {return m_size;}
+    /// Maximum number of frames received at once
+    std::size_t capacity() const noexcept {return m_frames.size();}
+    /// The CanId of the frame at index, with length and bus time populated
+    const CanId & id(const std::size_t index) const {return m_ids.at(index);}
+    /// The data of the frame at index, id(index).length() bytes long
+    const uint8_t * data(const std::size_t index) const {return &m_frames.at(index).data[0U];}
+
+private:
+    friend class SocketCanReceiver;
+    struct MessageHeaders;
+
+    std::vector<struct canfd_frame> m_frames;
+    std::vector<CanId> m_ids;
+    std::unique_ptr<MessageHeaders> m_headers;
+    std::size_t m_size;
+  };  // class FrameBatch
+
   /// Set SocketCAN filters
   /// \param[in] filters List of filters to be applied.
   /// \throw std::runtime_error If filters couldn't be applied
   void SetCanFilters(const CanFilterList & filters);
 
+  /// Enable kernel receive timestamps (SO_TIMESTAMPING) for receive_batch(). Hardware timestamps
+  /// are used when the CAN interface provides them, software timestamps otherwise
+  /// \throw std::runtime_error If timestamping couldn't be enabled
+  void EnableTimestamping();
+
   /// Receive CAN data
   /// \param[out] data A buffer to be written with data bytes. Must be at least 8 bytes in size
   /// \param[in] timeout Maximum duration to wait for data on the file descriptor. Negative
@@ -157,6 +209,19 @@ public:
     return ret;
   }
 
+  /// Receive all queued CAN or CAN FD frames, up to the capacity of the batch, with a single
+  /// recvmmsg() call
+  /// \param[out] batch The batch to be written with the received frames. The bus time of the
+  ///                   frames is only populated if EnableTimestamping() was called, else zero
+  /// \param[in] timeout Maximum duration to wait for data on the file descriptor. Negative
+  ///                    durations are treated the same as zero timeout
+  /// \return The number of received frames, equal to batch.size()
+  /// \throw SocketCanTimeout On timeout
+  /// \throw std::runtime_error on other errors
+  std::size_t receive_batch(
+    FrameBatch & batch,
+    const std::chrono::nanoseconds timeout = std::chrono::nanoseconds::zero()) const;
+
 private:
   // Wait for file descriptor to be available to send data via select()
   SOCKETCAN_LOCAL void wait(const std::chrono::nanoseconds timeout) const;
@@ -31,6 +31,8 @@
 #include "rosidl_runtime_cpp/message_initialization.hpp"
 #include "can_msgs/msg/frame.hpp"
 #include "ros2_socketcan_msgs/msg/fd_frame.hpp"
+#include "ros2_socketcan_msgs/msg/fd_frame_array.hpp"
+#include "ros2_socketcan_msgs/msg/frame_array.hpp"
 #include "lifecycle_msgs/msg/state.hpp"
 
 namespace lc = rclcpp_lifecycle;
@@ -73,14 +75,23 @@ public:
   void receive();
 
 private:
+  /// \brief Read all queued frames at once with recvmmsg() and publish them either one by one
+  /// or as a single frame array.
+  void receive_batch();
+
   std::string interface_;
   std::shared_ptr<lc::LifecyclePublisher<can_msgs::msg::Frame>> frames_pub_;
   std::shared_ptr<lc::LifecyclePublisher<ros2_socketcan_msgs::msg::FdFrame>> fd_frames_pub_;
+  std::shared_ptr<lc::LifecyclePublisher<ros2_socketcan_msgs::msg::FrameArray>> frame_array_pub_;
+  std::shared_ptr<lc::LifecyclePublisher<ros2_socketcan_msgs::msg::FdFrameArray>>
+  fd_frame_array_pub_;
   std::unique_ptr<SocketCanReceiver> receiver_;
   std::unique_ptr<std::thread> receiver_thread_;
   std::chrono::nanoseconds interval_ns_;
   bool enable_fd_;
   bool use_bus_time_;
+  std::size_t batch_size_;
+  bool publish_frame_array_;
 };
 }  // namespace socketcan
 }  // namespace drivers
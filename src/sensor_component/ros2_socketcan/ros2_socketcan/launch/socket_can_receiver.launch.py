@@ -41,6 +41,9 @@ def generate_launch_description():
             LaunchConfiguration('interval_sec'),
             'filters': LaunchConfiguration('filters'),
             'use_bus_time': LaunchConfiguration('use_bus_time'),
+            'filter_ids': LaunchConfiguration('filter_ids'),
+            'receive_batch_size': LaunchConfiguration('receive_batch_size'),
+            'publish_frame_array': LaunchConfiguration('publish_frame_array'),
         }],
         remappings=[('from_can_bus', LaunchConfiguration('from_can_bus_topic'))],
         output='screen')
@@ -105,6 +108,19 @@ def generate_launch_description():
                                           '\tFor more information about syntax check: '
                                           'https://manpages.ubuntu.com/manpages/jammy/'
                                           'man1/candump.1.html'),
+        DeclareLaunchArgument('filter_ids', default_value='',
+                              description='Comma separated hexadecimal CAN IDs. If not empty, '
+                                          'only data frames with exactly these IDs are '
+                                          'received and `filters` is ignored. IDs given with '
+                                          '8 digits or larger than 7FF are assumed to be 29 '
+                                          'bit EFF.'),
+        DeclareLaunchArgument('receive_batch_size', default_value='1',
+                              description='Maximum number of frames read with a single '
+                                          'recvmmsg() call. 1 reads frame by frame.'),
+        DeclareLaunchArgument('publish_frame_array', default_value='false',
+                              description='Publish all frames of a batch as a single array on '
+                                          'from_can_bus_array (from_can_bus_fd_array for CAN '
+                                          'FD) instead of one message per frame.'),
         DeclareLaunchArgument('auto_configure', default_value='true'),
         DeclareLaunchArgument('auto_activate', default_value='true'),
         DeclareLaunchArgument('from_can_bus_topic', default_value='from_can_bus'),
@@ -22,6 +22,7 @@
 #include <sys/socket.h>
 #include <sys/ioctl.h>
 #include <linux/can/raw.h>
+#include <linux/net_tstamp.h>
 
 #include <unistd.h>
 #include <linux/can.h>
@@ -125,6 +126,22 @@ void set_can_filter_join(int32_t fd, bool join_filters)
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+void enable_can_timestamping(int32_t fd)
+{
+  const int32_t flags =
+    SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE |
+    SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+  if (0 !=
+    setsockopt(
+      fd, SOL_SOCKET, SO_TIMESTAMPING, &flags,
+      sizeof(flags)))
+  {
+    throw std::runtime_error{"Failed to enable CAN timestamping: " +
+            std::string{strerror(errno)}};
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 struct timeval to_timeval(const std::chrono::nanoseconds timeout) noexcept
 {
@@ -143,6 +160,13 @@ uint64_t from_timeval(const struct timeval tv) noexcept
   return static_cast<uint64_t>(tv.tv_sec) * 1e6 + tv.tv_usec;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+uint64_t from_timespec(const struct timespec ts) noexcept
+{
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000ULL +
+         static_cast<uint64_t>(ts.tv_nsec) / 1000ULL;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 fd_set single_set(int32_t file_descriptor) noexcept
 {
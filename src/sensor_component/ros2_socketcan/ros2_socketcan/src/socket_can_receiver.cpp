@@ -22,10 +22,13 @@
 #include <sys/types.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <linux/can.h>
 #include <linux/sockios.h>
 
+#include <cerrno>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -35,6 +38,19 @@ namespace drivers
 {
 namespace socketcan
 {
+namespace
+{
+// SO_TIMESTAMPING reports three timestamps: software, deprecated and raw hardware
+constexpr std::size_t NUM_TIMESTAMPS = 3U;
+constexpr std::size_t CONTROL_SIZE = CMSG_SPACE(NUM_TIMESTAMPS * sizeof(struct timespec));
+}  // namespace
+
+struct SocketCanReceiver::FrameBatch::MessageHeaders
+{
+  std::vector<struct iovec> iovecs;
+  std::vector<struct mmsghdr> headers;
+  std::vector<uint8_t> control;
+};
 
 ////////////////////////////////////////////////////////////////////////////////
 SocketCanReceiver::SocketCanReceiver(const std::string & interface, const bool enable_fd)
@@ -102,6 +118,89 @@ SocketCanReceiver::CanFilterList SocketCanReceiver::CanFilterList::ParseFilters(
   return filter_list;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+SocketCanReceiver::CanFilterList SocketCanReceiver::CanFilterList::FromIds(
+  const std::vector<CanId::IdT> & ids)
+{
+  CanFilterList filter_list;
+  filter_list.error_mask = 0;
+  filter_list.join_filters = false;
+
+  for (const auto id : ids) {
+    // match the whole identifier, the frame format and data frames only
+    struct can_filter filter;
+    if (id > CAN_SFF_MASK) {
+      filter.can_id = (id & CAN_EFF_MASK) | CAN_EFF_FLAG;
+      filter.can_mask = CAN_EFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    } else {
+      filter.can_id = id;
+      filter.can_mask = CAN_SFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    }
+    filter_list.filters.push_back(filter);
+  }
+  return filter_list;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+SocketCanReceiver::CanFilterList SocketCanReceiver::CanFilterList::ParseIds(
+  const std::string & str)
+{
+  std::vector<CanId::IdT> ids;
+
+  std::istringstream input(str);
+  std::string id_str;
+
+  while (getline(input, id_str, ',')) {
+    const auto first = id_str.find_first_not_of(" \t");
+    if (first == std::string::npos) {
+      continue;
+    }
+    // trim leading and trailing whitespaces
+    id_str = id_str.substr(first, id_str.find_last_not_of(" \t") - first + 1);
+
+    CanId::IdT id;
+    char trailing;
+    if (std::sscanf(id_str.c_str(), "%x%c", &id, &trailing) != 1 || id > CAN_EFF_MASK) {
+      throw std::runtime_error("Error during CAN ID parsing: " + id_str);
+    }
+    if (id_str.size() == 8) {
+      id |= CAN_EFF_FLAG;
+    }
+    ids.push_back(id);
+  }
+  return FromIds(ids);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+SocketCanReceiver::FrameBatch::FrameBatch(const std::size_t capacity)
+: m_frames(capacity),
+  m_ids(capacity),
+  m_headers{std::make_unique<MessageHeaders>()},
+  m_size{0U}
+{
+  if (capacity == 0U) {
+    throw std::domain_error{"CAN frame batch capacity must be positive"};
+  }
+
+  auto & headers = *m_headers;
+  headers.iovecs.resize(capacity);
+  headers.headers.resize(capacity);
+  headers.control.resize(capacity * CONTROL_SIZE);
+  for (std::size_t idx = 0U; idx < capacity; ++idx) {
+    headers.iovecs[idx].iov_base = &m_frames[idx];
+    headers.iovecs[idx].iov_len = sizeof(struct canfd_frame);
+    auto & msg_hdr = headers.headers[idx].msg_hdr;
+    std::memset(&msg_hdr, 0, sizeof(msg_hdr));
+    msg_hdr.msg_iov = &headers.iovecs[idx];
+    msg_hdr.msg_iovlen = 1U;
+    msg_hdr.msg_control = &headers.control[idx * CONTROL_SIZE];
+    msg_hdr.msg_controllen = CONTROL_SIZE;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+SocketCanReceiver::FrameBatch::~FrameBatch() noexcept = default;
+
 ////////////////////////////////////////////////////////////////////////////////
 void SocketCanReceiver::SetCanFilters(const CanFilterList & filters)
 {
@@ -110,6 +209,12 @@ void SocketCanReceiver::SetCanFilters(const CanFilterList & filters)
   set_can_filter_join(m_file_descriptor, filters.join_filters);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+void SocketCanReceiver::EnableTimestamping()
+{
+  enable_can_timestamping(m_file_descriptor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void SocketCanReceiver::wait(const std::chrono::nanoseconds timeout) const
 {
@@ -203,5 +308,69 @@ CanId SocketCanReceiver::receive_fd(void * const data, const std::chrono::nanose
   return CanId{frame.can_id, bus_time, data_length};
 }
 
+////////////////////////////////////////////////////////////////////////////////
+std::size_t SocketCanReceiver::receive_batch(
+  FrameBatch & batch,
+  const std::chrono::nanoseconds timeout) const
+{
+  batch.m_size = 0U;
+  wait(timeout);
+
+  // recvmmsg() overwrites the lengths with the received ones
+  auto & headers = *batch.m_headers;
+  const auto mtu = m_enable_fd ? sizeof(struct canfd_frame) : sizeof(struct can_frame);
+  for (std::size_t idx = 0U; idx < batch.capacity(); ++idx) {
+    headers.iovecs[idx].iov_len = mtu;
+    headers.headers[idx].msg_hdr.msg_controllen = CONTROL_SIZE;
+    headers.headers[idx].msg_hdr.msg_flags = 0;
+  }
+
+  // Read
+  const auto count = recvmmsg(
+    m_file_descriptor, headers.headers.data(), static_cast<uint32_t>(batch.capacity()),
+    MSG_DONTWAIT, NULL);
+  if (count < 0) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      throw SocketCanTimeout{"CAN Receive Timeout"};
+    }
+    throw std::runtime_error{strerror(errno)};
+  }
+
+  for (std::size_t idx = 0U; idx < static_cast<std::size_t>(count); ++idx) {
+    // Checks; can_frame::can_dlc and canfd_frame::len share the same offset
+    const auto & frame = batch.m_frames[idx];
+    const auto nbytes = static_cast<std::size_t>(headers.headers[idx].msg_len);
+    if (nbytes == sizeof(struct can_frame)) {
+      if (frame.len > CAN_MAX_DLEN) {
+        throw std::runtime_error{"recvmmsg: frame length is larger than max CAN payload length"};
+      }
+    } else if (m_enable_fd && nbytes == sizeof(struct canfd_frame)) {
+      if (frame.len > CANFD_MAX_DLEN) {
+        throw std::runtime_error{"recvmmsg: frame length is larger than max CAN FD payload length"};
+      }
+    } else {
+      throw std::runtime_error{"recvmmsg: incomplete CAN frame"};
+    }
+
+    // get bus timestamp, preferring the hardware one
+    uint64_t bus_time = 0U;
+    auto * msg_hdr = &headers.headers[idx].msg_hdr;
+    for (auto * cmsg = CMSG_FIRSTHDR(msg_hdr); cmsg != NULL; cmsg = CMSG_NXTHDR(msg_hdr, cmsg)) {
+      if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMPING) {
+        struct timespec stamps[NUM_TIMESTAMPS];
+        (void)std::memcpy(&stamps[0U], CMSG_DATA(cmsg), sizeof(stamps));
+        const auto & stamp = (stamps[2U].tv_sec != 0 || stamps[2U].tv_nsec != 0) ?
+          stamps[2U] : stamps[0U];
+        bus_time = from_timespec(stamp);
+      }
+    }
+
+    batch.m_ids[idx] = CanId{frame.can_id, bus_time, static_cast<CanId::LengthT>(frame.len)};
+  }
+  batch.m_size = static_cast<std::size_t>(count);
+
+  return batch.m_size;
+}
+
 }  // namespace socketcan
 }  // namespace drivers
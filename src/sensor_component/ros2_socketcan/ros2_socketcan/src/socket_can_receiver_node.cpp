@@ -17,7 +17,9 @@
 #include "ros2_socketcan/socket_can_receiver_node.hpp"
 #include "ros2_socketcan/socket_can_common.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -40,6 +42,10 @@ SocketCanReceiverNode::SocketCanReceiverNode(rclcpp::NodeOptions options)
   enable_fd_ = this->declare_parameter<bool>("enable_can_fd", false);
   double interval_sec = this->declare_parameter("interval_sec", 0.01);
   this->declare_parameter("filters", "0:0");
+  this->declare_parameter("filter_ids", "");
+  batch_size_ = static_cast<std::size_t>(
+    std::max<int64_t>(this->declare_parameter<int64_t>("receive_batch_size", 1), 1));
+  publish_frame_array_ = this->declare_parameter<bool>("publish_frame_array", false);
   interval_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
     std::chrono::duration<double>(interval_sec));
 
@@ -47,6 +53,9 @@ SocketCanReceiverNode::SocketCanReceiverNode(rclcpp::NodeOptions options)
   RCLCPP_INFO(this->get_logger(), "use bus time: %d", use_bus_time_);
   RCLCPP_INFO(this->get_logger(), "can fd enabled: %s", enable_fd_ ? "true" : "false");
   RCLCPP_INFO(this->get_logger(), "interval(s): %f", interval_sec);
+  RCLCPP_INFO(this->get_logger(), "receive batch size: %zu", batch_size_);
+  RCLCPP_INFO(
+    this->get_logger(), "publish frame array: %s", publish_frame_array_ ? "true" : "false");
 }
 
 LNI::CallbackReturn SocketCanReceiverNode::on_configure(const lc::State & state)
@@ -55,10 +64,20 @@ LNI::CallbackReturn SocketCanReceiverNode::on_configure(const lc::State & state)
 
   try {
     receiver_ = std::make_unique<SocketCanReceiver>(interface_, enable_fd_);
-    // apply CAN filters
-    auto filters = get_parameter("filters").as_string();
-    receiver_->SetCanFilters(SocketCanReceiver::CanFilterList(filters));
-    RCLCPP_INFO(get_logger(), "applied filters: %s", filters.c_str());
+    // apply CAN filters, an ID list takes precedence over the filter string
+    auto filter_ids = get_parameter("filter_ids").as_string();
+    if (filter_ids.find_first_not_of(" \t,") != std::string::npos) {
+      receiver_->SetCanFilters(SocketCanReceiver::CanFilterList::ParseIds(filter_ids));
+      RCLCPP_INFO(get_logger(), "applied filter ids: %s", filter_ids.c_str());
+    } else {
+      auto filters = get_parameter("filters").as_string();
+      receiver_->SetCanFilters(SocketCanReceiver::CanFilterList(filters));
+      RCLCPP_INFO(get_logger(), "applied filters: %s", filters.c_str());
+    }
+    // the batched receive reads bus time from the kernel timestamps
+    if (use_bus_time_ && (batch_size_ > 1U || publish_frame_array_)) {
+      receiver_->EnableTimestamping();
+    }
   } catch (const std::exception & ex) {
     RCLCPP_ERROR(
       this->get_logger(), "Error opening CAN receiver: %s - %s",
@@ -68,7 +87,16 @@ LNI::CallbackReturn SocketCanReceiverNode::on_configure(const lc::State & state)
 
   RCLCPP_DEBUG(this->get_logger(), "Receiver successfully configured.");
 
-  if (!enable_fd_) {
+  if (publish_frame_array_) {
+    if (!enable_fd_) {
+      frame_array_pub_ =
+        this->create_publisher<ros2_socketcan_msgs::msg::FrameArray>("from_can_bus_array", 50);
+    } else {
+      fd_frame_array_pub_ =
+        this->create_publisher<ros2_socketcan_msgs::msg::FdFrameArray>(
+        "from_can_bus_fd_array", 50);
+    }
+  } else if (!enable_fd_) {
     frames_pub_ = this->create_publisher<can_msgs::msg::Frame>("from_can_bus", 500);
   } else {
     fd_frames_pub_ =
@@ -84,11 +112,18 @@ LNI::CallbackReturn SocketCanReceiverNode::on_activate(const lc::State & state)
 {
   (void)state;
 
-  if (!enable_fd_) {
+  if (frames_pub_) {
     frames_pub_->on_activate();
-  } else {
+  }
+  if (fd_frames_pub_) {
     fd_frames_pub_->on_activate();
   }
+  if (frame_array_pub_) {
+    frame_array_pub_->on_activate();
+  }
+  if (fd_frame_array_pub_) {
+    fd_frame_array_pub_->on_activate();
+  }
 
   RCLCPP_DEBUG(this->get_logger(), "Receiver activated.");
   return LNI::CallbackReturn::SUCCESS;
@@ -98,11 +133,18 @@ LNI::CallbackReturn SocketCanReceiverNode::on_deactivate(const lc::State & state
 {
   (void)state;
 
-  if (!enable_fd_) {
+  if (frames_pub_) {
     frames_pub_->on_deactivate();
-  } else {
+  }
+  if (fd_frames_pub_) {
     fd_frames_pub_->on_deactivate();
   }
+  if (frame_array_pub_) {
+    frame_array_pub_->on_deactivate();
+  }
+  if (fd_frame_array_pub_) {
+    fd_frame_array_pub_->on_deactivate();
+  }
 
   RCLCPP_DEBUG(this->get_logger(), "Receiver deactivated.");
   return LNI::CallbackReturn::SUCCESS;
@@ -112,11 +154,10 @@ LNI::CallbackReturn SocketCanReceiverNode::on_cleanup(const lc::State & state)
 {
   (void)state;
 
-  if (!enable_fd_) {
-    frames_pub_.reset();
-  } else {
-    fd_frames_pub_.reset();
-  }
+  frames_pub_.reset();
+  fd_frames_pub_.reset();
+  frame_array_pub_.reset();
+  fd_frame_array_pub_.reset();
 
   if (receiver_thread_->joinable()) {
     receiver_thread_->join();
@@ -134,6 +175,11 @@ LNI::CallbackReturn SocketCanReceiverNode::on_shutdown(const lc::State & state)
 
 void SocketCanReceiverNode::receive()
 {
+  if (batch_size_ > 1U || publish_frame_array_) {
+    receive_batch();
+    return;
+  }
+
   CanId receive_id{};
 
   if (!enable_fd_) {
@@ -210,6 +256,95 @@ void SocketCanReceiverNode::receive()
   }
 }
 
+void SocketCanReceiverNode::receive_batch()
+{
+  SocketCanReceiver::FrameBatch batch(batch_size_);
+
+  can_msgs::msg::Frame frame_msg(rosidl_runtime_cpp::MessageInitialization::ZERO);
+  frame_msg.header.frame_id = "can";
+  ros2_socketcan_msgs::msg::FdFrame fd_frame_msg(rosidl_runtime_cpp::MessageInitialization::ZERO);
+  fd_frame_msg.header.frame_id = "can";
+
+  while (rclcpp::ok()) {
+    if (this->get_current_state().id() != State::PRIMARY_STATE_ACTIVE) {
+      std::this_thread::sleep_for(100ms);
+      continue;
+    }
+
+    try {
+      receiver_->receive_batch(batch, interval_ns_);
+    } catch (const std::exception & ex) {
+      RCLCPP_WARN_THROTTLE(
+        this->get_logger(), *this->get_clock(), 1000,
+        "Error receiving CAN message: %s - %s",
+        interface_.c_str(), ex.what());
+      continue;
+    }
+
+    // one clock read per batch when not using the bus time
+    const auto receive_time = this->now();
+    std::unique_ptr<ros2_socketcan_msgs::msg::FrameArray> frame_array_msg;
+    std::unique_ptr<ros2_socketcan_msgs::msg::FdFrameArray> fd_frame_array_msg;
+    if (publish_frame_array_ && !enable_fd_) {
+      frame_array_msg = std::make_unique<ros2_socketcan_msgs::msg::FrameArray>();
+      frame_array_msg->frames.reserve(batch.size());
+    } else if (publish_frame_array_) {
+      fd_frame_array_msg = std::make_unique<ros2_socketcan_msgs::msg::FdFrameArray>();
+      fd_frame_array_msg->frames.reserve(batch.size());
+    }
+
+    for (std::size_t idx = 0U; idx < batch.size(); ++idx) {
+      const auto & receive_id = batch.id(idx);
+      const auto stamp = use_bus_time_ ?
+        rclcpp::Time(static_cast<int64_t>(receive_id.get_bus_time() * 1000U)) : receive_time;
+
+      if (!enable_fd_) {
+        frame_msg.header.stamp = stamp;
+        frame_msg.id = receive_id.identifier();
+        frame_msg.is_rtr = (receive_id.frame_type() == FrameType::REMOTE);
+        frame_msg.is_extended = receive_id.is_extended();
+        frame_msg.is_error = (receive_id.frame_type() == FrameType::ERROR);
+        frame_msg.dlc = receive_id.length();
+        frame_msg.data.fill(0U);
+        (void)std::memcpy(frame_msg.data.data(), batch.data(idx), receive_id.length());
+        if (publish_frame_array_) {
+          frame_array_msg->frames.push_back(frame_msg);
+        } else {
+          frames_pub_->publish(frame_msg);
+        }
+      } else {
+        fd_frame_msg.header.stamp = stamp;
+        fd_frame_msg.id = receive_id.identifier();
+        fd_frame_msg.is_extended = receive_id.is_extended();
+        fd_frame_msg.is_error = (receive_id.frame_type() == FrameType::ERROR);
+        fd_frame_msg.len = receive_id.length();
+        fd_frame_msg.data.assign(batch.data(idx), batch.data(idx) + receive_id.length());
+        if (publish_frame_array_) {
+          fd_frame_array_msg->frames.push_back(fd_frame_msg);
+        } else {
+          fd_frames_pub_->publish(fd_frame_msg);
+        }
+      }
+    }
+
+    if (publish_frame_array_ && batch.size() > 0U) {
+      // stamped with the last frame of the batch
+      const auto stamp = use_bus_time_ ?
+        rclcpp::Time(static_cast<int64_t>(batch.id(batch.size() - 1U).get_bus_time() * 1000U)) :
+        receive_time;
+      if (!enable_fd_) {
+        frame_array_msg->header.stamp = stamp;
+        frame_array_msg->header.frame_id = "can";
+        frame_array_pub_->publish(std::move(frame_array_msg));
+      } else {
+        fd_frame_array_msg->header.stamp = stamp;
+        fd_frame_array_msg->header.frame_id = "can";
+        fd_frame_array_pub_->publish(std::move(fd_frame_array_msg));
+      }
+    }
+  }
+}
+
 }  // namespace socketcan
 }  // namespace drivers
 
@@ -0,0 +1,102 @@
+// Copyright 2024 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/kalman_filter/fixed_time_delay_kalman_filter.hpp"
+#include "autoware/kalman_filter/time_delay_kalman_filter.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using autoware::kalman_filter::FixedTimeDelayKalmanFilter;
+using autoware::kalman_filter::TimeDelayKalmanFilter;
+
+namespace
+{
+constexpr int dim_x = 6;
+using Vector6d = Eigen::Matrix<double, dim_x, 1>;
+using Matrix6d = Eigen::Matrix<double, dim_x, dim_x>;
+
+struct Input
+{
+  Matrix6d A;
+  Matrix6d Q;
+  int delay_step;
+  Eigen::Vector3d y;
+};
+
+std::vector<Input> create_inputs(const int nb_iterations, const int max_delay_step)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> dist(-0.01, 0.01);
+  std::uniform_int_distribution<int> delay_dist(0, max_delay_step - 1);
+
+  std::vector<Input> inputs(nb_iterations);
+  for (auto & input : inputs) {
+    input.A = Matrix6d::Identity() + Matrix6d::NullaryExpr([&]() { return dist(engine); });
+    input.Q = Vector6d::Constant(0.01).asDiagonal();
+    input.delay_step = delay_dist(engine);
+    input.y = Eigen::Vector3d::NullaryExpr([&]() { return dist(engine); });
+  }
+  return inputs;
+}
+
+template <class Filter, class Update>
+double measure_ms(Filter & filter, const std::vector<Input> & inputs, Update update)
+{
+  const Eigen::Matrix<double, 3, dim_x> C = Eigen::Matrix<double, 3, dim_x>::Identity();
+  const Eigen::Matrix3d R = Eigen::Matrix3d::Identity() * 0.1;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto & input : inputs) {
+    const Vector6d x_next = input.A * Vector6d(filter.getLatestX());
+    filter.predictWithDelay(x_next, input.A, input.Q);
+    update(filter, input.y, C, R, input.delay_step);
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+}  // namespace
+
+int main()
+{
+  constexpr int nb_iterations = 200;
+
+  std::printf("#max_delay_step  time_delay_kf[ms]  fixed_time_delay_kf[ms]  speedup\n");
+  for (const int max_delay_step : {5, 10, 25, 50, 100, 200}) {
+    const auto inputs = create_inputs(nb_iterations, max_delay_step);
+    const Vector6d x0 = Vector6d::Zero();
+    const Matrix6d P0 = Matrix6d::Identity();
+
+    TimeDelayKalmanFilter td_kf;
+    td_kf.init(x0, P0, max_delay_step);
+    const double td_kf_ms = measure_ms(
+      td_kf, inputs, [](auto & kf, const auto & y, const auto & C, const auto & R, int delay) {
+        kf.updateWithDelay(y, C, R, delay);
+      });
+
+    FixedTimeDelayKalmanFilter<dim_x> fixed_kf;
+    fixed_kf.init(x0, P0, max_delay_step);
+    const double fixed_kf_ms = measure_ms(
+      fixed_kf, inputs, [](auto & kf, const auto & y, const auto & C, const auto & R, int delay) {
+        kf.template updateWithDelay<3>(y, C, R, delay);
+      });
+
+    std::printf(
+      "%15d  %17.3f  %23.3f  %7.1f\n", max_delay_step, td_kf_ms, fixed_kf_ms,
+      td_kf_ms / fixed_kf_ms);
+  }
+  return 0;
+}
@@ -0,0 +1,222 @@
+// Copyright 2024 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__KALMAN_FILTER__FIXED_TIME_DELAY_KALMAN_FILTER_HPP_
+#define AUTOWARE__KALMAN_FILTER__FIXED_TIME_DELAY_KALMAN_FILTER_HPP_
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <Eigen/StdVector>
+
+#include <iostream>
+#include <vector>
+
+namespace autoware::kalman_filter
+{
+/**
+ * @file fixed_time_delay_kalman_filter.hpp
+ * @brief kalman filter with delayed measurement and compile-time state dimension
+ *
+ * Equivalent to TimeDelayKalmanFilter, but the extended state is not stored as a dense
+ * (dim_x * max_delay_step)^2 matrix. Each delayed state and each cross-covariance block is kept in
+ * a ring buffer indexed by delay step, so that a prediction only rotates the ring head and
+ * rewrites the first block row / column, instead of copying the whole extended covariance.
+ */
+
+template <int DimX>
+class FixedTimeDelayKalmanFilter
+{
+public:
+  using StateVector = Eigen::Matrix<double, DimX, 1>;
+  using StateMatrix = Eigen::Matrix<double, DimX, DimX>;
+
+  /**
+   * @brief No initialization constructor.
+   */
+  FixedTimeDelayKalmanFilter() = default;
+
+  /**
+   * @brief initialization of kalman filter
+   * @param x initial state
+   * @param P0 initial covariance of estimated state
+   * @param max_delay_step Maximum number of delay steps, which determines the size of the ring
+   * buffer
+   */
+  void init(const StateVector & x, const StateMatrix & P0, const int max_delay_step)
+  {
+    max_delay_step_ = max_delay_step;
+    head_ = 0;
+
+    x_.assign(max_delay_step_, x);
+    P_.assign(max_delay_step_ * max_delay_step_, StateMatrix::Zero());
+    for (int i = 0; i < max_delay_step_; ++i) {
+      P(i, i) = P0;
+    }
+  }
+
+  /**
+   * @brief get maximum number of delay steps
+   */
+  int getMaxDelayStep() const { return max_delay_step_; }
+
+  /**
+   * @brief get latest time estimated state
+   */
+  const StateVector & getLatestX() const { return x_[physicalIndex(0)]; }
+
+  /**
+   * @brief get latest time estimation covariance
+   */
+  const StateMatrix & getLatestP() const { return P(0, 0); }
+
+  /**
+   * @brief get estimated state at the given delay step
+   * @param delay_step delay step (0 is the latest)
+   */
+  const StateVector & getX(const int delay_step) const { return x_[physicalIndex(delay_step)]; }
+
+  /**
+   * @brief get cross covariance block between two delay steps
+   * @param i delay step of the row block
+   * @param j delay step of the column block
+   */
+  const StateMatrix & getP(const int i, const int j) const { return P(i, j); }
+
+  /**
+   * @brief get element of the extended state, indexed as in TimeDelayKalmanFilter
+   * @param i index of the element (delay_step * DimX + state index)
+   */
+  double getXelement(const unsigned int i) const { return getX(i / DimX)(i % DimX); }
+
+  /**
+   * @brief calculate kalman filter covariance by precision model with time delay. This is mainly
+   * for EKF of nonlinear process model.
+   * @param x_next predicted state by prediction model
+   * @param A coefficient matrix of x for process model
+   * @param Q covariance matrix for process model
+   */
+  bool predictWithDelay(const StateVector & x_next, const StateMatrix & A, const StateMatrix & Q)
+  {
+    /*
+     * Rotating the head by one step turns the former (i, j) blocks into the (i + 1, j + 1) blocks
+     * and drops the oldest state, so only the first block row / column has to be computed:
+     *
+     *     [A*P11*A'*+Q  A*P11  A*P12]
+     * P = [     P11*A'    P11    P12]
+     *     [     P21*A'    P21    P22]
+     */
+    head_ = (head_ + max_delay_step_ - 1) % max_delay_step_;
+
+    x_[physicalIndex(0)] = x_next;
+
+    for (int j = 1; j < max_delay_step_; ++j) {
+      P(0, j).noalias() = A * P(1, j);
+      P(j, 0).noalias() = P(j, 1) * A.transpose();
+    }
+    if (max_delay_step_ > 1) {
+      P(0, 0).noalias() = A * P(1, 1) * A.transpose();
+      P(0, 0) += Q;
+    } else {
+      const StateMatrix P00 = P(0, 0);
+      P(0, 0).noalias() = A * P00 * A.transpose();
+      P(0, 0) += Q;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief calculate kalman filter covariance by measurement model with time delay. This is mainly
+   * for EKF of nonlinear process model.
+   * @param y measured values
+   * @param C coefficient matrix of the delayed state for measurement model
+   * @param R covariance matrix for measurement model
+   * @param delay_step measurement delay
+   */
+  template <int DimY>
+  bool updateWithDelay(
+    const Eigen::Matrix<double, DimY, 1> & y, const Eigen::Matrix<double, DimY, DimX> & C,
+    const Eigen::Matrix<double, DimY, DimY> & R, const int delay_step)
+  {
+    if (delay_step >= max_delay_step_) {
+      std::cerr << "delay step is larger than max_delay_step. ignore update." << std::endl;
+      return false;
+    }
+
+    using GainMatrix = Eigen::Matrix<double, DimX, DimY>;
+    using MeasurementMatrix = Eigen::Matrix<double, DimY, DimX>;
+
+    /* only the column blocks of the measured delay step take part in the gain */
+    gain_buffer_.resize(max_delay_step_ * DimX * DimY);
+    measured_row_buffer_.resize(max_delay_step_ * DimX * DimY);
+    Eigen::Map<Eigen::Matrix<double, DimX, Eigen::Dynamic>> K(
+      gain_buffer_.data(), DimX, max_delay_step_ * DimY);
+    Eigen::Map<Eigen::Matrix<double, DimY, Eigen::Dynamic>> CP(
+      measured_row_buffer_.data(), DimY, max_delay_step_ * DimX);
+
+    for (int i = 0; i < max_delay_step_; ++i) {
+      K.template block<DimX, DimY>(0, i * DimY).noalias() = P(i, delay_step) * C.transpose();
+    }
+    const Eigen::Matrix<double, DimY, DimY> S =
+      R + C * K.template block<DimX, DimY>(0, delay_step * DimY);
+    const Eigen::Matrix<double, DimY, DimY> S_inv = S.inverse();
+    for (int i = 0; i < max_delay_step_; ++i) {
+      const GainMatrix PCT = K.template block<DimX, DimY>(0, i * DimY);
+      K.template block<DimX, DimY>(0, i * DimY).noalias() = PCT * S_inv;
+    }
+
+    if (K.array().isNaN().any() || K.array().isInf().any()) {
+      return false;
+    }
+
+    const Eigen::Matrix<double, DimY, 1> innovation = y - C * getX(delay_step);
+    for (int j = 0; j < max_delay_step_; ++j) {
+      CP.template block<DimY, DimX>(0, j * DimX).noalias() = C * P(delay_step, j);
+    }
+
+    for (int i = 0; i < max_delay_step_; ++i) {
+      const GainMatrix K_i = K.template block<DimX, DimY>(0, i * DimY);
+      x_[physicalIndex(i)].noalias() += K_i * innovation;
+      for (int j = 0; j < max_delay_step_; ++j) {
+        const MeasurementMatrix CP_j = CP.template block<DimY, DimX>(0, j * DimX);
+        P(i, j).noalias() -= K_i * CP_j;
+      }
+    }
+
+    return true;
+  }
+
+private:
+  int physicalIndex(const int delay_step) const { return (head_ + delay_step) % max_delay_step_; }
+
+  StateMatrix & P(const int i, const int j)
+  {
+    return P_[physicalIndex(i) * max_delay_step_ + physicalIndex(j)];
+  }
+  const StateMatrix & P(const int i, const int j) const
+  {
+    return P_[physicalIndex(i) * max_delay_step_ + physicalIndex(j)];
+  }
+
+  int max_delay_step_{0};  //!< @brief maximum number of delay steps
+  int head_{0};            //!< @brief ring buffer slot of the latest state
+
+  std::vector<StateVector, Eigen::aligned_allocator<StateVector>> x_;  //!< @brief states by slot
+  std::vector<StateMatrix, Eigen::aligned_allocator<StateMatrix>> P_;  //!< @brief blocks by slot
+
+  std::vector<double> gain_buffer_;          //!< @brief kalman gain work buffer
+  std::vector<double> measured_row_buffer_;  //!< @brief C * P work buffer
+};
+}  // namespace autoware::kalman_filter
+#endif  // AUTOWARE__KALMAN_FILTER__FIXED_TIME_DELAY_KALMAN_FILTER_HPP_
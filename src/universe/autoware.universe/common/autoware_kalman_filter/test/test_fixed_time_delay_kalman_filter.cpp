@@ -0,0 +1,102 @@
+// Copyright 2024 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/kalman_filter/fixed_time_delay_kalman_filter.hpp"
+#include "autoware/kalman_filter/time_delay_kalman_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using autoware::kalman_filter::FixedTimeDelayKalmanFilter;
+using autoware::kalman_filter::TimeDelayKalmanFilter;
+
+namespace
+{
+constexpr int dim_x = 6;
+using Vector6d = Eigen::Matrix<double, dim_x, 1>;
+using Matrix6d = Eigen::Matrix<double, dim_x, dim_x>;
+
+void expect_same_state(
+  const TimeDelayKalmanFilter & td_kf, const FixedTimeDelayKalmanFilter<dim_x> & fixed_kf,
+  const int max_delay_step)
+{
+  const Eigen::MatrixXd P_latest = td_kf.getLatestP();
+  for (int r = 0; r < dim_x; ++r) {
+    for (int c = 0; c < dim_x; ++c) {
+      EXPECT_NEAR(fixed_kf.getLatestP()(r, c), P_latest(r, c), 1e-8);
+    }
+  }
+  for (int i = 0; i < dim_x * max_delay_step; ++i) {
+    EXPECT_NEAR(fixed_kf.getXelement(i), td_kf.getXelement(i), 1e-8);
+  }
+}
+}  // namespace
+
+TEST(fixed_time_delay_kalman_filter, matches_time_delay_kalman_filter)
+{
+  const int max_delay_step = 7;
+
+  Vector6d x0;
+  x0 << 1.0, 2.0, 0.3, 0.0, 5.0, 0.1;
+  const Matrix6d P0 = Vector6d(0.5, 0.5, 0.1, 0.01, 1.0, 0.1).asDiagonal();
+
+  TimeDelayKalmanFilter td_kf;
+  FixedTimeDelayKalmanFilter<dim_x> fixed_kf;
+  td_kf.init(x0, P0, max_delay_step);
+  fixed_kf.init(x0, P0, max_delay_step);
+  expect_same_state(td_kf, fixed_kf, max_delay_step);
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> dist(-0.1, 0.1);
+  std::uniform_int_distribution<int> delay_dist(0, max_delay_step - 1);
+
+  // predict more often than max_delay_step so that the ring buffer wraps around several times
+  for (int step = 0; step < 4 * max_delay_step; ++step) {
+    const Matrix6d A = Matrix6d::Identity() + Matrix6d::NullaryExpr([&]() { return dist(engine); });
+    const Matrix6d Q = Vector6d::Constant(0.01).asDiagonal();
+    const Vector6d x_next = A * fixed_kf.getLatestX();
+
+    EXPECT_TRUE(td_kf.predictWithDelay(x_next, A, Q));
+    EXPECT_TRUE(fixed_kf.predictWithDelay(x_next, A, Q));
+    expect_same_state(td_kf, fixed_kf, max_delay_step);
+
+    const int delay_step = delay_dist(engine);
+    Eigen::Matrix<double, 3, dim_x> C = Eigen::Matrix<double, 3, dim_x>::Zero();
+    C(0, 0) = C(1, 1) = C(2, 2) = 1.0;
+    const Eigen::Matrix3d R = Eigen::Vector3d(0.1, 0.1, 0.01).asDiagonal();
+    const Eigen::Vector3d y = C * fixed_kf.getX(delay_step) + Eigen::Vector3d::Constant(dist(engine));
+
+    EXPECT_TRUE(td_kf.updateWithDelay(y, C, R, delay_step));
+    EXPECT_TRUE(fixed_kf.updateWithDelay<3>(y, C, R, delay_step));
+    expect_same_state(td_kf, fixed_kf, max_delay_step);
+  }
+}
+
+TEST(fixed_time_delay_kalman_filter, reject_too_large_delay)
+{
+  const int max_delay_step = 3;
+  FixedTimeDelayKalmanFilter<dim_x> fixed_kf;
+  fixed_kf.init(Vector6d::Zero(), Matrix6d::Identity(), max_delay_step);
+
+  const Eigen::Matrix<double, 2, dim_x> C = Eigen::Matrix<double, 2, dim_x>::Identity();
+  const Eigen::Matrix2d R = Eigen::Matrix2d::Identity();
+  const Eigen::Vector2d y(1.0, 1.0);
+  EXPECT_FALSE(fixed_kf.updateWithDelay<2>(y, C, R, max_delay_step));
+  EXPECT_TRUE(fixed_kf.updateWithDelay<2>(y, C, R, max_delay_step - 1));
+
+  // the latest state is only affected through the cross covariance, which is zero after init
+  EXPECT_NEAR(fixed_kf.getLatestX()(0), 0.0, 1e-10);
+  EXPECT_NEAR(fixed_kf.getX(max_delay_step - 1)(0), 0.5, 1e-10);
+}
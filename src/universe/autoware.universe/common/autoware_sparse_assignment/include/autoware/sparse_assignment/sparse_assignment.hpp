@@ -0,0 +1,119 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__SPARSE_ASSIGNMENT__SPARSE_ASSIGNMENT_HPP_
+#define AUTOWARE__SPARSE_ASSIGNMENT__SPARSE_ASSIGNMENT_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace autoware::sparse_assignment
+{
+/**
+ * @brief candidate pair of a row (e.g. a tracker) and a column (e.g. a measurement) that passed
+ * the gating, with the gain of assigning them to each other
+ */
+struct Edge
+{
+  int row;
+  int col;
+  double weight;
+};
+
+/**
+ * @brief result of an assignment, -1 for unassigned rows / columns
+ */
+struct Assignment
+{
+  std::vector<int> row_to_col;
+  std::vector<int> col_to_row;
+};
+
+/**
+ * @brief maximum weight bipartite matching on a sparse list of candidate edges
+ *
+ * Selects at most one edge per row and per column so that the sum of the selected weights is
+ * maximal. Rows and columns may stay unassigned, and edges with a non-positive weight are never
+ * selected, which is the global nearest neighbor association of gated scores.
+ *
+ * The edges are split into connected components, which are solved independently: isolated pairs
+ * directly, larger components by shortest augmenting paths on a sparse graph (the augmentation
+ * phase of the Jonker-Volgenant algorithm, with a binary heap instead of a dense scan). The cost
+ * therefore grows with the number of gated edges instead of rows * columns.
+ *
+ * The solver keeps its buffers between calls, so reuse one instance per association.
+ */
+class SparseAssignmentSolver
+{
+public:
+  /**
+   * @brief solve the maximum weight matching
+   * @param num_rows number of rows, all edge rows must be in [0, num_rows)
+   * @param num_cols number of columns, all edge columns must be in [0, num_cols)
+   * @param edges candidate edges, at most one per (row, col) pair
+   * @param assignment result, resized to num_rows / num_cols
+   * @return sum of the weights of the selected edges
+   */
+  double maximize(
+    const int num_rows, const int num_cols, const std::vector<Edge> & edges,
+    Assignment & assignment);
+
+  /**
+   * @brief solve the minimum cost assignment where leaving a row and a column unassigned costs
+   * cost_limit, i.e. the assignment of lapjv with cost_limit on the extended cost matrix
+   * @details only edges with cost < cost_limit can be selected. The weight of the edges is
+   * overwritten with cost_limit - cost.
+   * @param edges candidate edges, with their cost in weight
+   */
+  double minimize(
+    const int num_rows, const int num_cols, std::vector<Edge> & edges, const double cost_limit,
+    Assignment & assignment);
+
+private:
+  // union find over rows [0, num_rows) and columns [num_rows, num_rows + num_cols)
+  int findRoot(int node);
+  void solveComponent(const std::size_t edge_begin, const std::size_t edge_end);
+
+  std::vector<int> parent_;
+  std::vector<int> component_of_edge_;
+  std::vector<std::size_t> edge_order_;
+  std::vector<Edge> component_edges_;
+  std::vector<int> local_rows_;
+  std::vector<int> local_cols_;
+  std::vector<int> local_index_;
+
+  // extended graph of a component, in compressed sparse row format
+  std::vector<int> adjacency_begin_;
+  std::vector<int> adjacency_col_;
+  std::vector<double> adjacency_cost_;
+  std::vector<int> adjacency_fill_;
+
+  // shortest augmenting path state
+  std::vector<double> row_potential_;
+  std::vector<double> col_potential_;
+  std::vector<int> row_match_;
+  std::vector<int> col_match_;
+  std::vector<double> distance_;
+  std::vector<int> predecessor_;
+  std::vector<char> is_finalized_;
+  std::vector<int> touched_cols_;
+  std::vector<int> finalized_cols_;
+
+  Assignment * assignment_{nullptr};
+  int num_rows_{0};
+};
+
+}  // namespace autoware::sparse_assignment
+
+#endif  // AUTOWARE__SPARSE_ASSIGNMENT__SPARSE_ASSIGNMENT_HPP_
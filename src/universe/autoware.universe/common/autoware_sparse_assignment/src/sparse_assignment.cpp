@@ -0,0 +1,280 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/sparse_assignment/sparse_assignment.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace autoware::sparse_assignment
+{
+namespace
+{
+constexpr double infinity = std::numeric_limits<double>::infinity();
+}  // namespace
+
+double SparseAssignmentSolver::maximize(
+  const int num_rows, const int num_cols, const std::vector<Edge> & edges, Assignment & assignment)
+{
+  assignment.row_to_col.assign(num_rows, -1);
+  assignment.col_to_row.assign(num_cols, -1);
+  assignment_ = &assignment;
+  num_rows_ = num_rows;
+
+  const int num_nodes = num_rows + num_cols;
+  parent_.resize(num_nodes);
+  std::iota(parent_.begin(), parent_.end(), 0);
+  local_index_.assign(num_nodes, -1);
+
+  // connected components of the edges that can be selected
+  for (const auto & edge : edges) {
+    if (edge.row < 0 || num_rows <= edge.row || edge.col < 0 || num_cols <= edge.col) {
+      throw std::out_of_range("sparse_assignment: edge out of the row / column range");
+    }
+    if (!(0.0 < edge.weight)) continue;
+    const int row_root = findRoot(edge.row);
+    const int col_root = findRoot(num_rows + edge.col);
+    if (row_root != col_root) parent_[row_root] = col_root;
+  }
+
+  component_of_edge_.resize(edges.size());
+  edge_order_.clear();
+  for (std::size_t i = 0; i < edges.size(); ++i) {
+    if (!(0.0 < edges[i].weight)) continue;
+    component_of_edge_[i] = findRoot(edges[i].row);
+    edge_order_.push_back(i);
+  }
+  std::sort(edge_order_.begin(), edge_order_.end(), [this](const auto lhs, const auto rhs) {
+    return component_of_edge_[lhs] < component_of_edge_[rhs];
+  });
+
+  for (std::size_t begin = 0; begin < edge_order_.size();) {
+    const int component = component_of_edge_[edge_order_[begin]];
+    std::size_t end = begin + 1;
+    while (end < edge_order_.size() && component_of_edge_[edge_order_[end]] == component) {
+      ++end;
+    }
+    component_edges_.clear();
+    for (std::size_t i = begin; i < end; ++i) {
+      component_edges_.push_back(edges[edge_order_[i]]);
+    }
+    solveComponent(0, component_edges_.size());
+    begin = end;
+  }
+
+  double total_weight = 0.0;
+  for (const auto & edge : edges) {
+    if (0.0 < edge.weight && assignment.row_to_col[edge.row] == edge.col) {
+      total_weight += edge.weight;
+    }
+  }
+  assignment_ = nullptr;
+  return total_weight;
+}
+
+double SparseAssignmentSolver::minimize(
+  const int num_rows, const int num_cols, std::vector<Edge> & edges, const double cost_limit,
+  Assignment & assignment)
+{
+  for (auto & edge : edges) {
+    edge.weight = cost_limit - edge.weight;
+  }
+  const double total_weight = maximize(num_rows, num_cols, edges, assignment);
+
+  // cost of the assigned pairs
+  int num_assigned = 0;
+  for (const auto col : assignment.row_to_col) {
+    if (0 <= col) ++num_assigned;
+  }
+  return num_assigned * cost_limit - total_weight;
+}
+
+int SparseAssignmentSolver::findRoot(int node)
+{
+  while (parent_[node] != node) {
+    parent_[node] = parent_[parent_[node]];
+    node = parent_[node];
+  }
+  return node;
+}
+
+void SparseAssignmentSolver::solveComponent(const std::size_t edge_begin, const std::size_t edge_end)
+{
+  // an isolated pair is assigned if its weight is positive, which it always is here
+  if (edge_end - edge_begin == 1) {
+    const auto & edge = component_edges_[edge_begin];
+    assignment_->row_to_col[edge.row] = edge.col;
+    assignment_->col_to_row[edge.col] = edge.row;
+    return;
+  }
+
+  // local indices of the rows and columns of the component
+  local_rows_.clear();
+  local_cols_.clear();
+  double max_weight = 0.0;
+  for (std::size_t i = edge_begin; i < edge_end; ++i) {
+    const auto & edge = component_edges_[i];
+    int & row_index = local_index_[edge.row];
+    if (row_index < 0) {
+      row_index = static_cast<int>(local_rows_.size());
+      local_rows_.push_back(edge.row);
+    }
+    int & col_index = local_index_[num_rows_ + edge.col];
+    if (col_index < 0) {
+      col_index = static_cast<int>(local_cols_.size());
+      local_cols_.push_back(edge.col);
+    }
+    max_weight = std::max(max_weight, edge.weight);
+  }
+  const int r = static_cast<int>(local_rows_.size());
+  const int c = static_cast<int>(local_cols_.size());
+  const int n = r + c;
+
+  // Extended square problem with n = r + c rows and columns, which has a perfect matching:
+  // - left nodes: rows [0, r), one dummy row per column [r, n)
+  // - right nodes: columns [0, c), one dummy column per row [c, n)
+  // A row assigned to its dummy column and a column assigned to its dummy row are unassigned and
+  // cost max_weight / 2 each. An assigned pair (i, j) costs max_weight - weight and also matches
+  // the dummy row of j with the dummy column of i at cost 0, so that the total cost is a constant
+  // minus the sum of the assigned weights, with all costs non-negative.
+  adjacency_begin_.assign(n + 1, 0);
+  for (std::size_t i = edge_begin; i < edge_end; ++i) {
+    const auto & edge = component_edges_[i];
+    ++adjacency_begin_[local_index_[edge.row] + 1];
+    ++adjacency_begin_[r + local_index_[num_rows_ + edge.col] + 1];
+  }
+  for (int left = 0; left < n; ++left) {
+    // dummy edge of each left node
+    ++adjacency_begin_[left + 1];
+    adjacency_begin_[left + 1] += adjacency_begin_[left];
+  }
+  const int num_adjacency = adjacency_begin_[n];
+  adjacency_col_.resize(num_adjacency);
+  adjacency_cost_.resize(num_adjacency);
+  // fill from the end of each range
+  adjacency_fill_.assign(adjacency_begin_.begin() + 1, adjacency_begin_.end());
+  const auto add = [&](const int left, const int right, const double cost) {
+    const int index = --adjacency_fill_[left];
+    adjacency_col_[index] = right;
+    adjacency_cost_[index] = cost;
+  };
+  for (int i = 0; i < r; ++i) {
+    add(i, c + i, 0.5 * max_weight);
+  }
+  for (int j = 0; j < c; ++j) {
+    add(r + j, j, 0.5 * max_weight);
+  }
+  for (std::size_t k = edge_begin; k < edge_end; ++k) {
+    const auto & edge = component_edges_[k];
+    const int i = local_index_[edge.row];
+    const int j = local_index_[num_rows_ + edge.col];
+    add(i, j, max_weight - edge.weight);
+    add(r + j, c + i, 0.0);
+  }
+
+  // shortest augmenting paths, keeping c - u - v >= 0 on all edges and == 0 on matched edges
+  row_potential_.assign(n, 0.0);
+  col_potential_.assign(n, 0.0);
+  row_match_.assign(n, -1);
+  col_match_.assign(n, -1);
+  distance_.assign(n, infinity);
+  predecessor_.assign(n, -1);
+  is_finalized_.assign(n, 0);
+
+  using QueueElement = std::pair<double, int>;
+  std::priority_queue<QueueElement, std::vector<QueueElement>, std::greater<QueueElement>> queue;
+
+  for (int source = 0; source < n; ++source) {
+    touched_cols_.clear();
+    finalized_cols_.clear();
+    const auto relax = [&](const int left, const double left_distance) {
+      for (int index = adjacency_begin_[left]; index < adjacency_begin_[left + 1]; ++index) {
+        const int right = adjacency_col_[index];
+        if (is_finalized_[right]) continue;
+        const double reduced_cost =
+          adjacency_cost_[index] - row_potential_[left] - col_potential_[right];
+        const double new_distance = left_distance + std::max(reduced_cost, 0.0);
+        if (new_distance < distance_[right]) {
+          if (distance_[right] == infinity) touched_cols_.push_back(right);
+          distance_[right] = new_distance;
+          predecessor_[right] = left;
+          queue.emplace(new_distance, right);
+        }
+      }
+    };
+
+    relax(source, 0.0);
+    int sink = -1;
+    double sink_distance = 0.0;
+    while (!queue.empty()) {
+      const auto [col_distance, right] = queue.top();
+      queue.pop();
+      if (is_finalized_[right] || distance_[right] < col_distance) continue;
+      is_finalized_[right] = 1;
+      finalized_cols_.push_back(right);
+      if (col_match_[right] < 0) {
+        sink = right;
+        sink_distance = col_distance;
+        break;
+      }
+      relax(col_match_[right], col_distance);
+    }
+    while (!queue.empty()) queue.pop();
+    if (sink < 0) {
+      // cannot happen, every row has its own dummy column
+      throw std::logic_error("sparse_assignment: no augmenting path");
+    }
+
+    // update the potentials so that the path becomes tight
+    for (const int right : finalized_cols_) {
+      const double delta = sink_distance - distance_[right];
+      col_potential_[right] -= delta;
+      if (0 <= col_match_[right]) row_potential_[col_match_[right]] += delta;
+    }
+    row_potential_[source] += sink_distance;
+
+    // augment
+    for (int right = sink; right >= 0;) {
+      const int left = predecessor_[right];
+      const int previous = row_match_[left];
+      row_match_[left] = right;
+      col_match_[right] = left;
+      right = previous;
+    }
+
+    for (const int right : touched_cols_) {
+      distance_[right] = infinity;
+      is_finalized_[right] = 0;
+    }
+  }
+
+  for (int i = 0; i < r; ++i) {
+    const int j = row_match_[i];
+    if (j < c) {
+      assignment_->row_to_col[local_rows_[i]] = local_cols_[j];
+      assignment_->col_to_row[local_cols_[j]] = local_rows_[i];
+    }
+  }
+
+  for (const int row : local_rows_) local_index_[row] = -1;
+  for (const int col : local_cols_) local_index_[num_rows_ + col] = -1;
+}
+
+}  // namespace autoware::sparse_assignment
@@ -0,0 +1,171 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/sparse_assignment/sparse_assignment.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using autoware::sparse_assignment::Assignment;
+using autoware::sparse_assignment::Edge;
+using autoware::sparse_assignment::SparseAssignmentSolver;
+
+namespace
+{
+// maximum weight matching by enumerating the column (or none) of every row
+double bruteForce(
+  const int num_rows, const int num_cols, const std::vector<std::vector<double>> & weights,
+  const int row, std::vector<bool> & used_cols)
+{
+  if (row == num_rows) return 0.0;
+  double best = bruteForce(num_rows, num_cols, weights, row + 1, used_cols);
+  for (int col = 0; col < num_cols; ++col) {
+    if (used_cols[col] || !(0.0 < weights[row][col])) continue;
+    used_cols[col] = true;
+    best = std::max(
+      best, weights[row][col] + bruteForce(num_rows, num_cols, weights, row + 1, used_cols));
+    used_cols[col] = false;
+  }
+  return best;
+}
+
+void expectValidAssignment(
+  const int num_rows, const int num_cols, const std::vector<std::vector<double>> & weights,
+  const Assignment & assignment, const double total_weight)
+{
+  ASSERT_EQ(assignment.row_to_col.size(), static_cast<std::size_t>(num_rows));
+  ASSERT_EQ(assignment.col_to_row.size(), static_cast<std::size_t>(num_cols));
+  double sum = 0.0;
+  for (int row = 0; row < num_rows; ++row) {
+    const int col = assignment.row_to_col[row];
+    if (col < 0) continue;
+    EXPECT_EQ(assignment.col_to_row[col], row);
+    EXPECT_GT(weights[row][col], 0.0);
+    sum += weights[row][col];
+  }
+  for (int col = 0; col < num_cols; ++col) {
+    const int row = assignment.col_to_row[col];
+    if (0 <= row) {
+      EXPECT_EQ(assignment.row_to_col[row], col);
+    }
+  }
+  EXPECT_NEAR(sum, total_weight, 1e-9);
+}
+}  // namespace
+
+TEST(sparse_assignment, empty)
+{
+  SparseAssignmentSolver solver;
+  Assignment assignment;
+  EXPECT_EQ(solver.maximize(3, 2, {}, assignment), 0.0);
+  EXPECT_EQ(assignment.row_to_col, std::vector<int>(3, -1));
+  EXPECT_EQ(assignment.col_to_row, std::vector<int>(2, -1));
+
+  EXPECT_EQ(solver.maximize(0, 0, {}, assignment), 0.0);
+  EXPECT_TRUE(assignment.row_to_col.empty());
+}
+
+TEST(sparse_assignment, maximize)
+{
+  SparseAssignmentSolver solver;
+  Assignment assignment;
+
+  // greedy would take (0, 0) and leave row 1 unassigned
+  const std::vector<Edge> edges{{0, 0, 0.9}, {0, 1, 0.8}, {1, 0, 0.7}, {2, 2, 0.5}, {2, 3, -1.0}};
+  EXPECT_DOUBLE_EQ(solver.maximize(3, 4, edges, assignment), 2.0);
+  EXPECT_EQ(assignment.row_to_col, (std::vector<int>{1, 0, 2}));
+  EXPECT_EQ(assignment.col_to_row, (std::vector<int>{1, 0, 2, -1}));
+
+  // leaving a row unassigned is better than a low weight chain
+  const std::vector<Edge> chain{{0, 0, 1.0}, {1, 0, 0.1}, {1, 1, 0.1}, {0, 1, 0.0}};
+  EXPECT_DOUBLE_EQ(solver.maximize(2, 2, chain, assignment), 1.1);
+  EXPECT_EQ(assignment.row_to_col, (std::vector<int>{0, 1}));
+
+  EXPECT_THROW(solver.maximize(1, 1, {{0, 1, 1.0}}, assignment), std::out_of_range);
+}
+
+TEST(sparse_assignment, minimize)
+{
+  SparseAssignmentSolver solver;
+  Assignment assignment;
+
+  // only pairs cheaper than the cost limit are assigned
+  std::vector<Edge> edges{{0, 0, 0.1}, {0, 1, 0.2}, {1, 0, 0.15}, {1, 1, 0.9}, {2, 1, 0.79}};
+  EXPECT_NEAR(solver.minimize(3, 2, edges, 0.8, assignment), 0.2 + 0.15, 1e-12);
+  EXPECT_EQ(assignment.row_to_col, (std::vector<int>{1, 0, -1}));
+  EXPECT_EQ(assignment.col_to_row, (std::vector<int>{1, 0}));
+}
+
+TEST(sparse_assignment, random_against_brute_force)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> weight_distribution(-0.2, 1.0);
+  std::uniform_real_distribution<double> density_distribution(0.1, 0.8);
+
+  SparseAssignmentSolver solver;
+  Assignment assignment;
+  for (int trial = 0; trial < 500; ++trial) {
+    const int num_rows = 1 + static_cast<int>(engine() % 7);
+    const int num_cols = 1 + static_cast<int>(engine() % 7);
+    const double density = density_distribution(engine);
+
+    std::vector<std::vector<double>> weights(num_rows, std::vector<double>(num_cols, 0.0));
+    std::vector<Edge> edges;
+    for (int row = 0; row < num_rows; ++row) {
+      for (int col = 0; col < num_cols; ++col) {
+        if (density < std::generate_canonical<double, 32>(engine)) continue;
+        // few distinct values so that ties are common
+        weights[row][col] = trial % 2 ? weight_distribution(engine)
+                                      : static_cast<double>(engine() % 4) * 0.25;
+        edges.push_back({row, col, weights[row][col]});
+      }
+    }
+    std::shuffle(edges.begin(), edges.end(), engine);
+
+    std::vector<bool> used_cols(num_cols, false);
+    const double expected = bruteForce(num_rows, num_cols, weights, 0, used_cols);
+    const double total_weight = solver.maximize(num_rows, num_cols, edges, assignment);
+    EXPECT_NEAR(total_weight, expected, 1e-9) << "trial " << trial;
+    expectValidAssignment(num_rows, num_cols, weights, assignment, total_weight);
+  }
+}
+
+TEST(sparse_assignment, many_components)
+{
+  // independent 2x2 blocks, with the block (k, k) of rows 2k, 2k+1 and columns 2k, 2k+1
+  constexpr int num_blocks = 200;
+  std::vector<Edge> edges;
+  for (int k = 0; k < num_blocks; ++k) {
+    edges.push_back({2 * k, 2 * k, 1.0});
+    edges.push_back({2 * k, 2 * k + 1, 0.6});
+    edges.push_back({2 * k + 1, 2 * k, 0.6});
+  }
+  // one isolated pair
+  edges.push_back({2 * num_blocks, 2 * num_blocks, 0.3});
+
+  SparseAssignmentSolver solver;
+  Assignment assignment;
+  EXPECT_NEAR(
+    solver.maximize(2 * num_blocks + 1, 2 * num_blocks + 1, edges, assignment),
+    num_blocks * 1.2 + 0.3, 1e-9);
+  for (int k = 0; k < num_blocks; ++k) {
+    EXPECT_EQ(assignment.row_to_col[2 * k], 2 * k + 1);
+    EXPECT_EQ(assignment.row_to_col[2 * k + 1], 2 * k);
+  }
+  EXPECT_EQ(assignment.row_to_col[2 * num_blocks], 2 * num_blocks);
+}
@@ -0,0 +1,364 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef AUTOWARE__UNIVERSE_UTILS__SYSTEM__AGGREGATED_TIME_KEEPER_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__SYSTEM__AGGREGATED_TIME_KEEPER_HPP_
+
+#include "autoware/universe_utils/system/time_keeper.hpp"
+
+#include <rclcpp/publisher.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+/**
+ * @brief Name of a tracked scope interned to an integer id
+ *
+ * The name is interned once, so define the scope as a static variable at the call site.
+ *
+ * @code
+ * static const TimeTrackScope scope("plan");
+ * ScopedAggregatedTimeTrack st(scope, *time_keeper_);
+ * @endcode
+ */
+class TimeTrackScope
+{
+public:
+  /**
+   * @brief Intern the name. Scopes with the same name share the id.
+   *
+   * @param name Name of the scope
+   */
+  explicit TimeTrackScope(const std::string & name);
+
+  /**
+   * @brief Get the id of the scope
+   */
+  uint32_t id() const { return id_; }
+
+  /**
+   * @brief Get the name of an interned id
+   *
+   * @param id Id of the scope
+   * @return std::string Name of the scope
+   */
+  static std::string name_of(const uint32_t id);
+
+private:
+  uint32_t id_;  //!< Interned id of the name
+};
+
+/**
+ * @brief Histogram of processing times in microseconds with log-linear buckets
+ *
+ * Like HdrHistogram, each power of two is divided into 16 buckets, so a recorded value is
+ * reproduced within 1/16 of it. Values up to about 71 minutes are recorded.
+ */
+class TimeHistogram
+{
+public:
+  static constexpr size_t sub_bucket_bits = 4;
+  static constexpr size_t sub_bucket_count = 1 << sub_bucket_bits;
+  static constexpr size_t num_buckets = sub_bucket_count * (32 - sub_bucket_bits + 1);
+  static constexpr uint64_t max_value = (uint64_t{1} << 32) - 1;
+
+  /**
+   * @brief Get the index of the bucket which the value is recorded in
+   *
+   * @param value_us Value in microseconds, clamped to max_value
+   */
+  static size_t bucket_index(const uint64_t value_us);
+
+  /**
+   * @brief Get the highest value recorded in the bucket
+   *
+   * @param index Index of the bucket
+   */
+  static uint64_t bucket_highest_value(const size_t index);
+
+  /**
+   * @brief Record a value
+   *
+   * @param value_us Value in microseconds
+   * @param count Number of times the value is recorded
+   */
+  void add(const uint64_t value_us, const uint64_t count = 1);
+
+  /**
+   * @brief Add the counts of a bucket directly
+   *
+   * @param index Index of the bucket
+   * @param count Number of values in the bucket
+   */
+  void add_to_bucket(const size_t index, const uint64_t count);
+
+  /**
+   * @brief Add the sum of the values, which is used for the mean
+   *
+   * @param sum_us Sum of the values in microseconds
+   */
+  void add_sum(const uint64_t sum_us) { sum_us_ += sum_us; }
+
+  /**
+   * @brief Add all values of another histogram
+   */
+  void merge(const TimeHistogram & other);
+
+  /**
+   * @brief Remove all values
+   */
+  void clear();
+
+  uint64_t count() const { return count_; }
+
+  /**
+   * @brief Get the mean in milliseconds, or 0 if empty
+   */
+  double mean_ms() const;
+
+  /**
+   * @brief Get the percentile in milliseconds, or 0 if empty
+   *
+   * @param ratio Ratio of the percentile, e.g. 0.99 for p99
+   */
+  double percentile_ms(const double ratio) const;
+
+  /**
+   * @brief Get the maximum in milliseconds, or 0 if empty
+   */
+  double max_ms() const;
+
+private:
+  std::array<uint64_t, num_buckets> counts_{};  //!< Number of values in each bucket
+  uint64_t count_{0};                           //!< Number of all values
+  uint64_t sum_us_{0};                          //!< Sum of all values
+};
+
+/**
+ * @brief Low-overhead variant of TimeKeeper which aggregates processing times into histograms
+ *
+ * TimeKeeper builds and reports a tree of ProcessingTimeNode on every call of the root function.
+ * AggregatedTimeKeeper instead keeps one persistent tree per thread in a preallocated arena, and
+ * records the processing time of each node of the tree into a histogram. The histograms are
+ * reported only once per report period and restarted, so tracking a scope does not allocate
+ * memory nor build messages, and it can be enabled in production.
+ *
+ * The reported tree has the same form as that of TimeKeeper. The processing time of each node is
+ * the 99th percentile in the period, and the comment contains the statistics.
+ */
+class AggregatedTimeKeeper
+{
+public:
+  static constexpr size_t max_nodes_per_thread = 64;  //!< Capacity of the arena of each thread
+
+  template <typename... Reporters>
+  explicit AggregatedTimeKeeper(
+    const std::chrono::milliseconds report_period, Reporters... reporters)
+  : report_period_(report_period),
+    next_report_time_ns_(to_ns(std::chrono::steady_clock::now() + report_period))
+  {
+    reporters_.reserve(sizeof...(Reporters));
+    (add_reporter(reporters), ...);
+  }
+
+  AggregatedTimeKeeper(const AggregatedTimeKeeper &) = delete;
+  AggregatedTimeKeeper & operator=(const AggregatedTimeKeeper &) = delete;
+
+  /**
+   * @brief Add a reporter to output the aggregated processing times to an ostream
+   *
+   * @param os Pointer to the ostream object
+   */
+  void add_reporter(std::ostream * os);
+
+  /**
+   * @brief Add a reporter to publish the aggregated processing times to an rclcpp publisher
+   *
+   * @param publisher Shared pointer to the rclcpp publisher
+   */
+  void add_reporter(rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr publisher);
+
+  /**
+   * @brief Start tracking the processing time of a scope
+   *
+   * @param scope Scope to be tracked
+   */
+  void start_track(const TimeTrackScope & scope);
+
+  /**
+   * @brief End tracking the processing time of a scope. When the root scope of the thread ends
+   * and the report period has passed, the histograms are reported.
+   *
+   * @param scope Scope to end tracking
+   */
+  void end_track(const TimeTrackScope & scope);
+
+  /**
+   * @brief Report the histograms of all threads and restart them
+   */
+  void report();
+
+  /**
+   * @brief Number of scopes which were not tracked because an arena was full
+   */
+  uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  /**
+   * @brief Node of the tree of a thread, which is a scope under a path of parent scopes
+   */
+  struct Node
+  {
+    uint32_t scope_id{0};
+    int32_t parent{-1};
+    int32_t first_child{-1};   //!< Only accessed by the owner thread
+    int32_t next_sibling{-1};  //!< Only accessed by the owner thread
+    std::chrono::steady_clock::time_point start_time;
+    std::array<std::atomic<uint32_t>, TimeHistogram::num_buckets> buckets{};
+    std::atomic<uint64_t> sum_us{0};
+  };
+
+  /**
+   * @brief Preallocated tree of a thread. Nodes are appended by the owner thread and read by the
+   * reporting thread up to the published size.
+   */
+  struct Arena
+  {
+    std::unique_ptr<Node[]> nodes{new Node[max_nodes_per_thread]};
+    std::atomic<size_t> size{0};
+    int32_t first_root{-1};
+    int32_t current{-1};
+    size_t untracked_depth{0};  //!< Depth of the scopes started while the arena was full
+  };
+
+  static int64_t to_ns(const std::chrono::steady_clock::time_point & time)
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+  }
+
+  Arena & arena_of_this_thread();
+  int32_t find_or_add_child(Arena & arena, const int32_t parent, const uint32_t scope_id);
+  void report_if_due(const std::chrono::steady_clock::time_point & now);
+
+  const std::chrono::steady_clock::duration report_period_;
+  std::atomic<int64_t> next_report_time_ns_;
+  std::atomic<uint64_t> dropped_{0};
+
+  // The arena of the first thread is found without the lock.
+  std::atomic<std::thread::id> primary_thread_{};
+  Arena * primary_arena_{nullptr};
+  std::mutex arenas_mutex_;
+  std::unordered_map<std::thread::id, std::unique_ptr<Arena>> arenas_;
+
+  std::mutex report_mutex_;
+  std::vector<std::function<void(const std::shared_ptr<ProcessingTimeNode> &)>>
+    reporters_;  //!< Vector of functions for reporting the processing times
+};
+
+/**
+ * @brief Class for automatically tracking the processing time of a scope with
+ * AggregatedTimeKeeper
+ */
+class ScopedAggregatedTimeTrack
+{
+public:
+  /**
+   * @brief Construct a new ScopedAggregatedTimeTrack object
+   *
+   * @param scope Scope to be tracked, which must outlive this object
+   * @param time_keeper Reference to the AggregatedTimeKeeper object
+   */
+  ScopedAggregatedTimeTrack(const TimeTrackScope & scope, AggregatedTimeKeeper & time_keeper);
+
+  /**
+   * @brief Construct a new ScopedAggregatedTimeTrack object, which does nothing if time_keeper is
+   * null, so that the tracking can be disabled by a parameter
+   *
+   * @param scope Scope to be tracked, which must outlive this object
+   * @param time_keeper Pointer to the AggregatedTimeKeeper object, or nullptr
+   */
+  ScopedAggregatedTimeTrack(const TimeTrackScope & scope, AggregatedTimeKeeper * time_keeper);
+
+  ScopedAggregatedTimeTrack(const ScopedAggregatedTimeTrack &) = delete;
+  ScopedAggregatedTimeTrack & operator=(const ScopedAggregatedTimeTrack &) = delete;
+  ScopedAggregatedTimeTrack(ScopedAggregatedTimeTrack &&) = delete;
+  ScopedAggregatedTimeTrack & operator=(ScopedAggregatedTimeTrack &&) = delete;
+
+  /**
+   * @brief Destroy the ScopedAggregatedTimeTrack object, ending the tracking of the scope
+   */
+  ~ScopedAggregatedTimeTrack();
+
+private:
+  const TimeTrackScope & scope_;        //!< Scope being tracked
+  AggregatedTimeKeeper * time_keeper_;  //!< Pointer to the AggregatedTimeKeeper object
+};
+
+/**
+ * @brief Class for automatically tracking the processing time of a scope with either
+ * AggregatedTimeKeeper or TimeKeeper, so that a node can switch between them by a parameter
+ *
+ * The scope is tracked only with AggregatedTimeKeeper if it is not null, and otherwise with
+ * TimeKeeper if it is not null.
+ *
+ * @code
+ * static const TimeTrackScope scope(__func__);
+ * ScopedSelectedTimeTrack st(scope, time_keeper_.get(), aggregated_time_keeper_.get());
+ * @endcode
+ */
+class ScopedSelectedTimeTrack
+{
+public:
+  /**
+   * @brief Construct a new ScopedSelectedTimeTrack object
+   *
+   * @param scope Scope to be tracked, which must outlive this object
+   * @param time_keeper Pointer to the TimeKeeper object, or nullptr
+   * @param aggregated_time_keeper Pointer to the AggregatedTimeKeeper object, or nullptr
+   */
+  ScopedSelectedTimeTrack(
+    const TimeTrackScope & scope, TimeKeeper * time_keeper,
+    AggregatedTimeKeeper * aggregated_time_keeper);
+
+  ScopedSelectedTimeTrack(const ScopedSelectedTimeTrack &) = delete;
+  ScopedSelectedTimeTrack & operator=(const ScopedSelectedTimeTrack &) = delete;
+  ScopedSelectedTimeTrack(ScopedSelectedTimeTrack &&) = delete;
+  ScopedSelectedTimeTrack & operator=(ScopedSelectedTimeTrack &&) = delete;
+
+  /**
+   * @brief Destroy the ScopedSelectedTimeTrack object, ending the tracking of the scope
+   */
+  ~ScopedSelectedTimeTrack();
+
+private:
+  const TimeTrackScope & scope_;                   //!< Scope being tracked
+  TimeKeeper * time_keeper_;                       //!< TimeKeeper in use, or nullptr
+  AggregatedTimeKeeper * aggregated_time_keeper_;  //!< AggregatedTimeKeeper in use, or nullptr
+  std::string name_;                               //!< Name of the scope given to TimeKeeper
+};
+
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__SYSTEM__AGGREGATED_TIME_KEEPER_HPP_
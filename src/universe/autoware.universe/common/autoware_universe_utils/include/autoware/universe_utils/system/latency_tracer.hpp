@@ -0,0 +1,233 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__UNIVERSE_UTILS__SYSTEM__LATENCY_TRACER_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__SYSTEM__LATENCY_TRACER_HPP_
+
+#include <builtin_interfaces/msg/time.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+
+/**
+ * @brief One execution of a stage which consumed the message with input_id and produced the
+ * message with output_id. The ids are the header stamps of the messages in nanoseconds.
+ */
+struct LatencyTraceEvent
+{
+  uint64_t input_id{};
+  uint64_t output_id{};
+  int64_t start_ns{};  //!< @brief system clock, comparable between processes on the same host
+  int64_t publish_ns{};  //!< @brief when the output was published, i.e. available to consumers
+  int64_t end_ns{};
+  uint32_t stage_id{};
+};
+
+/**
+ * @brief Lock-free ring buffer with a single producer and a single consumer.
+ *
+ * The producer never waits. When the buffer is full, the new event is dropped and counted.
+ */
+class LatencyTraceRing
+{
+public:
+  /**
+   * @param capacity maximum number of events, rounded up to a power of two
+   */
+  explicit LatencyTraceRing(size_t capacity);
+
+  /**
+   * @brief Add an event. Called only by the owner thread.
+   * @return false if the buffer is full
+   */
+  bool push(const LatencyTraceEvent & event);
+
+  /**
+   * @brief Move all events to the output. Called only by the flushing thread.
+   * @return number of moved events
+   */
+  size_t pop_all(std::vector<LatencyTraceEvent> & output);
+
+  uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  std::vector<LatencyTraceEvent> events_;
+  uint64_t mask_;
+  alignas(64) std::atomic<uint64_t> head_{0};  //!< @brief next index to write
+  alignas(64) std::atomic<uint64_t> tail_{0};  //!< @brief next index to read
+  std::atomic<uint64_t> dropped_{0};
+};
+
+/**
+ * @brief Records latency trace events of the process and writes them to a CSV file.
+ *
+ * Each thread records to its own ring buffer, and a background thread writes the events
+ * periodically, so recording does not take a lock or do I/O.
+ * The file is read by the latency_trace_analyzer of autoware_processing_time_checker.
+ */
+class LatencyTracer
+{
+public:
+  /**
+   * @brief The tracer of the process. It is enabled if the environment variable
+   * AUTOWARE_LATENCY_TRACE_DIR is set, and writes to <dir>/latency_trace_<pid>.csv.
+   */
+  static LatencyTracer & instance();
+
+  /**
+   * @param output_path path of the CSV file, the tracer is disabled if it is empty
+   * @param ring_capacity number of events which can be buffered per thread
+   * @param flush_period period of writing the buffered events
+   */
+  explicit LatencyTracer(
+    const std::string & output_path, size_t ring_capacity = 4096,
+    std::chrono::milliseconds flush_period = std::chrono::milliseconds(100));
+  ~LatencyTracer();
+  LatencyTracer(const LatencyTracer &) = delete;
+  LatencyTracer & operator=(const LatencyTracer &) = delete;
+
+  bool enabled() const { return enabled_; }
+
+  /**
+   * @brief Register a stage, e.g. a node, and get the id to record its events with.
+   */
+  uint32_t register_stage(const std::string & name);
+
+  /**
+   * @brief Record an event to the ring buffer of the calling thread.
+   */
+  void record(const LatencyTraceEvent & event);
+
+  /**
+   * @brief Write all buffered events to the file.
+   */
+  void flush();
+
+  /**
+   * @brief Number of events dropped because a ring buffer was full.
+   */
+  uint64_t dropped() const;
+
+  static int64_t now_ns();
+
+private:
+  LatencyTraceRing * ring_of_this_thread();
+  void run_flush_loop();
+
+  const bool enabled_;
+  const uint64_t id_;
+  const size_t ring_capacity_;
+  const std::chrono::milliseconds flush_period_;
+
+  mutable std::mutex rings_mutex_;
+  std::unordered_map<std::thread::id, size_t> ring_indices_;
+  std::vector<std::unique_ptr<LatencyTraceRing>> rings_;
+  std::vector<std::string> stage_names_;
+
+  std::mutex flush_mutex_;
+  std::ofstream output_;
+  std::vector<LatencyTraceEvent> flush_buffer_;
+
+  std::mutex stop_mutex_;
+  std::condition_variable stop_cv_;
+  bool stop_{false};
+  std::thread flush_thread_;
+};
+
+/**
+ * @brief Convert a header stamp to the id of the message.
+ */
+inline uint64_t to_latency_trace_id(const builtin_interfaces::msg::Time & stamp)
+{
+  return static_cast<uint64_t>(stamp.sec) * 1000000000ULL + stamp.nanosec;
+}
+
+/**
+ * @brief A traced stage, usually one per node.
+ */
+class LatencyTraceStage
+{
+public:
+  explicit LatencyTraceStage(
+    const std::string & name, LatencyTracer & tracer = LatencyTracer::instance());
+
+  bool enabled() const { return tracer_.enabled(); }
+
+  void record(
+    uint64_t input_id, uint64_t output_id, int64_t start_ns, int64_t publish_ns,
+    int64_t end_ns) const;
+
+private:
+  LatencyTracer & tracer_;
+  uint32_t id_{};
+};
+
+/**
+ * @brief Record one execution of a stage from the construction to the destruction.
+ *
+ * An event is recorded for each input when the output is set, so returning early without
+ * publishing records nothing. set_output() must be called right after the publication, since
+ * its time is the one consumers are matched against. Nothing is done when tracing is disabled.
+ *
+ * @code
+ * void Node::on_objects(const PredictedObjects::ConstSharedPtr msg)
+ * {
+ *   LatencyTraceScope trace_scope(*latency_trace_stage_);
+ *   trace_scope.add_input(msg->header.stamp);
+ *   ...
+ *   pub_->publish(output);
+ *   trace_scope.set_output(output.header.stamp);
+ * }
+ * @endcode
+ */
+class LatencyTraceScope
+{
+public:
+  explicit LatencyTraceScope(const LatencyTraceStage & stage);
+  ~LatencyTraceScope();
+  LatencyTraceScope(const LatencyTraceScope &) = delete;
+  LatencyTraceScope & operator=(const LatencyTraceScope &) = delete;
+
+  void add_input(const builtin_interfaces::msg::Time & stamp);
+  void set_output(const builtin_interfaces::msg::Time & stamp);
+
+private:
+  static constexpr size_t max_inputs = 4;
+
+  const LatencyTraceStage & stage_;
+  const bool enabled_;
+  int64_t start_ns_{};
+  std::array<uint64_t, max_inputs> input_ids_{};
+  size_t num_inputs_{0};
+  uint64_t output_id_{};
+  int64_t publish_ns_{};
+  bool has_output_{false};
+};
+
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__SYSTEM__LATENCY_TRACER_HPP_
@@ -0,0 +1,222 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__UNIVERSE_UTILS__SYSTEM__PROC_SAMPLER_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__SYSTEM__PROC_SAMPLER_HPP_
+
+#include <sys/types.h>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+
+/**
+ * @brief A procfs or sysfs file which is kept open and read again from the beginning.
+ *
+ * The read buffer is kept between reads, so that sampling the same file does not allocate
+ * once the buffer has grown to the size of the file.
+ */
+class ProcFile
+{
+public:
+  ProcFile() = default;
+  explicit ProcFile(const std::string & path) { open(path); }
+  ~ProcFile() { close(); }
+  ProcFile(const ProcFile &) = delete;
+  ProcFile & operator=(const ProcFile &) = delete;
+  ProcFile(ProcFile && other) noexcept;
+  ProcFile & operator=(ProcFile && other) noexcept;
+
+  /**
+   * @brief Open the file, closing the previous one. The buffer is reused.
+   * @return false if the file cannot be opened, errno is set in that case.
+   */
+  bool open(const std::string & path);
+  bool open(const char * path);
+  void close();
+  bool is_open() const { return fd_ >= 0; }
+
+  /**
+   * @brief Read the whole content of the file.
+   * @return The content, which is valid until the next read, or std::nullopt on error.
+   */
+  std::optional<std::string_view> read();
+
+private:
+  int fd_{-1};
+  std::vector<char> buffer_;
+};
+
+/**
+ * @brief Fields of /proc/<pid>/stat, see proc(5).
+ */
+struct ProcessStat
+{
+  std::array<char, 16> command{};  //!< @brief executable name, null-terminated
+  char state{};                    //!< @brief R, S, D, Z, T, ...
+  int64_t priority{};
+  int64_t nice{};
+  uint64_t user_ticks{};    //!< @brief utime in clock ticks
+  uint64_t system_ticks{};  //!< @brief stime in clock ticks
+  uint64_t virtual_bytes{};
+  uint64_t resident_pages{};
+
+  uint64_t cpu_ticks() const { return user_ticks + system_ticks; }
+};
+
+/**
+ * @brief Fields of /proc/<pid>/statm in pages.
+ */
+struct ProcessMemory
+{
+  uint64_t size_pages{};
+  uint64_t resident_pages{};
+  uint64_t shared_pages{};
+};
+
+/**
+ * @brief The aggregated "cpu" line of /proc/stat in clock ticks.
+ */
+struct CpuTimes
+{
+  uint64_t user{};
+  uint64_t nice{};
+  uint64_t system{};
+  uint64_t idle{};
+  uint64_t iowait{};
+  uint64_t irq{};
+  uint64_t softirq{};
+  uint64_t steal{};
+
+  uint64_t total() const { return user + nice + system + idle + iowait + irq + softirq + steal; }
+};
+
+/**
+ * @brief Fields of /proc/meminfo in KiB.
+ */
+struct MemoryInfo
+{
+  uint64_t total_kib{};
+  uint64_t free_kib{};
+  uint64_t available_kib{};
+  uint64_t buffers_kib{};
+  uint64_t cached_kib{};
+  uint64_t swap_total_kib{};
+  uint64_t swap_free_kib{};
+};
+
+/**
+ * @brief Fields of one device of /proc/diskstats.
+ */
+struct DiskStat
+{
+  uint64_t read_ios{};
+  uint64_t read_sectors{};
+  uint64_t write_ios{};
+  uint64_t write_sectors{};
+};
+
+bool parse_process_stat(std::string_view content, ProcessStat & stat);
+bool parse_process_memory(std::string_view content, ProcessMemory & memory);
+bool parse_cpu_times(std::string_view content, CpuTimes & times);
+bool parse_memory_info(std::string_view content, MemoryInfo & info);
+bool parse_disk_stat(std::string_view content, std::string_view device, DiskStat & stat);
+
+/**
+ * @brief Number of clock ticks per second, the unit of the CPU times.
+ */
+int64_t clock_ticks_per_second();
+
+/**
+ * @brief Page size in bytes, the unit of the process memory.
+ */
+int64_t page_size_bytes();
+
+/**
+ * @brief Sample the stat and statm files of one process, e.g. of the own process.
+ */
+class ProcessSampler
+{
+public:
+  explicit ProcessSampler(pid_t pid);
+  pid_t pid() const { return pid_; }
+
+  bool read_stat(ProcessStat & stat);
+  bool read_memory(ProcessMemory & memory);
+
+private:
+  pid_t pid_;
+  ProcFile stat_file_;
+  ProcFile statm_file_;
+};
+
+/**
+ * @brief Sample the system wide files /proc/stat, /proc/meminfo and /proc/diskstats.
+ */
+class SystemSampler
+{
+public:
+  SystemSampler();
+
+  bool read_cpu_times(CpuTimes & times);
+  bool read_memory_info(MemoryInfo & info);
+  bool read_disk_stat(std::string_view device, DiskStat & stat);
+
+private:
+  ProcFile stat_file_;
+  ProcFile meminfo_file_;
+  ProcFile diskstats_file_;
+};
+
+/**
+ * @brief An input of a hwmon device, e.g. a voltage of the super I/O chip.
+ */
+class HwmonSensor
+{
+public:
+  /**
+   * @brief Find the first input of /sys/class/hwmon/hwmon* whose label matches the given text.
+   * @param [in] type input type, e.g. "in" for voltages and "temp" for temperatures
+   * @param [in] label text contained in "<label>:", e.g. "Vbat" or "in7:", where the label is the
+   * one of the driver and the input name such as "in7" if the input has no label file. Unlike the
+   * output of sensors, the label statements of sensors.conf are not applied.
+   * @param [in] root directory of the hwmon devices
+   * @return false if no input matches
+   */
+  bool find(
+    const std::string & type, const std::string & label,
+    const std::string & root = "/sys/class/hwmon");
+
+  /**
+   * @brief Read the raw value, e.g. millivolts for voltages and millidegrees for temperatures.
+   * @note The compute statements of sensors.conf are not applied.
+   */
+  std::optional<int64_t> read();
+
+  const std::string & path() const { return path_; }
+
+private:
+  std::string path_;
+  ProcFile input_file_;
+};
+
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__SYSTEM__PROC_SAMPLER_HPP_
@@ -193,6 +193,14 @@ public:
    */
   ScopedTimeTrack(const std::string & func_name, TimeKeeper & time_keeper);
 
+  /**
+   * @brief Construct a new ScopedTimeTrack object, which does nothing if time_keeper is null
+   *
+   * @param func_name Name of the function to be tracked
+   * @param time_keeper Pointer to the TimeKeeper object, or nullptr
+   */
+  ScopedTimeTrack(const std::string & func_name, TimeKeeper * time_keeper);
+
   ScopedTimeTrack(const ScopedTimeTrack &) = delete;
   ScopedTimeTrack & operator=(const ScopedTimeTrack &) = delete;
   ScopedTimeTrack(ScopedTimeTrack &&) = delete;
@@ -205,7 +213,7 @@ public:
 
 private:
   const std::string func_name_;  //!< Name of the function being tracked
-  TimeKeeper & time_keeper_;     //!< Reference to the TimeKeeper object
+  TimeKeeper * time_keeper_;     //!< Pointer to the TimeKeeper object
 };
 
 }  // namespace autoware::universe_utils
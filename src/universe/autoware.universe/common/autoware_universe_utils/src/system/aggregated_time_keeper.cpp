@@ -0,0 +1,402 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/system/aggregated_time_keeper.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+namespace autoware::universe_utils
+{
+namespace
+{
+struct ScopeRegistry
+{
+  std::mutex mutex;
+  std::deque<std::string> names;
+  std::unordered_map<std::string, uint32_t> ids;
+};
+
+ScopeRegistry & scope_registry()
+{
+  static ScopeRegistry registry;
+  return registry;
+}
+
+int highest_bit(const uint64_t value)
+{
+  return 63 - __builtin_clzll(value);
+}
+}  // namespace
+
+TimeTrackScope::TimeTrackScope(const std::string & name)
+{
+  auto & registry = scope_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  const auto [itr, inserted] =
+    registry.ids.emplace(name, static_cast<uint32_t>(registry.names.size()));
+  if (inserted) {
+    registry.names.push_back(name);
+  }
+  id_ = itr->second;
+}
+
+std::string TimeTrackScope::name_of(const uint32_t id)
+{
+  auto & registry = scope_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return registry.names.at(id);
+}
+
+size_t TimeHistogram::bucket_index(const uint64_t value_us)
+{
+  const auto value = std::min(value_us, max_value);
+  if (value < sub_bucket_count) {
+    return static_cast<size_t>(value);
+  }
+  // The bucket is determined by the highest bit and the following sub_bucket_bits bits.
+  const auto shift = static_cast<size_t>(highest_bit(value)) - sub_bucket_bits;
+  const auto sub_bucket = static_cast<size_t>(value >> shift) & (sub_bucket_count - 1);
+  return sub_bucket_count * (shift + 1) + sub_bucket;
+}
+
+uint64_t TimeHistogram::bucket_highest_value(const size_t index)
+{
+  if (index < sub_bucket_count) {
+    return index;
+  }
+  const auto shift = index / sub_bucket_count - 1;
+  const auto sub_bucket = index % sub_bucket_count;
+  return ((sub_bucket_count + sub_bucket + 1) << shift) - 1;
+}
+
+void TimeHistogram::add(const uint64_t value_us, const uint64_t count)
+{
+  add_to_bucket(bucket_index(value_us), count);
+  sum_us_ += value_us * count;
+}
+
+void TimeHistogram::add_to_bucket(const size_t index, const uint64_t count)
+{
+  counts_.at(index) += count;
+  count_ += count;
+}
+
+void TimeHistogram::merge(const TimeHistogram & other)
+{
+  for (size_t i = 0; i < num_buckets; ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  count_ += other.count_;
+  sum_us_ += other.sum_us_;
+}
+
+void TimeHistogram::clear()
+{
+  counts_.fill(0);
+  count_ = 0;
+  sum_us_ = 0;
+}
+
+double TimeHistogram::mean_ms() const
+{
+  if (count_ == 0) return 0.0;
+  return static_cast<double>(sum_us_) / static_cast<double>(count_) * 1e-3;
+}
+
+double TimeHistogram::percentile_ms(const double ratio) const
+{
+  if (count_ == 0) return 0.0;
+  const auto rank = std::max<uint64_t>(
+    1, static_cast<uint64_t>(std::ceil(std::clamp(ratio, 0.0, 1.0) * static_cast<double>(count_))));
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < num_buckets; ++i) {
+    cumulative += counts_[i];
+    if (cumulative >= rank) {
+      return static_cast<double>(bucket_highest_value(i)) * 1e-3;
+    }
+  }
+  return static_cast<double>(max_value) * 1e-3;
+}
+
+double TimeHistogram::max_ms() const
+{
+  return percentile_ms(1.0);
+}
+
+void AggregatedTimeKeeper::add_reporter(std::ostream * os)
+{
+  reporters_.emplace_back([os](const std::shared_ptr<ProcessingTimeNode> & node) {
+    *os << "==========================" << std::endl;
+    *os << node->to_string() << std::endl;
+  });
+}
+
+void AggregatedTimeKeeper::add_reporter(
+  rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr publisher)
+{
+  reporters_.emplace_back([publisher](const std::shared_ptr<ProcessingTimeNode> & node) {
+    publisher->publish(node->to_msg());
+  });
+}
+
+AggregatedTimeKeeper::Arena & AggregatedTimeKeeper::arena_of_this_thread()
+{
+  const auto thread_id = std::this_thread::get_id();
+  if (primary_thread_.load(std::memory_order_acquire) == thread_id) {
+    return *primary_arena_;
+  }
+
+  std::lock_guard<std::mutex> lock(arenas_mutex_);
+  auto & arena = arenas_[thread_id];
+  if (!arena) {
+    arena = std::make_unique<Arena>();
+    if (primary_thread_.load(std::memory_order_relaxed) == std::thread::id()) {
+      primary_arena_ = arena.get();
+      primary_thread_.store(thread_id, std::memory_order_release);
+    }
+  }
+  return *arena;
+}
+
+int32_t AggregatedTimeKeeper::find_or_add_child(
+  Arena & arena, const int32_t parent, const uint32_t scope_id)
+{
+  auto & first = parent < 0 ? arena.first_root : arena.nodes[parent].first_child;
+  for (auto index = first; index >= 0; index = arena.nodes[index].next_sibling) {
+    if (arena.nodes[index].scope_id == scope_id) {
+      return index;
+    }
+  }
+
+  const auto size = arena.size.load(std::memory_order_relaxed);
+  if (size == max_nodes_per_thread) {
+    return -1;
+  }
+  auto & node = arena.nodes[size];
+  node.scope_id = scope_id;
+  node.parent = parent;
+  node.next_sibling = first;
+  first = static_cast<int32_t>(size);
+  // Publish the node to the reporting thread.
+  arena.size.store(size + 1, std::memory_order_release);
+  return first;
+}
+
+void AggregatedTimeKeeper::start_track(const TimeTrackScope & scope)
+{
+  auto & arena = arena_of_this_thread();
+  // The scopes nested in an untracked scope are not tracked either, and each one is dropped.
+  const auto index =
+    arena.untracked_depth > 0 ? -1 : find_or_add_child(arena, arena.current, scope.id());
+  if (index < 0) {
+    ++arena.untracked_depth;
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  arena.current = index;
+  arena.nodes[index].start_time = std::chrono::steady_clock::now();
+}
+
+void AggregatedTimeKeeper::end_track(const TimeTrackScope & scope)
+{
+  const auto now = std::chrono::steady_clock::now();
+  auto & arena = arena_of_this_thread();
+  if (arena.untracked_depth > 0) {
+    --arena.untracked_depth;
+    return;
+  }
+  if (arena.current < 0) {
+    throw std::runtime_error(fmt::format(
+      "You must call start_track({}) first, but end_track({}) is called",
+      TimeTrackScope::name_of(scope.id()), TimeTrackScope::name_of(scope.id())));
+  }
+  auto & node = arena.nodes[arena.current];
+  if (node.scope_id != scope.id()) {
+    throw std::runtime_error(fmt::format(
+      "You must call end_track({}) first, but end_track({}) is called",
+      TimeTrackScope::name_of(node.scope_id), TimeTrackScope::name_of(scope.id())));
+  }
+
+  const auto processing_time_us = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::microseconds>(now - node.start_time).count());
+  node.buckets[TimeHistogram::bucket_index(processing_time_us)].fetch_add(
+    1, std::memory_order_relaxed);
+  node.sum_us.fetch_add(processing_time_us, std::memory_order_relaxed);
+  arena.current = node.parent;
+
+  if (arena.current < 0) {
+    report_if_due(now);
+  }
+}
+
+void AggregatedTimeKeeper::report_if_due(const std::chrono::steady_clock::time_point & now)
+{
+  const auto now_ns = to_ns(now);
+  auto next_report_time_ns = next_report_time_ns_.load(std::memory_order_relaxed);
+  if (now_ns < next_report_time_ns) {
+    return;
+  }
+  // Only one thread reports in a period.
+  const auto period_ns =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(report_period_).count();
+  if (!next_report_time_ns_.compare_exchange_strong(
+        next_report_time_ns, now_ns + period_ns, std::memory_order_relaxed)) {
+    return;
+  }
+  report();
+}
+
+void AggregatedTimeKeeper::report()
+{
+  std::lock_guard<std::mutex> report_lock(report_mutex_);
+
+  // Merge the trees of all threads by the path of the scopes.
+  struct MergedNode
+  {
+    uint32_t scope_id;
+    int32_t parent;
+    TimeHistogram histogram;
+  };
+  std::vector<MergedNode> merged_nodes;
+  std::map<std::pair<int32_t, uint32_t>, int32_t> merged_indices;
+  {
+    std::lock_guard<std::mutex> arenas_lock(arenas_mutex_);
+    for (const auto & [thread_id, arena] : arenas_) {
+      const auto size = arena->size.load(std::memory_order_acquire);
+      std::vector<int32_t> to_merged(size);
+      for (size_t i = 0; i < size; ++i) {
+        // The parent is always added before the child.
+        auto & node = arena->nodes[i];
+        const auto parent = node.parent < 0 ? -1 : to_merged.at(node.parent);
+        const auto [itr, inserted] = merged_indices.emplace(
+          std::make_pair(parent, node.scope_id), static_cast<int32_t>(merged_nodes.size()));
+        if (inserted) {
+          merged_nodes.push_back(MergedNode{node.scope_id, parent, TimeHistogram{}});
+        }
+        to_merged[i] = itr->second;
+
+        auto & histogram = merged_nodes.at(itr->second).histogram;
+        for (size_t j = 0; j < TimeHistogram::num_buckets; ++j) {
+          const auto count = node.buckets[j].exchange(0, std::memory_order_relaxed);
+          if (count > 0) {
+            histogram.add_to_bucket(j, count);
+          }
+        }
+        histogram.add_sum(node.sum_us.exchange(0, std::memory_order_relaxed));
+      }
+    }
+  }
+
+  // Keep the scopes run in the period and their ancestors. An ancestor may have no count when it
+  // has not ended yet, e.g. it straddles the report on another thread, and the samples of its
+  // children are already taken from the arenas, so they must not be dropped with it.
+  std::vector<bool> is_active(merged_nodes.size(), false);
+  for (size_t i = merged_nodes.size(); i-- > 0;) {
+    const auto & merged_node = merged_nodes.at(i);
+    if (merged_node.histogram.count() > 0) {
+      is_active.at(i) = true;
+    }
+    if (is_active.at(i) && merged_node.parent >= 0) {
+      is_active.at(merged_node.parent) = true;
+    }
+  }
+
+  // Build the trees in the same form as TimeKeeper.
+  std::vector<std::shared_ptr<ProcessingTimeNode>> time_nodes(merged_nodes.size());
+  std::vector<std::shared_ptr<ProcessingTimeNode>> roots;
+  for (size_t i = 0; i < merged_nodes.size(); ++i) {
+    if (!is_active.at(i)) {
+      continue;
+    }
+    const auto & merged_node = merged_nodes.at(i);
+    const auto & histogram = merged_node.histogram;
+    const auto name = TimeTrackScope::name_of(merged_node.scope_id);
+    if (merged_node.parent < 0) {
+      time_nodes.at(i) = std::make_shared<ProcessingTimeNode>(name);
+      roots.push_back(time_nodes.at(i));
+    } else {
+      time_nodes.at(i) = time_nodes.at(merged_node.parent)->add_child(name);
+    }
+    if (histogram.count() == 0) {
+      time_nodes.at(i)->set_comment("count: 0");
+      continue;
+    }
+    time_nodes.at(i)->set_time(histogram.percentile_ms(0.99));
+    time_nodes.at(i)->set_comment(fmt::format(
+      "count: {}, mean: {:.3f}ms, p50: {:.3f}ms, p90: {:.3f}ms, p99: {:.3f}ms, max: {:.3f}ms",
+      histogram.count(), histogram.mean_ms(), histogram.percentile_ms(0.5),
+      histogram.percentile_ms(0.9), histogram.percentile_ms(0.99), histogram.max_ms()));
+  }
+
+  for (const auto & root : roots) {
+    for (const auto & reporter : reporters_) {
+      reporter(root);
+    }
+  }
+}
+
+ScopedAggregatedTimeTrack::ScopedAggregatedTimeTrack(
+  const TimeTrackScope & scope, AggregatedTimeKeeper & time_keeper)
+: ScopedAggregatedTimeTrack(scope, &time_keeper)
+{
+}
+
+ScopedAggregatedTimeTrack::ScopedAggregatedTimeTrack(
+  const TimeTrackScope & scope, AggregatedTimeKeeper * time_keeper)
+: scope_(scope), time_keeper_(time_keeper)
+{
+  if (time_keeper_) {
+    time_keeper_->start_track(scope_);
+  }
+}
+
+ScopedAggregatedTimeTrack::~ScopedAggregatedTimeTrack()  // NOLINT
+{
+  if (time_keeper_) {
+    time_keeper_->end_track(scope_);
+  }
+}
+
+ScopedSelectedTimeTrack::ScopedSelectedTimeTrack(
+  const TimeTrackScope & scope, TimeKeeper * time_keeper,
+  AggregatedTimeKeeper * aggregated_time_keeper)
+: scope_(scope),
+  time_keeper_(aggregated_time_keeper ? nullptr : time_keeper),
+  aggregated_time_keeper_(aggregated_time_keeper)
+{
+  if (aggregated_time_keeper_) {
+    aggregated_time_keeper_->start_track(scope_);
+  } else if (time_keeper_) {
+    name_ = TimeTrackScope::name_of(scope_.id());
+    time_keeper_->start_track(name_);
+  }
+}
+
+ScopedSelectedTimeTrack::~ScopedSelectedTimeTrack()  // NOLINT
+{
+  if (aggregated_time_keeper_) {
+    aggregated_time_keeper_->end_track(scope_);
+  } else if (time_keeper_) {
+    time_keeper_->end_track(name_);
+  }
+}
+
+}  // namespace autoware::universe_utils
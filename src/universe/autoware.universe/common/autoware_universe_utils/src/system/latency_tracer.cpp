@@ -0,0 +1,223 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/system/latency_tracer.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+namespace
+{
+std::atomic<uint64_t> next_tracer_id{1};
+
+size_t round_up_to_power_of_two(size_t value)
+{
+  size_t result = 1;
+  while (result < value) result <<= 1;
+  return result;
+}
+
+std::string default_output_path()
+{
+  const char * dir = std::getenv("AUTOWARE_LATENCY_TRACE_DIR");
+  if (dir == nullptr || dir[0] == '\0') return "";
+  return std::string(dir) + "/latency_trace_" + std::to_string(getpid()) + ".csv";
+}
+}  // namespace
+
+LatencyTraceRing::LatencyTraceRing(size_t capacity)
+: events_(round_up_to_power_of_two(std::max<size_t>(capacity, 1))), mask_(events_.size() - 1)
+{
+}
+
+bool LatencyTraceRing::push(const LatencyTraceEvent & event)
+{
+  const auto head = head_.load(std::memory_order_relaxed);
+  if (head - tail_.load(std::memory_order_acquire) == events_.size()) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  events_[head & mask_] = event;
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+size_t LatencyTraceRing::pop_all(std::vector<LatencyTraceEvent> & output)
+{
+  const auto tail = tail_.load(std::memory_order_relaxed);
+  const auto head = head_.load(std::memory_order_acquire);
+  for (auto i = tail; i != head; ++i) {
+    output.push_back(events_[i & mask_]);
+  }
+  tail_.store(head, std::memory_order_release);
+  return head - tail;
+}
+
+LatencyTracer & LatencyTracer::instance()
+{
+  static LatencyTracer tracer(default_output_path());
+  return tracer;
+}
+
+LatencyTracer::LatencyTracer(
+  const std::string & output_path, size_t ring_capacity, std::chrono::milliseconds flush_period)
+: enabled_(!output_path.empty()),
+  id_(next_tracer_id.fetch_add(1)),
+  ring_capacity_(ring_capacity),
+  flush_period_(flush_period)
+{
+  if (!enabled_) return;
+
+  output_.open(output_path, std::ios::out | std::ios::trunc);
+  output_ << "stage,input_id,output_id,start_ns,publish_ns,end_ns,thread\n";
+  flush_thread_ = std::thread([this]() { run_flush_loop(); });
+}
+
+LatencyTracer::~LatencyTracer()
+{
+  if (!enabled_) return;
+
+  {
+    std::lock_guard<std::mutex> lock(stop_mutex_);
+    stop_ = true;
+  }
+  stop_cv_.notify_all();
+  flush_thread_.join();
+  flush();
+}
+
+uint32_t LatencyTracer::register_stage(const std::string & name)
+{
+  std::lock_guard<std::mutex> lock(rings_mutex_);
+  for (size_t i = 0; i < stage_names_.size(); ++i) {
+    if (stage_names_[i] == name) return static_cast<uint32_t>(i);
+  }
+  stage_names_.push_back(name);
+  return static_cast<uint32_t>(stage_names_.size() - 1);
+}
+
+LatencyTraceRing * LatencyTracer::ring_of_this_thread()
+{
+  // Cache the ring so that only the first event of each thread takes the lock.
+  thread_local uint64_t cached_tracer_id = 0;
+  thread_local LatencyTraceRing * cached_ring = nullptr;
+  if (cached_tracer_id == id_) return cached_ring;
+
+  std::lock_guard<std::mutex> lock(rings_mutex_);
+  const auto [itr, inserted] = ring_indices_.emplace(std::this_thread::get_id(), rings_.size());
+  if (inserted) {
+    rings_.push_back(std::make_unique<LatencyTraceRing>(ring_capacity_));
+  }
+  cached_tracer_id = id_;
+  cached_ring = rings_.at(itr->second).get();
+  return cached_ring;
+}
+
+void LatencyTracer::record(const LatencyTraceEvent & event)
+{
+  if (!enabled_) return;
+  ring_of_this_thread()->push(event);
+}
+
+void LatencyTracer::flush()
+{
+  if (!enabled_) return;
+
+  std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+  std::lock_guard<std::mutex> rings_lock(rings_mutex_);
+  for (size_t thread = 0; thread < rings_.size(); ++thread) {
+    flush_buffer_.clear();
+    rings_[thread]->pop_all(flush_buffer_);
+    for (const auto & event : flush_buffer_) {
+      output_ << stage_names_.at(event.stage_id) << ',' << event.input_id << ','
+              << event.output_id << ',' << event.start_ns << ',' << event.publish_ns << ','
+              << event.end_ns << ',' << thread << '\n';
+    }
+  }
+  output_.flush();
+}
+
+uint64_t LatencyTracer::dropped() const
+{
+  std::lock_guard<std::mutex> lock(rings_mutex_);
+  uint64_t dropped = 0;
+  for (const auto & ring : rings_) dropped += ring->dropped();
+  return dropped;
+}
+
+int64_t LatencyTracer::now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::system_clock::now().time_since_epoch())
+    .count();
+}
+
+void LatencyTracer::run_flush_loop()
+{
+  std::unique_lock<std::mutex> lock(stop_mutex_);
+  while (!stop_cv_.wait_for(lock, flush_period_, [this]() { return stop_; })) {
+    lock.unlock();
+    flush();
+    lock.lock();
+  }
+}
+
+LatencyTraceStage::LatencyTraceStage(const std::string & name, LatencyTracer & tracer)
+: tracer_(tracer)
+{
+  if (tracer_.enabled()) id_ = tracer_.register_stage(name);
+}
+
+void LatencyTraceStage::record(
+  uint64_t input_id, uint64_t output_id, int64_t start_ns, int64_t publish_ns, int64_t end_ns) const
+{
+  tracer_.record(LatencyTraceEvent{input_id, output_id, start_ns, publish_ns, end_ns, id_});
+}
+
+LatencyTraceScope::LatencyTraceScope(const LatencyTraceStage & stage)
+: stage_(stage), enabled_(stage.enabled())
+{
+  if (enabled_) start_ns_ = LatencyTracer::now_ns();
+}
+
+LatencyTraceScope::~LatencyTraceScope()
+{
+  if (!enabled_ || !has_output_) return;
+  const auto end_ns = LatencyTracer::now_ns();
+  for (size_t i = 0; i < num_inputs_; ++i) {
+    stage_.record(input_ids_[i], output_id_, start_ns_, publish_ns_, end_ns);
+  }
+}
+
+void LatencyTraceScope::add_input(const builtin_interfaces::msg::Time & stamp)
+{
+  if (!enabled_ || num_inputs_ == max_inputs) return;
+  input_ids_[num_inputs_++] = to_latency_trace_id(stamp);
+}
+
+void LatencyTraceScope::set_output(const builtin_interfaces::msg::Time & stamp)
+{
+  if (!enabled_) return;
+  publish_ns_ = LatencyTracer::now_ns();
+  output_id_ = to_latency_trace_id(stamp);
+  has_output_ = true;
+}
+
+}  // namespace autoware::universe_utils
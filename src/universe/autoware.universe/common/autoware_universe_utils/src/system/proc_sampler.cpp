@@ -0,0 +1,326 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/system/proc_sampler.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <filesystem>
+#include <string>
+#include <utility>
+
+namespace autoware::universe_utils
+{
+namespace
+{
+constexpr size_t initial_buffer_size = 4096;
+
+bool is_space(const char c)
+{
+  return c == ' ' || c == '\t' || c == '\n';
+}
+
+// Split the next whitespace separated token from the content.
+std::string_view next_token(std::string_view & content)
+{
+  size_t begin = 0;
+  while (begin < content.size() && is_space(content[begin])) ++begin;
+  size_t end = begin;
+  while (end < content.size() && !is_space(content[end])) ++end;
+  const auto token = content.substr(begin, end - begin);
+  content.remove_prefix(end);
+  return token;
+}
+
+template <typename T>
+bool parse_number(std::string_view token, T & value)
+{
+  const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+  return ec == std::errc() && ptr == token.data() + token.size();
+}
+
+template <typename T>
+bool next_number(std::string_view & content, T & value)
+{
+  return parse_number(next_token(content), value);
+}
+
+bool skip_tokens(std::string_view & content, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    if (next_token(content).empty()) return false;
+  }
+  return true;
+}
+
+// Get the line which starts with the given key, without the key.
+std::optional<std::string_view> find_line(std::string_view content, std::string_view key)
+{
+  size_t pos = 0;
+  while (pos < content.size()) {
+    const auto end = std::min(content.find('\n', pos), content.size());
+    const auto line = content.substr(pos, end - pos);
+    if (line.substr(0, key.size()) == key) return line.substr(key.size());
+    pos = end + 1;
+  }
+  return std::nullopt;
+}
+}  // namespace
+
+ProcFile::ProcFile(ProcFile && other) noexcept
+: fd_(std::exchange(other.fd_, -1)), buffer_(std::move(other.buffer_))
+{
+}
+
+ProcFile & ProcFile::operator=(ProcFile && other) noexcept
+{
+  if (this != &other) {
+    close();
+    fd_ = std::exchange(other.fd_, -1);
+    buffer_ = std::move(other.buffer_);
+  }
+  return *this;
+}
+
+bool ProcFile::open(const std::string & path)
+{
+  return open(path.c_str());
+}
+
+bool ProcFile::open(const char * path)
+{
+  close();
+  fd_ = ::open(path, O_RDONLY | O_CLOEXEC);
+  if (buffer_.empty()) buffer_.resize(initial_buffer_size);
+  return is_open();
+}
+
+void ProcFile::close()
+{
+  if (is_open()) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+}
+
+std::optional<std::string_view> ProcFile::read()
+{
+  if (!is_open()) return std::nullopt;
+
+  // Reading from the offset 0 makes the kernel generate the content again.
+  size_t size = 0;
+  while (true) {
+    if (size == buffer_.size()) buffer_.resize(buffer_.size() * 2);
+    const auto result = ::pread(fd_, buffer_.data() + size, buffer_.size() - size, size);
+    if (result < 0) {
+      if (errno == EINTR) continue;
+      return std::nullopt;
+    }
+    if (result == 0) break;
+    size += static_cast<size_t>(result);
+  }
+  return std::string_view(buffer_.data(), size);
+}
+
+bool parse_process_stat(std::string_view content, ProcessStat & stat)
+{
+  // The command is enclosed in parentheses and may contain spaces and parentheses.
+  const auto open = content.find('(');
+  const auto close = content.rfind(')');
+  if (open == std::string_view::npos || close == std::string_view::npos || close < open) {
+    return false;
+  }
+  const auto command = content.substr(open + 1, close - open - 1);
+  const auto length = std::min(command.size(), stat.command.size() - 1);
+  std::copy_n(command.data(), length, stat.command.data());
+  stat.command[length] = '\0';
+
+  // Fields from (3) state.
+  content.remove_prefix(close + 1);
+  const auto state = next_token(content);
+  if (state.size() != 1) return false;
+  stat.state = state.front();
+
+  // (4) ppid to (13) cmajflt are not used.
+  return skip_tokens(content, 10) && next_number(content, stat.user_ticks) &&
+         next_number(content, stat.system_ticks) && skip_tokens(content, 2) &&
+         next_number(content, stat.priority) && next_number(content, stat.nice) &&
+         skip_tokens(content, 3) && next_number(content, stat.virtual_bytes) &&
+         next_number(content, stat.resident_pages);
+}
+
+bool parse_process_memory(std::string_view content, ProcessMemory & memory)
+{
+  return next_number(content, memory.size_pages) && next_number(content, memory.resident_pages) &&
+         next_number(content, memory.shared_pages);
+}
+
+bool parse_cpu_times(std::string_view content, CpuTimes & times)
+{
+  auto line = find_line(content, "cpu ");
+  if (!line) return false;
+  // The steal time is missing on old kernels.
+  times.steal = 0;
+  const bool result = next_number(*line, times.user) && next_number(*line, times.nice) &&
+                      next_number(*line, times.system) && next_number(*line, times.idle) &&
+                      next_number(*line, times.iowait) && next_number(*line, times.irq) &&
+                      next_number(*line, times.softirq);
+  if (result) next_number(*line, times.steal);
+  return result;
+}
+
+bool parse_memory_info(std::string_view content, MemoryInfo & info)
+{
+  const auto read = [content](std::string_view key, uint64_t & value) {
+    auto line = find_line(content, key);
+    return line && next_number(*line, value);
+  };
+  return read("MemTotal:", info.total_kib) && read("MemFree:", info.free_kib) &&
+         read("MemAvailable:", info.available_kib) && read("Buffers:", info.buffers_kib) &&
+         read("Cached:", info.cached_kib) && read("SwapTotal:", info.swap_total_kib) &&
+         read("SwapFree:", info.swap_free_kib);
+}
+
+bool parse_disk_stat(std::string_view content, std::string_view device, DiskStat & stat)
+{
+  while (!content.empty()) {
+    const auto end = std::min(content.find('\n'), content.size());
+    auto line = content.substr(0, end);
+    content.remove_prefix(std::min(end + 1, content.size()));
+
+    // major minor name reads reads_merged sectors_read time_reading writes writes_merged ...
+    if (!skip_tokens(line, 2) || next_token(line) != device) continue;
+    return next_number(line, stat.read_ios) && skip_tokens(line, 1) &&
+           next_number(line, stat.read_sectors) && skip_tokens(line, 1) &&
+           next_number(line, stat.write_ios) && skip_tokens(line, 1) &&
+           next_number(line, stat.write_sectors);
+  }
+  return false;
+}
+
+int64_t clock_ticks_per_second()
+{
+  static const int64_t ticks = sysconf(_SC_CLK_TCK);
+  return ticks;
+}
+
+int64_t page_size_bytes()
+{
+  static const int64_t size = sysconf(_SC_PAGESIZE);
+  return size;
+}
+
+ProcessSampler::ProcessSampler(pid_t pid) : pid_(pid)
+{
+  const auto dir = "/proc/" + std::to_string(pid);
+  stat_file_.open(dir + "/stat");
+  statm_file_.open(dir + "/statm");
+}
+
+bool ProcessSampler::read_stat(ProcessStat & stat)
+{
+  const auto content = stat_file_.read();
+  return content && parse_process_stat(*content, stat);
+}
+
+bool ProcessSampler::read_memory(ProcessMemory & memory)
+{
+  const auto content = statm_file_.read();
+  return content && parse_process_memory(*content, memory);
+}
+
+SystemSampler::SystemSampler()
+{
+  stat_file_.open("/proc/stat");
+  meminfo_file_.open("/proc/meminfo");
+  diskstats_file_.open("/proc/diskstats");
+}
+
+bool SystemSampler::read_cpu_times(CpuTimes & times)
+{
+  const auto content = stat_file_.read();
+  return content && parse_cpu_times(*content, times);
+}
+
+bool SystemSampler::read_memory_info(MemoryInfo & info)
+{
+  const auto content = meminfo_file_.read();
+  return content && parse_memory_info(*content, info);
+}
+
+bool SystemSampler::read_disk_stat(std::string_view device, DiskStat & stat)
+{
+  const auto content = diskstats_file_.read();
+  return content && parse_disk_stat(*content, device, stat);
+}
+
+bool HwmonSensor::find(
+  const std::string & type, const std::string & label, const std::string & root)
+{
+  namespace fs = std::filesystem;
+
+  path_.clear();
+  input_file_.close();
+
+  // Sort the devices and inputs for a deterministic result.
+  std::error_code ec;
+  std::vector<fs::path> inputs;
+  for (const auto & device : fs::directory_iterator(root, ec)) {
+    for (const auto & entry : fs::directory_iterator(device.path(), ec)) {
+      const auto name = entry.path().filename().string();
+      const auto suffix = std::string("_input");
+      if (name.rfind(type, 0) != 0 || name.size() <= type.size() + suffix.size()) continue;
+      if (name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) continue;
+      inputs.push_back(entry.path());
+    }
+  }
+  std::sort(inputs.begin(), inputs.end());
+
+  for (const auto & input : inputs) {
+    // The label file is optional, then tools like sensors show the input name.
+    auto input_name = input.filename().string();
+    input_name.resize(input_name.size() - std::string("_input").size());
+    auto label_path = input;
+    label_path.replace_filename(input_name + "_label");
+
+    std::string input_label = input_name;
+    ProcFile label_file;
+    if (label_file.open(label_path.string())) {
+      if (auto content = label_file.read()) {
+        while (!content->empty() && is_space(content->back())) content->remove_suffix(1);
+        input_label.assign(content->data(), content->size());
+      }
+    }
+    // Match with the line of the input such as "in7:" or "Vbat:".
+    if ((input_label + ":").find(label) == std::string::npos) continue;
+    if (!input_file_.open(input.string())) continue;
+    path_ = input.string();
+    return true;
+  }
+  return false;
+}
+
+std::optional<int64_t> HwmonSensor::read()
+{
+  auto content = input_file_.read();
+  int64_t value;
+  if (!content || !next_number(*content, value)) return std::nullopt;
+  return value;
+}
+
+}  // namespace autoware::universe_utils
@@ -186,14 +186,23 @@ void TimeKeeper::report()
 }
 
 ScopedTimeTrack::ScopedTimeTrack(const std::string & func_name, TimeKeeper & time_keeper)
+: ScopedTimeTrack(func_name, &time_keeper)
+{
+}
+
+ScopedTimeTrack::ScopedTimeTrack(const std::string & func_name, TimeKeeper * time_keeper)
 : func_name_(func_name), time_keeper_(time_keeper)
 {
-  time_keeper_.start_track(func_name_);
+  if (time_keeper_) {
+    time_keeper_->start_track(func_name_);
+  }
 }
 
 ScopedTimeTrack::~ScopedTimeTrack()  // NOLINT
 {
-  time_keeper_.end_track(func_name_);
+  if (time_keeper_) {
+    time_keeper_->end_track(func_name_);
+  }
 }
 
 }  // namespace autoware::universe_utils
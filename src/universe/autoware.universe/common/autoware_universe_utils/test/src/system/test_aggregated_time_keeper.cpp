@@ -0,0 +1,204 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "autoware/universe_utils/system/aggregated_time_keeper.hpp"
+#include "autoware/universe_utils/system/time_keeper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(system, TimeHistogram)
+{
+  using autoware::universe_utils::TimeHistogram;
+
+  // The buckets are contiguous and the highest value of a bucket is within 1/16 of the value.
+  size_t previous_index = 0;
+  for (uint64_t value = 0; value < 100000; ++value) {
+    const auto index = TimeHistogram::bucket_index(value);
+    EXPECT_TRUE(index == previous_index || index == previous_index + 1) << value;
+    EXPECT_GE(TimeHistogram::bucket_highest_value(index), value);
+    EXPECT_LE(TimeHistogram::bucket_highest_value(index), value + value / 16);
+    previous_index = index;
+  }
+  EXPECT_EQ(
+    TimeHistogram::bucket_index(TimeHistogram::max_value), TimeHistogram::num_buckets - 1);
+  EXPECT_EQ(TimeHistogram::bucket_index(UINT64_MAX), TimeHistogram::num_buckets - 1);
+
+  TimeHistogram histogram;
+  EXPECT_DOUBLE_EQ(histogram.percentile_ms(0.99), 0.0);
+  for (uint64_t value_us = 1; value_us <= 1000; ++value_us) {
+    histogram.add(value_us * 10);
+  }
+  EXPECT_EQ(histogram.count(), 1000u);
+  EXPECT_NEAR(histogram.mean_ms(), 5.005, 1e-9);
+  EXPECT_NEAR(histogram.percentile_ms(0.5), 5.0, 5.0 / 16);
+  EXPECT_NEAR(histogram.percentile_ms(0.99), 9.9, 9.9 / 16);
+  EXPECT_NEAR(histogram.max_ms(), 10.0, 10.0 / 16);
+
+  TimeHistogram other;
+  other.add(1000000, 1000);
+  histogram.merge(other);
+  EXPECT_EQ(histogram.count(), 2000u);
+  EXPECT_NEAR(histogram.percentile_ms(0.99), 1000.0, 1000.0 / 16);
+
+  histogram.clear();
+  EXPECT_EQ(histogram.count(), 0u);
+}
+
+TEST(system, AggregatedTimeKeeper)
+{
+  using autoware::universe_utils::AggregatedTimeKeeper;
+  using autoware::universe_utils::ScopedAggregatedTimeTrack;
+  using autoware::universe_utils::TimeTrackScope;
+
+  std::ostringstream oss;
+  AggregatedTimeKeeper time_keeper(std::chrono::hours(1), &oss);
+
+  const auto run = [&time_keeper]() {
+    static const TimeTrackScope main_scope("main_func");
+    static const TimeTrackScope scope_a("funcA");
+    static const TimeTrackScope scope_b("funcB");
+    for (int i = 0; i < 10; ++i) {
+      ScopedAggregatedTimeTrack st{main_scope, time_keeper};
+      {
+        ScopedAggregatedTimeTrack st{scope_a, time_keeper};
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      {
+        ScopedAggregatedTimeTrack st{scope_b, time_keeper};
+        // The same scope under another parent is a different node.
+        ScopedAggregatedTimeTrack st_a{scope_a, time_keeper};
+      }
+    }
+  };
+  std::thread thread(run);
+  run();
+  thread.join();
+
+  // Nothing is reported before the report period.
+  EXPECT_TRUE(oss.str().empty());
+
+  time_keeper.report();
+  const auto output = oss.str();
+  EXPECT_NE(output.find("main_func"), std::string::npos);
+  EXPECT_NE(output.find("├── funcA"), std::string::npos);
+  EXPECT_NE(output.find("└── funcB"), std::string::npos);
+  EXPECT_NE(output.find("    └── funcA"), std::string::npos);
+  // The trees of both threads are merged.
+  EXPECT_NE(output.find("count: 20,"), std::string::npos);
+  EXPECT_EQ(output.find("count: 10,"), std::string::npos);
+
+  // The histograms are restarted after the report.
+  oss.str("");
+  time_keeper.report();
+  EXPECT_TRUE(oss.str().empty());
+
+  static const TimeTrackScope scope_c("funcC");
+  time_keeper.start_track(scope_c);
+  EXPECT_THROW(time_keeper.end_track(TimeTrackScope("funcD")), std::runtime_error);
+  time_keeper.end_track(scope_c);
+  EXPECT_EQ(time_keeper.dropped(), 0u);
+}
+
+TEST(system, AggregatedTimeKeeper_full_arena)
+{
+  using autoware::universe_utils::AggregatedTimeKeeper;
+  using autoware::universe_utils::TimeTrackScope;
+
+  std::ostringstream oss;
+  AggregatedTimeKeeper time_keeper(std::chrono::hours(1), &oss);
+
+  // Nest more scopes than the capacity of the arena.
+  std::vector<TimeTrackScope> scopes;
+  for (size_t i = 0; i < AggregatedTimeKeeper::max_nodes_per_thread + 2; ++i) {
+    scopes.emplace_back("nested_" + std::to_string(i));
+  }
+  for (const auto & scope : scopes) {
+    time_keeper.start_track(scope);
+  }
+  for (auto itr = scopes.rbegin(); itr != scopes.rend(); ++itr) {
+    time_keeper.end_track(*itr);
+  }
+  // Both scopes beyond the capacity are dropped, not only the outermost one.
+  EXPECT_EQ(time_keeper.dropped(), 2u);
+
+  time_keeper.report();
+  EXPECT_NE(oss.str().find("nested_63"), std::string::npos);
+  EXPECT_EQ(oss.str().find("nested_64"), std::string::npos);
+}
+
+TEST(system, AggregatedTimeKeeper_open_parent)
+{
+  using autoware::universe_utils::AggregatedTimeKeeper;
+  using autoware::universe_utils::TimeTrackScope;
+
+  std::ostringstream oss;
+  AggregatedTimeKeeper time_keeper(std::chrono::hours(1), &oss);
+
+  static const TimeTrackScope parent_scope("open_parent");
+  static const TimeTrackScope child_scope("closed_child");
+  time_keeper.start_track(parent_scope);
+  time_keeper.start_track(child_scope);
+  time_keeper.end_track(child_scope);
+
+  // The child is reported under its parent which has not ended yet.
+  time_keeper.report();
+  EXPECT_NE(oss.str().find("open_parent"), std::string::npos);
+  EXPECT_NE(oss.str().find("count: 0"), std::string::npos);
+  EXPECT_NE(oss.str().find("closed_child"), std::string::npos);
+  EXPECT_NE(oss.str().find("count: 1,"), std::string::npos);
+
+  // The parent is counted in the next period, without the child already reported.
+  oss.str("");
+  time_keeper.end_track(parent_scope);
+  time_keeper.report();
+  EXPECT_NE(oss.str().find("open_parent"), std::string::npos);
+  EXPECT_NE(oss.str().find("count: 1,"), std::string::npos);
+  EXPECT_EQ(oss.str().find("closed_child"), std::string::npos);
+}
+
+TEST(system, ScopedSelectedTimeTrack)
+{
+  using autoware::universe_utils::AggregatedTimeKeeper;
+  using autoware::universe_utils::ScopedSelectedTimeTrack;
+  using autoware::universe_utils::TimeKeeper;
+  using autoware::universe_utils::TimeTrackScope;
+
+  static const TimeTrackScope scope("selected_func");
+
+  // Only AggregatedTimeKeeper is used if both are given.
+  std::ostringstream time_keeper_oss;
+  std::ostringstream aggregated_oss;
+  TimeKeeper time_keeper(&time_keeper_oss);
+  AggregatedTimeKeeper aggregated_time_keeper(std::chrono::hours(1), &aggregated_oss);
+  {
+    ScopedSelectedTimeTrack st(scope, &time_keeper, &aggregated_time_keeper);
+  }
+  aggregated_time_keeper.report();
+  EXPECT_TRUE(time_keeper_oss.str().empty());
+  EXPECT_NE(aggregated_oss.str().find("selected_func"), std::string::npos);
+
+  // TimeKeeper is used without AggregatedTimeKeeper.
+  {
+    ScopedSelectedTimeTrack st(scope, &time_keeper, nullptr);
+  }
+  EXPECT_NE(time_keeper_oss.str().find("selected_func"), std::string::npos);
+
+  // Nothing is tracked without both.
+  EXPECT_NO_THROW(ScopedSelectedTimeTrack(scope, nullptr, nullptr));
+}
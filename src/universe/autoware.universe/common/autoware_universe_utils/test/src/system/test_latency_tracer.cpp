@@ -0,0 +1,125 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/system/latency_tracer.hpp"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::vector<std::string> read_lines(const std::filesystem::path & path)
+{
+  std::ifstream file(path);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(file, line);) lines.push_back(line);
+  return lines;
+}
+
+builtin_interfaces::msg::Time make_stamp(int32_t sec, uint32_t nanosec)
+{
+  builtin_interfaces::msg::Time stamp;
+  stamp.sec = sec;
+  stamp.nanosec = nanosec;
+  return stamp;
+}
+}  // namespace
+
+TEST(system, LatencyTraceRing)
+{
+  using autoware::universe_utils::LatencyTraceEvent;
+
+  // The capacity is rounded up to 4.
+  autoware::universe_utils::LatencyTraceRing ring(3);
+  std::vector<LatencyTraceEvent> events;
+  for (uint64_t i = 0; i < 6; ++i) {
+    EXPECT_EQ(ring.push(LatencyTraceEvent{i, i, 0, 0, 0, 0}), i < 4);
+  }
+  EXPECT_EQ(ring.dropped(), 2u);
+  EXPECT_EQ(ring.pop_all(events), 4u);
+  EXPECT_EQ(events.back().input_id, 3u);
+
+  // The index wraps around.
+  for (uint64_t i = 0; i < 3; ++i) EXPECT_TRUE(ring.push(LatencyTraceEvent{10 + i, 0, 0, 0, 0, 0}));
+  events.clear();
+  EXPECT_EQ(ring.pop_all(events), 3u);
+  EXPECT_EQ(events.front().input_id, 10u);
+  EXPECT_EQ(ring.pop_all(events), 0u);
+}
+
+TEST(system, LatencyTracer)
+{
+  using autoware::universe_utils::LatencyTracer;
+  using autoware::universe_utils::LatencyTraceScope;
+  using autoware::universe_utils::LatencyTraceStage;
+
+  const auto path = std::filesystem::temp_directory_path() /
+                    ("test_latency_tracer_" + std::to_string(getpid()) + ".csv");
+  {
+    LatencyTracer tracer(path.string());
+    ASSERT_TRUE(tracer.enabled());
+    LatencyTraceStage stage_a("/a", tracer);
+    LatencyTraceStage stage_b("/b", tracer);
+
+    {
+      LatencyTraceScope scope(stage_a);
+      scope.add_input(make_stamp(1, 0));
+      scope.add_input(make_stamp(1, 500));
+      scope.set_output(make_stamp(2, 0));
+    }
+    {
+      // Nothing is recorded without the output.
+      LatencyTraceScope scope(stage_a);
+      scope.add_input(make_stamp(3, 0));
+    }
+    std::thread thread([&stage_b]() {
+      for (int i = 0; i < 10; ++i) stage_b.record(i, i, i, i + 1, i + 2);
+    });
+    thread.join();
+    tracer.flush();
+
+    const auto lines = read_lines(path);
+    ASSERT_EQ(lines.size(), 13u);
+    EXPECT_EQ(lines[0], "stage,input_id,output_id,start_ns,publish_ns,end_ns,thread");
+    EXPECT_EQ(lines[1].rfind("/a,1000000000,2000000000,", 0), 0u);
+    EXPECT_EQ(lines[2].rfind("/a,1000000500,2000000000,", 0), 0u);
+    {
+      // The publication is between the start and the end of the scope.
+      std::istringstream fields(lines[1]);
+      std::vector<std::string> values;
+      for (std::string value; std::getline(fields, value, ',');) values.push_back(value);
+      ASSERT_EQ(values.size(), 7u);
+      EXPECT_LE(std::stoll(values[3]), std::stoll(values[4]));
+      EXPECT_LE(std::stoll(values[4]), std::stoll(values[5]));
+    }
+    EXPECT_EQ(lines[12], "/b,9,9,9,10,11,1");
+    EXPECT_EQ(tracer.dropped(), 0u);
+  }
+  std::filesystem::remove(path);
+
+  // A disabled tracer does not record anything.
+  LatencyTracer disabled("");
+  EXPECT_FALSE(disabled.enabled());
+  LatencyTraceStage stage("/c", disabled);
+  LatencyTraceScope scope(stage);
+  scope.add_input(make_stamp(1, 0));
+  scope.set_output(make_stamp(1, 0));
+}
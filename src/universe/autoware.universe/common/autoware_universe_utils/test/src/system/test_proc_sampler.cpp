@@ -0,0 +1,144 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/system/proc_sampler.hpp"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+TEST(system, ProcSampler_parse_process_stat)
+{
+  using autoware::universe_utils::parse_process_stat;
+  using autoware::universe_utils::ProcessStat;
+
+  // The command contains spaces and parentheses.
+  const std::string content =
+    "3017 (my (proc) x) S 2531 2531 2531 0 -1 4194304 82 0 0 0 1234 56 0 0 -2 5 1 0 403404 "
+    "2703360 289 18446744073709551615 94288585154560 0 0 0 0 0 0 0 0 0 17 0 0 0 0 0 0\n";
+  ProcessStat stat;
+  ASSERT_TRUE(parse_process_stat(content, stat));
+  EXPECT_STREQ(stat.command.data(), "my (proc) x");
+  EXPECT_EQ(stat.state, 'S');
+  EXPECT_EQ(stat.user_ticks, 1234u);
+  EXPECT_EQ(stat.system_ticks, 56u);
+  EXPECT_EQ(stat.cpu_ticks(), 1290u);
+  EXPECT_EQ(stat.priority, -2);
+  EXPECT_EQ(stat.nice, 5);
+  EXPECT_EQ(stat.virtual_bytes, 2703360u);
+  EXPECT_EQ(stat.resident_pages, 289u);
+
+  EXPECT_FALSE(parse_process_stat("3017 (cat) R 2531", stat));
+  EXPECT_FALSE(parse_process_stat("", stat));
+}
+
+TEST(system, ProcSampler_parse_system_files)
+{
+  using autoware::universe_utils::CpuTimes;
+  using autoware::universe_utils::DiskStat;
+  using autoware::universe_utils::MemoryInfo;
+  using autoware::universe_utils::ProcessMemory;
+
+  ProcessMemory memory;
+  ASSERT_TRUE(autoware::universe_utils::parse_process_memory("660 312 287 5 0 123 0\n", memory));
+  EXPECT_EQ(memory.size_pages, 660u);
+  EXPECT_EQ(memory.resident_pages, 312u);
+  EXPECT_EQ(memory.shared_pages, 287u);
+
+  CpuTimes times;
+  ASSERT_TRUE(autoware::universe_utils::parse_cpu_times(
+    "cpu  100 1 20 300 4 5 6 7 0 0\ncpu0 50 0 10 150 2 2 3 3 0 0\nintr 1 2 3\n", times));
+  EXPECT_EQ(times.user, 100u);
+  EXPECT_EQ(times.idle, 300u);
+  EXPECT_EQ(times.total(), 443u);
+
+  MemoryInfo info;
+  ASSERT_TRUE(autoware::universe_utils::parse_memory_info(
+    "MemTotal:        6147400 kB\nMemFree:         4065444 kB\nMemAvailable:    5506392 kB\n"
+    "Buffers:          403288 kB\nCached:          1181604 kB\nSwapCached:            0 kB\n"
+    "SwapTotal:       2097148 kB\nSwapFree:        2097000 kB\n",
+    info));
+  EXPECT_EQ(info.total_kib, 6147400u);
+  EXPECT_EQ(info.available_kib, 5506392u);
+  EXPECT_EQ(info.cached_kib, 1181604u);
+  EXPECT_EQ(info.swap_free_kib, 2097000u);
+
+  const std::string diskstats =
+    "   8       0 sda 100 2 3000 40 500 6 7000 80 0 90 120 0 0 0 0\n"
+    "   8       1 sda1 10 0 300 4 50 0 700 8 0 9 12 0 0 0 0\n";
+  DiskStat disk;
+  ASSERT_TRUE(autoware::universe_utils::parse_disk_stat(diskstats, "sda1", disk));
+  EXPECT_EQ(disk.read_ios, 10u);
+  EXPECT_EQ(disk.read_sectors, 300u);
+  EXPECT_EQ(disk.write_ios, 50u);
+  EXPECT_EQ(disk.write_sectors, 700u);
+  EXPECT_FALSE(autoware::universe_utils::parse_disk_stat(diskstats, "sdb", disk));
+}
+
+TEST(system, ProcSampler_read_own_process)
+{
+  using autoware::universe_utils::ProcessSampler;
+  using autoware::universe_utils::SystemSampler;
+
+  ProcessSampler process(getpid());
+  autoware::universe_utils::ProcessStat stat;
+  autoware::universe_utils::ProcessMemory memory;
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(process.read_stat(stat));
+    ASSERT_TRUE(process.read_memory(memory));
+  }
+  EXPECT_EQ(stat.state, 'R');
+  EXPECT_GT(memory.resident_pages, 0u);
+
+  SystemSampler system;
+  autoware::universe_utils::CpuTimes times;
+  autoware::universe_utils::MemoryInfo info;
+  EXPECT_TRUE(system.read_cpu_times(times));
+  EXPECT_TRUE(system.read_memory_info(info));
+  EXPECT_GT(times.total(), 0u);
+  EXPECT_GT(info.total_kib, 0u);
+}
+
+TEST(system, ProcSampler_hwmon)
+{
+  namespace fs = std::filesystem;
+  const auto root = fs::temp_directory_path() / ("test_proc_sampler_" + std::to_string(getpid()));
+  fs::create_directories(root / "hwmon0");
+  fs::create_directories(root / "hwmon1");
+  std::ofstream(root / "hwmon0" / "in0_input") << "1000\n";
+  std::ofstream(root / "hwmon1" / "in0_input") << "12000\n";
+  std::ofstream(root / "hwmon1" / "in0_label") << "+12V\n";
+  std::ofstream(root / "hwmon1" / "in1_input") << "3040\n";
+  std::ofstream(root / "hwmon1" / "in1_label") << "Vbat\n";
+
+  autoware::universe_utils::HwmonSensor sensor;
+  ASSERT_TRUE(sensor.find("in", "Vbat", root.string()));
+  EXPECT_EQ(sensor.read(), 3040);
+  std::ofstream(root / "hwmon1" / "in1_input") << "2900\n";
+  EXPECT_EQ(sensor.read(), 2900);
+
+  // The input name is used without the label file.
+  ASSERT_TRUE(sensor.find("in", "in0:", root.string()));
+  EXPECT_EQ(sensor.read(), 1000);
+  EXPECT_EQ(sensor.path(), (root / "hwmon0" / "in0_input").string());
+
+  EXPECT_FALSE(sensor.find("in", "in1:", root.string()));
+  EXPECT_FALSE(sensor.find("in", "VCore", root.string()));
+  EXPECT_FALSE(sensor.read());
+
+  fs::remove_all(root);
+}
@@ -18,6 +18,7 @@
 #include "osqp/glob_opts.h"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <vector>
 
@@ -38,6 +39,9 @@ struct CSC_Matrix
 CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat);
 /// \brief Calculate upper trapezoidal CSC matrix from square Eigen matrix
 CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat);
+/// Convert a sparse matrix keeping its explicit zeros, so that the pattern is kept.
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat);
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat);
 /// \brief Print the given CSC matrix to the standard output
 void printCSCMatrix(const CSC_Matrix & csc_mat);
 
@@ -116,7 +116,7 @@ public:
   // Setter functions for warm start
   bool setWarmStart(
     const std::vector<double> & primal_variables, const std::vector<double> & dual_variables);
-  bool setPrimalVariables(const std::vector<double> & primal_variables);
+  bool setPrimalVariables(const std::vector<double> & primal_variables) override;
   bool setDualVariables(const std::vector<double> & dual_variables);
 
 private:
@@ -136,6 +136,11 @@ private:
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) override;
 
+  void initializeProblemImpl(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l,
+    const std::vector<double> & u) override;
+
   void initializeCSCProblemImpl(
     CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
     const std::vector<double> & u);
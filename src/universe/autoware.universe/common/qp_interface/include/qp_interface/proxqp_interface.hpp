@@ -22,6 +22,7 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -42,14 +43,22 @@ public:
   void updateEpsRel(const double eps_rel) override;
   void updateVerbose(const bool verbose) override;
 
+  bool setPrimalVariables(const std::vector<double> & primal_variables) override;
+
 private:
   proxsuite::proxqp::Settings<double> settings_{};
   std::shared_ptr<proxsuite::proxqp::sparse::QP<double, int>> qp_ptr_{nullptr};
+  std::optional<Eigen::VectorXd> primal_initial_guess_{std::nullopt};
 
   void initializeProblemImpl(
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) override;
 
+  void initializeProblemImpl(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l,
+    const std::vector<double> & u) override;
+
   std::vector<double> optimizeImpl() override;
 };
 }  // namespace autoware::common
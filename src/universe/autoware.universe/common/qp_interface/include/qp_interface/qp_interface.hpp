@@ -16,6 +16,7 @@
 #define QP_INTERFACE__QP_INTERFACE_HPP_
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <optional>
 #include <string>
@@ -32,6 +33,19 @@ public:
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u);
 
+  /// \brief Optimize the problem given as sparse matrices. If the sparsity patterns of P and A are
+  /// kept between the calls, the solver can update the problem without analyzing it again.
+  std::vector<double> optimize(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
+  /// \brief Set the initial guess of the primal variables for the next optimization.
+  /// \return false if the solver does not support it
+  virtual bool setPrimalVariables([[maybe_unused]] const std::vector<double> & primal_variables)
+  {
+    return false;
+  }
+
   virtual bool isSolved() const = 0;
   virtual int getIterationNumber() const = 0;
   virtual std::string getStatus() const = 0;
@@ -47,14 +61,29 @@ protected:
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u);
 
+  void initializeProblem(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
   virtual void initializeProblemImpl(
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) = 0;
 
+  virtual void initializeProblemImpl(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l,
+    const std::vector<double> & u) = 0;
+
   virtual std::vector<double> optimizeImpl() = 0;
 
   std::optional<size_t> variables_num_{std::nullopt};
   std::optional<size_t> constraints_num_{std::nullopt};
+
+private:
+  static void checkProblemSize(
+    const Eigen::Index P_rows, const Eigen::Index P_cols, const Eigen::Index A_rows,
+    const Eigen::Index A_cols, const std::vector<double> & q, const std::vector<double> & l,
+    const std::vector<double> & u);
 };
 }  // namespace autoware::common
 
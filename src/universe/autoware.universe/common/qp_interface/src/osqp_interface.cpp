@@ -76,6 +76,15 @@ void OSQPInterface::initializeProblemImpl(
   initializeCSCProblemImpl(P_csc, A_csc, q, l, u);
 }
 
+void OSQPInterface::initializeProblemImpl(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P);
+  CSC_Matrix A_csc = calCSCMatrix(A);
+  initializeCSCProblemImpl(P_csc, A_csc, q, l, u);
+}
+
 void OSQPInterface::initializeCSCProblemImpl(
   CSC_Matrix P_csc, CSC_Matrix A_csc, const std::vector<double> & q, const std::vector<double> & l,
   const std::vector<double> & u)
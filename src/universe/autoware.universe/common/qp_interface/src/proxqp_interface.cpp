@@ -32,6 +32,15 @@ ProxQPInterface::ProxQPInterface(
 void ProxQPInterface::initializeProblemImpl(
   const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
   const std::vector<double> & l, const std::vector<double> & u)
+{
+  const Eigen::SparseMatrix<double> P_sparse = P.sparseView();
+  const Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+  initializeProblemImpl(P_sparse, A_sparse, q, l, u);
+}
+
+void ProxQPInterface::initializeProblemImpl(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
 {
   const size_t variables_num = q.size();
   const size_t constraints_num = l.size();
@@ -55,32 +64,31 @@ void ProxQPInterface::initializeProblemImpl(
       variables_num, 0, constraints_num);
   }
 
-  settings_.initial_guess =
-    enable_warm_start ? proxsuite::proxqp::InitialGuessStatus::WARM_START_WITH_PREVIOUS_RESULT
-                      : proxsuite::proxqp::InitialGuessStatus::NO_INITIAL_GUESS;
+  const bool has_initial_guess =
+    primal_initial_guess_ && static_cast<size_t>(primal_initial_guess_->size()) == variables_num;
+  if (!has_initial_guess) {
+    primal_initial_guess_ = std::nullopt;
+  }
 
-  qp_ptr_->settings = settings_;
+  if (has_initial_guess) {
+    settings_.initial_guess = proxsuite::proxqp::InitialGuessStatus::WARM_START;
+  } else {
+    settings_.initial_guess =
+      enable_warm_start ? proxsuite::proxqp::InitialGuessStatus::WARM_START_WITH_PREVIOUS_RESULT
+                        : proxsuite::proxqp::InitialGuessStatus::NO_INITIAL_GUESS;
+  }
 
-  Eigen::SparseMatrix<double> P_sparse(variables_num, constraints_num);
-  P_sparse = P.sparseView();
+  qp_ptr_->settings = settings_;
 
-  // NOTE: const std vector cannot be converted to eigen vector
-  std::vector<double> non_const_q = q;
-  Eigen::VectorXd eigen_q =
-    Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(non_const_q.data(), non_const_q.size());
-  std::vector<double> l_std_vec = l;
-  Eigen::VectorXd eigen_l =
-    Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(l_std_vec.data(), l_std_vec.size());
-  std::vector<double> u_std_vec = u;
-  Eigen::VectorXd eigen_u =
-    Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(u_std_vec.data(), u_std_vec.size());
+  const Eigen::Map<const Eigen::VectorXd> eigen_q(q.data(), q.size());
+  const Eigen::Map<const Eigen::VectorXd> eigen_l(l.data(), l.size());
+  const Eigen::Map<const Eigen::VectorXd> eigen_u(u.data(), u.size());
 
+  // NOTE: The update keeps the symbolic analysis, which requires the same sparsity patterns.
   if (enable_warm_start) {
-    qp_ptr_->update(
-      P_sparse, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A.sparseView(), eigen_l, eigen_u);
+    qp_ptr_->update(P, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A, eigen_l, eigen_u);
   } else {
-    qp_ptr_->init(
-      P_sparse, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A.sparseView(), eigen_l, eigen_u);
+    qp_ptr_->init(P, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A, eigen_l, eigen_u);
   }
 }
 
@@ -99,6 +107,13 @@ void ProxQPInterface::updateVerbose(const bool is_verbose)
   settings_.verbose = is_verbose;
 }
 
+bool ProxQPInterface::setPrimalVariables(const std::vector<double> & primal_variables)
+{
+  primal_initial_guess_ =
+    Eigen::Map<const Eigen::VectorXd>(primal_variables.data(), primal_variables.size());
+  return true;
+}
+
 bool ProxQPInterface::isSolved() const
 {
   if (qp_ptr_) {
@@ -142,7 +157,12 @@ std::string ProxQPInterface::getStatus() const
 
 std::vector<double> ProxQPInterface::optimizeImpl()
 {
-  qp_ptr_->solve();
+  if (primal_initial_guess_) {
+    qp_ptr_->solve(*primal_initial_guess_, proxsuite::nullopt, proxsuite::nullopt);
+    primal_initial_guess_ = std::nullopt;
+  } else {
+    qp_ptr_->solve();
+  }
 
   std::vector<double> result;
   for (Eigen::Index i = 0; i < qp_ptr_->results.x.size(); ++i) {
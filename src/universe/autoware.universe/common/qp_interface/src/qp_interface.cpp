@@ -20,37 +20,57 @@
 
 namespace autoware::common
 {
-void QPInterface::initializeProblem(
-  const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
-  const std::vector<double> & l, const std::vector<double> & u)
+void QPInterface::checkProblemSize(
+  const Eigen::Index P_rows, const Eigen::Index P_cols, const Eigen::Index A_rows,
+  const Eigen::Index A_cols, const std::vector<double> & q, const std::vector<double> & l,
+  const std::vector<double> & u)
 {
   // check if arguments are valid
   std::stringstream ss;
-  if (P.rows() != P.cols()) {
-    ss << "P.rows() and P.cols() are not the same. P.rows() = " << P.rows()
-       << ", P.cols() = " << P.cols();
+  if (P_rows != P_cols) {
+    ss << "P.rows() and P.cols() are not the same. P.rows() = " << P_rows
+       << ", P.cols() = " << P_cols;
     throw std::invalid_argument(ss.str());
   }
-  if (P.rows() != static_cast<int>(q.size())) {
-    ss << "P.rows() and q.size() are not the same. P.rows() = " << P.rows()
+  if (P_rows != static_cast<int>(q.size())) {
+    ss << "P.rows() and q.size() are not the same. P.rows() = " << P_rows
        << ", q.size() = " << q.size();
     throw std::invalid_argument(ss.str());
   }
-  if (P.rows() != A.cols()) {
-    ss << "P.rows() and A.cols() are not the same. P.rows() = " << P.rows()
-       << ", A.cols() = " << A.cols();
+  if (P_rows != A_cols) {
+    ss << "P.rows() and A.cols() are not the same. P.rows() = " << P_rows
+       << ", A.cols() = " << A_cols;
     throw std::invalid_argument(ss.str());
   }
-  if (A.rows() != static_cast<int>(l.size())) {
-    ss << "A.rows() and l.size() are not the same. A.rows() = " << A.rows()
+  if (A_rows != static_cast<int>(l.size())) {
+    ss << "A.rows() and l.size() are not the same. A.rows() = " << A_rows
        << ", l.size() = " << l.size();
     throw std::invalid_argument(ss.str());
   }
-  if (A.rows() != static_cast<int>(u.size())) {
-    ss << "A.rows() and u.size() are not the same. A.rows() = " << A.rows()
+  if (A_rows != static_cast<int>(u.size())) {
+    ss << "A.rows() and u.size() are not the same. A.rows() = " << A_rows
        << ", u.size() = " << u.size();
     throw std::invalid_argument(ss.str());
   }
+}
+
+void QPInterface::initializeProblem(
+  const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  checkProblemSize(P.rows(), P.cols(), A.rows(), A.cols(), q, l, u);
+
+  initializeProblemImpl(P, A, q, l, u);
+
+  variables_num_ = q.size();
+  constraints_num_ = l.size();
+}
+
+void QPInterface::initializeProblem(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  checkProblemSize(P.rows(), P.cols(), A.rows(), A.cols(), q, l, u);
 
   initializeProblemImpl(P, A, q, l, u);
 
@@ -67,4 +87,14 @@ std::vector<double> QPInterface::optimize(
 
   return result;
 }
+
+std::vector<double> QPInterface::optimize(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  initializeProblem(P, A, q, l, u);
+  const auto result = optimizeImpl();
+
+  return result;
+}
 }  // namespace autoware::common
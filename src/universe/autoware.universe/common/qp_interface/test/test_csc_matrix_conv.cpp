@@ -164,6 +164,33 @@ TEST(TestCscMatrixConv, Trapezoidal)
     EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
   }
 }
+TEST(TestCscMatrixConv, Sparse)
+{
+  using autoware::common::calCSCMatrix;
+  using autoware::common::calCSCMatrixTrapezoidal;
+  using autoware::common::CSC_Matrix;
+
+  // The explicit zero at (1, 1) is kept to keep the sparsity pattern.
+  Eigen::SparseMatrix<double> square(3, 3);
+  square.insert(0, 0) = 1.0;
+  square.insert(1, 0) = 2.0;
+  square.insert(0, 1) = 2.0;
+  square.insert(1, 1) = 0.0;
+  square.insert(2, 2) = 3.0;
+  square.makeCompressed();
+
+  const CSC_Matrix square_m = calCSCMatrix(square);
+  EXPECT_EQ(square_m.vals_, (std::vector<c_float>{1.0, 2.0, 2.0, 0.0, 3.0}));
+  EXPECT_EQ(square_m.row_idxs_, (std::vector<c_int>{0, 1, 0, 1, 2}));
+  EXPECT_EQ(square_m.col_idxs_, (std::vector<c_int>{0, 2, 4, 5}));
+
+  const CSC_Matrix square_trap_m = calCSCMatrixTrapezoidal(square);
+  EXPECT_EQ(square_trap_m.vals_, (std::vector<c_float>{1.0, 2.0, 0.0, 3.0}));
+  EXPECT_EQ(square_trap_m.row_idxs_, (std::vector<c_int>{0, 0, 1, 2}));
+  EXPECT_EQ(square_trap_m.col_idxs_, (std::vector<c_int>{0, 1, 3, 4}));
+
+  EXPECT_THROW(calCSCMatrixTrapezoidal(Eigen::SparseMatrix<double>(1, 2)), std::invalid_argument);
+}
 TEST(TestCscMatrixConv, Print)
 {
   using autoware::common::calCSCMatrix;
@@ -80,4 +80,31 @@ TEST(TestProxqpInterface, BasicQp)
     }
   }
 }
+
+TEST(TestProxqpInterface, SparseQp)
+{
+  const Eigen::MatrixXd P = (Eigen::MatrixXd(2, 2) << 4, 1, 1, 2).finished();
+  const Eigen::MatrixXd A = (Eigen::MatrixXd(4, 2) << 1, 1, 1, 0, 0, 1, 0, 1).finished();
+  const Eigen::SparseMatrix<double> P_sparse = P.sparseView();
+  const Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+  const std::vector<double> q = {1.0, 1.0};
+  const std::vector<double> l = {1.0, 0.0, 0.0, -std::numeric_limits<double>::max()};
+  const std::vector<double> u = {1.0, 0.7, 0.7, std::numeric_limits<double>::max()};
+
+  autoware::common::ProxQPInterface proxqp(true, 4000, 1e-9, 1e-9, false);
+  for (int i = 0; i < 2; ++i) {
+    const auto solution = proxqp.QPInterface::optimize(P_sparse, A_sparse, q, l, u);
+    EXPECT_EQ(proxqp.getStatus(), "PROXQP_SOLVED");
+    ASSERT_EQ(solution.size(), size_t(2));
+    EXPECT_NEAR(solution[0], 0.3, 1.0e-8);
+    EXPECT_NEAR(solution[1], 0.7, 1.0e-8);
+  }
+
+  // The solver starts from the given primal variables.
+  EXPECT_TRUE(proxqp.setPrimalVariables({0.3, 0.7}));
+  const auto solution = proxqp.QPInterface::optimize(P_sparse, A_sparse, q, l, u);
+  EXPECT_EQ(proxqp.getStatus(), "PROXQP_SOLVED");
+  EXPECT_NEAR(solution[0], 0.3, 1.0e-8);
+  EXPECT_NEAR(solution[1], 0.7, 1.0e-8);
+}
 }  // namespace
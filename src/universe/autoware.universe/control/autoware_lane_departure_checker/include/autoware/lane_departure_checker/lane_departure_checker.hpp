@@ -42,13 +42,16 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 namespace autoware::lane_departure_checker
 {
+using autoware::universe_utils::Box2d;
 using autoware::universe_utils::LinearRing2d;
+using autoware::universe_utils::Point2d;
 using autoware::universe_utils::PoseDeviation;
 using autoware::universe_utils::Segment2d;
 using autoware_planning_msgs::msg::LaneletRoute;
@@ -57,6 +60,8 @@ using autoware_planning_msgs::msg::TrajectoryPoint;
 using tier4_planning_msgs::msg::PathWithLaneId;
 using TrajectoryPoints = std::vector<TrajectoryPoint>;
 typedef boost::geometry::index::rtree<Segment2d, boost::geometry::index::rstar<16>> SegmentRtree;
+typedef boost::geometry::index::rtree<std::pair<Box2d, size_t>, boost::geometry::index::rstar<16>>
+  LaneletRtree;
 
 struct Param
 {
@@ -74,6 +79,11 @@ struct Param
   double ego_nearest_yaw_threshold{0.0};
 };
 
+/**
+ * @note the route lanelets, the shoulder lanelets and the uncrossable boundaries are indexed in
+ * LaneDepartureChecker::update when the map, the route or boundary_types_to_detect change, i.e.
+ * the route lanelets are assumed to be the same while the map and the route are the same
+ */
 struct Input
 {
   nav_msgs::msg::Odometry::ConstSharedPtr current_odom{};
@@ -156,6 +166,36 @@ private:
   Param param_;
   std::shared_ptr<autoware::vehicle_info_utils::VehicleInfo> vehicle_info_ptr_;
 
+  // route lanelets followed by shoulder lanelets with the polygons converted once
+  struct DrivableLanelet
+  {
+    lanelet::ConstLanelet lanelet;
+    lanelet::BasicPolygon2d polygon;
+  };
+
+  // indices of the inputs reused until the map, the route or the boundary types change
+  lanelet::LaneletMapConstPtr indexed_lanelet_map_{};
+  LaneletRoute::ConstSharedPtr indexed_route_{};
+  std::pair<size_t, size_t> indexed_lanelets_size_{};
+  std::vector<DrivableLanelet> drivable_lanelets_{};
+  LaneletRtree drivable_lanelets_rtree_{};
+  lanelet::LaneletMapConstPtr boundaries_lanelet_map_{};
+  std::vector<std::string> indexed_boundary_types_{};
+  SegmentRtree uncrossable_boundaries_{};
+
+  void updateIndices(const Input & input);
+
+  lanelet::ConstLanelets getCandidateDrivableLanelets(
+    const std::vector<LinearRing2d> & vehicle_footprints) const;
+
+  // the last lanelet which contained a point is tested first for the next point
+  bool isInDrivableArea(const Point2d & point, std::optional<size_t> & last_lanelet_idx) const;
+
+  bool isOutOfDrivableArea(
+    const LinearRing2d & vehicle_footprint, std::optional<size_t> & last_lanelet_idx) const;
+
+  bool willLeaveDrivableArea(const std::vector<LinearRing2d> & vehicle_footprints) const;
+
   static PoseDeviation calcTrajectoryDeviation(
     const Trajectory & trajectory, const geometry_msgs::msg::Pose & pose,
     const double dist_threshold, const double yaw_threshold);
@@ -170,12 +210,14 @@ private:
   double calcMaxSearchLengthForBoundaries(const Trajectory & trajectory) const;
 
   static SegmentRtree extractUncrossableBoundaries(
-    const lanelet::LaneletMap & lanelet_map, const geometry_msgs::msg::Point & ego_point,
-    const double max_search_length, const std::vector<std::string> & boundary_types_to_detect);
+    const lanelet::LaneletMap & lanelet_map,
+    const std::vector<std::string> & boundary_types_to_detect);
 
+  // only the segments closer to the ego point than max_search_length are considered
   bool willCrossBoundary(
     const std::vector<LinearRing2d> & vehicle_footprints,
-    const SegmentRtree & uncrossable_segments) const;
+    const SegmentRtree & uncrossable_segments, const geometry_msgs::msg::Point & ego_point,
+    const double max_search_length) const;
 
   lanelet::BasicPolygon2d toBasicPolygon2D(const LinearRing2d & footprint_hull) const;
   autoware::universe_utils::Polygon2d toPolygon2D(const lanelet::BasicPolygon2d & poly) const;
@@ -28,6 +28,7 @@
 namespace autoware::lane_departure_checker::utils
 {
 using autoware::universe_utils::LinearRing2d;
+using autoware::universe_utils::Segment2d;
 using autoware_planning_msgs::msg::Trajectory;
 using autoware_planning_msgs::msg::TrajectoryPoint;
 using tier4_planning_msgs::msg::PathWithLaneId;
@@ -73,6 +74,16 @@ std::vector<LinearRing2d> createVehicleFootprints(
 std::vector<LinearRing2d> createVehicleFootprints(
   const PathWithLaneId & path, const autoware::vehicle_info_utils::VehicleInfo & vehicle_info,
   const double footprint_extra_margin);
+
+/**
+ * @brief check if the segment intersects the vehicle footprint, including its boundary
+ * @param segment segment to check
+ * @param vehicle_footprint vehicle footprint, either closed or open and oriented either way
+ * @return true if the segment intersects the vehicle footprint
+ * @note same result as boost::geometry::intersects without the overhead of its general algorithm
+ */
+bool isSegmentIntersectingFootprint(
+  const Segment2d & segment, const LinearRing2d & vehicle_footprint);
 }  // namespace autoware::lane_departure_checker::utils
 
 #endif  // AUTOWARE__LANE_DEPARTURE_CHECKER__UTILS_HPP_
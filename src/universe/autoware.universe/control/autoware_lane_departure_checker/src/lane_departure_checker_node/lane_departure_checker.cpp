@@ -27,9 +27,12 @@
 #include <tf2/utils.h>
 
 #include <algorithm>
+#include <string>
+#include <utility>
 #include <vector>
 
 using autoware::motion_utils::calcArcLength;
+using autoware::universe_utils::Box2d;
 using autoware::universe_utils::LinearRing2d;
 using autoware::universe_utils::LineString2d;
 using autoware::universe_utils::MultiPoint2d;
@@ -130,34 +133,142 @@ Output LaneDepartureChecker::update(const Input & input)
   output.vehicle_passing_areas = createVehiclePassingAreas(output.vehicle_footprints);
   output.processing_time_map["createVehiclePassingAreas"] = stop_watch.toc(true);
 
-  const auto candidate_road_lanelets =
-    getCandidateLanelets(input.route_lanelets, output.vehicle_footprints);
-  const auto candidate_shoulder_lanelets =
-    getCandidateLanelets(input.shoulder_lanelets, output.vehicle_footprints);
-  output.candidate_lanelets = candidate_road_lanelets;
-  output.candidate_lanelets.insert(
-    output.candidate_lanelets.end(), candidate_shoulder_lanelets.begin(),
-    candidate_shoulder_lanelets.end());
+  updateIndices(input);
+  output.processing_time_map["updateIndices"] = stop_watch.toc(true);
 
+  output.candidate_lanelets = getCandidateDrivableLanelets(output.vehicle_footprints);
   output.processing_time_map["getCandidateLanelets"] = stop_watch.toc(true);
 
-  output.will_leave_lane = willLeaveLane(output.candidate_lanelets, output.vehicle_footprints);
+  // a point of a footprint is in a candidate lanelet if and only if it is in any of the route and
+  // shoulder lanelets, so that the footprints are checked directly with the index
+  output.will_leave_lane = willLeaveDrivableArea(output.vehicle_footprints);
   output.processing_time_map["willLeaveLane"] = stop_watch.toc(true);
 
-  output.is_out_of_lane = isOutOfLane(output.candidate_lanelets, output.vehicle_footprints.front());
+  std::optional<size_t> last_lanelet_idx{};
+  output.is_out_of_lane = isOutOfDrivableArea(output.vehicle_footprints.front(), last_lanelet_idx);
   output.processing_time_map["isOutOfLane"] = stop_watch.toc(true);
 
   const double max_search_length_for_boundaries =
     calcMaxSearchLengthForBoundaries(*input.predicted_trajectory);
-  const auto uncrossable_boundaries = extractUncrossableBoundaries(
-    *input.lanelet_map, input.predicted_trajectory->points.front().pose.position,
-    max_search_length_for_boundaries, input.boundary_types_to_detect);
-  output.will_cross_boundary = willCrossBoundary(output.vehicle_footprints, uncrossable_boundaries);
+  output.will_cross_boundary = willCrossBoundary(
+    output.vehicle_footprints, uncrossable_boundaries_,
+    input.predicted_trajectory->points.front().pose.position, max_search_length_for_boundaries);
   output.processing_time_map["willCrossBoundary"] = stop_watch.toc(true);
 
   return output;
 }
 
+void LaneDepartureChecker::updateIndices(const Input & input)
+{
+  universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+
+  const std::pair<size_t, size_t> lanelets_size{
+    input.route_lanelets.size(), input.shoulder_lanelets.size()};
+  if (
+    input.lanelet_map != indexed_lanelet_map_ || input.route != indexed_route_ ||
+    lanelets_size != indexed_lanelets_size_) {
+    drivable_lanelets_.clear();
+    drivable_lanelets_.reserve(lanelets_size.first + lanelets_size.second);
+    for (const auto * lanelets : {&input.route_lanelets, &input.shoulder_lanelets}) {
+      for (const auto & lanelet : *lanelets) {
+        drivable_lanelets_.push_back({lanelet, lanelet.polygon2d().basicPolygon()});
+      }
+    }
+
+    std::vector<std::pair<Box2d, size_t>> boxes;
+    boxes.reserve(drivable_lanelets_.size());
+    for (size_t i = 0; i < drivable_lanelets_.size(); ++i) {
+      Box2d box;
+      boost::geometry::assign_inverse(box);
+      for (const auto & p : drivable_lanelets_.at(i).polygon) {
+        boost::geometry::expand(box, Point2d{p.x(), p.y()});
+      }
+      boxes.emplace_back(box, i);
+    }
+    drivable_lanelets_rtree_ = LaneletRtree(boxes.begin(), boxes.end());
+
+    indexed_lanelet_map_ = input.lanelet_map;
+    indexed_route_ = input.route;
+    indexed_lanelets_size_ = lanelets_size;
+  }
+
+  if (
+    input.lanelet_map != boundaries_lanelet_map_ ||
+    input.boundary_types_to_detect != indexed_boundary_types_) {
+    uncrossable_boundaries_ =
+      extractUncrossableBoundaries(*input.lanelet_map, input.boundary_types_to_detect);
+    boundaries_lanelet_map_ = input.lanelet_map;
+    indexed_boundary_types_ = input.boundary_types_to_detect;
+  }
+}
+
+lanelet::ConstLanelets LaneDepartureChecker::getCandidateDrivableLanelets(
+  const std::vector<LinearRing2d> & vehicle_footprints) const
+{
+  // Find lanes within the convex hull of footprints, in the order of the input lanelets
+  const auto footprint_hull = createHullFromFootprints(vehicle_footprints);
+  Box2d hull_box;
+  boost::geometry::envelope(footprint_hull, hull_box);
+
+  std::vector<size_t> candidate_indices;
+  for (auto itr = drivable_lanelets_rtree_.qbegin(boost::geometry::index::intersects(hull_box));
+       itr != drivable_lanelets_rtree_.qend(); ++itr) {
+    if (!boost::geometry::disjoint(drivable_lanelets_.at(itr->second).polygon, footprint_hull)) {
+      candidate_indices.push_back(itr->second);
+    }
+  }
+  std::sort(candidate_indices.begin(), candidate_indices.end());
+
+  lanelet::ConstLanelets candidate_lanelets;
+  candidate_lanelets.reserve(candidate_indices.size());
+  for (const auto idx : candidate_indices) {
+    candidate_lanelets.push_back(drivable_lanelets_.at(idx).lanelet);
+  }
+  return candidate_lanelets;
+}
+
+bool LaneDepartureChecker::isInDrivableArea(
+  const Point2d & point, std::optional<size_t> & last_lanelet_idx) const
+{
+  if (
+    last_lanelet_idx &&
+    boost::geometry::within(point, drivable_lanelets_.at(*last_lanelet_idx).polygon)) {
+    return true;
+  }
+
+  for (auto itr = drivable_lanelets_rtree_.qbegin(boost::geometry::index::intersects(point));
+       itr != drivable_lanelets_rtree_.qend(); ++itr) {
+    if (itr->second == last_lanelet_idx) {
+      continue;
+    }
+    if (boost::geometry::within(point, drivable_lanelets_.at(itr->second).polygon)) {
+      last_lanelet_idx = itr->second;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool LaneDepartureChecker::isOutOfDrivableArea(
+  const LinearRing2d & vehicle_footprint, std::optional<size_t> & last_lanelet_idx) const
+{
+  return std::any_of(vehicle_footprint.begin(), vehicle_footprint.end(), [&](const auto & point) {
+    return !isInDrivableArea(point, last_lanelet_idx);
+  });
+}
+
+bool LaneDepartureChecker::willLeaveDrivableArea(
+  const std::vector<LinearRing2d> & vehicle_footprints) const
+{
+  universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+
+  // the footprints are checked along the trajectory and the check stops at the first departure
+  std::optional<size_t> last_lanelet_idx{};
+  return std::any_of(
+    vehicle_footprints.begin(), vehicle_footprints.end(),
+    [&](const auto & footprint) { return isOutOfDrivableArea(footprint, last_lanelet_idx); });
+}
+
 bool LaneDepartureChecker::checkPathWillLeaveLane(
   const lanelet::ConstLanelets & lanelets, const PathWithLaneId & path) const
 {
@@ -393,8 +504,8 @@ double LaneDepartureChecker::calcMaxSearchLengthForBoundaries(const Trajectory &
 }
 
 SegmentRtree LaneDepartureChecker::extractUncrossableBoundaries(
-  const lanelet::LaneletMap & lanelet_map, const geometry_msgs::msg::Point & ego_point,
-  const double max_search_length, const std::vector<std::string> & boundary_types_to_detect)
+  const lanelet::LaneletMap & lanelet_map,
+  const std::vector<std::string> & boundary_types_to_detect)
 {
   const auto has_types =
     [](const lanelet::ConstLineString3d & ls, const std::vector<std::string> & types) {
@@ -403,36 +514,39 @@ SegmentRtree LaneDepartureChecker::extractUncrossableBoundaries(
       return (type != no_type && std::find(types.begin(), types.end(), type) != types.end());
     };
 
-  SegmentRtree uncrossable_segments_in_range;
+  std::vector<Segment2d> uncrossable_segments;
   LineString2d line;
-  const auto ego_p = Point2d{ego_point.x, ego_point.y};
   for (const auto & ls : lanelet_map.lineStringLayer) {
     if (has_types(ls, boundary_types_to_detect)) {
       line.clear();
       for (const auto & p : ls) line.push_back(Point2d{p.x(), p.y()});
       for (auto segment_idx = 0LU; segment_idx + 1 < line.size(); ++segment_idx) {
-        const Segment2d segment = {line[segment_idx], line[segment_idx + 1]};
-        if (boost::geometry::distance(segment, ego_p) < max_search_length) {
-          uncrossable_segments_in_range.insert(segment);
-        }
+        uncrossable_segments.push_back({line[segment_idx], line[segment_idx + 1]});
       }
     }
   }
-  return uncrossable_segments_in_range;
+  // packing construction, which gives a better tree than the insertions one by one
+  return SegmentRtree(uncrossable_segments.begin(), uncrossable_segments.end());
 }
 
 bool LaneDepartureChecker::willCrossBoundary(
   const std::vector<LinearRing2d> & vehicle_footprints,
-  const SegmentRtree & uncrossable_segments) const
+  const SegmentRtree & uncrossable_segments, const geometry_msgs::msg::Point & ego_point,
+  const double max_search_length) const
 {
   universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
+  const auto ego_p = Point2d{ego_point.x, ego_point.y};
   for (const auto & footprint : vehicle_footprints) {
-    std::vector<Segment2d> intersection_result;
-    uncrossable_segments.query(
-      boost::geometry::index::intersects(footprint), std::back_inserter(intersection_result));
-    if (!intersection_result.empty()) {
-      return true;
+    Box2d footprint_box;
+    boost::geometry::envelope(footprint, footprint_box);
+    for (auto itr = uncrossable_segments.qbegin(boost::geometry::index::intersects(footprint_box));
+         itr != uncrossable_segments.qend(); ++itr) {
+      if (
+        utils::isSegmentIntersectingFootprint(*itr, footprint) &&
+        boost::geometry::distance(*itr, ego_p) < max_search_length) {
+        return true;
+      }
     }
   }
   return false;
@@ -18,6 +18,8 @@
 
 #include <boost/geometry.hpp>
 
+#include <algorithm>
+
 namespace
 {
 struct FootprintMargin
@@ -48,6 +50,52 @@ FootprintMargin calcFootprintMargin(
   // in Cov_xy_vehicle(0,0), Cov_xy_vehicle(1,1) respectively.
   return FootprintMargin{Cov_xy_vehicle(0, 0) * scale, Cov_xy_vehicle(1, 1) * scale};
 }
+
+using autoware::universe_utils::Point2d;
+
+// sign of the cross product of (b - a) and (c - a)
+int orientation(const Point2d & a, const Point2d & b, const Point2d & c)
+{
+  const double cross = (b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x());
+  return (cross > 0.0) - (cross < 0.0);
+}
+
+// whether the point c collinear with the segment [a, b] is on the segment
+bool isOnSegment(const Point2d & a, const Point2d & b, const Point2d & c)
+{
+  return std::min(a.x(), b.x()) <= c.x() && c.x() <= std::max(a.x(), b.x()) &&
+         std::min(a.y(), b.y()) <= c.y() && c.y() <= std::max(a.y(), b.y());
+}
+
+bool isSegmentIntersectingSegment(
+  const Point2d & p1, const Point2d & p2, const Point2d & q1, const Point2d & q2)
+{
+  const int o1 = orientation(p1, p2, q1);
+  const int o2 = orientation(p1, p2, q2);
+  const int o3 = orientation(q1, q2, p1);
+  const int o4 = orientation(q1, q2, p2);
+  if (o1 != o2 && o3 != o4) {
+    return true;
+  }
+  return (o1 == 0 && isOnSegment(p1, p2, q1)) || (o2 == 0 && isOnSegment(p1, p2, q2)) ||
+         (o3 == 0 && isOnSegment(q1, q2, p1)) || (o4 == 0 && isOnSegment(q1, q2, p2));
+}
+
+// crossing number test, the points on the boundary are handled by the caller
+bool isInsideRing(const Point2d & point, const autoware::universe_utils::LinearRing2d & ring)
+{
+  bool is_inside = false;
+  for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+    const auto & a = ring[i];
+    const auto & b = ring[j];
+    if (
+      (a.y() > point.y()) != (b.y() > point.y()) &&
+      point.x() < a.x() + (point.y() - a.y()) / (b.y() - a.y()) * (b.x() - a.x())) {
+      is_inside = !is_inside;
+    }
+  }
+  return is_inside;
+}
 }  // namespace
 
 namespace autoware::lane_departure_checker::utils
@@ -161,4 +209,20 @@ std::vector<LinearRing2d> createVehicleFootprints(
 
   return vehicle_footprints;
 }
+
+bool isSegmentIntersectingFootprint(
+  const Segment2d & segment, const LinearRing2d & vehicle_footprint)
+{
+  if (vehicle_footprint.empty()) {
+    return false;
+  }
+  // the segment crosses or touches an edge, or is entirely inside the footprint
+  for (size_t i = 0, j = vehicle_footprint.size() - 1; i < vehicle_footprint.size(); j = i++) {
+    if (isSegmentIntersectingSegment(
+          segment.first, segment.second, vehicle_footprint[j], vehicle_footprint[i])) {
+      return true;
+    }
+  }
+  return isInsideRing(segment.first, vehicle_footprint);
+}
 }  // namespace autoware::lane_departure_checker::utils
@@ -0,0 +1,129 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/lane_departure_checker/utils.hpp"
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+using autoware::universe_utils::LinearRing2d;
+using autoware::universe_utils::Point2d;
+using autoware::universe_utils::Segment2d;
+
+namespace
+{
+// closed rectangle footprint rotated by yaw around its center
+LinearRing2d create_footprint(
+  const double x, const double y, const double yaw, const double length, const double width)
+{
+  LinearRing2d footprint;
+  for (const auto & [lon, lat] : std::vector<std::pair<double, double>>{
+         {length / 2, width / 2},
+         {length / 2, -width / 2},
+         {-length / 2, -width / 2},
+         {-length / 2, width / 2},
+         {length / 2, width / 2}}) {
+    footprint.emplace_back(
+      x + lon * std::cos(yaw) - lat * std::sin(yaw), y + lon * std::sin(yaw) + lat * std::cos(yaw));
+  }
+  return footprint;
+}
+}  // namespace
+
+struct SegmentFootprintIntersectionTestParam
+{
+  std::string description;
+  Segment2d segment;
+  bool expected;
+};
+
+std::ostream & operator<<(std::ostream & os, const SegmentFootprintIntersectionTestParam & p)
+{
+  return os << p.description;
+}
+
+class SegmentFootprintIntersectionTest
+: public ::testing::TestWithParam<SegmentFootprintIntersectionTestParam>
+{
+};
+
+TEST_P(SegmentFootprintIntersectionTest, test_segment_footprint_intersection)
+{
+  const auto p = GetParam();
+  const auto footprint = create_footprint(0.0, 0.0, 0.0, 4.0, 2.0);
+  EXPECT_EQ(
+    autoware::lane_departure_checker::utils::isSegmentIntersectingFootprint(p.segment, footprint),
+    p.expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  LaneDepartureCheckerTest, SegmentFootprintIntersectionTest,
+  ::testing::Values(
+    SegmentFootprintIntersectionTestParam{
+      "Crossing", Segment2d{Point2d{0.0, -2.0}, Point2d{0.0, 2.0}}, true},
+    SegmentFootprintIntersectionTestParam{
+      "Inside", Segment2d{Point2d{-1.0, 0.0}, Point2d{1.0, 0.0}}, true},
+    SegmentFootprintIntersectionTestParam{
+      "OneEndInside", Segment2d{Point2d{0.0, 0.0}, Point2d{5.0, 5.0}}, true},
+    SegmentFootprintIntersectionTestParam{
+      "TouchingEdge", Segment2d{Point2d{0.0, 1.0}, Point2d{0.0, 3.0}}, true},
+    SegmentFootprintIntersectionTestParam{
+      "TouchingCorner", Segment2d{Point2d{2.0, 1.0}, Point2d{3.0, 3.0}}, true},
+    SegmentFootprintIntersectionTestParam{
+      "AlongEdge", Segment2d{Point2d{-3.0, 1.0}, Point2d{3.0, 1.0}}, true},
+    SegmentFootprintIntersectionTestParam{
+      "Outside", Segment2d{Point2d{3.0, -3.0}, Point2d{3.0, 3.0}}, false},
+    SegmentFootprintIntersectionTestParam{
+      "OutsideCollinearWithEdge", Segment2d{Point2d{2.5, 1.0}, Point2d{4.0, 1.0}}, false}),
+  ::testing::PrintToStringParamName());
+
+TEST(SegmentFootprintIntersectionTest, SameAsBoostGeometry)
+{
+  // segments on a grid around the footprints to include the touching and collinear cases, with
+  // the corners of the axis aligned footprints exactly on the grid
+  for (auto footprint :
+       {create_footprint(0.5, -0.5, 0.0, 4.0, 2.0), create_footprint(0.5, -0.5, 0.0, 2.0, 4.0),
+        create_footprint(0.5, -0.5, 0.3, 4.0, 2.0), create_footprint(0.5, -0.5, -2.0, 4.0, 2.0)}) {
+    for (const bool is_reversed : {false, true}) {
+      if (is_reversed) {
+        std::reverse(footprint.begin(), footprint.end());
+      }
+      for (int x1 = -4; x1 <= 4; x1 += 2) {
+        for (int y1 = -4; y1 <= 4; ++y1) {
+          for (int x2 = -4; x2 <= 4; ++x2) {
+            for (int y2 = -4; y2 <= 4; y2 += 2) {
+              const Segment2d segment{Point2d(x1, y1), Point2d(x2, y2)};
+              auto boost_footprint = footprint;
+              boost::geometry::correct(boost_footprint);
+              EXPECT_EQ(
+                autoware::lane_departure_checker::utils::isSegmentIntersectingFootprint(
+                  segment, footprint),
+                boost::geometry::intersects(segment, boost_footprint))
+                << "segment: (" << x1 << ", " << y1 << ") - (" << x2 << ", "
+                << y2 << ")";
+            }
+          }
+        }
+      }
+    }
+  }
+}
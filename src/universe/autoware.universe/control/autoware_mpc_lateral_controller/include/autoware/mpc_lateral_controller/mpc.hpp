@@ -174,6 +174,8 @@ struct MPCData
  * Xex = Aex * X0 + Bex * Uex * Wex
  * Yex = Cex * Xex
  * Cost = Xex' * Qex * Xex + (Uex - Uref_ex)' * R1ex * (Uex - Uref_ex) +  Uex' * R2ex * Uex
+ * Ad_ex = [Ad(0), Ad(1), ...] keeps the discrete state matrix of each step, so that the condensed
+ * QP can be built by a backward recursion over the steps.
  */
 struct MPCMatrix
 {
@@ -185,10 +187,27 @@ struct MPCMatrix
   MatrixXd R1ex;
   MatrixXd R2ex;
   MatrixXd Uref_ex;
+  MatrixXd Ad_ex;
 
   MPCMatrix() = default;
 };
 
+/**
+ * @brief Calculate the condensed QP cost 1/2 * Uex' * H * Uex + f * Uex of the MPC matrix, i.e.
+ * H = (Cex * Bex)' * Qex * (Cex * Bex) + R1ex + R2ex and
+ * f = (Cex * (Aex * x0 + Wex))' * Qex * Cex * Bex - Uref_ex' * R1ex.
+ * @details Cex and Qex are block diagonal and Bex is block lower triangular, so the blocks of
+ * (Cex * Bex)' * Qex * (Cex * Bex) are computed by a backward recursion of
+ * P(k) = C(k)' * Q(k) * C(k) + Ad(k+1)' * P(k+1) * Ad(k+1) in O(N^2) instead of the O(N^3) dense
+ * products. The blocks have fixed sizes for the dimensions of the vehicle models.
+ * @param m The MPC matrix.
+ * @param x0 The initial state vector.
+ * @param H The hessian, resized if necessary.
+ * @param f The gradient as a row vector, resized if necessary.
+ */
+void calculateCondensedQPMatrix(
+  const MPCMatrix & m, const VectorXd & x0, MatrixXd & H, MatrixXd & f);
+
 /**
  * MPC-based waypoints follower class
  * @brief calculate control command to follow reference waypoints
@@ -221,6 +240,13 @@ private:
 
   double m_min_prediction_length = 5.0;  // Minimum prediction distance.
 
+  // Workspace of the MPC and QP matrices reused across the control cycles to avoid reallocating
+  // them while the prediction horizon and the vehicle model do not change.
+  MPCMatrix m_mpc_matrix;
+  MatrixXd m_qp_hessian;
+  MatrixXd m_qp_gradient;
+  MatrixXd m_qp_constraint;
+
   rclcpp::Publisher<Trajectory>::SharedPtr m_debug_frenet_predicted_trajectory_pub;
   rclcpp::Publisher<Trajectory>::SharedPtr m_debug_resampled_reference_trajectory_pub;
   /**
@@ -255,10 +281,10 @@ private:
    * @brief Generate the MPC matrix using the reference trajectory and vehicle model.
    * @param reference_trajectory The reference trajectory used for linearization.
    * @param prediction_dt The prediction time step.
-   * @return The generated MPC matrix.
+   * @param m The generated MPC matrix, whose storage is reused when the sizes do not change.
    */
-  MPCMatrix generateMPCMatrix(
-    const MPCTrajectory & reference_trajectory, const double prediction_dt);
+  void generateMPCMatrix(
+    const MPCTrajectory & reference_trajectory, const double prediction_dt, MPCMatrix & m);
 
   /**
    * @brief Execute the optimization using the provided MPC matrix, initial state, and prediction
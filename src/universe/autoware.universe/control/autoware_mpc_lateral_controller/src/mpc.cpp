@@ -29,6 +29,90 @@ using autoware::universe_utils::calcDistance2d;
 using autoware::universe_utils::normalizeRadian;
 using autoware::universe_utils::rad2deg;
 
+namespace
+{
+template <int DIM_X, int DIM_Y, int DIM_U>
+void calculateCondensedQPMatrixImpl(
+  const MPCMatrix & m, const VectorXd & x0, const int dim_x, const int dim_y, const int dim_u,
+  MatrixXd & H, MatrixXd & f)
+{
+  using MatrixXX = Eigen::Matrix<double, DIM_X, DIM_X>;
+  using MatrixXU = Eigen::Matrix<double, DIM_X, DIM_U>;
+  using MatrixYX = Eigen::Matrix<double, DIM_Y, DIM_X>;
+  using VectorX = Eigen::Matrix<double, DIM_X, 1>;
+  using VectorY = Eigen::Matrix<double, DIM_Y, 1>;
+
+  const int N = static_cast<int>(m.Aex.rows()) / dim_x;
+  H.setZero(dim_u * N, dim_u * N);
+  f.setZero(1, dim_u * N);
+
+  const auto Bex = [&](const int i, const int j) {
+    return m.Bex.template block<DIM_X, DIM_U>(i * dim_x, j * dim_u, dim_x, dim_u);
+  };
+
+  // P(k) = sum_{i >= k} Phi(i, k)' * C(i)' * Q(i) * C(i) * Phi(i, k) and
+  // g(k) = sum_{i >= k} Phi(i, k)' * C(i)' * Q(i) * y(i), where Phi(i, k) = Ad(i) * ... * Ad(k+1)
+  // and y(i) = C(i) * (Aex(i) * x0 + Wex(i)) is the output without input. Since
+  // Bex(i, j) = Phi(i, k) * Bex(k, j) for j <= k <= i, the blocks of the cost are
+  // H(j, k) = Bex(k, j)' * P(k) * Bd(k) and f(k) = g(k)' * Bd(k).
+  MatrixXX P = MatrixXX::Zero(dim_x, dim_x);
+  VectorX g = VectorX::Zero(dim_x);
+  for (int k = N - 1; k >= 0; --k) {
+    const auto C = m.Cex.template block<DIM_Y, DIM_X>(k * dim_y, k * dim_x, dim_y, dim_x);
+    const auto Q = m.Qex.template block<DIM_Y, DIM_Y>(k * dim_y, k * dim_y, dim_y, dim_y);
+    const MatrixYX QC = Q * C;
+    const VectorY y =
+      C * (m.Aex.template block<DIM_X, DIM_X>(k * dim_x, 0, dim_x, dim_x) * x0 +
+           m.Wex.template block<DIM_X, 1>(k * dim_x, 0, dim_x, 1));
+    if (k == N - 1) {
+      P = C.transpose() * QC;
+      g = QC.transpose() * y;
+    } else {
+      const auto Ad = m.Ad_ex.template block<DIM_X, DIM_X>(0, (k + 1) * dim_x, dim_x, dim_x);
+      P = C.transpose() * QC + Ad.transpose() * P * Ad;
+      g = QC.transpose() * y + Ad.transpose() * g;
+    }
+
+    const MatrixXU PB = P * Bex(k, k);
+    for (int j = 0; j <= k; ++j) {
+      H.template block<DIM_U, DIM_U>(j * dim_u, k * dim_u, dim_u, dim_u).noalias() =
+        Bex(k, j).transpose() * PB;
+    }
+    f.template block<1, DIM_U>(0, k * dim_u, 1, dim_u).noalias() = g.transpose() * Bex(k, k);
+  }
+
+  H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
+  H.triangularView<Eigen::Lower>() = H.transpose();
+  f.noalias() -= m.Uref_ex.transpose() * m.R1ex;
+}
+}  // namespace
+
+void calculateCondensedQPMatrix(
+  const MPCMatrix & m, const VectorXd & x0, MatrixXd & H, MatrixXd & f)
+{
+  const int dim_x = static_cast<int>(m.Aex.cols());
+  const int N = dim_x > 0 ? static_cast<int>(m.Aex.rows()) / dim_x : 0;
+  if (N == 0) {
+    H.resize(0, 0);
+    f.resize(1, 0);
+    return;
+  }
+  const int dim_y = static_cast<int>(m.Cex.rows()) / N;
+  const int dim_u = static_cast<int>(m.Bex.cols()) / N;
+
+  // fixed size blocks for the kinematics, kinematics_no_delay and dynamics models
+  if (dim_u == 1 && dim_y == 2 && dim_x == 3) {
+    calculateCondensedQPMatrixImpl<3, 2, 1>(m, x0, dim_x, dim_y, dim_u, H, f);
+  } else if (dim_u == 1 && dim_y == 2 && dim_x == 2) {
+    calculateCondensedQPMatrixImpl<2, 2, 1>(m, x0, dim_x, dim_y, dim_u, H, f);
+  } else if (dim_u == 1 && dim_y == 2 && dim_x == 4) {
+    calculateCondensedQPMatrixImpl<4, 2, 1>(m, x0, dim_x, dim_y, dim_u, H, f);
+  } else {
+    calculateCondensedQPMatrixImpl<Eigen::Dynamic, Eigen::Dynamic, Eigen::Dynamic>(
+      m, x0, dim_x, dim_y, dim_u, H, f);
+  }
+}
+
 MPC::MPC(rclcpp::Node & node)
 {
   m_debug_frenet_predicted_trajectory_pub = node.create_publisher<Trajectory>(
@@ -75,7 +159,8 @@ bool MPC::calculateMPC(
   }
 
   // generate mpc matrix : predict equation Xec = Aex * x0 + Bex * Uex + Wex
-  const auto mpc_matrix = generateMPCMatrix(mpc_resampled_ref_trajectory, prediction_dt);
+  generateMPCMatrix(mpc_resampled_ref_trajectory, prediction_dt, m_mpc_matrix);
+  const auto & mpc_matrix = m_mpc_matrix;
 
   // solve Optimization problem
   const auto [success_opt, Uex] = executeOptimization(
@@ -316,6 +401,7 @@ std::pair<bool, MPCTrajectory> MPC::resampleMPCTrajectoryByTime(
 {
   MPCTrajectory output;
   std::vector<double> mpc_time_v;
+  mpc_time_v.reserve(m_param.prediction_horizon);
   for (double i = 0; i < static_cast<double>(m_param.prediction_horizon); ++i) {
     mpc_time_v.push_back(ts + i * prediction_dt);
   }
@@ -432,8 +518,8 @@ MPCTrajectory MPC::applyVelocityDynamicsFilter(
  * cost function: J = Xex' * Qex * Xex + (Uex - Uref)' * R1ex * (Uex - Uref_ex) + Uex' * R2ex * Uex
  * Qex = diag([Q,Q,...]), R1ex = diag([R,R,...])
  */
-MPCMatrix MPC::generateMPCMatrix(
-  const MPCTrajectory & reference_trajectory, const double prediction_dt)
+void MPC::generateMPCMatrix(
+  const MPCTrajectory & reference_trajectory, const double prediction_dt, MPCMatrix & m)
 {
   const int N = m_param.prediction_horizon;
   const double DT = prediction_dt;
@@ -441,15 +527,16 @@ MPCMatrix MPC::generateMPCMatrix(
   const int DIM_U = m_vehicle_model_ptr->getDimU();
   const int DIM_Y = m_vehicle_model_ptr->getDimY();
 
-  MPCMatrix m;
-  m.Aex = MatrixXd::Zero(DIM_X * N, DIM_X);
-  m.Bex = MatrixXd::Zero(DIM_X * N, DIM_U * N);
-  m.Wex = MatrixXd::Zero(DIM_X * N, 1);
-  m.Cex = MatrixXd::Zero(DIM_Y * N, DIM_X * N);
-  m.Qex = MatrixXd::Zero(DIM_Y * N, DIM_Y * N);
-  m.R1ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
-  m.R2ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
-  m.Uref_ex = MatrixXd::Zero(DIM_U * N, 1);
+  // setZero does not reallocate the storage when the size does not change
+  m.Aex.setZero(DIM_X * N, DIM_X);
+  m.Bex.setZero(DIM_X * N, DIM_U * N);
+  m.Wex.setZero(DIM_X * N, 1);
+  m.Cex.setZero(DIM_Y * N, DIM_X * N);
+  m.Qex.setZero(DIM_Y * N, DIM_Y * N);
+  m.R1ex.setZero(DIM_U * N, DIM_U * N);
+  m.R2ex.setZero(DIM_U * N, DIM_U * N);
+  m.Uref_ex.setZero(DIM_U * N, 1);
+  m.Ad_ex.setZero(DIM_X, DIM_X * N);
 
   // weight matrix depends on the vehicle model
   MatrixXd Q = MatrixXd::Zero(DIM_Y, DIM_Y);
@@ -505,14 +592,18 @@ MPCMatrix MPC::generateMPCMatrix(
       m.Bex.block(0, 0, DIM_X, DIM_U) = Bd;
       m.Wex.block(0, 0, DIM_X, 1) = Wd;
     } else {
-      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X) = Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
+      // the blocks of the previous step do not overlap the blocks of the current step
+      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X).noalias() =
+        Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
       for (int j = 0; j < i; ++j) {
         int idx_u_j = j * DIM_U;
-        m.Bex.block(idx_x_i, idx_u_j, DIM_X, DIM_U) =
+        m.Bex.block(idx_x_i, idx_u_j, DIM_X, DIM_U).noalias() =
           Ad * m.Bex.block(idx_x_i_prev, idx_u_j, DIM_X, DIM_U);
       }
-      m.Wex.block(idx_x_i, 0, DIM_X, 1) = Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1) + Wd;
+      m.Wex.block(idx_x_i, 0, DIM_X, 1) = Wd;
+      m.Wex.block(idx_x_i, 0, DIM_X, 1).noalias() += Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1);
     }
+    m.Ad_ex.block(0, idx_x_i, DIM_X, DIM_X) = Ad;
     m.Bex.block(idx_x_i, idx_u_i, DIM_X, DIM_U) = Bd;
     m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = Cd;
     m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y) = Q_adaptive;
@@ -537,8 +628,6 @@ MPCMatrix MPC::generateMPCMatrix(
   }
 
   addSteerWeightR(prediction_dt, m.R1ex);
-
-  return m;
 }
 
 /*
@@ -577,20 +666,17 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
   const int DIM_U_N = m_param.prediction_horizon * m_vehicle_model_ptr->getDimU();
 
   // cost function: 1/2 * Uex' * H * Uex + f' * Uex,  H = B' * C' * Q * C * B + R
-  const MatrixXd CB = m.Cex * m.Bex;
-  const MatrixXd QCB = m.Qex * CB;
-  // MatrixXd H = CB.transpose() * QCB + m.R1ex + m.R2ex; // This calculation is heavy. looking for
-  // a good way.  //NOLINT
-  MatrixXd H = MatrixXd::Zero(DIM_U_N, DIM_U_N);
-  H.triangularView<Eigen::Upper>() = CB.transpose() * QCB;
-  H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
-  H.triangularView<Eigen::Lower>() = H.transpose();
-  MatrixXd f = (m.Cex * (m.Aex * x0 + m.Wex)).transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
+  MatrixXd & H = m_qp_hessian;
+  MatrixXd & f = m_qp_gradient;
+  calculateCondensedQPMatrix(m, x0, H, f);
   addSteerWeightF(prediction_dt, f);
 
-  MatrixXd A = MatrixXd::Identity(DIM_U_N, DIM_U_N);
-  for (int i = 1; i < DIM_U_N; i++) {
-    A(i, i - 1) = -1.0;
+  MatrixXd & A = m_qp_constraint;
+  if (A.rows() != DIM_U_N) {
+    A = MatrixXd::Identity(DIM_U_N, DIM_U_N);
+    for (int i = 1; i < DIM_U_N; i++) {
+      A(i, i - 1) = -1.0;
+    }
   }
 
   // steering angle limit
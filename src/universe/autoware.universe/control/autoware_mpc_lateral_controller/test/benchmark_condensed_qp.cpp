@@ -0,0 +1,115 @@
+// Copyright 2024 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/mpc_lateral_controller/mpc.hpp"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using autoware::motion::control::mpc_lateral_controller::calculateCondensedQPMatrix;
+using autoware::motion::control::mpc_lateral_controller::MPCMatrix;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+namespace
+{
+constexpr int nb_iterations = 200;
+
+// MPC matrix of the kinematics model with random step matrices
+MPCMatrix create_mpc_matrix(const int N)
+{
+  constexpr int dim_x = 3;
+  constexpr int dim_y = 2;
+  constexpr int dim_u = 1;
+  std::srand(0);
+  MPCMatrix m;
+  m.Aex.setZero(dim_x * N, dim_x);
+  m.Bex.setZero(dim_x * N, dim_u * N);
+  m.Wex.setZero(dim_x * N, 1);
+  m.Cex.setZero(dim_y * N, dim_x * N);
+  m.Qex.setZero(dim_y * N, dim_y * N);
+  m.Ad_ex.setZero(dim_x, dim_x * N);
+  for (int i = 0; i < N; ++i) {
+    const MatrixXd Ad = MatrixXd::Identity(dim_x, dim_x) + 0.1 * MatrixXd::Random(dim_x, dim_x);
+    const MatrixXd Wd = MatrixXd::Random(dim_x, 1);
+    if (i == 0) {
+      m.Aex.block(0, 0, dim_x, dim_x) = Ad;
+      m.Wex.block(0, 0, dim_x, 1) = Wd;
+    } else {
+      m.Aex.block(i * dim_x, 0, dim_x, dim_x) = Ad * m.Aex.block((i - 1) * dim_x, 0, dim_x, dim_x);
+      for (int j = 0; j < i; ++j) {
+        m.Bex.block(i * dim_x, j * dim_u, dim_x, dim_u) =
+          Ad * m.Bex.block((i - 1) * dim_x, j * dim_u, dim_x, dim_u);
+      }
+      m.Wex.block(i * dim_x, 0, dim_x, 1) = Ad * m.Wex.block((i - 1) * dim_x, 0, dim_x, 1) + Wd;
+    }
+    m.Bex.block(i * dim_x, i * dim_u, dim_x, dim_u) = MatrixXd::Random(dim_x, dim_u);
+    m.Cex.block(i * dim_y, i * dim_x, dim_y, dim_x) = MatrixXd::Identity(dim_y, dim_x);
+    m.Qex.block(i * dim_y, i * dim_y, dim_y, dim_y) = MatrixXd::Identity(dim_y, dim_y);
+    m.Ad_ex.block(0, i * dim_x, dim_x, dim_x) = Ad;
+  }
+  m.R1ex = MatrixXd::Identity(dim_u * N, dim_u * N);
+  m.R2ex = MatrixXd::Zero(dim_u * N, dim_u * N);
+  m.Uref_ex = MatrixXd::Random(dim_u * N, 1);
+  return m;
+}
+
+// H and f as calculated before the condensed QP
+void calculate_dense_qp_matrix(
+  const MPCMatrix & m, const VectorXd & x0, MatrixXd & H, MatrixXd & f)
+{
+  const MatrixXd CB = m.Cex * m.Bex;
+  const MatrixXd QCB = m.Qex * CB;
+  H = MatrixXd::Zero(m.Bex.cols(), m.Bex.cols());
+  H.triangularView<Eigen::Upper>() = CB.transpose() * QCB;
+  H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
+  H.triangularView<Eigen::Lower>() = H.transpose();
+  f = (m.Cex * (m.Aex * x0 + m.Wex)).transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
+}
+
+template <class Function>
+double measure_ms(Function && function)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nb_iterations; ++i) {
+    function();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() / nb_iterations;
+}
+}  // namespace
+
+int main()
+{
+  std::printf("horizon  dense [ms]  condensed [ms]  max diff\n");
+  for (const int N : {25, 50, 100, 200}) {
+    const auto m = create_mpc_matrix(N);
+    const VectorXd x0 = VectorXd::Random(3);
+    MatrixXd dense_H;
+    MatrixXd dense_f;
+    MatrixXd H;
+    MatrixXd f;
+    const double dense_ms =
+      measure_ms([&]() { calculate_dense_qp_matrix(m, x0, dense_H, dense_f); });
+    const double condensed_ms = measure_ms([&]() { calculateCondensedQPMatrix(m, x0, H, f); });
+    const double max_diff =
+      std::max((H - dense_H).cwiseAbs().maxCoeff(), (f - dense_f).cwiseAbs().maxCoeff());
+    std::printf("%7d  %10.3f  %14.3f  %8.2e\n", N, dense_ms, condensed_ms, max_diff);
+  }
+  return 0;
+}
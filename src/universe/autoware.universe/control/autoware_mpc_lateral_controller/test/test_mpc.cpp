@@ -34,8 +34,10 @@
 #include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
 #endif
 
+#include <cstdlib>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::motion::control::mpc_lateral_controller
@@ -453,4 +455,76 @@ TEST_F(MPCTest, FailureCases)
   EXPECT_FALSE(mpc->calculateMPC(
     neutral_steer, makeOdometry(pose_far, default_velocity + 10.0), ctrl_cmd, pred_traj, diag));
 }
+
+// MPC matrix with the structure of MPC::generateMPCMatrix and random step matrices
+MPCMatrix makeRandomMPCMatrix(const int N, const int dim_x, const int dim_y, const int dim_u)
+{
+  std::srand(0);
+  MPCMatrix m;
+  m.Aex.setZero(dim_x * N, dim_x);
+  m.Bex.setZero(dim_x * N, dim_u * N);
+  m.Wex.setZero(dim_x * N, 1);
+  m.Cex.setZero(dim_y * N, dim_x * N);
+  m.Qex.setZero(dim_y * N, dim_y * N);
+  m.Ad_ex.setZero(dim_x, dim_x * N);
+  for (int i = 0; i < N; ++i) {
+    const Eigen::MatrixXd Ad =
+      Eigen::MatrixXd::Identity(dim_x, dim_x) + 0.1 * Eigen::MatrixXd::Random(dim_x, dim_x);
+    const Eigen::MatrixXd Bd = Eigen::MatrixXd::Random(dim_x, dim_u);
+    const Eigen::MatrixXd Wd = Eigen::MatrixXd::Random(dim_x, 1);
+    if (i == 0) {
+      m.Aex.block(0, 0, dim_x, dim_x) = Ad;
+      m.Wex.block(0, 0, dim_x, 1) = Wd;
+    } else {
+      m.Aex.block(i * dim_x, 0, dim_x, dim_x) = Ad * m.Aex.block((i - 1) * dim_x, 0, dim_x, dim_x);
+      for (int j = 0; j < i; ++j) {
+        m.Bex.block(i * dim_x, j * dim_u, dim_x, dim_u) =
+          Ad * m.Bex.block((i - 1) * dim_x, j * dim_u, dim_x, dim_u);
+      }
+      m.Wex.block(i * dim_x, 0, dim_x, 1) = Ad * m.Wex.block((i - 1) * dim_x, 0, dim_x, 1) + Wd;
+    }
+    m.Bex.block(i * dim_x, i * dim_u, dim_x, dim_u) = Bd;
+    m.Cex.block(i * dim_y, i * dim_x, dim_y, dim_x) = Eigen::MatrixXd::Random(dim_y, dim_x);
+    m.Qex.block(i * dim_y, i * dim_y, dim_y, dim_y) =
+      Eigen::VectorXd::Random(dim_y).cwiseAbs().asDiagonal();
+    m.Ad_ex.block(0, i * dim_x, dim_x, dim_x) = Ad;
+  }
+  m.R1ex = Eigen::VectorXd::Random(dim_u * N).cwiseAbs().asDiagonal();
+  const Eigen::MatrixXd R2 = Eigen::MatrixXd::Random(dim_u * N, dim_u * N);
+  m.R2ex = R2 * R2.transpose();
+  m.Uref_ex = Eigen::MatrixXd::Random(dim_u * N, 1);
+  return m;
+}
+
+TEST(MPCCondensedQPTest, SameAsDenseProducts)
+{
+  // kinematics, kinematics_no_delay, dynamics and a dimension without fixed size blocks
+  const std::vector<std::pair<int, int>> dimensions = {{3, 1}, {2, 1}, {4, 1}, {3, 2}};
+  for (const auto & [dim_x, dim_u] : dimensions) {
+    constexpr int N = 20;
+    constexpr int dim_y = 2;
+    const auto m = makeRandomMPCMatrix(N, dim_x, dim_y, dim_u);
+    const Eigen::VectorXd x0 = Eigen::VectorXd::Random(dim_x);
+
+    const Eigen::MatrixXd CB = m.Cex * m.Bex;
+    const Eigen::MatrixXd QCB = m.Qex * CB;
+    const Eigen::MatrixXd expected_H = CB.transpose() * QCB + m.R1ex + m.R2ex;
+    const Eigen::MatrixXd expected_f =
+      (m.Cex * (m.Aex * x0 + m.Wex)).transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
+
+    // the workspace is reused for the second calculation
+    Eigen::MatrixXd H;
+    Eigen::MatrixXd f;
+    for (int i = 0; i < 2; ++i) {
+      calculateCondensedQPMatrix(m, x0, H, f);
+      ASSERT_EQ(H.rows(), expected_H.rows());
+      ASSERT_EQ(H.cols(), expected_H.cols());
+      ASSERT_EQ(f.rows(), 1);
+      ASSERT_EQ(f.cols(), expected_f.cols());
+      EXPECT_TRUE(H.isApprox(expected_H, 1e-10)) << "dim_x: " << dim_x << ", dim_u: " << dim_u;
+      EXPECT_TRUE(f.isApprox(expected_f, 1e-10)) << "dim_x: " << dim_x << ", dim_u: " << dim_u;
+      EXPECT_TRUE(H.isApprox(H.transpose()));
+    }
+  }
+}
 }  // namespace autoware::motion::control::mpc_lateral_controller
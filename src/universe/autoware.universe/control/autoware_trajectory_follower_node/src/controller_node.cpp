@@ -86,6 +86,9 @@ Controller::Controller(const rclcpp::NodeOptions & node_options) : Node("control
 
   published_time_publisher_ =
     std::make_unique<autoware::universe_utils::PublishedTimePublisher>(this);
+
+  latency_trace_stage_ =
+    std::make_unique<autoware::universe_utils::LatencyTraceStage>(get_fully_qualified_name());
 }
 
 Controller::LateralControllerMode Controller::getLateralControllerMode(
@@ -171,6 +174,8 @@ boost::optional<trajectory_follower::InputData> Controller::createInputData(rclc
 
 void Controller::callbackTimerControl()
 {
+  autoware::universe_utils::LatencyTraceScope trace_scope(*latency_trace_stage_);
+
   // 1. create input data
   const auto input_data = createInputData(*get_clock());
   if (!input_data) {
@@ -178,6 +183,7 @@ void Controller::callbackTimerControl()
       get_logger(), *get_clock(), 5000, "Control is skipped since input data is not ready.");
     return;
   }
+  trace_scope.add_input(input_data->current_trajectory.header.stamp);
 
   // 2. check if controllers are ready
   const bool is_lat_ready = lateral_controller_->isReady(*input_data);
@@ -211,6 +217,7 @@ void Controller::callbackTimerControl()
   out.lateral = lat_out.control_cmd;
   out.longitudinal = lon_out.control_cmd;
   control_cmd_pub_->publish(out);
+  trace_scope.set_output(out.stamp);
 
   // 6. publish debug
   published_time_publisher_->publish_if_subscribed(control_cmd_pub_, out.stamp);
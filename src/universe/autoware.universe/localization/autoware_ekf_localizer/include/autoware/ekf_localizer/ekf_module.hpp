@@ -16,11 +16,11 @@
 #define AUTOWARE__EKF_LOCALIZER__EKF_MODULE_HPP_
 
 #include "autoware/ekf_localizer/hyper_parameters.hpp"
+#include "autoware/ekf_localizer/matrix_types.hpp"
 #include "autoware/ekf_localizer/state_index.hpp"
 #include "autoware/ekf_localizer/warning.hpp"
 
-#include <autoware/kalman_filter/kalman_filter.hpp>
-#include <autoware/kalman_filter/time_delay_kalman_filter.hpp>
+#include <autoware/kalman_filter/fixed_time_delay_kalman_filter.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <geometry_msgs/msg/pose_stamped.hpp>
@@ -36,7 +36,7 @@
 
 namespace autoware::ekf_localizer
 {
-using autoware::kalman_filter::TimeDelayKalmanFilter;
+using autoware::kalman_filter::FixedTimeDelayKalmanFilter;
 
 struct EKFDiagnosticInfo
 {
@@ -132,7 +132,7 @@ private:
   void update_simple_1d_filters(
     const geometry_msgs::msg::PoseWithCovarianceStamped & pose, const size_t smoothing_step);
 
-  TimeDelayKalmanFilter kalman_filter_;
+  FixedTimeDelayKalmanFilter<6> kalman_filter_;  // x, y, yaw, yaw_bias, vx, wz
 
   std::shared_ptr<Warning> warning_;
   const int dim_x_;
@@ -46,8 +46,8 @@ EKFModule::EKFModule(std::shared_ptr<Warning> warning, const HyperParameters & p
   params_(params),
   last_angular_velocity_(0.0, 0.0, 0.0)
 {
-  Eigen::MatrixXd x = Eigen::MatrixXd::Zero(dim_x_, 1);
-  Eigen::MatrixXd p = Eigen::MatrixXd::Identity(dim_x_, dim_x_) * 1.0E15;  // for x & y
+  Vector6d x = Vector6d::Zero();
+  Matrix6d p = Matrix6d::Identity() * 1.0E15;  // for x & y
   p(IDX::YAW, IDX::YAW) = 50.0;                                            // for yaw
   if (params_.enable_yaw_bias_estimation) {
     p(IDX::YAWB, IDX::YAWB) = 50.0;  // for yaw bias
@@ -64,8 +64,8 @@ EKFModule::EKFModule(std::shared_ptr<Warning> warning, const HyperParameters & p
 void EKFModule::initialize(
   const PoseWithCovariance & initial_pose, const geometry_msgs::msg::TransformStamped & transform)
 {
-  Eigen::MatrixXd x(dim_x_, 1);
-  Eigen::MatrixXd p = Eigen::MatrixXd::Zero(dim_x_, dim_x_);
+  Vector6d x;
+  Matrix6d p = Matrix6d::Zero();
 
   x(IDX::X) = initial_pose.pose.pose.position.x + transform.transform.translation.x;
   x(IDX::Y) = initial_pose.pose.pose.position.y + transform.transform.translation.y;
@@ -214,8 +214,7 @@ void EKFModule::accumulate_delay_time(const double dt)
 
 void EKFModule::predict_with_delay(const double dt)
 {
-  const Eigen::MatrixXd x_curr = kalman_filter_.getLatestX();
-  const Eigen::MatrixXd p_curr = kalman_filter_.getLatestP();
+  const Vector6d x_curr = kalman_filter_.getLatestX();
 
   const double proc_cov_vx_d = std::pow(params_.proc_stddev_vx_c * dt, 2.0);
   const double proc_cov_wz_d = std::pow(params_.proc_stddev_wz_c * dt, 2.0);
@@ -273,7 +272,7 @@ bool EKFModule::measurement_update_pose(
   yaw = yaw_error + ekf_yaw;
 
   /* Set measurement matrix */
-  Eigen::MatrixXd y(dim_y, 1);
+  Eigen::Matrix<double, dim_y, 1> y;
   y << pose.pose.pose.position.x, pose.pose.pose.position.y, yaw;
 
   if (has_nan(y) || has_inf(y)) {
@@ -393,7 +392,7 @@ bool EKFModule::measurement_update_twist(
   }
 
   /* Set measurement matrix */
-  Eigen::MatrixXd y(dim_y, 1);
+  Eigen::Matrix<double, dim_y, 1> y;
   y << twist.twist.twist.linear.x, twist.twist.twist.angular.z;
 
   if (has_nan(y) || has_inf(y)) {
@@ -0,0 +1,82 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__BATCHED_LOGIT_HPP_
+#define YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__BATCHED_LOGIT_HPP_
+
+#include <Eigen/StdVector>
+#include <sophus/se3.hpp>
+#include <yabloc_particle_filter/ll2_cost_map/hierarchical_cost_map.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <array>
+#include <vector>
+
+namespace yabloc::modularized_particle_filter
+{
+/**
+ * Evaluate the logit of many particles against the same line segments at once
+ *
+ * The line segments are converted once per observation into a flat layout, and the particles are
+ * evaluated in parallel. The cost map is only read during the evaluation: areas which are not built
+ * yet are collected, built serially, and only the particles touching them are evaluated again.
+ * The result is identical to evaluating each particle with HierarchicalCostMap::at().
+ */
+class BatchedLogitEvaluator
+{
+public:
+  using LineSegment = pcl::PointXYZLNormal;
+  using LineSegments = pcl::PointCloud<LineSegment>;
+  using Transforms = std::vector<Sophus::SE3f, Eigen::aligned_allocator<Sophus::SE3f>>;
+
+  BatchedLogitEvaluator(float far_weight_gain, int num_threads);
+
+  /**
+   * Set line segments in the particle frame
+   *
+   * @param[in] line_segments Reliable line segments (label != 0 is treated as apriori)
+   * @param[in] iffy_line_segments Line segments which are evaluated after line_segments
+   */
+  void set_line_segments(const LineSegments & line_segments, const LineSegments & iffy_line_segments);
+
+  /**
+   * Compute logit of each particle pose
+   *
+   * @param[in] transforms Particle poses
+   * @param[in] cost_map Cost map. Areas are built and marked as accessed as in at()
+   * @return Logit for each particle
+   */
+  std::vector<float> compute_logits(const Transforms & transforms, HierarchicalCostMap & cost_map);
+
+private:
+  const float far_weight_gain_;
+  const int num_threads_;
+
+  // Line segments in the particle frame, stored as structure of arrays
+  std::vector<Eigen::Vector3f> from_;
+  std::vector<Eigen::Vector3f> to_;
+  std::vector<float> label_gain_;
+
+  // Unit direction of each pixel angle (0~255 [deg]) of the cost map
+  std::array<Eigen::Vector2f, 256> angle_direction_;
+
+  float evaluate(
+    const Sophus::SE3f & transform, const HierarchicalCostMap & cost_map,
+    std::vector<Area> & accessed_areas, std::vector<Area> & missing_areas) const;
+};
+}  // namespace yabloc::modularized_particle_filter
+
+#endif  // YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__BATCHED_LOGIT_HPP_
@@ -16,6 +16,7 @@
 #define YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__CAMERA_PARTICLE_CORRECTOR_HPP_
 
 #include <opencv4/opencv2/core.hpp>
+#include <yabloc_particle_filter/camera_corrector/batched_logit.hpp>
 #include <yabloc_particle_filter/correction/abstract_corrector.hpp>
 #include <yabloc_particle_filter/ll2_cost_map/hierarchical_cost_map.hpp>
 
@@ -55,6 +56,7 @@ private:
   const float min_prob_;
   const float far_weight_gain_;
   HierarchicalCostMap cost_map_;
+  BatchedLogitEvaluator logit_evaluator_;
 
   rclcpp::Subscription<PointCloud2>::SharedPtr sub_bounding_box_;
   rclcpp::Subscription<PointCloud2>::SharedPtr sub_line_segments_cloud_;
@@ -85,9 +87,6 @@ private:
 
   std::pair<LineSegments, LineSegments> split_line_segments(const PointCloud2 & msg);
 
-  float compute_logit(
-    const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
-
   pcl::PointCloud<pcl::PointXYZI> evaluate_cloud(
     const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
 
@@ -117,6 +117,27 @@ public:
    */
   CostMapValue at(const Eigen::Vector2f & position);
 
+  /**
+   * Get the cost map image of the specified area if it has already been built
+   *
+   * This does not build nor mark the area as accessed, so that it can be called concurrently.
+   *
+   * @param[in] area Area index
+   * @return Pointer to CV_8UC3 image or nullptr if the area has not been built yet
+   */
+  const cv::Mat * find_map(const Area & area) const;
+
+  /**
+   * Build the cost map of the specified area if necessary and mark it as accessed
+   *
+   * @param[in] area Area index
+   */
+  void prepare_map(const Area & area);
+
+  bool has_cloud() const { return cloud_.has_value(); }
+
+  cv::Point to_cv_point(const Area & area, const Eigen::Vector2f & p) const;
+
   MarkerArray show_map_range() const;
 
   cv::Mat get_map_image(const Pose & pose);
@@ -141,7 +162,6 @@ private:
   std::vector<BgPolygon> bounding_boxes_;
   std::unordered_map<Area, cv::Mat, Area> cost_maps_;
 
-  cv::Point to_cv_point(const Area & area, const Eigen::Vector2f & p) const;
   void build_map(const Area & area);
 
   cv::Mat create_available_area_image(const Area & area) const;
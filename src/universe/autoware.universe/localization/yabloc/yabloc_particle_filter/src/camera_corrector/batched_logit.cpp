@@ -0,0 +1,183 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yabloc_particle_filter/camera_corrector/batched_logit.hpp"
+
+#include <autoware/universe_utils/math/trigonometry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace yabloc::modularized_particle_filter
+{
+namespace
+{
+void push_unique(std::vector<Area> & areas, const Area & area)
+{
+  if (std::find(areas.begin(), areas.end(), area) == areas.end()) {
+    areas.push_back(area);
+  }
+}
+}  // namespace
+
+BatchedLogitEvaluator::BatchedLogitEvaluator(float far_weight_gain, int num_threads)
+: far_weight_gain_(far_weight_gain), num_threads_(std::max(num_threads, 1))
+{
+  // NOTE: This must be the same computation as abs_cos() so that the logit does not change
+  for (size_t deg = 0; deg < angle_direction_.size(); ++deg) {
+    const auto radian = static_cast<float>(static_cast<float>(deg) * M_PI / 180.0);
+    angle_direction_.at(deg) =
+      Eigen::Vector2f(autoware::universe_utils::cos(radian), autoware::universe_utils::sin(radian));
+  }
+}
+
+void BatchedLogitEvaluator::set_line_segments(
+  const LineSegments & line_segments, const LineSegments & iffy_line_segments)
+{
+  from_.clear();
+  to_.clear();
+  label_gain_.clear();
+
+  for (const LineSegments * cloud : {&line_segments, &iffy_line_segments}) {
+    for (const LineSegment & pn : *cloud) {
+      from_.push_back(pn.getVector3fMap());
+      to_.push_back(pn.getNormalVector3fMap());
+      label_gain_.push_back(pn.label == 0 ? 0.2f : 1.0f);  // posteriori : apriori
+    }
+  }
+}
+
+std::vector<float> BatchedLogitEvaluator::compute_logits(
+  const Transforms & transforms, HierarchicalCostMap & cost_map)
+{
+  std::vector<float> logits(transforms.size(), 0.f);
+  if (!cost_map.has_cloud()) {
+    // every pixel is unmapped
+    return logits;
+  }
+
+  std::vector<Area> accessed_areas;
+  std::vector<Area> missing_areas;
+  std::vector<uint8_t> incomplete(transforms.size(), 0);
+
+  auto evaluate_particles = [&](const std::vector<int> & indices) -> void {
+    const int size = static_cast<int>(indices.size());
+#pragma omp parallel num_threads(num_threads_)
+    {
+      std::vector<Area> local_accessed_areas;
+      std::vector<Area> local_missing_areas;
+      std::vector<Area> particle_missing_areas;
+
+#pragma omp for schedule(dynamic, 16)
+      for (int k = 0; k < size; ++k) {
+        const int index = indices[k];
+        particle_missing_areas.clear();
+        logits[index] =
+          evaluate(transforms[index], cost_map, local_accessed_areas, particle_missing_areas);
+        incomplete[index] = particle_missing_areas.empty() ? 0 : 1;
+        for (const Area & area : particle_missing_areas) {
+          push_unique(local_missing_areas, area);
+        }
+      }
+
+#pragma omp critical
+      {
+        for (const Area & area : local_accessed_areas) push_unique(accessed_areas, area);
+        for (const Area & area : local_missing_areas) push_unique(missing_areas, area);
+      }
+    }
+  };
+
+  std::vector<int> indices(transforms.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    indices[i] = static_cast<int>(i);
+  }
+  evaluate_particles(indices);
+
+  if (!missing_areas.empty()) {
+    // Build the missing areas serially, and evaluate again only the affected particles
+    for (const Area & area : missing_areas) {
+      cost_map.prepare_map(area);
+    }
+    indices.clear();
+    for (size_t i = 0; i < incomplete.size(); ++i) {
+      if (incomplete[i]) indices.push_back(static_cast<int>(i));
+    }
+    evaluate_particles(indices);
+  }
+
+  for (const Area & area : accessed_areas) {
+    cost_map.prepare_map(area);
+  }
+
+  return logits;
+}
+
+float BatchedLogitEvaluator::evaluate(
+  const Sophus::SE3f & transform, const HierarchicalCostMap & cost_map,
+  std::vector<Area> & accessed_areas, std::vector<Area> & missing_areas) const
+{
+  const Eigen::Vector3f self_position = transform.translation();
+
+  std::optional<Area> cached_area{std::nullopt};
+  const cv::Mat * cached_map = nullptr;
+
+  float logit = 0;
+  for (size_t i = 0; i < from_.size(); ++i) {
+    const Eigen::Vector3f from = transform * from_[i];
+    const Eigen::Vector3f to = transform * to_[i];
+    const Eigen::Vector3f tangent = (to - from).normalized();
+    const float length = (from - to).norm();
+    const Eigen::Vector2f direction = Eigen::Vector2f(tangent.x(), tangent.y()).normalized();
+
+    for (float distance = 0; distance < length; distance += 0.1f) {
+      const Eigen::Vector3f p = from + tangent * distance;
+      const Eigen::Vector2f position = p.topRows(2);
+
+      // Consecutive samples almost always fall into the same area
+      const Area area(position);
+      if (!cached_area || *cached_area != area) {
+        cached_area = area;
+        cached_map = cost_map.find_map(area);
+        if (cached_map) {
+          push_unique(accessed_areas, area);
+        } else {
+          push_unique(missing_areas, area);
+        }
+      }
+      if (!cached_map) {
+        continue;
+      }
+
+      const cv::Point2i pixel = cost_map.to_cv_point(area, position);
+      const cv::Vec3b & b3 = cached_map->ptr<cv::Vec3b>(pixel.y)[pixel.x];
+      if (b3[2] == 1) {
+        // logit does not change if target pixel is unmapped
+        continue;
+      }
+
+      // NOTE: Close points are prioritized
+      const float squared_norm = (p - self_position).topRows(2).squaredNorm();
+      const float gain = std::exp(-far_weight_gain_ * squared_norm);  // 0 < gain < 1
+
+      const float intensity = static_cast<float>(b3[0]) / 255.f;
+      const float abs_cos = std::abs(direction.dot(angle_direction_[b3[1]]));
+      logit += label_gain_[i] * gain * (abs_cos * intensity - 0.5f);
+    }
+  }
+  return logit;
+}
+
+}  // namespace yabloc::modularized_particle_filter
@@ -34,7 +34,8 @@ CameraParticleCorrector::CameraParticleCorrector(const rclcpp::NodeOptions & opt
 : AbstractCorrector("camera_particle_corrector", options),
   min_prob_(static_cast<float>(declare_parameter<float>("min_prob"))),
   far_weight_gain_(static_cast<float>(declare_parameter<float>("far_weight_gain"))),
-  cost_map_(this)
+  cost_map_(this),
+  logit_evaluator_(far_weight_gain_, static_cast<int>(declare_parameter<int>("num_threads")))
 {
   using std::placeholders::_1;
   using std::placeholders::_2;
@@ -168,16 +169,16 @@ void CameraParticleCorrector::on_line_segments(const PointCloud2 & line_segments
   cost_map_.set_height(static_cast<float>(mean_pose.position.z));
 
   if (publish_weighted_particles) {
-    for (auto & particle : weighted_particles.particles) {
-      Sophus::SE3f transform = common::pose_to_se3(particle.pose);
-      LineSegments transformed_line_segments =
-        common::transform_line_segments(line_segments_cloud, transform);
-      LineSegments transformed_iffy_line_segments =
-        common::transform_line_segments(iffy_line_segments_cloud, transform);
-      transformed_line_segments += transformed_iffy_line_segments;
-
-      float logit = compute_logit(transformed_line_segments, transform.translation());
-      particle.weight = logit_to_prob(logit, 0.01f);
+    BatchedLogitEvaluator::Transforms transforms;
+    transforms.reserve(weighted_particles.particles.size());
+    for (const auto & particle : weighted_particles.particles) {
+      transforms.push_back(common::pose_to_se3(particle.pose));
+    }
+
+    logit_evaluator_.set_line_segments(line_segments_cloud, iffy_line_segments_cloud);
+    const std::vector<float> logits = logit_evaluator_.compute_logits(transforms, cost_map_);
+    for (size_t i = 0; i < logits.size(); ++i) {
+      weighted_particles.particles.at(i).weight = logit_to_prob(logits.at(i), 0.01f);
     }
 
     if (enable_switch_) {
@@ -264,38 +265,6 @@ float abs_cos(const Eigen::Vector3f & t, float deg)
   return std::abs(x.dot(y));
 }
 
-float CameraParticleCorrector::compute_logit(
-  const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position)
-{
-  float logit = 0;
-  for (const LineSegment & pn : line_segments_cloud) {
-    const Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
-    const float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
-
-    for (float distance = 0; distance < length; distance += 0.1f) {
-      Eigen::Vector3f p = pn.getVector3fMap() + tangent * distance;
-
-      // NOTE: Close points are prioritized
-      float squared_norm = (p - self_position).topRows(2).squaredNorm();
-      float gain = std::exp(-far_weight_gain_ * squared_norm);  // 0 < gain < 1
-
-      const CostMapValue v3 = cost_map_.at(p.topRows(2));
-
-      if (v3.unmapped) {
-        // logit does not change if target pixel is unmapped
-        continue;
-      }
-      if (pn.label == 0) {  // posteriori
-        logit +=
-          0.2f * gain * (abs_cos(tangent, static_cast<float>(v3.angle)) * v3.intensity - 0.5f);
-      } else {  // apriori
-        logit += gain * (abs_cos(tangent, static_cast<float>(v3.angle)) * v3.intensity - 0.5f);
-      }
-    }
-  }
-  return logit;
-}
-
 pcl::PointCloud<pcl::PointXYZI> CameraParticleCorrector::evaluate_cloud(
   const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position)
 {
@@ -62,6 +62,26 @@ CostMapValue HierarchicalCostMap::at(const Eigen::Vector2f & position)
   return {static_cast<float>(b3[0]) / 255.f, b3[1], b3[2] == 1};
 }
 
+const cv::Mat * HierarchicalCostMap::find_map(const Area & area) const
+{
+  const auto itr = cost_maps_.find(area);
+  if (itr == cost_maps_.end()) {
+    return nullptr;
+  }
+  return &itr->second;
+}
+
+void HierarchicalCostMap::prepare_map(const Area & area)
+{
+  if (!cloud_.has_value()) {
+    return;
+  }
+  if (cost_maps_.count(area) == 0) {
+    build_map(area);
+  }
+  map_accessed_[area] = true;
+}
+
 void HierarchicalCostMap::set_height(float height)
 {
   if (height_) {
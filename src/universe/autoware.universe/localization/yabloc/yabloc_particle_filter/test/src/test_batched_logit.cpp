@@ -0,0 +1,154 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yabloc_particle_filter/camera_corrector/batched_logit.hpp"
+#include "yabloc_particle_filter/camera_corrector/camera_particle_corrector.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+#include <yabloc_common/transform_line_segments.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+
+namespace mpf = yabloc::modularized_particle_filter;
+using LineSegments = mpf::BatchedLogitEvaluator::LineSegments;
+
+constexpr float far_weight_gain = 0.001f;
+
+namespace
+{
+std::shared_ptr<rclcpp::Node> create_node(const std::string & name)
+{
+  rclcpp::NodeOptions options;
+  options.parameter_overrides({{"max_range", 40.0}, {"image_size", 800}, {"gamma", 5.0}});
+  return std::make_shared<rclcpp::Node>(name, options);
+}
+
+LineSegments random_line_segments(std::mt19937 & engine, int size, uint32_t label)
+{
+  std::uniform_real_distribution<float> dist(-15.f, 15.f);
+  LineSegments cloud;
+  for (int i = 0; i < size; ++i) {
+    pcl::PointXYZLNormal pn;
+    pn.getVector3fMap() = Eigen::Vector3f(dist(engine), dist(engine), 0.f);
+    pn.getNormalVector3fMap() = Eigen::Vector3f(dist(engine), dist(engine), 0.f);
+    pn.label = label;
+    cloud.push_back(pn);
+  }
+  return cloud;
+}
+
+// Same computation as the former CameraParticleCorrector::compute_logit()
+float reference_logit(
+  const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position,
+  yabloc::HierarchicalCostMap & cost_map)
+{
+  float logit = 0;
+  for (const auto & pn : line_segments_cloud) {
+    const Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
+    const float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
+
+    for (float distance = 0; distance < length; distance += 0.1f) {
+      Eigen::Vector3f p = pn.getVector3fMap() + tangent * distance;
+      float squared_norm = (p - self_position).topRows(2).squaredNorm();
+      float gain = std::exp(-far_weight_gain * squared_norm);
+
+      const yabloc::CostMapValue v3 = cost_map.at(p.topRows(2));
+      if (v3.unmapped) {
+        continue;
+      }
+      const float abs_cos = mpf::abs_cos(tangent, static_cast<float>(v3.angle));
+      if (pn.label == 0) {
+        logit += 0.2f * gain * (abs_cos * v3.intensity - 0.5f);
+      } else {
+        logit += gain * (abs_cos * v3.intensity - 0.5f);
+      }
+    }
+  }
+  return logit;
+}
+}  // namespace
+
+TEST(BatchedLogitTestSuite, sameAsSerialEvaluation)
+{
+  rclcpp::init(0, nullptr);
+  {
+    auto reference_node = create_node("reference_node");
+    auto batched_node = create_node("batched_node");
+    yabloc::HierarchicalCostMap reference_cost_map(reference_node.get());
+    yabloc::HierarchicalCostMap batched_cost_map(batched_node.get());
+
+    // Road markings spread over several areas of the cost map
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<float> map_dist(-60.f, 60.f);
+    pcl::PointCloud<pcl::PointNormal> ll2_cloud;
+    for (int i = 0; i < 200; ++i) {
+      pcl::PointNormal pn;
+      pn.getVector3fMap() = Eigen::Vector3f(map_dist(engine), map_dist(engine), 0.f);
+      pn.getNormalVector3fMap() =
+        pn.getVector3fMap() + Eigen::Vector3f(map_dist(engine), map_dist(engine), 0.f) * 0.1f;
+      ll2_cloud.push_back(pn);
+    }
+    reference_cost_map.set_cloud(ll2_cloud);
+    batched_cost_map.set_cloud(ll2_cloud);
+
+    const LineSegments line_segments = random_line_segments(engine, 30, 1);
+    const LineSegments iffy_line_segments = random_line_segments(engine, 10, 0);
+
+    std::uniform_real_distribution<float> position_dist(-30.f, 30.f);
+    std::uniform_real_distribution<float> yaw_dist(-M_PI, M_PI);
+    mpf::BatchedLogitEvaluator::Transforms transforms;
+    for (int i = 0; i < 100; ++i) {
+      transforms.emplace_back(
+        Sophus::SO3f::rotZ(yaw_dist(engine)),
+        Eigen::Vector3f(position_dist(engine), position_dist(engine), 0.f));
+    }
+
+    mpf::BatchedLogitEvaluator evaluator(far_weight_gain, 4);
+    evaluator.set_line_segments(line_segments, iffy_line_segments);
+    const std::vector<float> logits = evaluator.compute_logits(transforms, batched_cost_map);
+
+    ASSERT_EQ(logits.size(), transforms.size());
+    for (size_t i = 0; i < transforms.size(); ++i) {
+      LineSegments transformed =
+        yabloc::common::transform_line_segments(line_segments, transforms[i]);
+      transformed += yabloc::common::transform_line_segments(iffy_line_segments, transforms[i]);
+      const float expected =
+        reference_logit(transformed, transforms[i].translation(), reference_cost_map);
+      EXPECT_FLOAT_EQ(logits[i], expected);
+    }
+  }
+  rclcpp::shutdown();
+}
+
+TEST(BatchedLogitTestSuite, noCloud)
+{
+  rclcpp::init(0, nullptr);
+  {
+    auto node = create_node("no_cloud_node");
+    yabloc::HierarchicalCostMap cost_map(node.get());
+
+    std::mt19937 engine(0);
+    mpf::BatchedLogitEvaluator evaluator(far_weight_gain, 2);
+    evaluator.set_line_segments(random_line_segments(engine, 5, 1), LineSegments{});
+
+    mpf::BatchedLogitEvaluator::Transforms transforms(3, Sophus::SE3f());
+    for (const float logit : evaluator.compute_logits(transforms, cost_map)) {
+      EXPECT_FLOAT_EQ(logit, 0.f);
+    }
+  }
+  rclcpp::shutdown();
+}
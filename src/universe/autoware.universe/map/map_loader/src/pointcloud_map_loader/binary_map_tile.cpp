@@ -0,0 +1,230 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "binary_map_tile.hpp"
+
+#include <Eigen/Core>
+
+#include <fcntl.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl_conversions/pcl_conversions.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+
+namespace
+{
+template <typename PointT>
+bool is_finite(const PointT & point)
+{
+  return std::isfinite(point.x) && std::isfinite(point.y) && std::isfinite(point.z);
+}
+
+float intensity_of(const pcl::PointXYZ &)
+{
+  return 0.0f;
+}
+
+float intensity_of(const pcl::PointXYZI & point)
+{
+  return point.intensity;
+}
+
+uint64_t align(const uint64_t offset)
+{
+  return (offset + binary_map_tile_alignment - 1) / binary_map_tile_alignment *
+         binary_map_tile_alignment;
+}
+
+template <typename PointT>
+bool write_points(
+  const std::string & path, const pcl::PointCloud<PointT> & cloud, const uint32_t flags)
+{
+  std::vector<BinaryMapTilePoint> points;
+  points.reserve(cloud.size());
+  Eigen::Array3f min = Eigen::Array3f::Constant(std::numeric_limits<float>::max());
+  Eigen::Array3f max = Eigen::Array3f::Constant(std::numeric_limits<float>::lowest());
+  for (const auto & point : cloud) {
+    if (!is_finite(point)) {
+      continue;
+    }
+    points.push_back(BinaryMapTilePoint{point.x, point.y, point.z, intensity_of(point)});
+    min = min.min(point.getArray3fMap());
+    max = max.max(point.getArray3fMap());
+  }
+  if (points.empty()) {
+    min.setZero();
+    max.setZero();
+  }
+
+  BinaryMapTileHeader header{};
+  std::memcpy(header.magic, binary_map_tile_magic, sizeof(header.magic));
+  header.version = binary_map_tile_version;
+  header.point_count = static_cast<uint32_t>(points.size());
+  header.flags = flags;
+  Eigen::Map<Eigen::Array3f>(header.min) = min;
+  Eigen::Map<Eigen::Array3f>(header.max) = max;
+  header.points_offset = align(sizeof(BinaryMapTileHeader));
+  const uint64_t file_size = header.points_offset + points.size() * sizeof(points[0]);
+
+  std::vector<uint8_t> buffer(file_size, 0);
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  std::memcpy(
+    buffer.data() + header.points_offset, points.data(), points.size() * sizeof(points[0]));
+
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    return false;
+  }
+  ofs.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(file_size));
+  return static_cast<bool>(ofs);
+}
+}  // namespace
+
+bool write_binary_map_tile(const std::string & path, const pcl::PointCloud<pcl::PointXYZ> & cloud)
+{
+  return write_points(path, cloud, 0U);
+}
+
+bool write_binary_map_tile(const std::string & path, const pcl::PointCloud<pcl::PointXYZI> & cloud)
+{
+  return write_points(path, cloud, binary_map_tile_flag_intensity);
+}
+
+BinaryMapTileReader::~BinaryMapTileReader()
+{
+  close();
+}
+
+bool BinaryMapTileReader::open(const std::string & path)
+{
+  close();
+
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat file_stat
+  {
+  };
+  if (
+    fstat(fd, &file_stat) != 0 ||
+    file_stat.st_size < static_cast<off_t>(sizeof(BinaryMapTileHeader))) {
+    ::close(fd);
+    return false;
+  }
+  const size_t size = static_cast<size_t>(file_stat.st_size);
+  void * data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  data_ = static_cast<const uint8_t *>(data);
+  size_ = size;
+
+  const auto & h = header();
+  const auto section_fits = [this](const uint64_t offset, const uint64_t count, const size_t size) {
+    return offset % binary_map_tile_alignment == 0 && offset <= size_ &&
+           count <= (size_ - offset) / size;
+  };
+  if (
+    std::memcmp(h.magic, binary_map_tile_magic, sizeof(h.magic)) != 0 ||
+    h.version != binary_map_tile_version ||
+    !section_fits(h.points_offset, h.point_count, sizeof(BinaryMapTilePoint))) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void BinaryMapTileReader::close()
+{
+  if (data_ != nullptr) {
+    munmap(const_cast<uint8_t *>(data_), size_);
+  }
+  data_ = nullptr;
+  size_ = 0;
+}
+
+const BinaryMapTileHeader & BinaryMapTileReader::header() const
+{
+  return *reinterpret_cast<const BinaryMapTileHeader *>(data_);
+}
+
+const BinaryMapTilePoint * BinaryMapTileReader::points() const
+{
+  return reinterpret_cast<const BinaryMapTilePoint *>(data_ + header().points_offset);
+}
+
+bool BinaryMapTileReader::has_intensity() const
+{
+  return (header().flags & binary_map_tile_flag_intensity) != 0;
+}
+
+void BinaryMapTileReader::to_point_cloud2(sensor_msgs::msg::PointCloud2 & cloud) const
+{
+  const uint32_t point_count = header().point_count;
+
+  cloud.fields.clear();
+  const auto add_field = [&cloud](const std::string & name, const size_t offset) {
+    sensor_msgs::msg::PointField field;
+    field.name = name;
+    field.offset = static_cast<uint32_t>(offset);
+    field.datatype = sensor_msgs::msg::PointField::FLOAT32;
+    field.count = 1;
+    cloud.fields.push_back(field);
+  };
+  add_field("x", offsetof(BinaryMapTilePoint, x));
+  add_field("y", offsetof(BinaryMapTilePoint, y));
+  add_field("z", offsetof(BinaryMapTilePoint, z));
+  if (has_intensity()) {
+    add_field("intensity", offsetof(BinaryMapTilePoint, intensity));
+  }
+  cloud.height = 1;
+  cloud.width = point_count;
+  cloud.is_bigendian = false;
+  cloud.is_dense = true;
+  cloud.point_step = sizeof(BinaryMapTilePoint);
+  cloud.row_step = cloud.point_step * point_count;
+
+  const auto * begin = reinterpret_cast<const uint8_t *>(points());
+  cloud.data.assign(begin, begin + cloud.row_step);
+}
+
+bool is_binary_map_tile(const std::string & path)
+{
+  return std::filesystem::path(path).extension() == binary_map_tile_extension;
+}
+
+bool load_map_tile(const std::string & path, sensor_msgs::msg::PointCloud2 & cloud)
+{
+  if (!is_binary_map_tile(path)) {
+    return pcl::io::loadPCDFile(path, cloud) != -1;
+  }
+
+  BinaryMapTileReader reader;
+  if (!reader.open(path)) {
+    return false;
+  }
+  reader.to_point_cloud2(cloud);
+  return true;
+}
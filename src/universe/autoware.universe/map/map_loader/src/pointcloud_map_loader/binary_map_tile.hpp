@@ -0,0 +1,124 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_MAP_LOADER__BINARY_MAP_TILE_HPP_
+#define POINTCLOUD_MAP_LOADER__BINARY_MAP_TILE_HPP_
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * Binary pointcloud map tile (.pcbin)
+ *
+ * A tile is a single little-endian file which can be mapped into memory as is:
+ *
+ *   BinaryMapTileHeader
+ *   BinaryMapTilePoint[point_count]              at points_offset
+ *
+ * The points section starts at a multiple of binary_map_tile_alignment bytes. The intensity of
+ * each point is kept if binary_map_tile_flag_intensity is set, so that a map with or without the
+ * intensity field is converted without loss.
+ *
+ * Only the points are stored. The NDT leaves and the voxel grids of compare_map_segmentation are
+ * still computed by their consumers from the points received through the map services.
+ */
+
+constexpr char binary_map_tile_magic[8] = {'A', 'W', 'P', 'C', 'T', 'I', 'L', 'E'};
+constexpr uint32_t binary_map_tile_version = 3;
+constexpr uint32_t binary_map_tile_flag_intensity = 1U << 0;
+constexpr size_t binary_map_tile_alignment = 64;
+constexpr const char * binary_map_tile_extension = ".pcbin";
+
+struct BinaryMapTileHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t point_count;
+  float min[3];
+  float max[3];
+  uint32_t flags;
+  uint32_t reserved;
+  uint64_t points_offset;
+};
+
+struct BinaryMapTilePoint
+{
+  float x;
+  float y;
+  float z;
+  float intensity;  // 0 if binary_map_tile_flag_intensity is not set
+};
+
+static_assert(sizeof(BinaryMapTileHeader) == 56, "unexpected padding in BinaryMapTileHeader");
+static_assert(sizeof(BinaryMapTilePoint) == 16, "unexpected padding in BinaryMapTilePoint");
+
+/**
+ * @brief Write the finite points of the cloud into a binary map tile without intensity
+ */
+bool write_binary_map_tile(const std::string & path, const pcl::PointCloud<pcl::PointXYZ> & cloud);
+
+/**
+ * @brief Write the finite points of the cloud into a binary map tile with intensity
+ */
+bool write_binary_map_tile(const std::string & path, const pcl::PointCloud<pcl::PointXYZI> & cloud);
+
+/**
+ * @brief Read-only memory mapping of a binary pointcloud map tile
+ */
+class BinaryMapTileReader
+{
+public:
+  BinaryMapTileReader() = default;
+  ~BinaryMapTileReader();
+
+  BinaryMapTileReader(const BinaryMapTileReader &) = delete;
+  BinaryMapTileReader & operator=(const BinaryMapTileReader &) = delete;
+
+  /**
+   * @brief Map the file into memory and validate the header and the section sizes
+   */
+  bool open(const std::string & path);
+  void close();
+
+  [[nodiscard]] bool is_open() const { return data_ != nullptr; }
+  [[nodiscard]] const BinaryMapTileHeader & header() const;
+  [[nodiscard]] const BinaryMapTilePoint * points() const;
+  [[nodiscard]] bool has_intensity() const;
+
+  /**
+   * @brief Copy the points into a PointCloud2 with x, y and z fields, and intensity if the tile
+   * has it
+   */
+  void to_point_cloud2(sensor_msgs::msg::PointCloud2 & cloud) const;
+
+private:
+  const uint8_t * data_{nullptr};
+  size_t size_{0};
+};
+
+[[nodiscard]] bool is_binary_map_tile(const std::string & path);
+
+/**
+ * @brief Load a pointcloud map tile, either a PCD file or a binary map tile
+ */
+bool load_map_tile(const std::string & path, sensor_msgs::msg::PointCloud2 & cloud);
+
+#endif  // POINTCLOUD_MAP_LOADER__BINARY_MAP_TILE_HPP_
@@ -0,0 +1,95 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Convert the PCD tiles listed in a pointcloud map metadata file into binary map tiles.
+// The intensity is kept if the PCD file has the intensity field.
+//
+// usage: binary_map_tile_converter <metadata.yaml> <input_dir> <output_dir>
+
+#include "binary_map_tile.hpp"
+
+#include <pcl/io/pcd_io.h>
+#include <pcl_conversions/pcl_conversions.h>
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char ** argv)
+{
+  if (argc < 4) {
+    std::cerr << "usage: " << argv[0] << " <metadata.yaml> <input_dir> <output_dir>" << std::endl;
+    return 1;
+  }
+  const fs::path metadata_path(argv[1]);
+  const fs::path input_dir(argv[2]);
+  const fs::path output_dir(argv[3]);
+
+  const YAML::Node metadata = YAML::LoadFile(metadata_path.string());
+  fs::create_directories(output_dir);
+
+  YAML::Emitter output_metadata;
+  output_metadata << YAML::BeginMap;
+  for (const auto & node : metadata) {
+    const auto key = node.first.as<std::string>();
+    if (key == "x_resolution" || key == "y_resolution") {
+      output_metadata << YAML::Key << key << YAML::Value << node.second.as<float>();
+      continue;
+    }
+
+    pcl::PCLPointCloud2 pcd;
+    const fs::path input_path = input_dir / key;
+    if (pcl::io::loadPCDFile(input_path.string(), pcd) == -1) {
+      std::cerr << "PCD load failed: " << input_path << std::endl;
+      return 1;
+    }
+    const bool has_intensity = std::any_of(
+      pcd.fields.begin(), pcd.fields.end(),
+      [](const pcl::PCLPointField & field) { return field.name == "intensity"; });
+
+    const std::string output_name = fs::path(key).stem().string() + binary_map_tile_extension;
+    const auto output_path = (output_dir / output_name).string();
+    bool written = false;
+    if (has_intensity) {
+      pcl::PointCloud<pcl::PointXYZI> cloud;
+      pcl::fromPCLPointCloud2(pcd, cloud);
+      written = write_binary_map_tile(output_path, cloud);
+    } else {
+      pcl::PointCloud<pcl::PointXYZ> cloud;
+      pcl::fromPCLPointCloud2(pcd, cloud);
+      written = write_binary_map_tile(output_path, cloud);
+    }
+    if (!written) {
+      std::cerr << "Write failed: " << output_path << std::endl;
+      return 1;
+    }
+    std::cout << input_path.string() << " -> " << output_name << " ("
+              << static_cast<size_t>(pcd.width) * pcd.height << " points"
+              << (has_intensity ? ", with intensity" : "") << ")" << std::endl;
+
+    output_metadata << YAML::Key << output_name << YAML::Value << YAML::Flow
+                    << node.second.as<std::vector<int>>();
+  }
+  output_metadata << YAML::EndMap;
+
+  std::ofstream ofs(output_dir / metadata_path.filename());
+  ofs << output_metadata.c_str() << std::endl;
+  return 0;
+}
@@ -14,12 +14,28 @@
 
 #include "differential_map_loader_module.hpp"
 
+#include "binary_map_tile.hpp"
+
+#include <cmath>
 #include <utility>
 
 DifferentialMapLoaderModule::DifferentialMapLoaderModule(
-  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
+  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+  const size_t tile_cache_size, const double prefetch_distance)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict)),
+  prefetch_distance_(prefetch_distance)
 {
+  if (tile_cache_size > 0) {
+    tile_cache_ = std::make_unique<PointCloudTileCache>(
+      tile_cache_size, [this](const std::string & path) { return load_tile(path); });
+
+    diagnostics_updater_ = std::make_unique<diagnostic_updater::Updater>(node);
+    diagnostics_updater_->setHardwareID(node->get_name());
+    diagnostics_updater_->add(
+      "pointcloud_tile_cache", this, &DifferentialMapLoaderModule::update_cache_diagnostics);
+  }
+
   get_differential_pcd_maps_service_ = node->create_service<GetDifferentialPointCloudMap>(
     "service/get_differential_pcd_map",
     std::bind(
@@ -67,25 +83,95 @@ void DifferentialMapLoaderModule::differential_area_load(
 
 bool DifferentialMapLoaderModule::on_service_get_differential_point_cloud_map(
   GetDifferentialPointCloudMap::Request::SharedPtr req,
-  GetDifferentialPointCloudMap::Response::SharedPtr res) const
+  GetDifferentialPointCloudMap::Response::SharedPtr res)
 {
   auto area = req->area;
   std::vector<std::string> cached_ids = req->cached_ids;
   differential_area_load(area, cached_ids, res);
   res->header.frame_id = "map";
+  prefetch_area_ahead(area);
   return true;
 }
 
+void DifferentialMapLoaderModule::prefetch_area_ahead(
+  const autoware_map_msgs::msg::AreaInfo & area_info)
+{
+  if (!tile_cache_ || prefetch_distance_ <= 0.0) {
+    return;
+  }
+
+  // The heading of the ego is estimated from the move of the requested area, since the clients
+  // request an area around the ego
+  const auto last_area_info = last_area_info_;
+  last_area_info_ = area_info;
+  if (!last_area_info) {
+    return;
+  }
+  const double dx = area_info.center_x - last_area_info->center_x;
+  const double dy = area_info.center_y - last_area_info->center_y;
+  const double distance = std::hypot(dx, dy);
+  if (distance < 1e-3) {
+    return;
+  }
+
+  autoware_map_msgs::msg::AreaInfo area_ahead = area_info;
+  area_ahead.center_x += dx / distance * prefetch_distance_;
+  area_ahead.center_y += dy / distance * prefetch_distance_;
+
+  std::vector<std::string> paths;
+  for (const auto & [path, metadata] : all_pcd_file_metadata_dict_) {
+    if (
+      is_grid_within_queried_area(area_ahead, metadata) &&
+      !is_grid_within_queried_area(area_info, metadata)) {
+      paths.push_back(path);
+    }
+  }
+  tile_cache_->prefetch(paths);
+}
+
 autoware_map_msgs::msg::PointCloudMapCellWithID
 DifferentialMapLoaderModule::load_point_cloud_map_cell_with_id(
   const std::string & path, const std::string & map_id) const
 {
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
-    RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
-  }
   autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
+  // the cell of a map which fails to load is empty
+  const auto tile = tile_cache_ ? tile_cache_->get(path) : load_tile(path);
+  if (tile) {
+    pointcloud_map_cell_with_id.pointcloud = *tile;
+  }
   pointcloud_map_cell_with_id.cell_id = map_id;
   return pointcloud_map_cell_with_id;
 }
+
+PointCloudTileCache::TileConstPtr DifferentialMapLoaderModule::load_tile(
+  const std::string & path) const
+{
+  auto pcd = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  if (!load_map_tile(path, *pcd)) {
+    RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
+    return nullptr;
+  }
+  return pcd;
+}
+
+void DifferentialMapLoaderModule::update_cache_diagnostics(
+  diagnostic_updater::DiagnosticStatusWrapper & stat) const
+{
+  const auto statistics = tile_cache_->statistics();
+  const size_t requests = statistics.hits + statistics.misses;
+  const double hit_rate =
+    requests > 0 ? static_cast<double>(statistics.hits) / static_cast<double>(requests) : 0.0;
+
+  stat.add("capacity", statistics.capacity);
+  stat.add("size", statistics.size);
+  stat.add("hits", statistics.hits);
+  stat.add("misses", statistics.misses);
+  stat.add("hit_rate", hit_rate);
+  stat.add("prefetched", statistics.prefetched);
+  stat.add("failures", statistics.failures);
+  if (statistics.failures > 0) {
+    stat.summary(diagnostic_msgs::msg::DiagnosticStatus::WARN, "failed to load some maps");
+  } else {
+    stat.summary(diagnostic_msgs::msg::DiagnosticStatus::OK, "OK");
+  }
+}
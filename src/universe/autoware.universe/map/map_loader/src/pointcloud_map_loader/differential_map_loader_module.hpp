@@ -15,8 +15,10 @@
 #ifndef POINTCLOUD_MAP_LOADER__DIFFERENTIAL_MAP_LOADER_MODULE_HPP_
 #define POINTCLOUD_MAP_LOADER__DIFFERENTIAL_MAP_LOADER_MODULE_HPP_
 
+#include "pointcloud_tile_cache.hpp"
 #include "utils.hpp"
 
+#include <diagnostic_updater/diagnostic_updater.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include "autoware_map_msgs/srv/get_differential_point_cloud_map.hpp"
@@ -29,6 +31,8 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -37,8 +41,14 @@ class DifferentialMapLoaderModule
   using GetDifferentialPointCloudMap = autoware_map_msgs::srv::GetDifferentialPointCloudMap;
 
 public:
+  /**
+   * @param tile_cache_size Number of tiles kept in memory. 0 disables the cache
+   * @param prefetch_distance Distance [m] ahead of the requested area whose tiles are prefetched
+   * into the cache. 0 disables the prefetch
+   */
   explicit DifferentialMapLoaderModule(
-    rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict);
+    rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+    const size_t tile_cache_size = 0, const double prefetch_distance = 0.0);
 
 private:
   rclcpp::Logger logger_;
@@ -46,14 +56,22 @@ private:
   std::map<std::string, PCDFileMetadata> all_pcd_file_metadata_dict_;
   rclcpp::Service<GetDifferentialPointCloudMap>::SharedPtr get_differential_pcd_maps_service_;
 
+  std::unique_ptr<PointCloudTileCache> tile_cache_;
+  double prefetch_distance_;
+  std::optional<autoware_map_msgs::msg::AreaInfo> last_area_info_;
+  std::unique_ptr<diagnostic_updater::Updater> diagnostics_updater_;
+
   [[nodiscard]] bool on_service_get_differential_point_cloud_map(
     GetDifferentialPointCloudMap::Request::SharedPtr req,
-    GetDifferentialPointCloudMap::Response::SharedPtr res) const;
+    GetDifferentialPointCloudMap::Response::SharedPtr res);
   void differential_area_load(
     const autoware_map_msgs::msg::AreaInfo & area_info, const std::vector<std::string> & cached_ids,
     const GetDifferentialPointCloudMap::Response::SharedPtr & response) const;
+  void prefetch_area_ahead(const autoware_map_msgs::msg::AreaInfo & area_info);
   [[nodiscard]] autoware_map_msgs::msg::PointCloudMapCellWithID load_point_cloud_map_cell_with_id(
     const std::string & path, const std::string & map_id) const;
+  [[nodiscard]] PointCloudTileCache::TileConstPtr load_tile(const std::string & path) const;
+  void update_cache_diagnostics(diagnostic_updater::DiagnosticStatusWrapper & stat) const;
 };
 
 #endif  // POINTCLOUD_MAP_LOADER__DIFFERENTIAL_MAP_LOADER_MODULE_HPP_
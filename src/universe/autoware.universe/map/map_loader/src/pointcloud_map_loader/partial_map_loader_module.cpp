@@ -14,6 +14,8 @@
 
 #include "partial_map_loader_module.hpp"
 
+#include "binary_map_tile.hpp"
+
 #include <utility>
 
 PartialMapLoaderModule::PartialMapLoaderModule(
@@ -68,7 +70,7 @@ PartialMapLoaderModule::load_point_cloud_map_cell_with_id(
   const std::string & path, const std::string & map_id) const
 {
   sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
+  if (!load_map_tile(path, pcd)) {
     RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
   }
   autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
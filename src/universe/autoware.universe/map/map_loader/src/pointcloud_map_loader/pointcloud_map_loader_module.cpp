@@ -14,10 +14,12 @@
 
 #include "pointcloud_map_loader_module.hpp"
 
+#include "binary_map_tile.hpp"
 #include "utils.hpp"
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -71,6 +73,19 @@ sensor_msgs::msg::PointCloud2 PointcloudMapLoaderModule::load_pcd_files(
   sensor_msgs::msg::PointCloud2 whole_pcd;
   sensor_msgs::msg::PointCloud2 partial_pcd;
 
+  // The points of the tiles are concatenated, so all the tiles must have the same fields
+  const auto binary_tile_count =
+    std::count_if(pcd_paths.begin(), pcd_paths.end(), is_binary_map_tile);
+  if (0 < binary_tile_count && static_cast<size_t>(binary_tile_count) < pcd_paths.size()) {
+    RCLCPP_ERROR_STREAM(
+      logger_, fmt::format(
+                 "PCD files and binary map tiles cannot be loaded together ({} binary map tiles "
+                 "out of {} files). Convert all the tiles to the same format.",
+                 binary_tile_count, pcd_paths.size()));
+    whole_pcd.header.frame_id = "map";
+    return whole_pcd;
+  }
+
   for (size_t i = 0; i < pcd_paths.size(); ++i) {
     auto & path = pcd_paths[i];
     if (i % 50 == 0) {
@@ -78,7 +93,7 @@ sensor_msgs::msg::PointCloud2 PointcloudMapLoaderModule::load_pcd_files(
         logger_, fmt::format("Load {} ({} out of {})", path, i + 1, pcd_paths.size()));
     }
 
-    if (pcl::io::loadPCDFile(path, partial_pcd) == -1) {
+    if (!load_map_tile(path, partial_pcd)) {
       RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
     }
 
@@ -14,11 +14,14 @@
 
 #include "pointcloud_map_loader_node.hpp"
 
+#include "binary_map_tile.hpp"
+
 #include <glob.h>
 #include <pcl/filters/voxel_grid.h>
 #include <pcl/io/pcd_io.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <string>
@@ -28,7 +31,7 @@ namespace fs = std::filesystem;
 
 namespace
 {
-bool is_pcd_file(const std::string & p)
+bool is_pointcloud_map_file(const std::string & p)
 {
   if (fs::is_directory(p)) {
     return false;
@@ -36,7 +39,7 @@ bool is_pcd_file(const std::string & p)
 
   const std::string ext = fs::path(p).extension();
 
-  return !(ext != ".pcd" && ext != ".PCD");
+  return ext == ".pcd" || ext == ".PCD" || ext == binary_map_tile_extension;
 }
 }  // namespace
 
@@ -50,6 +53,8 @@ PointCloudMapLoaderNode::PointCloudMapLoaderNode(const rclcpp::NodeOptions & opt
   bool enable_downsample_whole_load = declare_parameter<bool>("enable_downsampled_whole_load");
   bool enable_partial_load = declare_parameter<bool>("enable_partial_load");
   bool enable_selected_load = declare_parameter<bool>("enable_selected_load");
+  const auto tile_cache_size = declare_parameter<int>("tile_cache_size");
+  const double prefetch_distance = declare_parameter<double>("prefetch_distance");
 
   if (enable_whole_load) {
     std::string publisher_name = "output/pointcloud_map";
@@ -70,7 +75,9 @@ PointCloudMapLoaderNode::PointCloudMapLoaderNode(const rclcpp::NodeOptions & opt
     partial_map_loader_ = std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict);
   }
 
-  differential_map_loader_ = std::make_unique<DifferentialMapLoaderModule>(this, pcd_metadata_dict);
+  differential_map_loader_ = std::make_unique<DifferentialMapLoaderModule>(
+    this, pcd_metadata_dict, static_cast<size_t>(std::max<int64_t>(tile_cache_size, 0)),
+    prefetch_distance);
 
   if (enable_selected_load) {
     selected_map_loader_ = std::make_unique<SelectedMapLoaderModule>(this, pcd_metadata_dict);
@@ -109,12 +116,23 @@ std::map<std::string, PCDFileMetadata> PointCloudMapLoaderNode::get_pcd_metadata
     // Note that this should ideally be avoided and thus eventually be removed by someone, until
     // Autoware users get used to handling the PCD file(s) with metadata.
     RCLCPP_DEBUG_STREAM(get_logger(), "Create PCD metadata, as the pointcloud is a single file.");
-    pcl::PointCloud<pcl::PointXYZ> single_pcd;
     const auto & pcd_path = pcd_paths.front();
+    PCDFileMetadata metadata = {};
+    if (is_binary_map_tile(pcd_path)) {
+      // the bounds are stored in the header, so that the points need not be read
+      BinaryMapTileReader reader;
+      if (!reader.open(pcd_path)) {
+        throw std::runtime_error("Binary map tile load failed: " + pcd_path);
+      }
+      const auto & header = reader.header();
+      metadata.min = pcl::PointXYZ(header.min[0], header.min[1], header.min[2]);
+      metadata.max = pcl::PointXYZ(header.max[0], header.max[1], header.max[2]);
+      return std::map<std::string, PCDFileMetadata>{{pcd_path, metadata}};
+    }
+    pcl::PointCloud<pcl::PointXYZ> single_pcd;
     if (pcl::io::loadPCDFile(pcd_path, single_pcd) == -1) {
       throw std::runtime_error("PCD load failed: " + pcd_path);
     }
-    PCDFileMetadata metadata = {};
     pcl::getMinMax3D(single_pcd, metadata.min, metadata.max);
     return std::map<std::string, PCDFileMetadata>{{pcd_path, metadata}};
   }
@@ -130,14 +148,14 @@ std::vector<std::string> PointCloudMapLoaderNode::get_pcd_paths(
       RCLCPP_ERROR_STREAM(get_logger(), "invalid path: " << p);
     }
 
-    if (is_pcd_file(p)) {
+    if (is_pointcloud_map_file(p)) {
       pcd_paths.push_back(p);
     }
 
     if (fs::is_directory(p)) {
       for (const auto & file : fs::directory_iterator(p)) {
         const auto filename = file.path().string();
-        if (is_pcd_file(filename)) {
+        if (is_pointcloud_map_file(filename)) {
           pcd_paths.push_back(filename);
         }
       }
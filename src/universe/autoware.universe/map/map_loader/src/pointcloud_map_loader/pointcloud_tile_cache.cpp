@@ -0,0 +1,108 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_tile_cache.hpp"
+
+#include <utility>
+
+PointCloudTileCache::PointCloudTileCache(size_t capacity, TileLoader load_tile)
+: load_tile_(std::move(load_tile)), cache_(capacity)
+{
+  statistics_.capacity = capacity;
+  prefetch_thread_ = std::thread(&PointCloudTileCache::prefetch_loop, this);
+}
+
+PointCloudTileCache::~PointCloudTileCache()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_prefetch_ = true;
+  }
+  prefetch_cv_.notify_all();
+  prefetch_thread_.join();
+}
+
+PointCloudTileCache::TileConstPtr PointCloudTileCache::get(const std::string & path)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (const auto tile = cache_.get(path)) {
+      ++statistics_.hits;
+      return *tile;
+    }
+    ++statistics_.misses;
+  }
+
+  // NOTE: the file is parsed without the lock, so that the other tiles can be served meanwhile
+  auto tile = load_tile_(path);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!tile) {
+    ++statistics_.failures;
+    return nullptr;
+  }
+  cache_.put(path, tile);
+  return tile;
+}
+
+void PointCloudTileCache::prefetch(const std::vector<std::string> & paths)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prefetch_queue_.clear();
+    for (const auto & path : paths) {
+      if (!cache_.contains(path)) {
+        prefetch_queue_.push_back(path);
+      }
+    }
+  }
+  prefetch_cv_.notify_one();
+}
+
+PointCloudTileCache::Statistics PointCloudTileCache::statistics() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  Statistics statistics = statistics_;
+  statistics.size = cache_.size();
+  return statistics;
+}
+
+void PointCloudTileCache::prefetch_loop()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    prefetch_cv_.wait(lock, [this] { return stop_prefetch_ || !prefetch_queue_.empty(); });
+    if (stop_prefetch_) {
+      return;
+    }
+
+    const std::string path = prefetch_queue_.front();
+    prefetch_queue_.pop_front();
+    if (cache_.contains(path)) {
+      continue;
+    }
+
+    lock.unlock();
+    auto tile = load_tile_(path);
+    lock.lock();
+
+    if (!tile) {
+      ++statistics_.failures;
+      continue;
+    }
+    // put() marks the tile as the most recently used one, which is intended for prefetched tiles
+    cache_.put(path, tile);
+    ++statistics_.prefetched;
+  }
+}
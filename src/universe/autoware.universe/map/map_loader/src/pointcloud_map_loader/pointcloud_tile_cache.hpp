@@ -0,0 +1,91 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_MAP_LOADER__POINTCLOUD_TILE_CACHE_HPP_
+#define POINTCLOUD_MAP_LOADER__POINTCLOUD_TILE_CACHE_HPP_
+
+#include <autoware/universe_utils/system/lru_cache.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief LRU cache of pointcloud map tiles, which are already converted to PointCloud2.
+ *
+ * The tiles are shared and never modified, so a tile evicted from the cache stays valid while it is
+ * still referenced. Tiles can be prefetched on a background thread. The loader returns nullptr when
+ * a tile fails to load, which is not cached so that the next request loads it again.
+ */
+class PointCloudTileCache
+{
+public:
+  using Tile = sensor_msgs::msg::PointCloud2;
+  using TileConstPtr = std::shared_ptr<const Tile>;
+  using TileLoader = std::function<TileConstPtr(const std::string & path)>;
+
+  struct Statistics
+  {
+    size_t capacity{0};
+    size_t size{0};
+    size_t hits{0};
+    size_t misses{0};
+    size_t prefetched{0};
+    size_t failures{0};
+  };
+
+  PointCloudTileCache(size_t capacity, TileLoader load_tile);
+  ~PointCloudTileCache();
+
+  PointCloudTileCache(const PointCloudTileCache &) = delete;
+  PointCloudTileCache & operator=(const PointCloudTileCache &) = delete;
+
+  /**
+   * @brief Get a tile, and load it if it is not cached.
+   * @return nullptr if the tile fails to load
+   */
+  TileConstPtr get(const std::string & path);
+
+  /**
+   * @brief Load the tiles which are not cached on the background thread. The tiles requested by
+   * the previous call and not loaded yet are dropped.
+   */
+  void prefetch(const std::vector<std::string> & paths);
+
+  Statistics statistics() const;
+
+private:
+  void prefetch_loop();
+
+  TileLoader load_tile_;
+
+  mutable std::mutex mutex_;
+  autoware::universe_utils::LRUCache<std::string, TileConstPtr> cache_;
+  Statistics statistics_;
+
+  std::deque<std::string> prefetch_queue_;
+  std::condition_variable prefetch_cv_;
+  bool stop_prefetch_{false};
+  std::thread prefetch_thread_;
+};
+
+#endif  // POINTCLOUD_MAP_LOADER__POINTCLOUD_TILE_CACHE_HPP_
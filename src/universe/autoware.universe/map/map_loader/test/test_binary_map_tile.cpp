@@ -0,0 +1,133 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/pointcloud_map_loader/binary_map_tile.hpp"
+
+#include <gtest/gtest.h>
+#include <pcl/common/io.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+class TestBinaryMapTile : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<float> xy(-10.0f, 10.0f);
+    std::normal_distribution<float> z(1.0f, 0.2f);
+    std::uniform_real_distribution<float> intensity(0.0f, 255.0f);
+    for (int i = 0; i < 5000; ++i) {
+      pcl::PointXYZI point;
+      point.x = xy(engine);
+      point.y = xy(engine);
+      point.z = z(engine);
+      point.intensity = intensity(engine);
+      cloud_.push_back(point);
+    }
+
+    path_ = (std::filesystem::temp_directory_path() / "test_binary_map_tile.pcbin").string();
+  }
+
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  pcl::PointCloud<pcl::PointXYZI> cloud_;
+  std::string path_;
+};
+
+TEST_F(TestBinaryMapTile, RoundTrip)
+{
+  ASSERT_TRUE(write_binary_map_tile(path_, cloud_));
+
+  BinaryMapTileReader reader;
+  ASSERT_TRUE(reader.open(path_));
+  const auto & header = reader.header();
+  ASSERT_EQ(header.point_count, cloud_.size());
+  EXPECT_TRUE(reader.has_intensity());
+  EXPECT_EQ(header.points_offset % binary_map_tile_alignment, 0U);
+  EXPECT_EQ(
+    std::filesystem::file_size(path_),
+    header.points_offset + cloud_.size() * sizeof(BinaryMapTilePoint));
+
+  for (size_t i = 0; i < cloud_.size(); ++i) {
+    EXPECT_EQ(reader.points()[i].x, cloud_.points[i].x);
+    EXPECT_EQ(reader.points()[i].y, cloud_.points[i].y);
+    EXPECT_EQ(reader.points()[i].z, cloud_.points[i].z);
+    EXPECT_EQ(reader.points()[i].intensity, cloud_.points[i].intensity);
+    EXPECT_LE(header.min[2], cloud_.points[i].z);
+    EXPECT_GE(header.max[2], cloud_.points[i].z);
+  }
+
+  sensor_msgs::msg::PointCloud2 msg;
+  ASSERT_TRUE(load_map_tile(path_, msg));
+  EXPECT_EQ(msg.width, cloud_.size());
+  ASSERT_EQ(msg.fields.size(), 4U);
+  EXPECT_EQ(msg.fields.back().name, "intensity");
+  EXPECT_EQ(msg.data.size(), cloud_.size() * sizeof(BinaryMapTilePoint));
+  float last_intensity = 0.0f;
+  std::memcpy(
+    &last_intensity, msg.data.data() + msg.data.size() - msg.point_step + msg.fields.back().offset,
+    sizeof(float));
+  EXPECT_EQ(last_intensity, cloud_.points.back().intensity);
+}
+
+TEST_F(TestBinaryMapTile, RoundTripWithoutIntensity)
+{
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  pcl::copyPointCloud(cloud_, cloud);
+  ASSERT_TRUE(write_binary_map_tile(path_, cloud));
+
+  BinaryMapTileReader reader;
+  ASSERT_TRUE(reader.open(path_));
+  EXPECT_FALSE(reader.has_intensity());
+
+  // the intensity field is not published for a map without it
+  sensor_msgs::msg::PointCloud2 msg;
+  ASSERT_TRUE(load_map_tile(path_, msg));
+  ASSERT_EQ(msg.fields.size(), 3U);
+  EXPECT_EQ(msg.fields.back().name, "z");
+  float last_z = 0.0f;
+  std::memcpy(
+    &last_z, msg.data.data() + msg.data.size() - msg.point_step + msg.fields.back().offset,
+    sizeof(float));
+  EXPECT_EQ(last_z, cloud.points.back().z);
+}
+
+TEST_F(TestBinaryMapTile, RejectCorruptedFile)
+{
+  ASSERT_TRUE(write_binary_map_tile(path_, cloud_));
+
+  // truncate the file in the middle of the points
+  const auto size = std::filesystem::file_size(path_);
+  std::filesystem::resize_file(path_, size / 2);
+  BinaryMapTileReader reader;
+  EXPECT_FALSE(reader.open(path_));
+  EXPECT_FALSE(reader.is_open());
+
+  {
+    std::ofstream ofs(path_, std::ios::binary | std::ios::trunc);
+    ofs << std::string(sizeof(BinaryMapTileHeader), 'x');
+  }
+  EXPECT_FALSE(reader.open(path_));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "../src/pointcloud_map_loader/binary_map_tile.hpp"
 #include "../src/pointcloud_map_loader/pointcloud_map_loader_module.hpp"
 #include "../src/pointcloud_map_loader/utils.hpp"
 
@@ -31,6 +32,7 @@ class TestPointcloudMapLoaderModule : public ::testing::Test
 protected:
   rclcpp::Node::SharedPtr node;
   std::string temp_pcd_path;
+  std::string temp_binary_tile_path;
 
   void SetUp() override
   {
@@ -52,6 +54,8 @@ protected:
 
     temp_pcd_path = "/tmp/test_pointcloud_map_loader_module.pcd";
     pcl::io::savePCDFileASCII(temp_pcd_path, cloud);
+    temp_binary_tile_path = "/tmp/test_pointcloud_map_loader_module.pcbin";
+    write_binary_map_tile(temp_binary_tile_path, cloud);
   }
 
   void TearDown() override { rclcpp::shutdown(); }
@@ -107,6 +111,33 @@ TEST_F(TestPointcloudMapLoaderModule, LoadPCDFilesNoDownsampleTest)
   }
 }
 
+TEST_F(TestPointcloudMapLoaderModule, RejectMixedTileFormatsTest)
+{
+  using namespace std::literals::chrono_literals;
+
+  // A PCD file and a binary map tile have different point layouts, so they must not be concatenated
+  std::vector<std::string> pcd_paths = {temp_pcd_path, temp_binary_tile_path};
+  PointcloudMapLoaderModule loader(node.get(), pcd_paths, "pointcloud_map_mixed", false);
+
+  auto pointcloud_received = std::make_shared<bool>(false);
+  rclcpp::QoS durable_qos{10};
+  durable_qos.transient_local();
+  auto pointcloud_sub = node->create_subscription<sensor_msgs::msg::PointCloud2>(
+    "pointcloud_map_mixed", durable_qos,
+    [pointcloud_received](const sensor_msgs::msg::PointCloud2::ConstSharedPtr) {
+      *pointcloud_received = true;
+    });
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  auto start_time = node->now();
+  while (!*pointcloud_received && (node->now() - start_time).seconds() < 1) {
+    executor.spin_some(50ms);
+  }
+
+  EXPECT_FALSE(*pointcloud_received);
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
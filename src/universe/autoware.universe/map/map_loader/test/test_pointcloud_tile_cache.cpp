@@ -0,0 +1,155 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/pointcloud_map_loader/pointcloud_tile_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+class TestPointCloudTileCache : public ::testing::Test
+{
+protected:
+  PointCloudTileCache::TileLoader loader()
+  {
+    return [this](const std::string & path) {
+      ++load_count_;
+      auto tile = std::make_shared<PointCloudTileCache::Tile>();
+      tile->header.frame_id = path;
+      return tile;
+    };
+  }
+
+  std::atomic<int> load_count_{0};
+};
+
+TEST_F(TestPointCloudTileCache, LoadOnlyOnMiss)
+{
+  PointCloudTileCache cache(2, loader());
+
+  EXPECT_EQ(cache.get("a")->header.frame_id, "a");
+  EXPECT_EQ(cache.get("a")->header.frame_id, "a");
+  EXPECT_EQ(load_count_, 1);
+
+  const auto statistics = cache.statistics();
+  EXPECT_EQ(statistics.capacity, 2U);
+  EXPECT_EQ(statistics.size, 1U);
+  EXPECT_EQ(statistics.hits, 1U);
+  EXPECT_EQ(statistics.misses, 1U);
+}
+
+TEST_F(TestPointCloudTileCache, EvictLeastRecentlyUsed)
+{
+  PointCloudTileCache cache(2, loader());
+
+  const auto tile_a = cache.get("a");
+  cache.get("b");
+  cache.get("a");
+  cache.get("c");  // evicts "b"
+  EXPECT_EQ(load_count_, 3);
+  EXPECT_EQ(cache.statistics().size, 2U);
+
+  cache.get("a");
+  EXPECT_EQ(load_count_, 3);
+  cache.get("b");
+  EXPECT_EQ(load_count_, 4);
+
+  // the evicted tile is still valid while it is referenced
+  cache.get("c");
+  cache.get("d");
+  EXPECT_EQ(tile_a->header.frame_id, "a");
+}
+
+TEST_F(TestPointCloudTileCache, Prefetch)
+{
+  PointCloudTileCache cache(4, loader());
+  cache.get("a");
+  cache.prefetch({"a", "b", "c"});
+
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+  while (cache.statistics().prefetched < 2 && std::chrono::steady_clock::now() < timeout) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(cache.statistics().prefetched, 2U);
+  EXPECT_EQ(load_count_, 3);
+
+  cache.get("b");
+  cache.get("c");
+  EXPECT_EQ(load_count_, 3);
+  EXPECT_EQ(cache.statistics().hits, 2U);
+}
+
+TEST_F(TestPointCloudTileCache, DoNotCacheFailures)
+{
+  int fail_count = 2;
+  PointCloudTileCache cache(2, [&](const std::string & path) -> PointCloudTileCache::TileConstPtr {
+    ++load_count_;
+    if (fail_count > 0) {
+      --fail_count;
+      return nullptr;
+    }
+    auto tile = std::make_shared<PointCloudTileCache::Tile>();
+    tile->header.frame_id = path;
+    return tile;
+  });
+
+  // the failed tile is loaded again on the next request
+  EXPECT_EQ(cache.get("a"), nullptr);
+  EXPECT_EQ(cache.statistics().size, 0U);
+  EXPECT_EQ(cache.get("a"), nullptr);
+  ASSERT_NE(cache.get("a"), nullptr);
+  EXPECT_EQ(cache.get("a")->header.frame_id, "a");
+  EXPECT_EQ(load_count_, 3);
+
+  const auto statistics = cache.statistics();
+  EXPECT_EQ(statistics.size, 1U);
+  EXPECT_EQ(statistics.hits, 1U);
+  EXPECT_EQ(statistics.misses, 3U);
+  EXPECT_EQ(statistics.failures, 2U);
+}
+
+TEST_F(TestPointCloudTileCache, DoNotPrefetchFailures)
+{
+  PointCloudTileCache cache(4, [this](const std::string & path) {
+    ++load_count_;
+    return path == "bad" ? nullptr : std::make_shared<const PointCloudTileCache::Tile>();
+  });
+  cache.prefetch({"bad", "b"});
+
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+  const auto done = [&cache] {
+    const auto statistics = cache.statistics();
+    return statistics.prefetched + statistics.failures >= 2;
+  };
+  while (!done() && std::chrono::steady_clock::now() < timeout) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  const auto statistics = cache.statistics();
+  EXPECT_EQ(statistics.prefetched, 1U);
+  EXPECT_EQ(statistics.failures, 1U);
+  EXPECT_EQ(statistics.size, 1U);
+
+  EXPECT_EQ(cache.get("bad"), nullptr);
+  EXPECT_EQ(load_count_, 3);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
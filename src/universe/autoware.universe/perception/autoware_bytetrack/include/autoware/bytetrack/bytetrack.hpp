@@ -47,7 +47,10 @@ using ObjectArray = std::vector<Object>;
 class ByteTrack
 {
 public:
-  explicit ByteTrack(const int track_buffer_length = 30);
+  explicit ByteTrack(
+    const int track_buffer_length = 30, const float track_thresh = 0.5,
+    const float high_thresh = 0.6, const float match_thresh = 0.8,
+    const bool use_sparse_assignment = false);
 
   bool do_inference(ObjectArray & objects);
   ObjectArray update_tracker(ObjectArray & input_objects);
@@ -40,6 +40,8 @@
 
 #include "strack.h"
 
+#include <autoware/sparse_assignment/sparse_assignment.hpp>
+
 #include <vector>
 
 struct ByteTrackObject
@@ -54,7 +56,7 @@ class ByteTracker
 public:
   ByteTracker(
     int track_buffer = 30, float track_thresh = 0.5, float high_thresh = 0.6,
-    float match_thresh = 0.8);
+    float match_thresh = 0.8, bool use_sparse_assignment = false);
   ~ByteTracker();
 
   std::vector<STrack> update(const std::vector<ByteTrackObject> & objects);
@@ -93,6 +95,10 @@ private:
   int frame_id;
   int max_time_lost;
 
+  // solve the assignments on the pairs below the cost threshold instead of by lapjv
+  bool use_sparse_assignment;
+  autoware::sparse_assignment::SparseAssignmentSolver sparse_solver;
+
   std::vector<STrack> tracked_stracks;
   std::vector<STrack> lost_stracks;
   std::vector<STrack> removed_stracks;
@@ -42,8 +42,12 @@
 #include <fstream>
 
 ByteTracker::ByteTracker(
-  int track_buffer, float track_thresh, float high_thresh, float match_thresh)
-: track_thresh(track_thresh), high_thresh(high_thresh), match_thresh(match_thresh)
+  int track_buffer, float track_thresh, float high_thresh, float match_thresh,
+  bool use_sparse_assignment)
+: track_thresh(track_thresh),
+  high_thresh(high_thresh),
+  match_thresh(match_thresh),
+  use_sparse_assignment(use_sparse_assignment)
 
 {
   frame_id = 0;
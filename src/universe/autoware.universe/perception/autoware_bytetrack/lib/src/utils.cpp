@@ -158,7 +158,23 @@ void ByteTracker::linear_assignment(
 
   std::vector<int> rowsol;
   std::vector<int> colsol;
-  [[maybe_unused]] float c = lapjv(cost_matrix, rowsol, colsol, true, thresh);
+  if (use_sparse_assignment) {
+    // same assignment as lapjv with cost_limit = thresh, which never assigns pairs above thresh
+    std::vector<autoware::sparse_assignment::Edge> edges;
+    for (int i = 0; i < cost_matrix_size; i++) {
+      for (int j = 0; j < cost_matrix_size_size; j++) {
+        if (cost_matrix[i][j] < thresh) {
+          edges.push_back({i, j, cost_matrix[i][j]});
+        }
+      }
+    }
+    autoware::sparse_assignment::Assignment assignment;
+    sparse_solver.minimize(cost_matrix_size, cost_matrix_size_size, edges, thresh, assignment);
+    rowsol = assignment.row_to_col;
+    colsol = assignment.col_to_row;
+  } else {
+    [[maybe_unused]] float c = lapjv(cost_matrix, rowsol, colsol, true, thresh);
+  }
   for (size_t i = 0; i < rowsol.size(); i++) {
     if (rowsol[i] >= 0) {
       std::vector<int> match;
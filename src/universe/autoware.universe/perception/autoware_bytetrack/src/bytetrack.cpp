@@ -20,10 +20,13 @@
 
 namespace autoware::bytetrack
 {
-ByteTrack::ByteTrack(const int track_buffer_length)
+ByteTrack::ByteTrack(
+  const int track_buffer_length, const float track_thresh, const float high_thresh,
+  const float match_thresh, const bool use_sparse_assignment)
 {
   // Tracker initialization
-  tracker_ = std::make_unique<ByteTracker>(track_buffer_length);
+  tracker_ = std::make_unique<ByteTracker>(
+    track_buffer_length, track_thresh, high_thresh, match_thresh, use_sparse_assignment);
 }
 
 bool ByteTrack::do_inference(ObjectArray & objects)
@@ -32,8 +32,14 @@ ByteTrackNode::ByteTrackNode(const rclcpp::NodeOptions & node_options)
   using std::chrono_literals::operator""ms;
 
   int track_buffer_length = declare_parameter("track_buffer_length", 30);
-
-  this->bytetrack_ = std::make_unique<autoware::bytetrack::ByteTrack>(track_buffer_length);
+  double track_thresh = declare_parameter("track_thresh", 0.5);
+  double high_thresh = declare_parameter("high_thresh", 0.6);
+  double match_thresh = declare_parameter("match_thresh", 0.8);
+  bool use_sparse_assignment = declare_parameter("use_sparse_assignment", false);
+
+  this->bytetrack_ = std::make_unique<autoware::bytetrack::ByteTrack>(
+    track_buffer_length, static_cast<float>(track_thresh), static_cast<float>(high_thresh),
+    static_cast<float>(match_thresh), use_sparse_assignment);
 
   timer_ =
     rclcpp::create_timer(this, get_clock(), 100ms, std::bind(&ByteTrackNode::on_connect, this));
@@ -32,13 +32,7 @@ bool VoxelBasedApproximateStaticMapLoader::is_close_to_map(
   if (voxel_map_ptr_ == NULL) {
     return false;
   }
-  const int index =
-    voxel_grid_.getCentroidIndexAt(voxel_grid_.getGridCoordinates(point.x, point.y, point.z));
-  if (index == -1) {
-    return false;
-  } else {
-    return true;
-  }
+  return occupancy_set_.is_occupied(point);
 }
 
 bool VoxelBasedApproximateDynamicMapLoader::is_close_to_map(
@@ -47,26 +41,7 @@ bool VoxelBasedApproximateDynamicMapLoader::is_close_to_map(
   if (current_voxel_grid_dict_.size() == 0) {
     return false;
   }
-
-  const int map_grid_index = static_cast<int>(
-    std::floor((point.x - origin_x_) / map_grid_size_x_) +
-    map_grids_x_ * std::floor((point.y - origin_y_) / map_grid_size_y_));
-
-  if (static_cast<size_t>(map_grid_index) >= current_voxel_grid_array_.size()) {
-    return false;
-  }
-  if (current_voxel_grid_array_.at(map_grid_index) != NULL) {
-    const int index = current_voxel_grid_array_.at(map_grid_index)
-                        ->map_cell_voxel_grid.getCentroidIndexAt(
-                          current_voxel_grid_array_.at(map_grid_index)
-                            ->map_cell_voxel_grid.getGridCoordinates(point.x, point.y, point.z));
-    if (index == -1) {
-      return false;
-    } else {
-      return true;
-    }
-  }
-  return false;
+  return occupancy_set_.is_occupied(point);
 }
 
 VoxelBasedApproximateCompareMapFilterComponent::VoxelBasedApproximateCompareMapFilterComponent(
@@ -114,18 +89,29 @@ void VoxelBasedApproximateCompareMapFilterComponent::filter(
   int offset_y = input->fields[pcl::getFieldIndex(*input, "y")].offset;
   int offset_z = input->fields[pcl::getFieldIndex(*input, "z")].offset;
 
-  output.data.resize(input->data.size());
-  output.point_step = point_step;
-  size_t output_size = 0;
-  for (size_t global_offset = 0; global_offset < input->data.size(); global_offset += point_step) {
+  // the map is not updated while the mutex is locked, so the points are compared in parallel
+  const int num_points = static_cast<int>(input->data.size() / point_step);
+  std::vector<uint8_t> is_close_to_map(num_points, 0);
+#pragma omp parallel for
+  for (int i = 0; i < num_points; ++i) {
+    const size_t global_offset = static_cast<size_t>(i) * point_step;
     pcl::PointXYZ point{};
     std::memcpy(&point.x, &input->data[global_offset + offset_x], sizeof(float));
     std::memcpy(&point.y, &input->data[global_offset + offset_y], sizeof(float));
     std::memcpy(&point.z, &input->data[global_offset + offset_z], sizeof(float));
-    if (voxel_based_approximate_map_loader_->is_close_to_map(point, distance_threshold_)) {
+    is_close_to_map[i] =
+      voxel_based_approximate_map_loader_->is_close_to_map(point, distance_threshold_);
+  }
+
+  output.data.resize(input->data.size());
+  output.point_step = point_step;
+  size_t output_size = 0;
+  for (int i = 0; i < num_points; ++i) {
+    if (is_close_to_map[i]) {
       continue;
     }
-    std::memcpy(&output.data[output_size], &input->data[global_offset], point_step);
+    std::memcpy(
+      &output.data[output_size], &input->data[static_cast<size_t>(i) * point_step], point_step);
     output_size += point_step;
   }
   output.header = input->header;
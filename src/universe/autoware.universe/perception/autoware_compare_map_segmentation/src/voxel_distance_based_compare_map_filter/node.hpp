@@ -46,6 +46,7 @@ public:
     std::string * tf_map_input_frame, std::mutex * mutex)
   : VoxelGridStaticMapLoader(node, leaf_size, downsize_ratio_z_axis, tf_map_input_frame, mutex)
   {
+    occupancy_set_.set_leaf_size(voxel_leaf_size_, voxel_leaf_size_);
     RCLCPP_INFO(logger_, "VoxelDistanceBasedStaticMapLoader initialized.\n");
   }
   bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold) override;
@@ -66,6 +67,7 @@ public:
   : VoxelGridDynamicMapLoader(
       node, leaf_size, downsize_ratio_z_axis, tf_map_input_frame, mutex, main_callback_group)
   {
+    occupancy_set_.set_leaf_size(voxel_leaf_size_, voxel_leaf_size_);
     RCLCPP_INFO(logger_, "VoxelDistanceBasedDynamicMapLoader initialized.\n");
   }
   bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold) override;
@@ -119,6 +121,7 @@ public:
     // add
     (*mutex_ptr_).lock();
     current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item});
+    occupancy_set_.add_cell(map_cell_to_add.cell_id, *current_voxel_grid_list_item.map_cell_pc_ptr);
     (*mutex_ptr_).unlock();
   }
 };
@@ -41,11 +41,21 @@ void VoxelGridMapLoader::publish_downsampled_map(
 }
 
 bool VoxelGridMapLoader::is_close_to_neighbor_voxels(
-  const pcl::PointXYZ & point, const double distance_threshold, VoxelGridPointXYZ & voxel,
-  pcl::search::Search<pcl::PointXYZ>::Ptr tree)
+  const pcl::PointXYZ & point, const double distance_threshold) const
 {
-  const int index = voxel.getCentroidIndexAt(voxel.getGridCoordinates(point.x, point.y, point.z));
-  if (index != -1) {
+  return occupancy_set_.is_close_to_centroid(
+    point, distance_threshold, distance_threshold * downsize_ratio_z_axis_);
+}
+
+bool VoxelGridMapLoader::is_close_to_map_points(
+  const pcl::PointXYZ & point, const double distance_threshold,
+  const pcl::search::Search<pcl::PointXYZ>::Ptr & tree) const
+{
+  // map points within distance_threshold can only be in the 3x3x3 voxels around the point
+  if (!occupancy_set_.has_occupied_neighbor(point)) {
+    return false;
+  }
+  if (occupancy_set_.is_occupied(point)) {
     return true;
   }
   if (tree == NULL) {
@@ -59,196 +69,13 @@ bool VoxelGridMapLoader::is_close_to_neighbor_voxels(
   return true;
 }
 
-bool VoxelGridMapLoader::is_close_to_neighbor_voxels(
-  const pcl::PointXYZ & point, const double distance_threshold, const PointCloudPtr & map,
-  VoxelGridPointXYZ & voxel) const
-{
-  // check map downsampled pc
-  double distance_threshold_z = downsize_ratio_z_axis_ * distance_threshold;
-  if (map == NULL) {
-    return false;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y, point.z), point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y, point.z - distance_threshold_z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y, point.z + distance_threshold_z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y - distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y - distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y - distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y + distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y + distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y + distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y - distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y - distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y - distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y + distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y + distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y + distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  return false;
-}
-
-bool VoxelGridMapLoader::is_in_voxel(
-  const pcl::PointXYZ & src_point, const pcl::PointXYZ & target_point,
-  const double distance_threshold, const PointCloudPtr & map, VoxelGridPointXYZ & voxel) const
-{
-  int voxel_index =
-    voxel.getCentroidIndexAt(voxel.getGridCoordinates(src_point.x, src_point.y, src_point.z));
-  if (voxel_index != -1) {  // not empty voxel
-    const double dist_x = map->points.at(voxel_index).x - target_point.x;
-    const double dist_y = map->points.at(voxel_index).y - target_point.y;
-    const double dist_z = map->points.at(voxel_index).z - target_point.z;
-    // check if the point is inside the distance threshold voxel
-    if (
-      std::abs(dist_x) < distance_threshold && std::abs(dist_y) < distance_threshold &&
-      std::abs(dist_z) < distance_threshold * downsize_ratio_z_axis_) {
-      return true;
-    }
-  }
-  return false;
-}
-
 VoxelGridStaticMapLoader::VoxelGridStaticMapLoader(
   rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
   std::string * tf_map_input_frame, std::mutex * mutex)
 : VoxelGridMapLoader(node, leaf_size, downsize_ratio_z_axis, tf_map_input_frame, mutex)
 {
   voxel_leaf_size_z_ = voxel_leaf_size_ * downsize_ratio_z_axis_;
+  occupancy_set_.set_leaf_size(voxel_leaf_size_, voxel_leaf_size_z_);
   sub_map_ = node->create_subscription<sensor_msgs::msg::PointCloud2>(
     "map", rclcpp::QoS{1}.transient_local(),
     std::bind(&VoxelGridStaticMapLoader::onMapCallback, this, std::placeholders::_1));
@@ -268,6 +95,8 @@ void VoxelGridStaticMapLoader::onMapCallback(
   voxel_grid_.setInputCloud(map_pcl_ptr);
   voxel_grid_.setSaveLeafLayout(true);
   voxel_grid_.filter(*voxel_map_ptr_);
+  occupancy_set_.clear();
+  occupancy_set_.add_cell("map", *voxel_map_ptr_);
   (*mutex_ptr_).unlock();
 
   if (debug_) {
@@ -277,7 +106,7 @@ void VoxelGridStaticMapLoader::onMapCallback(
 bool VoxelGridStaticMapLoader::is_close_to_map(
   const pcl::PointXYZ & point, const double distance_threshold)
 {
-  if (is_close_to_neighbor_voxels(point, distance_threshold, voxel_map_ptr_, voxel_grid_)) {
+  if (is_close_to_neighbor_voxels(point, distance_threshold)) {
     return true;
   }
   return false;
@@ -290,6 +119,7 @@ VoxelGridDynamicMapLoader::VoxelGridDynamicMapLoader(
 : VoxelGridMapLoader(node, leaf_size, downsize_ratio_z_axis, tf_map_input_frame, mutex)
 {
   voxel_leaf_size_z_ = voxel_leaf_size_ * downsize_ratio_z_axis_;
+  occupancy_set_.set_leaf_size(voxel_leaf_size_, voxel_leaf_size_z_);
   auto timer_interval_ms = node->declare_parameter<int>("timer_interval_ms");
   map_update_distance_threshold_ = node->declare_parameter<double>("map_update_distance_threshold");
   map_loader_radius_ = node->declare_parameter<double>("map_loader_radius");
@@ -321,28 +151,6 @@ void VoxelGridDynamicMapLoader::onEstimatedPoseCallback(nav_msgs::msg::Odometry:
 {
   current_position_ = msg->pose.pose.position;
 }
-bool VoxelGridDynamicMapLoader::is_close_to_next_map_grid(
-  const pcl::PointXYZ & point, const int current_map_grid_index, const double distance_threshold)
-{
-  int neighbor_map_grid_index = static_cast<int>(
-    std::floor((point.x - origin_x_) / map_grid_size_x_) +
-    map_grids_x_ * std::floor((point.y - origin_y_) / map_grid_size_y_));
-
-  if (
-    static_cast<size_t>(neighbor_map_grid_index) >= current_voxel_grid_array_.size() ||
-    neighbor_map_grid_index == current_map_grid_index ||
-    current_voxel_grid_array_.at(neighbor_map_grid_index) != NULL) {
-    return false;
-  }
-  if (is_close_to_neighbor_voxels(
-        point, distance_threshold,
-        current_voxel_grid_array_.at(neighbor_map_grid_index)->map_cell_pc_ptr,
-        current_voxel_grid_array_.at(neighbor_map_grid_index)->map_cell_voxel_grid)) {
-    return true;
-  }
-  return false;
-}
-
 bool VoxelGridDynamicMapLoader::is_close_to_map(
   const pcl::PointXYZ & point, const double distance_threshold)
 {
@@ -350,48 +158,11 @@ bool VoxelGridDynamicMapLoader::is_close_to_map(
     return false;
   }
 
-  // Compare point with map grid that point belong to
-
-  int map_grid_index = static_cast<int>(
-    std::floor((point.x - origin_x_) / map_grid_size_x_) +
-    map_grids_x_ * std::floor((point.y - origin_y_) / map_grid_size_y_));
-
-  if (static_cast<size_t>(map_grid_index) >= current_voxel_grid_array_.size()) {
-    return false;
-  }
-  if (
-    current_voxel_grid_array_.at(map_grid_index) != NULL &&
-    is_close_to_neighbor_voxels(
-      point, distance_threshold, current_voxel_grid_array_.at(map_grid_index)->map_cell_pc_ptr,
-      current_voxel_grid_array_.at(map_grid_index)->map_cell_voxel_grid)) {
+  // The voxels of all loaded map cells are in the same set, so the neighbor map cells are
+  // compared as well when the point is close to a map cell boundary
+  if (is_close_to_neighbor_voxels(point, distance_threshold)) {
     return true;
   }
-
-  // Compare point with the neighbor map cells if point close to map cell boundary
-
-  if (is_close_to_next_map_grid(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z), map_grid_index,
-        distance_threshold)) {
-    return true;
-  }
-
-  if (is_close_to_next_map_grid(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z), map_grid_index,
-        distance_threshold)) {
-    return true;
-  }
-
-  if (is_close_to_next_map_grid(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z), map_grid_index,
-        distance_threshold)) {
-    return true;
-  }
-  if (is_close_to_next_map_grid(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z), map_grid_index,
-        distance_threshold)) {
-    return true;
-  }
-
   return false;
 }
 void VoxelGridDynamicMapLoader::timer_callback()
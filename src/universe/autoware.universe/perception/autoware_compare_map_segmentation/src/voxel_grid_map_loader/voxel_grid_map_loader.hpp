@@ -15,6 +15,8 @@
 #ifndef VOXEL_GRID_MAP_LOADER__VOXEL_GRID_MAP_LOADER_HPP_
 #define VOXEL_GRID_MAP_LOADER__VOXEL_GRID_MAP_LOADER_HPP_
 
+#include "voxel_occupancy_set.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include "autoware_map_msgs/srv/get_differential_point_cloud_map.hpp"
@@ -91,6 +93,8 @@ protected:
   double downsize_ratio_z_axis_;
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr downsampled_map_pub_;
   bool debug_ = false;
+  /** \brief Downsampled map voxels of all loaded map cells, guarded by mutex_ptr_ */
+  VoxelOccupancySet occupancy_set_;
 
 public:
   typedef VoxelGridEx<pcl::PointXYZ> VoxelGridPointXYZ;
@@ -100,16 +104,21 @@ public:
     rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
     std::string * tf_map_input_frame, std::mutex * mutex);
 
+  /** \brief Check if the point is close to the map. This is called from several threads at once,
+   * so it must not modify the loader.
+   */
   virtual bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold) = 0;
-  static bool is_close_to_neighbor_voxels(
-    const pcl::PointXYZ & point, const double distance_threshold, VoxelGridPointXYZ & voxel,
-    pcl::search::Search<pcl::PointXYZ>::Ptr tree);
+  /** \brief Check if a downsampled map point in the 3x3x3 voxels around the point is within
+   * distance_threshold in xy and distance_threshold * downsize_ratio_z_axis in z
+   */
   bool is_close_to_neighbor_voxels(
-    const pcl::PointXYZ & point, const double distance_threshold, const PointCloudPtr & map,
-    VoxelGridPointXYZ & voxel) const;
-  bool is_in_voxel(
-    const pcl::PointXYZ & src_point, const pcl::PointXYZ & target_point,
-    const double distance_threshold, const PointCloudPtr & map, VoxelGridPointXYZ & voxel) const;
+    const pcl::PointXYZ & point, const double distance_threshold) const;
+  /** \brief Check if a map point is within distance_threshold from the point. The voxels must be
+   * at least as large as distance_threshold, and tree holds the map points around the point.
+   */
+  bool is_close_to_map_points(
+    const pcl::PointXYZ & point, const double distance_threshold,
+    const pcl::search::Search<pcl::PointXYZ>::Ptr & tree) const;
 
   void publish_downsampled_map(const pcl::PointCloud<pcl::PointXYZ> & downsampled_pc);
   std::string * tf_map_input_frame_;
@@ -190,9 +199,6 @@ public:
   bool should_update_map() const;
   void request_update_map(const geometry_msgs::msg::Point & position);
   bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold) override;
-  /** \brief Check if point close to map pointcloud in the */
-  bool is_close_to_next_map_grid(
-    const pcl::PointXYZ & point, const int current_map_grid_index, const double distance_threshold);
 
   inline pcl::PointCloud<pcl::PointXYZ> getCurrentDownsampledMapPc() const
   {
@@ -263,6 +269,7 @@ public:
   {
     (*mutex_ptr_).lock();
     current_voxel_grid_dict_.erase(map_cell_id_to_remove);
+    occupancy_set_.remove_cell(map_cell_id_to_remove);
     (*mutex_ptr_).unlock();
   }
 
@@ -312,6 +319,7 @@ public:
     // add
     (*mutex_ptr_).lock();
     current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item});
+    occupancy_set_.add_cell(map_cell_to_add.cell_id, *current_voxel_grid_list_item.map_cell_pc_ptr);
     (*mutex_ptr_).unlock();
   }
 };
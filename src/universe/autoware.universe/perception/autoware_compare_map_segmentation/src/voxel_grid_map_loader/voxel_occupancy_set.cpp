@@ -0,0 +1,213 @@
+// Copyright 2024 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "voxel_occupancy_set.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace autoware::compare_map_segmentation
+{
+namespace
+{
+// Each grid coordinate is stored in 21 bits, which covers +-2^20 voxels around the origin
+constexpr int coordinate_bits = 21;
+constexpr std::uint64_t coordinate_mask = (1ULL << coordinate_bits) - 1;
+constexpr int coordinate_bias = 1 << (coordinate_bits - 1);
+}  // namespace
+
+VoxelOccupancySet::VoxelOccupancySet(double leaf_size_xy, double leaf_size_z)
+{
+  set_leaf_size(leaf_size_xy, leaf_size_z);
+}
+
+void VoxelOccupancySet::set_leaf_size(double leaf_size_xy, double leaf_size_z)
+{
+  // same precision as pcl::VoxelGrid so that the points fall into the same voxels
+  inverse_leaf_size_xy_ = 1.0f / static_cast<float>(leaf_size_xy);
+  inverse_leaf_size_z_ = 1.0f / static_cast<float>(leaf_size_z);
+  clear();
+}
+
+void VoxelOccupancySet::clear()
+{
+  voxels_.clear();
+  neighbor_masks_.clear();
+  cells_.clear();
+}
+
+void VoxelOccupancySet::add_cell(
+  const std::string & cell_id, const pcl::PointCloud<pcl::PointXYZ> & centroids)
+{
+  remove_cell(cell_id);
+
+  auto & cell_voxels = cells_[cell_id];
+  cell_voxels.reserve(centroids.size());
+  voxels_.reserve(voxels_.size() + centroids.size());
+  for (const auto & point : centroids.points) {
+    const VoxelKey key = to_key(point);
+    const Eigen::Vector3f centroid = point.getVector3fMap();
+    insert_voxel(key, centroid);
+    cell_voxels.emplace_back(key, centroid);
+  }
+}
+
+void VoxelOccupancySet::remove_cell(const std::string & cell_id)
+{
+  const auto cell_it = cells_.find(cell_id);
+  if (cell_it == cells_.end()) {
+    return;
+  }
+  for (const auto & [key, centroid] : cell_it->second) {
+    erase_voxel(key, centroid);
+  }
+  cells_.erase(cell_it);
+}
+
+bool VoxelOccupancySet::is_occupied(const pcl::PointXYZ & point) const
+{
+  return voxels_.find(to_key(point)) != voxels_.end();
+}
+
+bool VoxelOccupancySet::has_occupied_neighbor(const pcl::PointXYZ & point) const
+{
+  return neighbor_masks_.find(to_key(point)) != neighbor_masks_.end();
+}
+
+bool VoxelOccupancySet::is_close_to_centroid(
+  const pcl::PointXYZ & point, const double distance_threshold,
+  const double distance_threshold_z) const
+{
+  const VoxelKey key = to_key(point);
+  const auto mask_it = neighbor_masks_.find(key);
+  if (mask_it == neighbor_masks_.end()) {
+    return false;
+  }
+
+  const Eigen::Vector3i coordinates = unpack(key);
+  std::uint32_t mask = mask_it->second;
+  while (mask != 0) {
+    const int bit = __builtin_ctz(mask);
+    mask &= mask - 1;
+
+    const Eigen::Vector3i offset(bit / 9 - 1, (bit / 3) % 3 - 1, bit % 3 - 1);
+    const auto voxel_it = voxels_.find(pack(coordinates + offset));
+    if (voxel_it == voxels_.end()) {
+      continue;
+    }
+    // check if the point is inside the distance threshold voxel
+    const auto is_close = [&](const Eigen::Vector3f & centroid) {
+      return std::abs(centroid.x() - point.x) < distance_threshold &&
+             std::abs(centroid.y() - point.y) < distance_threshold &&
+             std::abs(centroid.z() - point.z) < distance_threshold_z;
+    };
+    const Voxel & voxel = voxel_it->second;
+    if (is_close(voxel.centroid)) {
+      return true;
+    }
+    for (const auto & centroid : voxel.shared_centroids) {
+      if (is_close(centroid)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+VoxelOccupancySet::VoxelKey VoxelOccupancySet::to_key(const pcl::PointXYZ & point) const
+{
+  return pack(Eigen::Vector3i(
+    static_cast<int>(std::floor(point.x * inverse_leaf_size_xy_)),
+    static_cast<int>(std::floor(point.y * inverse_leaf_size_xy_)),
+    static_cast<int>(std::floor(point.z * inverse_leaf_size_z_))));
+}
+
+VoxelOccupancySet::VoxelKey VoxelOccupancySet::pack(const Eigen::Vector3i & coordinates)
+{
+  const auto biased = [](const int value) {
+    return static_cast<std::uint64_t>(value + coordinate_bias) & coordinate_mask;
+  };
+  return (biased(coordinates.x()) << (2 * coordinate_bits)) |
+         (biased(coordinates.y()) << coordinate_bits) | biased(coordinates.z());
+}
+
+Eigen::Vector3i VoxelOccupancySet::unpack(const VoxelKey key)
+{
+  const auto unbiased = [](const std::uint64_t value) {
+    return static_cast<int>(value & coordinate_mask) - coordinate_bias;
+  };
+  return Eigen::Vector3i(
+    unbiased(key >> (2 * coordinate_bits)), unbiased(key >> coordinate_bits), unbiased(key));
+}
+
+void VoxelOccupancySet::insert_voxel(const VoxelKey key, const Eigen::Vector3f & centroid)
+{
+  const auto [voxel_it, inserted] = voxels_.try_emplace(key);
+  if (inserted) {
+    voxel_it->second.centroid = centroid;
+    update_neighbor_masks(key, true);
+    return;
+  }
+  voxel_it->second.shared_centroids.push_back(centroid);
+}
+
+void VoxelOccupancySet::erase_voxel(const VoxelKey key, const Eigen::Vector3f & centroid)
+{
+  const auto voxel_it = voxels_.find(key);
+  if (voxel_it == voxels_.end()) {
+    return;
+  }
+  // the cells sharing a voxel are interchangeable, so remove any entry with the same centroid
+  Voxel & voxel = voxel_it->second;
+  auto & shared = voxel.shared_centroids;
+  if (shared.empty()) {
+    voxels_.erase(voxel_it);
+    update_neighbor_masks(key, false);
+    return;
+  }
+  const auto shared_it = std::find(shared.begin(), shared.end(), centroid);
+  if (shared_it != shared.end()) {
+    *shared_it = shared.back();
+  } else {
+    voxel.centroid = shared.back();
+  }
+  shared.pop_back();
+}
+
+void VoxelOccupancySet::update_neighbor_masks(const VoxelKey key, const bool occupied)
+{
+  const Eigen::Vector3i coordinates = unpack(key);
+  for (int dx = -1; dx <= 1; ++dx) {
+    for (int dy = -1; dy <= 1; ++dy) {
+      for (int dz = -1; dz <= 1; ++dz) {
+        // seen from the neighbor, this voxel is at the opposite offset
+        const VoxelKey neighbor_key = pack(coordinates + Eigen::Vector3i(dx, dy, dz));
+        const std::uint32_t bit = 1U << neighbor_bit(-dx, -dy, -dz);
+        if (occupied) {
+          neighbor_masks_[neighbor_key] |= bit;
+          continue;
+        }
+        const auto mask_it = neighbor_masks_.find(neighbor_key);
+        if (mask_it == neighbor_masks_.end()) {
+          continue;
+        }
+        mask_it->second &= ~bit;
+        if (mask_it->second == 0) {
+          neighbor_masks_.erase(mask_it);
+        }
+      }
+    }
+  }
+}
+}  // namespace autoware::compare_map_segmentation
@@ -0,0 +1,116 @@
+// Copyright 2024 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VOXEL_GRID_MAP_LOADER__VOXEL_OCCUPANCY_SET_HPP_
+#define VOXEL_GRID_MAP_LOADER__VOXEL_OCCUPANCY_SET_HPP_
+
+#include <Eigen/Core>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware::compare_map_segmentation
+{
+/** \brief Hashed sparse set of map voxels with per-voxel centroid.
+ *
+ * Each voxel additionally owns a 27-bit mask of the occupied voxels in its 3x3x3 neighborhood,
+ * which is also kept for empty voxels next to the map. A query point therefore costs one hash
+ * lookup when the map is not around it, and the centroid checks only touch occupied neighbors.
+ *
+ * Map cells are added and removed incrementally. A voxel shared by several map cells keeps the
+ * centroid of each cell, as the voxel grids of the cells did, and a point is compared with all of
+ * them.
+ */
+class VoxelOccupancySet
+{
+public:
+  using VoxelKey = std::uint64_t;
+
+  VoxelOccupancySet() = default;
+  VoxelOccupancySet(double leaf_size_xy, double leaf_size_z);
+
+  /** \brief Change the voxel size. This clears all voxels. */
+  void set_leaf_size(double leaf_size_xy, double leaf_size_z);
+
+  void clear();
+
+  /** \brief Add the voxel centroids of a map cell. A cell with the same id is replaced. */
+  void add_cell(const std::string & cell_id, const pcl::PointCloud<pcl::PointXYZ> & centroids);
+
+  void remove_cell(const std::string & cell_id);
+
+  bool empty() const { return voxels_.empty(); }
+  size_t size() const { return voxels_.size(); }
+
+  /** \brief Check if the voxel containing the point is occupied */
+  bool is_occupied(const pcl::PointXYZ & point) const;
+
+  /** \brief Check if any voxel of the 3x3x3 neighborhood of the point is occupied */
+  bool has_occupied_neighbor(const pcl::PointXYZ & point) const;
+
+  /** \brief Check if the centroid of a voxel in the 3x3x3 neighborhood is inside the box
+   * |dx| < distance_threshold, |dy| < distance_threshold, |dz| < distance_threshold_z
+   */
+  bool is_close_to_centroid(
+    const pcl::PointXYZ & point, const double distance_threshold,
+    const double distance_threshold_z) const;
+
+private:
+  struct Voxel
+  {
+    Eigen::Vector3f centroid{Eigen::Vector3f::Zero()};
+    // centroids of the other map cells sharing the voxel, usually empty
+    std::vector<Eigen::Vector3f> shared_centroids;
+  };
+
+  struct KeyHash
+  {
+    size_t operator()(const VoxelKey key) const
+    {
+      // splitmix64 finalizer, since neighboring keys only differ in a few bits
+      VoxelKey z = key + 0x9e3779b97f4a7c15ULL;
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      return static_cast<size_t>(z ^ (z >> 31));
+    }
+  };
+
+  VoxelKey to_key(const pcl::PointXYZ & point) const;
+  static VoxelKey pack(const Eigen::Vector3i & coordinates);
+  static Eigen::Vector3i unpack(const VoxelKey key);
+  static int neighbor_bit(const int dx, const int dy, const int dz)
+  {
+    return (dx + 1) * 9 + (dy + 1) * 3 + (dz + 1);
+  }
+
+  void insert_voxel(const VoxelKey key, const Eigen::Vector3f & centroid);
+  void erase_voxel(const VoxelKey key, const Eigen::Vector3f & centroid);
+  void update_neighbor_masks(const VoxelKey key, const bool occupied);
+
+  float inverse_leaf_size_xy_{1.0f};
+  float inverse_leaf_size_z_{1.0f};
+
+  std::unordered_map<VoxelKey, Voxel, KeyHash> voxels_;
+  std::unordered_map<VoxelKey, std::uint32_t, KeyHash> neighbor_masks_;
+  std::unordered_map<std::string, std::vector<std::pair<VoxelKey, Eigen::Vector3f>>> cells_;
+};
+}  // namespace autoware::compare_map_segmentation
+
+#endif  // VOXEL_GRID_MAP_LOADER__VOXEL_OCCUPANCY_SET_HPP_
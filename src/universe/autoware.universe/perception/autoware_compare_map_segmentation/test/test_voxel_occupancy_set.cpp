@@ -0,0 +1,174 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/voxel_grid_map_loader/voxel_occupancy_set.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+using autoware::compare_map_segmentation::VoxelOccupancySet;
+
+namespace
+{
+constexpr double leaf_size = 0.5;
+constexpr double leaf_size_z = 0.25;
+
+// Centroids in about 5% of the voxels around (offset_x, 0, 0), with at most one centroid per voxel
+pcl::PointCloud<pcl::PointXYZ> create_centroids(std::mt19937 & engine, const float offset_x)
+{
+  std::uniform_real_distribution<float> occupied(0.f, 1.f);
+  std::uniform_real_distribution<float> offset_in_voxel(0.05f, 0.95f);
+  const int offset_index = static_cast<int>(offset_x / leaf_size);
+  pcl::PointCloud<pcl::PointXYZ> centroids;
+  for (int x = -10; x < 10; ++x) {
+    for (int y = -10; y < 10; ++y) {
+      for (int z = -4; z < 4; ++z) {
+        if (occupied(engine) > 0.05f) {
+          continue;
+        }
+        centroids.push_back(pcl::PointXYZ(
+          static_cast<float>((x + offset_index + offset_in_voxel(engine)) * leaf_size),
+          static_cast<float>((y + offset_in_voxel(engine)) * leaf_size),
+          static_cast<float>((z + offset_in_voxel(engine)) * leaf_size_z)));
+      }
+    }
+  }
+  return centroids;
+}
+
+// Brute force version of VoxelOccupancySet::is_close_to_centroid() for centroids of one voxel each
+bool is_close_brute_force(
+  const pcl::PointCloud<pcl::PointXYZ> & centroids, const pcl::PointXYZ & point)
+{
+  const auto voxel_index = [](const float value, const double leaf) {
+    return static_cast<int>(std::floor(value * static_cast<float>(1.0 / leaf)));
+  };
+  for (const auto & centroid : centroids) {
+    if (
+      std::abs(voxel_index(centroid.x, leaf_size) - voxel_index(point.x, leaf_size)) > 1 ||
+      std::abs(voxel_index(centroid.y, leaf_size) - voxel_index(point.y, leaf_size)) > 1 ||
+      std::abs(voxel_index(centroid.z, leaf_size_z) - voxel_index(point.z, leaf_size_z)) > 1) {
+      continue;
+    }
+    if (
+      std::abs(centroid.x - point.x) < leaf_size && std::abs(centroid.y - point.y) < leaf_size &&
+      std::abs(centroid.z - point.z) < leaf_size_z) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace
+
+TEST(VoxelOccupancySetTest, Occupancy)
+{
+  VoxelOccupancySet occupancy_set(leaf_size, leaf_size_z);
+  pcl::PointCloud<pcl::PointXYZ> centroids;
+  centroids.push_back(pcl::PointXYZ(0.1f, 0.1f, 0.1f));
+  occupancy_set.add_cell("0", centroids);
+
+  EXPECT_EQ(occupancy_set.size(), 1U);
+  EXPECT_TRUE(occupancy_set.is_occupied(pcl::PointXYZ(0.4f, 0.4f, 0.2f)));
+  EXPECT_FALSE(occupancy_set.is_occupied(pcl::PointXYZ(0.6f, 0.4f, 0.2f)));
+  EXPECT_TRUE(occupancy_set.has_occupied_neighbor(pcl::PointXYZ(0.6f, -0.4f, 0.3f)));
+  EXPECT_FALSE(occupancy_set.has_occupied_neighbor(pcl::PointXYZ(1.1f, 0.4f, 0.2f)));
+  EXPECT_FALSE(occupancy_set.has_occupied_neighbor(pcl::PointXYZ(0.4f, 0.4f, 0.6f)));
+
+  EXPECT_TRUE(
+    occupancy_set.is_close_to_centroid(pcl::PointXYZ(0.5f, -0.3f, 0.3f), leaf_size, leaf_size_z));
+  EXPECT_FALSE(
+    occupancy_set.is_close_to_centroid(pcl::PointXYZ(0.7f, -0.3f, 0.3f), leaf_size, leaf_size_z));
+}
+
+TEST(VoxelOccupancySetTest, SameAsBruteForce)
+{
+  std::mt19937 engine(0);
+  const auto centroids = create_centroids(engine, 0.f);
+  VoxelOccupancySet occupancy_set(leaf_size, leaf_size_z);
+  occupancy_set.add_cell("0", centroids);
+
+  std::uniform_real_distribution<float> dist(-6.f, 6.f);
+  for (int i = 0; i < 10000; ++i) {
+    const pcl::PointXYZ point(dist(engine), dist(engine), dist(engine) * 0.2f);
+    EXPECT_EQ(
+      occupancy_set.is_close_to_centroid(point, leaf_size, leaf_size_z),
+      is_close_brute_force(centroids, point));
+  }
+}
+
+TEST(VoxelOccupancySetTest, IncrementalUpdate)
+{
+  std::mt19937 engine(1);
+  const auto centroids_a = create_centroids(engine, 0.f);
+  const auto centroids_b = create_centroids(engine, 7.f);
+
+  VoxelOccupancySet expected(leaf_size, leaf_size_z);
+  expected.add_cell("b", centroids_b);
+
+  VoxelOccupancySet occupancy_set(leaf_size, leaf_size_z);
+  occupancy_set.add_cell("a", centroids_a);
+  occupancy_set.add_cell("b", centroids_b);
+  occupancy_set.remove_cell("a");
+  occupancy_set.remove_cell("not_loaded");
+  EXPECT_EQ(occupancy_set.size(), expected.size());
+
+  std::uniform_real_distribution<float> dist(-6.f, 14.f);
+  for (int i = 0; i < 10000; ++i) {
+    const pcl::PointXYZ point(dist(engine), dist(engine) * 0.5f, dist(engine) * 0.1f);
+    EXPECT_EQ(occupancy_set.has_occupied_neighbor(point), expected.has_occupied_neighbor(point));
+    EXPECT_EQ(
+      occupancy_set.is_close_to_centroid(point, leaf_size, leaf_size_z),
+      expected.is_close_to_centroid(point, leaf_size, leaf_size_z));
+  }
+
+  occupancy_set.remove_cell("b");
+  EXPECT_TRUE(occupancy_set.empty());
+  EXPECT_FALSE(occupancy_set.has_occupied_neighbor(centroids_b.front()));
+}
+
+TEST(VoxelOccupancySetTest, SharedVoxel)
+{
+  // two map cells with different centroids in the voxel [0, 0.5) x [0, 0.5) x [0, 0.25)
+  pcl::PointCloud<pcl::PointXYZ> centroids_a;
+  centroids_a.push_back(pcl::PointXYZ(0.05f, 0.25f, 0.1f));
+  pcl::PointCloud<pcl::PointXYZ> centroids_b;
+  centroids_b.push_back(pcl::PointXYZ(0.45f, 0.25f, 0.1f));
+
+  VoxelOccupancySet occupancy_set(leaf_size, leaf_size_z);
+  occupancy_set.add_cell("a", centroids_a);
+  occupancy_set.add_cell("b", centroids_b);
+  EXPECT_EQ(occupancy_set.size(), 1u);
+
+  // each centroid is kept, not their mean at x = 0.25
+  const pcl::PointXYZ near_a(-0.4f, 0.25f, 0.1f);
+  const pcl::PointXYZ near_b(0.9f, 0.25f, 0.1f);
+  EXPECT_TRUE(occupancy_set.is_close_to_centroid(near_a, leaf_size, leaf_size_z));
+  EXPECT_TRUE(occupancy_set.is_close_to_centroid(near_b, leaf_size, leaf_size_z));
+
+  // removing a cell restores the exact centroid of the other one
+  occupancy_set.remove_cell("a");
+  EXPECT_EQ(occupancy_set.size(), 1u);
+  EXPECT_FALSE(occupancy_set.is_close_to_centroid(near_a, leaf_size, leaf_size_z));
+  EXPECT_TRUE(occupancy_set.is_close_to_centroid(near_b, leaf_size, leaf_size_z));
+
+  occupancy_set.add_cell("a", centroids_a);
+  occupancy_set.remove_cell("b");
+  EXPECT_TRUE(occupancy_set.is_close_to_centroid(near_a, leaf_size, leaf_size_z));
+  EXPECT_FALSE(occupancy_set.is_close_to_centroid(near_b, leaf_size, leaf_size_z));
+
+  occupancy_set.remove_cell("a");
+  EXPECT_TRUE(occupancy_set.empty());
+}
@@ -16,6 +16,7 @@
 #define AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__FUSION_NODE_HPP_
 
 #include <autoware/image_projection_based_fusion/debugger.hpp>
+#include <autoware/image_projection_based_fusion/utils/multi_camera_projector.hpp>
 #include <autoware/universe_utils/ros/debug_publisher.hpp>
 #include <autoware/universe_utils/system/stop_watch.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -75,6 +76,9 @@ protected:
 
   virtual void preprocess(TargetMsg3D & output_msg);
 
+  // project a pointcloud into all the cameras with camera info, to be used by fuseOnSingleImage
+  void projectOnAllCameras(const PointCloud2 & pointcloud_msg);
+
   // callback for Msg subscription
   virtual void subCallback(const typename TargetMsg3D::ConstSharedPtr input_msg);
 
@@ -117,6 +121,9 @@ protected:
   // offsets between cameras and the lidars
   std::vector<double> input_offset_ms_;
 
+  // projection of the cached pointcloud into all the cameras
+  MultiCameraProjector multi_camera_projector_;
+
   // cache for fusion
   std::vector<bool> is_fused_;
   std::pair<int64_t, typename TargetMsg3D::SharedPtr>
@@ -0,0 +1,118 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__MULTI_CAMERA_PROJECTOR_HPP_
+#define AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__MULTI_CAMERA_PROJECTOR_HPP_
+
+#define EIGEN_MPL2_ONLY
+
+#include <Eigen/Core>
+
+#include <geometry_msgs/msg/transform_stamped.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <std_msgs/msg/header.hpp>
+
+#include <image_geometry/pinhole_camera_model.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace autoware::image_projection_based_fusion
+{
+
+struct ProjectedPoint
+{
+  uint32_t point_index;  // index of the point in the input pointcloud
+  float u;               // pixel in the raw image
+  float v;
+  float depth;  // z in the camera optical frame
+};
+
+/**
+ * @brief Precomputed projection from the pointcloud frame into the raw image of a camera
+ */
+struct CameraProjection
+{
+  std::string frame_id;
+  Eigen::Matrix3f rotation;
+  Eigen::Vector3f translation;
+  // coefficients of the rectified projection matrix P
+  float fx;
+  float fy;
+  float cx;
+  float cy;
+  float tx;
+  float ty;
+  float width;
+  float height;
+  // the rectified pixel is unrectified with this model only if the image has distortion
+  bool has_distortion;
+  image_geometry::PinholeCameraModel pinhole_camera_model;
+};
+
+CameraProjection makeCameraProjection(
+  const sensor_msgs::msg::CameraInfo & camera_info,
+  const geometry_msgs::msg::TransformStamped & pointcloud_to_camera);
+
+/**
+ * @brief Project the points in front of the camera and inside the image, in the order of the
+ * points in the pointcloud.
+ */
+void projectPointCloud(
+  const sensor_msgs::msg::PointCloud2 & pointcloud, const CameraProjection & camera,
+  std::vector<ProjectedPoint> & projected_points);
+
+/**
+ * @brief Project a pointcloud into all the cameras in a single pass.
+ *
+ * The xyz of each block of points are gathered once into contiguous arrays, and the blocks are
+ * projected into every camera in parallel. The projected points are bucketed per camera so that the
+ * fusion of each camera only visits the points which fall inside its image.
+ */
+class MultiCameraProjector
+{
+public:
+  explicit MultiCameraProjector(const std::size_t block_size = 4096);
+
+  void project(
+    const sensor_msgs::msg::PointCloud2 & pointcloud,
+    const std::map<std::size_t, CameraProjection> & cameras);
+
+  /**
+   * @brief Get the projected points of a camera, or nullptr if the last projected pointcloud is
+   * not the given one or the camera was not projected into the given frame.
+   */
+  const std::vector<ProjectedPoint> * getProjectedPoints(
+    const std::size_t camera_id, const std::string & camera_frame_id,
+    const std_msgs::msg::Header & pointcloud_header) const;
+
+  void clear();
+
+private:
+  std::size_t block_size_;
+  std_msgs::msg::Header pointcloud_header_;
+  std::map<std::size_t, std::string> camera_frame_ids_;
+  std::map<std::size_t, std::vector<ProjectedPoint>> projected_points_;
+  std::vector<float> xs_;
+  std::vector<float> ys_;
+  std::vector<float> zs_;
+};
+
+}  // namespace autoware::image_projection_based_fusion
+
+#endif  // AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__MULTI_CAMERA_PROJECTOR_HPP_
@@ -16,6 +16,8 @@
 
 #include "autoware/image_projection_based_fusion/fusion_node.hpp"
 
+#include "autoware/image_projection_based_fusion/utils/utils.hpp"
+
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
@@ -161,6 +163,25 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::preprocess(TargetMsg3D & ouput_msg
   // do nothing by default
 }
 
+template <class TargetMsg3D, class Obj, class Msg2D>
+void FusionNode<TargetMsg3D, Obj, Msg2D>::projectOnAllCameras(const PointCloud2 & pointcloud_msg)
+{
+  std::map<std::size_t, CameraProjection> cameras;
+  for (const auto & [camera_id, camera_info] : camera_info_map_) {
+    if (!checkCameraInfo(camera_info)) {
+      continue;
+    }
+    const auto transform_stamped_optional = getTransformStamped(
+      tf_buffer_, camera_info.header.frame_id, pointcloud_msg.header.frame_id,
+      pointcloud_msg.header.stamp);
+    if (!transform_stamped_optional) {
+      continue;
+    }
+    cameras.emplace(camera_id, makeCameraProjection(camera_info, *transform_stamped_optional));
+  }
+  multi_camera_projector_.project(pointcloud_msg, cameras);
+}
+
 template <class TargetMsg3D, class Obj, class Msg2D>
 void FusionNode<TargetMsg3D, Obj, Msg2D>::subCallback(
   const typename TargetMsg3D::ConstSharedPtr input_msg)
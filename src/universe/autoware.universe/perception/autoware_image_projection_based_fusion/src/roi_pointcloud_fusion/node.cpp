@@ -42,10 +42,9 @@ RoiPointCloudFusionNode::RoiPointCloudFusionNode(const rclcpp::NodeOptions & opt
   cluster_debug_pub_ = this->create_publisher<sensor_msgs::msg::PointCloud2>("debug/clusters", 1);
 }
 
-void RoiPointCloudFusionNode::preprocess(
-  __attribute__((unused)) sensor_msgs::msg::PointCloud2 & pointcloud_msg)
+void RoiPointCloudFusionNode::preprocess(sensor_msgs::msg::PointCloud2 & pointcloud_msg)
 {
-  return;
+  projectOnAllCameras(pointcloud_msg);
 }
 
 void RoiPointCloudFusionNode::postprocess(
@@ -73,8 +72,7 @@ void RoiPointCloudFusionNode::postprocess(
   }
 }
 void RoiPointCloudFusionNode::fuseOnSingleImage(
-  const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg,
-  __attribute__((unused)) const std::size_t image_id,
+  const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const std::size_t image_id,
   const DetectedObjectsWithFeature & input_roi_msg,
   const sensor_msgs::msg::CameraInfo & camera_info,
   __attribute__((unused)) sensor_msgs::msg::PointCloud2 & output_pointcloud_msg)
@@ -102,27 +100,23 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
     return;
   }
 
-  // transform pointcloud to camera optical frame id
-  image_geometry::PinholeCameraModel pinhole_camera_model;
-  pinhole_camera_model.fromCameraInfo(camera_info);
-
-  geometry_msgs::msg::TransformStamped transform_stamped;
-  {
+  // use the projection of the pointcloud into all the cameras if it matches, or project it here
+  std::vector<ProjectedPoint> projected_points_buffer;
+  const auto * projected_points = multi_camera_projector_.getProjectedPoints(
+    image_id, input_roi_msg.header.frame_id, input_pointcloud_msg.header);
+  if (!projected_points) {
     const auto transform_stamped_optional = getTransformStamped(
       tf_buffer_, input_roi_msg.header.frame_id, input_pointcloud_msg.header.frame_id,
       input_roi_msg.header.stamp);
     if (!transform_stamped_optional) {
       return;
     }
-    transform_stamped = transform_stamped_optional.value();
+    projectPointCloud(
+      input_pointcloud_msg, makeCameraProjection(camera_info, transform_stamped_optional.value()),
+      projected_points_buffer);
+    projected_points = &projected_points_buffer;
   }
-  int point_step = input_pointcloud_msg.point_step;
-  int x_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "x")].offset;
-  int y_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "y")].offset;
-  int z_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "z")].offset;
-
-  sensor_msgs::msg::PointCloud2 transformed_cloud;
-  tf2::doTransform(input_pointcloud_msg, transformed_cloud, transform_stamped);
+  const std::size_t point_step = input_pointcloud_msg.point_step;
 
   std::vector<sensor_msgs::msg::PointCloud2> clusters;
   std::vector<size_t> clusters_data_size;
@@ -134,30 +128,20 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
     cluster.data.resize(max_cluster_size_ * input_pointcloud_msg.point_step);
     clusters_data_size.push_back(0);
   }
-  for (size_t offset = 0; offset < input_pointcloud_msg.data.size(); offset += point_step) {
-    const float transformed_x =
-      *reinterpret_cast<const float *>(&transformed_cloud.data[offset + x_offset]);
-    const float transformed_y =
-      *reinterpret_cast<const float *>(&transformed_cloud.data[offset + y_offset]);
-    const float transformed_z =
-      *reinterpret_cast<const float *>(&transformed_cloud.data[offset + z_offset]);
-    if (transformed_z <= 0.0) {
-      continue;
-    }
-    Eigen::Vector2d projected_point = calcRawImageProjectedPoint(
-      pinhole_camera_model, cv::Point3d(transformed_x, transformed_y, transformed_z));
+  for (const auto & projected_point : *projected_points) {
+    const std::size_t offset = projected_point.point_index * point_step;
     for (std::size_t i = 0; i < output_objs.size(); ++i) {
       auto & feature_obj = output_objs.at(i);
       const auto & check_roi = feature_obj.feature.roi;
       auto & cluster = clusters.at(i);
 
-      if (clusters_data_size.at(i) >= static_cast<size_t>(max_cluster_size_ * point_step)) {
+      if (clusters_data_size.at(i) >= max_cluster_size_ * point_step) {
         continue;
       }
       if (
-        check_roi.x_offset <= projected_point.x() && check_roi.y_offset <= projected_point.y() &&
-        check_roi.x_offset + check_roi.width >= projected_point.x() &&
-        check_roi.y_offset + check_roi.height >= projected_point.y()) {
+        check_roi.x_offset <= projected_point.u && check_roi.y_offset <= projected_point.v &&
+        check_roi.x_offset + check_roi.width >= projected_point.u &&
+        check_roi.y_offset + check_roi.height >= projected_point.v) {
         std::memcpy(
           &cluster.data[clusters_data_size.at(i)], &input_pointcloud_msg.data[offset], point_step);
         clusters_data_size.at(i) += point_step;
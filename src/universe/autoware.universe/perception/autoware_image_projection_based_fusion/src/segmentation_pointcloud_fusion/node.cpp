@@ -44,9 +44,9 @@ SegmentPointCloudFusionNode::SegmentPointCloudFusionNode(const rclcpp::NodeOptio
   pub_debug_mask_ptr_ = image_transport::create_publisher(this, "~/debug/mask");
 }
 
-void SegmentPointCloudFusionNode::preprocess(__attribute__((unused)) PointCloud2 & pointcloud_msg)
+void SegmentPointCloudFusionNode::preprocess(PointCloud2 & pointcloud_msg)
 {
-  return;
+  projectOnAllCameras(pointcloud_msg);
 }
 
 void SegmentPointCloudFusionNode::postprocess(PointCloud2 & pointcloud_msg)
@@ -75,7 +75,7 @@ void SegmentPointCloudFusionNode::postprocess(PointCloud2 & pointcloud_msg)
 }
 
 void SegmentPointCloudFusionNode::fuseOnSingleImage(
-  const PointCloud2 & input_pointcloud_msg, __attribute__((unused)) const std::size_t image_id,
+  const PointCloud2 & input_pointcloud_msg, const std::size_t image_id,
   [[maybe_unused]] const Image & input_mask, __attribute__((unused)) const CameraInfo & camera_info,
   __attribute__((unused)) PointCloud2 & output_cloud)
 {
@@ -100,61 +100,47 @@ void SegmentPointCloudFusionNode::fuseOnSingleImage(
   const int orig_height = camera_info.height;
   // resize mask to the same size as the camera image
   cv::resize(mask, mask, cv::Size(orig_width, orig_height), 0, 0, cv::INTER_NEAREST);
-  image_geometry::PinholeCameraModel pinhole_camera_model;
-  pinhole_camera_model.fromCameraInfo(camera_info);
 
-  geometry_msgs::msg::TransformStamped transform_stamped;
-  // transform pointcloud from frame id to camera optical frame id
-  {
+  // use the projection of the pointcloud into all the cameras if it matches, or project it here
+  std::vector<ProjectedPoint> projected_points_buffer;
+  const auto * projected_points = multi_camera_projector_.getProjectedPoints(
+    image_id, input_mask.header.frame_id, input_pointcloud_msg.header);
+  if (!projected_points) {
     const auto transform_stamped_optional = getTransformStamped(
       tf_buffer_, input_mask.header.frame_id, input_pointcloud_msg.header.frame_id,
       input_pointcloud_msg.header.stamp);
     if (!transform_stamped_optional) {
       return;
     }
-    transform_stamped = transform_stamped_optional.value();
+    projectPointCloud(
+      input_pointcloud_msg, makeCameraProjection(camera_info, transform_stamped_optional.value()),
+      projected_points_buffer);
+    projected_points = &projected_points_buffer;
   }
 
-  PointCloud2 transformed_cloud;
-  tf2::doTransform(input_pointcloud_msg, transformed_cloud, transform_stamped);
-
-  int point_step = input_pointcloud_msg.point_step;
-  int x_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "x")].offset;
-  int y_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "y")].offset;
-  int z_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "z")].offset;
-
-  for (size_t global_offset = 0; global_offset < transformed_cloud.data.size();
-       global_offset += point_step) {
-    float transformed_x =
-      *reinterpret_cast<float *>(&transformed_cloud.data[global_offset + x_offset]);
-    float transformed_y =
-      *reinterpret_cast<float *>(&transformed_cloud.data[global_offset + y_offset]);
-    float transformed_z =
-      *reinterpret_cast<float *>(&transformed_cloud.data[global_offset + z_offset]);
-    // skip filtering pointcloud behind the camera or too far from camera
-    if (transformed_z <= 0.0 || transformed_z > filter_distance_threshold_) {
+  const std::size_t point_step = input_pointcloud_msg.point_step;
+  for (const auto & projected_point : *projected_points) {
+    // skip filtering pointcloud too far from camera
+    if (projected_point.depth > filter_distance_threshold_) {
       continue;
     }
 
-    Eigen::Vector2d projected_point = calcRawImageProjectedPoint(
-      pinhole_camera_model, cv::Point3d(transformed_x, transformed_y, transformed_z));
-
-    bool is_inside_image = projected_point.x() > 0 && projected_point.x() < camera_info.width &&
-                           projected_point.y() > 0 && projected_point.y() < camera_info.height;
+    bool is_inside_image = projected_point.u > 0 && projected_point.u < camera_info.width &&
+                           projected_point.v > 0 && projected_point.v < camera_info.height;
     if (!is_inside_image) {
       continue;
     }
 
     // skip filtering pointcloud where semantic id out of the defined list
     uint8_t semantic_id = mask.at<uint8_t>(
-      static_cast<uint16_t>(projected_point.y()), static_cast<uint16_t>(projected_point.x()));
+      static_cast<uint16_t>(projected_point.v), static_cast<uint16_t>(projected_point.u));
     if (
       static_cast<size_t>(semantic_id) >= filter_semantic_label_target_list_.size() ||
       !filter_semantic_label_target_list_.at(semantic_id).second) {
       continue;
     }
 
-    filter_global_offset_set_.insert(global_offset);
+    filter_global_offset_set_.insert(projected_point.point_index * point_step);
   }
 }
 
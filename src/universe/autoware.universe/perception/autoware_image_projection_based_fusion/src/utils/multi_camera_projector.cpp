@@ -0,0 +1,263 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/image_projection_based_fusion/utils/multi_camera_projector.hpp"
+
+#include <Eigen/Geometry>
+
+#ifdef ROS_DISTRO_GALACTIC
+#include <tf2_eigen/tf2_eigen.h>
+#else
+#include <tf2_eigen/tf2_eigen.hpp>
+#endif
+
+#include <pcl/PCLPointField.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace autoware::image_projection_based_fusion
+{
+namespace
+{
+struct PointCloudLayout
+{
+  const uint8_t * data;
+  std::size_t point_step;
+  std::size_t x_offset;
+  std::size_t y_offset;
+  std::size_t z_offset;
+  std::size_t num_points;
+};
+
+PointCloudLayout getLayout(const sensor_msgs::msg::PointCloud2 & pointcloud)
+{
+  return PointCloudLayout{
+    pointcloud.data.data(),
+    pointcloud.point_step,
+    pointcloud.fields[pcl::getFieldIndex(pointcloud, "x")].offset,
+    pointcloud.fields[pcl::getFieldIndex(pointcloud, "y")].offset,
+    pointcloud.fields[pcl::getFieldIndex(pointcloud, "z")].offset,
+    pointcloud.point_step > 0 ? pointcloud.data.size() / pointcloud.point_step : 0};
+}
+
+void gatherPoints(
+  const PointCloudLayout & layout, const std::size_t begin, const std::size_t end, float * xs,
+  float * ys, float * zs)
+{
+  for (std::size_t i = begin; i < end; ++i) {
+    const uint8_t * point = layout.data + i * layout.point_step;
+    std::memcpy(&xs[i], point + layout.x_offset, sizeof(float));
+    std::memcpy(&ys[i], point + layout.y_offset, sizeof(float));
+    std::memcpy(&zs[i], point + layout.z_offset, sizeof(float));
+  }
+}
+
+struct BlockBuffer
+{
+  std::vector<float> us;
+  std::vector<float> vs;
+  std::vector<float> depths;
+};
+
+// project the points [begin, end) and append the ones inside the image
+void projectBlock(
+  const float * xs, const float * ys, const float * zs, const std::size_t begin,
+  const std::size_t end, const CameraProjection & camera, BlockBuffer & buffer,
+  std::vector<ProjectedPoint> & projected_points)
+{
+  const std::size_t size = end - begin;
+  buffer.us.resize(size);
+  buffer.vs.resize(size);
+  buffer.depths.resize(size);
+
+  // copied into locals, so that the loop below is vectorized without aliasing
+  const float r00 = camera.rotation(0, 0), r01 = camera.rotation(0, 1), r02 = camera.rotation(0, 2);
+  const float r10 = camera.rotation(1, 0), r11 = camera.rotation(1, 1), r12 = camera.rotation(1, 2);
+  const float r20 = camera.rotation(2, 0), r21 = camera.rotation(2, 1), r22 = camera.rotation(2, 2);
+  const float t0 = camera.translation.x(), t1 = camera.translation.y();
+  const float t2 = camera.translation.z();
+  const float fx = camera.fx, fy = camera.fy, cx = camera.cx, cy = camera.cy;
+  const float tx = camera.tx, ty = camera.ty;
+  float * us = buffer.us.data();
+  float * vs = buffer.vs.data();
+  float * depths = buffer.depths.data();
+
+#pragma omp simd
+  for (std::size_t i = 0; i < size; ++i) {
+    const float x = xs[begin + i];
+    const float y = ys[begin + i];
+    const float z = zs[begin + i];
+    const float camera_x = r00 * x + r01 * y + r02 * z + t0;
+    const float camera_y = r10 * x + r11 * y + r12 * z + t1;
+    const float camera_z = r20 * x + r21 * y + r22 * z + t2;
+    const float inverse_z = 1.0f / camera_z;
+    us[i] = (fx * camera_x + tx) * inverse_z + cx;
+    vs[i] = (fy * camera_y + ty) * inverse_z + cy;
+    depths[i] = camera_z;
+  }
+
+  for (std::size_t i = 0; i < size; ++i) {
+    if (depths[i] <= 0.0f) {
+      continue;
+    }
+    float u = us[i];
+    float v = vs[i];
+    if (camera.has_distortion) {
+      const cv::Point2d raw_image_point =
+        camera.pinhole_camera_model.unrectifyPoint(cv::Point2d(u, v));
+      u = static_cast<float>(raw_image_point.x);
+      v = static_cast<float>(raw_image_point.y);
+    }
+    if (u < 0.0f || u > camera.width || v < 0.0f || v > camera.height) {
+      continue;
+    }
+    projected_points.push_back(
+      ProjectedPoint{static_cast<uint32_t>(begin + i), u, v, depths[i]});
+  }
+}
+}  // namespace
+
+CameraProjection makeCameraProjection(
+  const sensor_msgs::msg::CameraInfo & camera_info,
+  const geometry_msgs::msg::TransformStamped & pointcloud_to_camera)
+{
+  CameraProjection camera;
+  camera.frame_id = pointcloud_to_camera.header.frame_id;
+
+  const Eigen::Isometry3d transform = tf2::transformToEigen(pointcloud_to_camera.transform);
+  camera.rotation = transform.rotation().cast<float>();
+  camera.translation = transform.translation().cast<float>();
+
+  camera.fx = static_cast<float>(camera_info.p[0]);
+  camera.fy = static_cast<float>(camera_info.p[5]);
+  camera.cx = static_cast<float>(camera_info.p[2]);
+  camera.cy = static_cast<float>(camera_info.p[6]);
+  camera.tx = static_cast<float>(camera_info.p[3]);
+  camera.ty = static_cast<float>(camera_info.p[7]);
+  camera.width = static_cast<float>(camera_info.width);
+  camera.height = static_cast<float>(camera_info.height);
+
+  // image_geometry skips the unrectification when all the distortion coefficients are zero
+  camera.has_distortion = std::any_of(
+    camera_info.d.begin(), camera_info.d.end(), [](const double d) { return d != 0.0; });
+  camera.pinhole_camera_model.fromCameraInfo(camera_info);
+  return camera;
+}
+
+void projectPointCloud(
+  const sensor_msgs::msg::PointCloud2 & pointcloud, const CameraProjection & camera,
+  std::vector<ProjectedPoint> & projected_points)
+{
+  projected_points.clear();
+  if (pointcloud.data.empty()) {
+    return;
+  }
+
+  const auto layout = getLayout(pointcloud);
+  std::vector<float> xs(layout.num_points);
+  std::vector<float> ys(layout.num_points);
+  std::vector<float> zs(layout.num_points);
+  gatherPoints(layout, 0, layout.num_points, xs.data(), ys.data(), zs.data());
+
+  BlockBuffer buffer;
+  projectBlock(
+    xs.data(), ys.data(), zs.data(), 0, layout.num_points, camera, buffer, projected_points);
+}
+
+MultiCameraProjector::MultiCameraProjector(const std::size_t block_size)
+: block_size_(std::max<std::size_t>(block_size, 1))
+{
+}
+
+void MultiCameraProjector::project(
+  const sensor_msgs::msg::PointCloud2 & pointcloud,
+  const std::map<std::size_t, CameraProjection> & cameras)
+{
+  clear();
+  pointcloud_header_ = pointcloud.header;
+  if (pointcloud.data.empty() || cameras.empty()) {
+    return;
+  }
+
+  const auto layout = getLayout(pointcloud);
+  xs_.resize(layout.num_points);
+  ys_.resize(layout.num_points);
+  zs_.resize(layout.num_points);
+
+  std::vector<const CameraProjection *> camera_list;
+  for (const auto & [camera_id, camera] : cameras) {
+    camera_list.push_back(&camera);
+  }
+
+  // block_points[block][camera]
+  const std::size_t num_blocks = (layout.num_points + block_size_ - 1) / block_size_;
+  std::vector<std::vector<std::vector<ProjectedPoint>>> block_points(
+    num_blocks, std::vector<std::vector<ProjectedPoint>>(camera_list.size()));
+
+#pragma omp parallel for schedule(dynamic)
+  for (std::size_t block = 0; block < num_blocks; ++block) {
+    const std::size_t begin = block * block_size_;
+    const std::size_t end = std::min(begin + block_size_, layout.num_points);
+    gatherPoints(layout, begin, end, xs_.data(), ys_.data(), zs_.data());
+
+    BlockBuffer buffer;
+    for (std::size_t camera_i = 0; camera_i < camera_list.size(); ++camera_i) {
+      projectBlock(
+        xs_.data(), ys_.data(), zs_.data(), begin, end, *camera_list[camera_i], buffer,
+        block_points[block][camera_i]);
+    }
+  }
+
+  // concatenate in the order of the blocks, so that the points keep the order of the pointcloud
+  std::size_t camera_i = 0;
+  for (const auto & [camera_id, camera] : cameras) {
+    std::size_t num_projected_points = 0;
+    for (const auto & points : block_points) {
+      num_projected_points += points[camera_i].size();
+    }
+    auto & projected_points = projected_points_[camera_id];
+    projected_points.reserve(num_projected_points);
+    for (const auto & points : block_points) {
+      projected_points.insert(
+        projected_points.end(), points[camera_i].begin(), points[camera_i].end());
+    }
+    camera_frame_ids_[camera_id] = camera.frame_id;
+    ++camera_i;
+  }
+}
+
+const std::vector<ProjectedPoint> * MultiCameraProjector::getProjectedPoints(
+  const std::size_t camera_id, const std::string & camera_frame_id,
+  const std_msgs::msg::Header & pointcloud_header) const
+{
+  if (pointcloud_header != pointcloud_header_) {
+    return nullptr;
+  }
+  const auto frame_id = camera_frame_ids_.find(camera_id);
+  if (frame_id == camera_frame_ids_.end() || frame_id->second != camera_frame_id) {
+    return nullptr;
+  }
+  return &projected_points_.at(camera_id);
+}
+
+void MultiCameraProjector::clear()
+{
+  pointcloud_header_ = std_msgs::msg::Header();
+  camera_frame_ids_.clear();
+  projected_points_.clear();
+}
+
+}  // namespace autoware::image_projection_based_fusion
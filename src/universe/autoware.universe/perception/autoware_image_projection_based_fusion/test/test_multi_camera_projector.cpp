@@ -0,0 +1,164 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/image_projection_based_fusion/utils/multi_camera_projector.hpp>
+
+#include <Eigen/Geometry>
+
+#include <sensor_msgs/distortion_models.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+using autoware::image_projection_based_fusion::CameraProjection;
+using autoware::image_projection_based_fusion::makeCameraProjection;
+using autoware::image_projection_based_fusion::MultiCameraProjector;
+using autoware::image_projection_based_fusion::ProjectedPoint;
+using autoware::image_projection_based_fusion::projectPointCloud;
+
+namespace
+{
+sensor_msgs::msg::PointCloud2 createPointCloud(const std::vector<std::array<float, 3>> & points)
+{
+  sensor_msgs::msg::PointCloud2 pointcloud;
+  pointcloud.header.frame_id = "base_link";
+  pointcloud.fields.resize(4);
+  const char * names[] = {"x", "y", "z", "intensity"};
+  for (std::size_t i = 0; i < 4; ++i) {
+    pointcloud.fields[i].name = names[i];
+    pointcloud.fields[i].offset = 4 * i;
+    pointcloud.fields[i].datatype = sensor_msgs::msg::PointField::FLOAT32;
+    pointcloud.fields[i].count = 1;
+  }
+  pointcloud.point_step = 16;
+  pointcloud.height = 1;
+  pointcloud.width = points.size();
+  pointcloud.row_step = pointcloud.point_step * pointcloud.width;
+  pointcloud.data.resize(pointcloud.row_step);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    std::memcpy(&pointcloud.data[i * pointcloud.point_step], points[i].data(), 3 * sizeof(float));
+  }
+  return pointcloud;
+}
+
+sensor_msgs::msg::CameraInfo createCameraInfo()
+{
+  sensor_msgs::msg::CameraInfo camera_info;
+  camera_info.width = 1000;
+  camera_info.height = 800;
+  camera_info.distortion_model = sensor_msgs::distortion_models::PLUMB_BOB;
+  camera_info.d = {0.0, 0.0, 0.0, 0.0, 0.0};
+  camera_info.k = {500.0, 0.0, 500.0, 0.0, 500.0, 400.0, 0.0, 0.0, 1.0};
+  camera_info.r = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+  camera_info.p = {500.0, 0.0, 500.0, 0.0, 0.0, 500.0, 400.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+  return camera_info;
+}
+
+// transform from base_link (x forward, z up) into an optical frame looking at the given yaw
+geometry_msgs::msg::TransformStamped createTransform(const std::string & frame_id, double yaw)
+{
+  // optical frame: z forward, x right, y down
+  const Eigen::Matrix3d base_to_optical =
+    (Eigen::Matrix3d() << 0, -1, 0, 0, 0, -1, 1, 0, 0).finished();
+  const Eigen::Quaterniond rotation(
+    base_to_optical * Eigen::AngleAxisd(-yaw, Eigen::Vector3d::UnitZ()).toRotationMatrix());
+  geometry_msgs::msg::TransformStamped transform;
+  transform.header.frame_id = frame_id;
+  transform.child_frame_id = "base_link";
+  transform.transform.rotation.w = rotation.w();
+  transform.transform.rotation.x = rotation.x();
+  transform.transform.rotation.y = rotation.y();
+  transform.transform.rotation.z = rotation.z();
+  return transform;
+}
+}  // namespace
+
+TEST(MultiCameraProjectorTest, ProjectPointCloud)
+{
+  const auto pointcloud = createPointCloud({
+    {10.0f, 0.0f, 0.0f},    // image center
+    {10.0f, 2.0f, -1.0f},   // left and below the center
+    {-10.0f, 0.0f, 0.0f},   // behind the camera
+    {10.0f, 100.0f, 0.0f},  // outside the image
+  });
+  const auto camera =
+    makeCameraProjection(createCameraInfo(), createTransform("camera_optical_link", 0.0));
+  EXPECT_FALSE(camera.has_distortion);
+
+  std::vector<ProjectedPoint> projected_points;
+  projectPointCloud(pointcloud, camera, projected_points);
+  ASSERT_EQ(projected_points.size(), 2U);
+  EXPECT_EQ(projected_points[0].point_index, 0U);
+  EXPECT_NEAR(projected_points[0].u, 500.0f, 1e-3);
+  EXPECT_NEAR(projected_points[0].v, 400.0f, 1e-3);
+  EXPECT_NEAR(projected_points[0].depth, 10.0f, 1e-4);
+  EXPECT_EQ(projected_points[1].point_index, 1U);
+  EXPECT_NEAR(projected_points[1].u, 400.0f, 1e-3);
+  EXPECT_NEAR(projected_points[1].v, 450.0f, 1e-3);
+}
+
+TEST(MultiCameraProjectorTest, SamePointsAsSingleCameraProjection)
+{
+  std::vector<std::array<float, 3>> points;
+  for (int i = 0; i < 1000; ++i) {
+    const double angle = 0.05 * i;
+    points.push_back(
+      {static_cast<float>(20.0 * std::cos(angle)), static_cast<float>(20.0 * std::sin(angle)),
+       static_cast<float>(0.01 * (i % 100) - 0.5)});
+  }
+  const auto pointcloud = createPointCloud(points);
+
+  std::map<std::size_t, CameraProjection> cameras;
+  cameras.emplace(0, makeCameraProjection(createCameraInfo(), createTransform("camera0", 0.0)));
+  cameras.emplace(1, makeCameraProjection(createCameraInfo(), createTransform("camera1", M_PI_2)));
+  cameras.emplace(2, makeCameraProjection(createCameraInfo(), createTransform("camera2", M_PI)));
+
+  // a small block size, so that the points are split into many blocks
+  MultiCameraProjector projector(64);
+  projector.project(pointcloud, cameras);
+
+  for (const auto & [camera_id, camera] : cameras) {
+    std::vector<ProjectedPoint> expected;
+    projectPointCloud(pointcloud, camera, expected);
+    ASSERT_FALSE(expected.empty());
+
+    const auto * projected_points =
+      projector.getProjectedPoints(camera_id, camera.frame_id, pointcloud.header);
+    ASSERT_NE(projected_points, nullptr);
+    ASSERT_EQ(projected_points->size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(projected_points->at(i).point_index, expected[i].point_index);
+      EXPECT_FLOAT_EQ(projected_points->at(i).u, expected[i].u);
+      EXPECT_FLOAT_EQ(projected_points->at(i).v, expected[i].v);
+    }
+  }
+
+  // the projection is not used for another camera frame or another pointcloud
+  EXPECT_EQ(projector.getProjectedPoints(0, "camera1", pointcloud.header), nullptr);
+  auto other_header = pointcloud.header;
+  other_header.stamp.sec = 1;
+  EXPECT_EQ(projector.getProjectedPoints(0, "camera0", other_header), nullptr);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
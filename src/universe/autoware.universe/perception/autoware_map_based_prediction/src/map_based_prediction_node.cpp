@@ -869,6 +869,9 @@ MapBasedPredictionNode::MapBasedPredictionNode(const rclcpp::NodeOptions & node_
     path_generator_->setTimeKeeper(time_keeper_);
   }
 
+  latency_trace_stage_ =
+    std::make_unique<autoware::universe_utils::LatencyTraceStage>(get_fully_qualified_name());
+
   if (use_debug_marker) {
     pub_debug_markers_ =
       this->create_publisher<visualization_msgs::msg::MarkerArray>("maneuver", rclcpp::QoS{1});
@@ -971,6 +974,9 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
 
   if (stop_watch_ptr_) stop_watch_ptr_->toc("processing_time", true);
 
+  autoware::universe_utils::LatencyTraceScope trace_scope(*latency_trace_stage_);
+  trace_scope.add_input(in_objects->header.stamp);
+
   // take traffic_signal
   {
     const auto msg = sub_traffic_signals_.takeData();
@@ -1244,6 +1250,7 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
 
   // Publish Results
   publish(output, debug_markers);
+  trace_scope.set_output(output.header.stamp);
 
   // Publish Processing Time
   if (stop_watch_ptr_) {
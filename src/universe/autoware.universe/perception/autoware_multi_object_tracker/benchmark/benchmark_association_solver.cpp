@@ -0,0 +1,174 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/multi_object_tracker/association/solver/gnn_solver.hpp"
+#include "autoware/sparse_assignment/sparse_assignment.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using autoware::multi_object_tracker::gnn_solver::MuSSP;
+using autoware::sparse_assignment::Assignment;
+using autoware::sparse_assignment::Edge;
+using autoware::sparse_assignment::SparseAssignmentSolver;
+
+namespace
+{
+constexpr double max_dist = 5.0;
+constexpr double score_threshold = 0.01;
+
+struct Point
+{
+  double x;
+  double y;
+};
+
+struct Scene
+{
+  std::vector<Point> trackers;
+  std::vector<Point> measurements;
+};
+
+// objects spread with a constant density of one per 10m x 10m, measured with noise, and with
+// missed detections and false positives
+Scene create_scene(const int nb_objects, std::mt19937 & engine)
+{
+  const double area_size = 10.0 * std::sqrt(static_cast<double>(nb_objects));
+  std::uniform_real_distribution<double> position_dist(0.0, area_size);
+  std::normal_distribution<double> noise_dist(0.0, 0.5);
+  std::uniform_real_distribution<double> probability_dist(0.0, 1.0);
+
+  Scene scene;
+  for (int i = 0; i < nb_objects; ++i) {
+    const Point object{position_dist(engine), position_dist(engine)};
+    scene.trackers.push_back(object);
+    if (probability_dist(engine) < 0.9) {
+      scene.measurements.push_back({object.x + noise_dist(engine), object.y + noise_dist(engine)});
+    }
+    if (probability_dist(engine) < 0.1) {
+      scene.measurements.push_back({position_dist(engine), position_dist(engine)});
+    }
+  }
+  return scene;
+}
+
+double calc_score(const Point & tracker, const Point & measurement)
+{
+  const double dist = std::hypot(tracker.x - measurement.x, tracker.y - measurement.y);
+  if (max_dist < dist) return 0.0;
+  const double score = (max_dist - dist) / max_dist;
+  return score < score_threshold ? 0.0 : score;
+}
+
+// score matrix of all pairs and muSSP, as DataAssociation::calcScoreMatrix and assign
+double solve_dense(const Scene & scene, MuSSP & solver)
+{
+  std::vector<std::vector<double>> score(
+    scene.trackers.size(), std::vector<double>(scene.measurements.size()));
+  for (size_t i = 0; i < scene.trackers.size(); ++i) {
+    for (size_t j = 0; j < scene.measurements.size(); ++j) {
+      score[i][j] = calc_score(scene.trackers[i], scene.measurements[j]);
+    }
+  }
+  std::unordered_map<int, int> direct_assignment, reverse_assignment;
+  solver.maximizeLinearAssignment(score, &direct_assignment, &reverse_assignment);
+
+  double total_score = 0.0;
+  for (const auto & [tracker_idx, measurement_idx] : direct_assignment) {
+    if (score_threshold <= score[tracker_idx][measurement_idx]) {
+      total_score += score[tracker_idx][measurement_idx];
+    }
+  }
+  return total_score;
+}
+
+// gated pairs from a grid of the measurements and the sparse solver, as
+// DataAssociation::calcScoreEdges and assign
+double solve_sparse(const Scene & scene, SparseAssignmentSolver & solver, Assignment & assignment)
+{
+  const auto cell_key = [](const Point & point, const int dx, const int dy) {
+    const auto x = static_cast<std::int64_t>(std::floor(point.x / max_dist)) + dx;
+    const auto y = static_cast<std::int64_t>(std::floor(point.y / max_dist)) + dy;
+    return (x << 32) ^ (y & 0xFFFFFFFF);
+  };
+  std::unordered_map<std::int64_t, std::vector<size_t>> grid;
+  for (size_t j = 0; j < scene.measurements.size(); ++j) {
+    grid[cell_key(scene.measurements[j], 0, 0)].push_back(j);
+  }
+
+  std::vector<Edge> edges;
+  for (size_t i = 0; i < scene.trackers.size(); ++i) {
+    for (int dx = -1; dx <= 1; ++dx) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        const auto cell = grid.find(cell_key(scene.trackers[i], dx, dy));
+        if (cell == grid.end()) continue;
+        for (const size_t j : cell->second) {
+          const double score = calc_score(scene.trackers[i], scene.measurements[j]);
+          if (0.0 < score) {
+            edges.push_back({static_cast<int>(i), static_cast<int>(j), score});
+          }
+        }
+      }
+    }
+  }
+  return solver.maximize(
+    static_cast<int>(scene.trackers.size()), static_cast<int>(scene.measurements.size()), edges,
+    assignment);
+}
+}  // namespace
+
+int main()
+{
+  constexpr int nb_scenes = 20;
+
+  std::printf("#nb_objects  mussp_dense[ms]  sparse[ms]  speedup  score_difference\n");
+  for (const int nb_objects : {10, 50, 100, 200, 500, 1000}) {
+    std::mt19937 engine(nb_objects);
+    std::vector<Scene> scenes;
+    for (int i = 0; i < nb_scenes; ++i) {
+      scenes.push_back(create_scene(nb_objects, engine));
+    }
+
+    MuSSP mussp;
+    double dense_score = 0.0;
+    const auto dense_start = std::chrono::steady_clock::now();
+    for (const auto & scene : scenes) {
+      dense_score += solve_dense(scene, mussp);
+    }
+    const auto dense_end = std::chrono::steady_clock::now();
+
+    SparseAssignmentSolver sparse_solver;
+    Assignment assignment;
+    double sparse_score = 0.0;
+    const auto sparse_start = std::chrono::steady_clock::now();
+    for (const auto & scene : scenes) {
+      sparse_score += solve_sparse(scene, sparse_solver, assignment);
+    }
+    const auto sparse_end = std::chrono::steady_clock::now();
+
+    const double dense_ms =
+      std::chrono::duration<double, std::milli>(dense_end - dense_start).count() / nb_scenes;
+    const double sparse_ms =
+      std::chrono::duration<double, std::milli>(sparse_end - sparse_start).count() / nb_scenes;
+    std::printf(
+      "%11d  %15.3f  %10.3f  %7.1f  %16.2e\n", nb_objects, dense_ms, sparse_ms,
+      dense_ms / sparse_ms, sparse_score - dense_score);
+  }
+  return 0;
+}
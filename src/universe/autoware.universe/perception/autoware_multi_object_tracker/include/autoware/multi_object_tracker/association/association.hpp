@@ -23,12 +23,14 @@
 
 #include "autoware/multi_object_tracker/association/solver/gnn_solver.hpp"
 #include "autoware/multi_object_tracker/tracker/tracker.hpp"
+#include "autoware/sparse_assignment/sparse_assignment.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
 #include "autoware_perception_msgs/msg/detected_objects.hpp"
 
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -48,6 +50,17 @@ private:
   const double score_threshold_;
   std::unique_ptr<gnn_solver::GnnSolverInterface> gnn_solver_ptr_;
 
+  // sparse association
+  sparse_assignment::SparseAssignmentSolver sparse_solver_;
+  sparse_assignment::Assignment sparse_assignment_;
+  std::unordered_map<std::int64_t, std::vector<size_t>> measurement_grid_;
+  double max_dist_{0.0};
+
+  double calcScore(
+    const std::uint8_t tracker_label, const std::uint8_t measurement_label,
+    const autoware_perception_msgs::msg::DetectedObject & measurement_object,
+    const autoware_perception_msgs::msg::TrackedObject & tracked_object) const;
+
 public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   DataAssociation(
@@ -60,6 +73,23 @@ public:
   Eigen::MatrixXd calcScoreMatrix(
     const autoware_perception_msgs::msg::DetectedObjects & measurements,
     const std::list<std::shared_ptr<Tracker>> & trackers);
+
+  /**
+   * @brief sparse counterpart of assign, on the edges of calcScoreEdges
+   */
+  void assign(
+    const std::vector<sparse_assignment::Edge> & score_edges, const size_t num_trackers,
+    const size_t num_measurements, std::unordered_map<int, int> & direct_assignment,
+    std::unordered_map<int, int> & reverse_assignment);
+  /**
+   * @brief sparse counterpart of calcScoreMatrix, only the tracker / measurement pairs that pass
+   * the gates are returned
+   * @details the measurements are bucketed in a grid with the largest max_dist as cell size, so
+   * that only the measurements in the neighboring cells of a tracker are evaluated
+   */
+  std::vector<sparse_assignment::Edge> calcScoreEdges(
+    const autoware_perception_msgs::msg::DetectedObjects & measurements,
+    const std::list<std::shared_ptr<Tracker>> & trackers);
   virtual ~DataAssociation() {}
 };
 
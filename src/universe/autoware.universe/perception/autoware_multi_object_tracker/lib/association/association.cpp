@@ -19,6 +19,8 @@
 #include "autoware/object_recognition_utils/object_recognition_utils.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -88,6 +90,7 @@ DataAssociation::DataAssociation(
     Eigen::Map<Eigen::MatrixXd> max_dist_matrix_tmp(
       max_dist_vector.data(), max_dist_label_num, max_dist_label_num);
     max_dist_matrix_ = max_dist_matrix_tmp.transpose();
+    max_dist_ = max_dist_matrix_.size() > 0 ? max_dist_matrix_.maxCoeff() : 0.0;
   }
   {
     const int max_area_label_num = static_cast<int>(std::sqrt(max_area_vector.size()));
@@ -159,6 +162,8 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
   for (auto tracker_itr = trackers.begin(); tracker_itr != trackers.end();
        ++tracker_itr, ++tracker_idx) {
     const std::uint8_t tracker_label = (*tracker_itr)->getHighestProbLabel();
+    autoware_perception_msgs::msg::TrackedObject tracked_object;
+    bool has_tracked_object = false;
 
     for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
          ++measurement_idx) {
@@ -169,57 +174,11 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 
       double score = 0.0;
       if (can_assign_matrix_(tracker_label, measurement_label)) {
-        autoware_perception_msgs::msg::TrackedObject tracked_object;
-        (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
-
-        const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
-        const double dist = autoware::universe_utils::calcDistance2d(
-          measurement_object.kinematics.pose_with_covariance.pose.position,
-          tracked_object.kinematics.pose_with_covariance.pose.position);
-
-        bool passed_gate = true;
-        // dist gate
-        {  // passed_gate is always true
-          if (max_dist < dist) passed_gate = false;
-        }
-        // area gate
-        if (passed_gate) {
-          const double max_area = max_area_matrix_(tracker_label, measurement_label);
-          const double min_area = min_area_matrix_(tracker_label, measurement_label);
-          const double area = autoware::universe_utils::getArea(measurement_object.shape);
-          if (area < min_area || max_area < area) passed_gate = false;
-        }
-        // angle gate
-        if (passed_gate) {
-          const double max_rad = max_rad_matrix_(tracker_label, measurement_label);
-          const double angle = getFormedYawAngle(
-            measurement_object.kinematics.pose_with_covariance.pose.orientation,
-            tracked_object.kinematics.pose_with_covariance.pose.orientation, false);
-          if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle))
-            passed_gate = false;
-        }
-        // mahalanobis dist gate
-        if (passed_gate) {
-          const double mahalanobis_dist = getMahalanobisDistance(
-            measurement_object.kinematics.pose_with_covariance.pose.position,
-            tracked_object.kinematics.pose_with_covariance.pose.position,
-            getXYCovariance(tracked_object.kinematics.pose_with_covariance));
-          if (3.035 /*99%*/ <= mahalanobis_dist) passed_gate = false;
-        }
-        // 2d iou gate
-        if (passed_gate) {
-          const double min_iou = min_iou_matrix_(tracker_label, measurement_label);
-          const double min_union_iou_area = 1e-2;
-          const double iou = autoware::object_recognition_utils::get2dIoU(
-            measurement_object, tracked_object, min_union_iou_area);
-          if (iou < min_iou) passed_gate = false;
-        }
-
-        // all gate is passed
-        if (passed_gate) {
-          score = (max_dist - std::min(dist, max_dist)) / max_dist;
-          if (score < score_threshold_) score = 0.0;
+        if (!has_tracked_object) {
+          (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
+          has_tracked_object = true;
         }
+        score = calcScore(tracker_label, measurement_label, measurement_object, tracked_object);
       }
       score_matrix(tracker_idx, measurement_idx) = score;
     }
@@ -228,4 +187,128 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
   return score_matrix;
 }
 
+void DataAssociation::assign(
+  const std::vector<sparse_assignment::Edge> & score_edges, const size_t num_trackers,
+  const size_t num_measurements, std::unordered_map<int, int> & direct_assignment,
+  std::unordered_map<int, int> & reverse_assignment)
+{
+  // the edges are already above score_threshold_
+  sparse_solver_.maximize(
+    static_cast<int>(num_trackers), static_cast<int>(num_measurements), score_edges,
+    sparse_assignment_);
+
+  for (size_t tracker_idx = 0; tracker_idx < num_trackers; ++tracker_idx) {
+    const int measurement_idx = sparse_assignment_.row_to_col.at(tracker_idx);
+    if (measurement_idx < 0) continue;
+    direct_assignment[static_cast<int>(tracker_idx)] = measurement_idx;
+    reverse_assignment[measurement_idx] = static_cast<int>(tracker_idx);
+  }
+}
+
+std::vector<sparse_assignment::Edge> DataAssociation::calcScoreEdges(
+  const autoware_perception_msgs::msg::DetectedObjects & measurements,
+  const std::list<std::shared_ptr<Tracker>> & trackers)
+{
+  std::vector<sparse_assignment::Edge> score_edges;
+  if (!(0.0 < max_dist_)) return score_edges;
+
+  const auto cell_key = [this](const geometry_msgs::msg::Point & position, const int dx,
+                               const int dy) {
+    const auto x = static_cast<std::int64_t>(std::floor(position.x / max_dist_)) + dx;
+    const auto y = static_cast<std::int64_t>(std::floor(position.y / max_dist_)) + dy;
+    return (x << 32) ^ (y & 0xFFFFFFFF);
+  };
+
+  // bucket the measurements, a tracker can only pass the dist gate with measurements in the 3x3
+  // cells around it
+  measurement_grid_.clear();
+  std::vector<std::uint8_t> measurement_labels(measurements.objects.size());
+  for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
+       ++measurement_idx) {
+    const auto & measurement_object = measurements.objects.at(measurement_idx);
+    measurement_labels.at(measurement_idx) =
+      autoware::object_recognition_utils::getHighestProbLabel(measurement_object.classification);
+    const auto & position = measurement_object.kinematics.pose_with_covariance.pose.position;
+    measurement_grid_[cell_key(position, 0, 0)].push_back(measurement_idx);
+  }
+
+  size_t tracker_idx = 0;
+  autoware_perception_msgs::msg::TrackedObject tracked_object;
+  for (auto tracker_itr = trackers.begin(); tracker_itr != trackers.end();
+       ++tracker_itr, ++tracker_idx) {
+    const std::uint8_t tracker_label = (*tracker_itr)->getHighestProbLabel();
+    (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
+    const auto & tracker_position = tracked_object.kinematics.pose_with_covariance.pose.position;
+
+    for (int dx = -1; dx <= 1; ++dx) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        const auto cell = measurement_grid_.find(cell_key(tracker_position, dx, dy));
+        if (cell == measurement_grid_.end()) continue;
+        for (const size_t measurement_idx : cell->second) {
+          const std::uint8_t measurement_label = measurement_labels.at(measurement_idx);
+          if (!can_assign_matrix_(tracker_label, measurement_label)) continue;
+          const double score = calcScore(
+            tracker_label, measurement_label, measurements.objects.at(measurement_idx),
+            tracked_object);
+          if (0.0 < score) {
+            score_edges.push_back(
+              {static_cast<int>(tracker_idx), static_cast<int>(measurement_idx), score});
+          }
+        }
+      }
+    }
+  }
+
+  return score_edges;
+}
+
+double DataAssociation::calcScore(
+  const std::uint8_t tracker_label, const std::uint8_t measurement_label,
+  const autoware_perception_msgs::msg::DetectedObject & measurement_object,
+  const autoware_perception_msgs::msg::TrackedObject & tracked_object) const
+{
+  const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
+  const double dist = autoware::universe_utils::calcDistance2d(
+    measurement_object.kinematics.pose_with_covariance.pose.position,
+    tracked_object.kinematics.pose_with_covariance.pose.position);
+
+  // dist gate
+  if (max_dist < dist) return 0.0;
+  // area gate
+  {
+    const double max_area = max_area_matrix_(tracker_label, measurement_label);
+    const double min_area = min_area_matrix_(tracker_label, measurement_label);
+    const double area = autoware::universe_utils::getArea(measurement_object.shape);
+    if (area < min_area || max_area < area) return 0.0;
+  }
+  // angle gate
+  {
+    const double max_rad = max_rad_matrix_(tracker_label, measurement_label);
+    const double angle = getFormedYawAngle(
+      measurement_object.kinematics.pose_with_covariance.pose.orientation,
+      tracked_object.kinematics.pose_with_covariance.pose.orientation, false);
+    if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle)) return 0.0;
+  }
+  // mahalanobis dist gate
+  {
+    const double mahalanobis_dist = getMahalanobisDistance(
+      measurement_object.kinematics.pose_with_covariance.pose.position,
+      tracked_object.kinematics.pose_with_covariance.pose.position,
+      getXYCovariance(tracked_object.kinematics.pose_with_covariance));
+    if (3.035 /*99%*/ <= mahalanobis_dist) return 0.0;
+  }
+  // 2d iou gate
+  {
+    const double min_iou = min_iou_matrix_(tracker_label, measurement_label);
+    const double min_union_iou_area = 1e-2;
+    const double iou = autoware::object_recognition_utils::get2dIoU(
+      measurement_object, tracked_object, min_union_iou_area);
+    if (iou < min_iou) return 0.0;
+  }
+
+  // all gate is passed
+  const double score = (max_dist - std::min(dist, max_dist)) / max_dist;
+  return score < score_threshold_ ? 0.0 : score;
+}
+
 }  // namespace autoware::multi_object_tracker
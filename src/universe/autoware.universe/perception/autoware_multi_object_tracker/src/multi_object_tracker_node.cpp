@@ -87,6 +87,7 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
   double publish_rate = declare_parameter<double>("publish_rate");  // [hz]
   world_frame_id_ = declare_parameter<std::string>("world_frame_id");
   bool enable_delay_compensation{declare_parameter<bool>("enable_delay_compensation")};
+  use_sparse_assignment_ = declare_parameter<bool>("use_sparse_assignment");
 
   declare_parameter("selected_input_channels", std::vector<std::string>());
   std::vector<std::string> selected_input_channels =
@@ -203,6 +204,8 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
   debugger_->setObjectChannels(input_names_short);
   published_time_publisher_ =
     std::make_unique<autoware::universe_utils::PublishedTimePublisher>(this);
+  latency_trace_stage_ =
+    std::make_unique<autoware::universe_utils::LatencyTraceStage>(get_fully_qualified_name());
 }
 
 void MultiObjectTracker::onTrigger()
@@ -252,6 +255,13 @@ void MultiObjectTracker::onMessage(const ObjectsList & objects_list)
 
   // process start
   debugger_->startMeasurementTime(this->now(), oldest_time);
+  if (latency_trace_stage_->enabled()) {
+    const auto start_ns = autoware::universe_utils::LatencyTracer::now_ns();
+    for (const auto & objects_data : objects_list) {
+      latency_trace_inputs_.emplace_back(
+        autoware::universe_utils::to_latency_trace_id(objects_data.second.header.stamp), start_ns);
+    }
+  }
   // run process for each DetectedObjects
   for (const auto & objects_data : objects_list) {
     runProcess(objects_data.second, objects_data.first);
@@ -296,9 +306,16 @@ void MultiObjectTracker::runProcess(
     const auto & list_tracker = processor_->getListTracker();
     const auto & detected_objects = transformed_objects;
     // global nearest neighbor
-    Eigen::MatrixXd score_matrix = association_->calcScoreMatrix(
-      detected_objects, list_tracker);  // row : tracker, col : measurement
-    association_->assign(score_matrix, direct_assignment, reverse_assignment);
+    if (use_sparse_assignment_) {
+      const auto score_edges = association_->calcScoreEdges(detected_objects, list_tracker);
+      association_->assign(
+        score_edges, list_tracker.size(), detected_objects.objects.size(), direct_assignment,
+        reverse_assignment);
+    } else {
+      Eigen::MatrixXd score_matrix = association_->calcScoreMatrix(
+        detected_objects, list_tracker);  // row : tracker, col : measurement
+      association_->assign(score_matrix, direct_assignment, reverse_assignment);
+    }
 
     // Collect debug information - tracker list, existence probabilities, association results
     debugger_->collectObjectInfo(
@@ -326,6 +343,16 @@ void MultiObjectTracker::checkAndPublish(const rclcpp::Time & time)
   // Publish
   publish(time);
 
+  // The published objects depend on all the inputs since the last publication
+  if (latency_trace_stage_->enabled()) {
+    const auto output_id = autoware::universe_utils::to_latency_trace_id(time);
+    const auto publish_ns = autoware::universe_utils::LatencyTracer::now_ns();
+    for (const auto & [input_id, start_ns] : latency_trace_inputs_) {
+      latency_trace_stage_->record(input_id, output_id, start_ns, publish_ns, publish_ns);
+    }
+    latency_trace_inputs_.clear();
+  }
+
   // Update last published time
   last_published_time_ = this->now();
 }
@@ -25,6 +25,7 @@
 #include "processor/input_manager.hpp"
 #include "processor/processor.hpp"
 
+#include <autoware/universe_utils/system/latency_tracer.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include "autoware_perception_msgs/msg/detected_objects.hpp"
@@ -74,6 +75,9 @@ private:
   // debugger
   std::unique_ptr<TrackerDebugger> debugger_;
   std::unique_ptr<autoware::universe_utils::PublishedTimePublisher> published_time_publisher_;
+  std::unique_ptr<autoware::universe_utils::LatencyTraceStage> latency_trace_stage_;
+  // ids of the inputs processed since the last publication and the start time of the process
+  std::vector<std::pair<uint64_t, int64_t>> latency_trace_inputs_;
 
   // publish timer
   rclcpp::TimerBase::SharedPtr publish_timer_;
@@ -86,6 +90,7 @@ private:
   // internal states
   std::string world_frame_id_;  // tracking frame
   std::unique_ptr<DataAssociation> association_;
+  bool use_sparse_assignment_{false};
   std::unique_ptr<TrackerProcessor> processor_;
 
   // input manager
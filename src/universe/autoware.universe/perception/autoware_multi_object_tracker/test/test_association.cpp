@@ -0,0 +1,227 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/multi_object_tracker/association/association.hpp"
+#include "autoware/multi_object_tracker/tracker/model/tracker_base.hpp"
+
+#include <autoware/universe_utils/geometry/geometry.hpp>
+
+#include <autoware_perception_msgs/msg/object_classification.hpp>
+#include <autoware_perception_msgs/msg/shape.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using autoware::multi_object_tracker::DataAssociation;
+using autoware::multi_object_tracker::Tracker;
+using autoware_perception_msgs::msg::DetectedObject;
+using autoware_perception_msgs::msg::DetectedObjects;
+using autoware_perception_msgs::msg::ObjectClassification;
+using autoware_perception_msgs::msg::Shape;
+using autoware_perception_msgs::msg::TrackedObject;
+
+namespace
+{
+constexpr size_t num_labels = 8;
+
+// tracker returning a fixed object, i.e. without any motion between the stamps
+class FixedTracker : public Tracker
+{
+public:
+  explicit FixedTracker(const TrackedObject & object)
+  : Tracker(rclcpp::Time(0, 0), object.classification, 1), object_(object)
+  {
+  }
+  bool predict(const rclcpp::Time &) override { return true; }
+  bool getTrackedObject(const rclcpp::Time &, TrackedObject & object) const override
+  {
+    object = object_;
+    return true;
+  }
+
+protected:
+  bool measure(
+    const DetectedObject &, const rclcpp::Time &, const geometry_msgs::msg::Transform &) override
+  {
+    return true;
+  }
+
+private:
+  TrackedObject object_;
+};
+
+// gates of config/data_association_matrix.param.yaml, simplified where the label does not matter
+DataAssociation createDataAssociation()
+{
+  const std::vector<int> can_assign = {
+    1, 0, 0, 0, 0, 0, 0, 0,  //
+    0, 1, 1, 1, 1, 0, 0, 0,  //
+    0, 1, 1, 1, 1, 0, 0, 0,  //
+    0, 1, 1, 1, 1, 0, 0, 0,  //
+    0, 1, 1, 1, 1, 0, 0, 0,  //
+    0, 0, 0, 0, 0, 1, 1, 1,  //
+    0, 0, 0, 0, 0, 1, 1, 1,  //
+    0, 0, 0, 0, 0, 1, 1, 1};
+  const std::vector<double> max_dist = {
+    4.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,  //
+    4.0, 2.0, 5.0, 5.0, 5.0, 1.0, 1.0, 1.0,  //
+    4.0, 2.0, 5.0, 5.0, 5.0, 1.0, 1.0, 1.0,  //
+    4.0, 2.0, 5.0, 5.0, 5.0, 1.0, 1.0, 1.0,  //
+    4.0, 2.0, 5.0, 5.0, 5.0, 1.0, 1.0, 1.0,  //
+    3.0, 1.0, 1.0, 1.0, 1.0, 3.0, 3.0, 2.0,  //
+    3.0, 1.0, 1.0, 1.0, 1.0, 3.0, 3.0, 2.0,  //
+    2.0, 1.0, 1.0, 1.0, 1.0, 3.0, 3.0, 2.0};
+  const std::vector<double> max_area(num_labels * num_labels, 100.0);
+  const std::vector<double> min_area(num_labels * num_labels, 0.1);
+  std::vector<double> max_rad(num_labels * num_labels, 3.15);
+  std::vector<double> min_iou(num_labels * num_labels, 0.1);
+  for (size_t i = 1; i <= 4; ++i) {
+    for (size_t j = 1; j <= 4; ++j) {
+      max_rad.at(i * num_labels + j) = 1.047;
+    }
+  }
+  return DataAssociation(can_assign, max_dist, max_area, min_area, max_rad, min_iou);
+}
+
+struct Scene
+{
+  DetectedObjects measurements;
+  std::list<std::shared_ptr<Tracker>> trackers;
+};
+
+// trackers around the origin, with noisy measurements of most of them and false positives, so that
+// the positions fall on both sides of the grid cell boundaries
+Scene createScene(const size_t num_objects, std::mt19937 & engine)
+{
+  const double area_size = 8.0 * std::sqrt(static_cast<double>(num_objects));
+  std::uniform_real_distribution<double> position_dist(-0.5 * area_size, 0.5 * area_size);
+  std::uniform_real_distribution<double> size_dist(0.5, 5.0);
+  std::uniform_real_distribution<double> yaw_dist(-M_PI, M_PI);
+  std::uniform_int_distribution<int> label_dist(0, static_cast<int>(num_labels) - 1);
+  std::normal_distribution<double> position_noise(0.0, 1.0);
+  std::normal_distribution<double> size_noise(0.0, 0.3);
+  std::normal_distribution<double> yaw_noise(0.0, 0.5);
+  std::uniform_real_distribution<double> probability_dist(0.0, 1.0);
+
+  const auto set_object = [](
+                            auto & object, const double x, const double y, const double yaw,
+                            const double length, const double width, const std::uint8_t label) {
+    ObjectClassification classification;
+    classification.label = label;
+    classification.probability = 1.0;
+    object.classification = {classification};
+    auto & pose_with_covariance = object.kinematics.pose_with_covariance;
+    pose_with_covariance.pose.position.x = x;
+    pose_with_covariance.pose.position.y = y;
+    pose_with_covariance.pose.orientation =
+      autoware::universe_utils::createQuaternionFromYaw(yaw);
+    pose_with_covariance.covariance[0] = 2.0;
+    pose_with_covariance.covariance[7] = 2.0;
+    object.shape.type = Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = std::max(length, 0.2);
+    object.shape.dimensions.y = std::max(width, 0.2);
+    object.shape.dimensions.z = 1.5;
+  };
+
+  Scene scene;
+  for (size_t i = 0; i < num_objects; ++i) {
+    const double x = position_dist(engine);
+    const double y = position_dist(engine);
+    const double yaw = yaw_dist(engine);
+    const double length = size_dist(engine);
+    const double width = size_dist(engine);
+    const auto label = static_cast<std::uint8_t>(label_dist(engine));
+
+    TrackedObject tracked_object;
+    set_object(tracked_object, x, y, yaw, length, width, label);
+    scene.trackers.push_back(std::make_shared<FixedTracker>(tracked_object));
+
+    if (probability_dist(engine) < 0.9) {
+      DetectedObject measurement;
+      set_object(
+        measurement, x + position_noise(engine), y + position_noise(engine),
+        yaw + yaw_noise(engine), length + size_noise(engine), width + size_noise(engine),
+        probability_dist(engine) < 0.8 ? label : static_cast<std::uint8_t>(label_dist(engine)));
+      scene.measurements.objects.push_back(measurement);
+    }
+    if (probability_dist(engine) < 0.2) {
+      DetectedObject measurement;
+      set_object(
+        measurement, position_dist(engine), position_dist(engine), yaw_dist(engine),
+        size_dist(engine), size_dist(engine), static_cast<std::uint8_t>(label_dist(engine)));
+      scene.measurements.objects.push_back(measurement);
+    }
+  }
+  return scene;
+}
+
+double calcTotalScore(
+  const Eigen::MatrixXd & score_matrix, const std::unordered_map<int, int> & direct_assignment)
+{
+  double total_score = 0.0;
+  for (const auto & [tracker_idx, measurement_idx] : direct_assignment) {
+    total_score += score_matrix(tracker_idx, measurement_idx);
+  }
+  return total_score;
+}
+}  // namespace
+
+TEST(DataAssociationTest, ScoreEdgesMatchScoreMatrix)
+{
+  auto association = createDataAssociation();
+  std::mt19937 engine(0);
+  size_t num_edges = 0;
+  for (const size_t num_objects : std::vector<size_t>{0, 1, 5, 20, 50, 100, 200}) {
+    for (int trial = 0; trial < 5; ++trial) {
+      const auto scene = createScene(num_objects, engine);
+      const auto score_matrix = association.calcScoreMatrix(scene.measurements, scene.trackers);
+      const auto score_edges = association.calcScoreEdges(scene.measurements, scene.trackers);
+
+      // same scores on the edges, and no positive score outside of them
+      Eigen::MatrixXd edge_matrix = Eigen::MatrixXd::Zero(score_matrix.rows(), score_matrix.cols());
+      for (const auto & edge : score_edges) {
+        ASSERT_EQ(edge_matrix(edge.row, edge.col), 0.0) << "duplicated edge";
+        edge_matrix(edge.row, edge.col) = edge.weight;
+      }
+      for (int i = 0; i < score_matrix.rows(); ++i) {
+        for (int j = 0; j < score_matrix.cols(); ++j) {
+          EXPECT_DOUBLE_EQ(edge_matrix(i, j), score_matrix(i, j))
+            << "tracker " << i << ", measurement " << j << " of " << num_objects << " objects";
+        }
+      }
+      num_edges += score_edges.size();
+
+      // same optimum of the assignments
+      std::unordered_map<int, int> dense_direct, dense_reverse;
+      association.assign(score_matrix, dense_direct, dense_reverse);
+      std::unordered_map<int, int> sparse_direct, sparse_reverse;
+      association.assign(
+        score_edges, scene.trackers.size(), scene.measurements.objects.size(), sparse_direct,
+        sparse_reverse);
+      EXPECT_EQ(sparse_direct.size(), sparse_reverse.size());
+      EXPECT_NEAR(
+        calcTotalScore(score_matrix, sparse_direct), calcTotalScore(score_matrix, dense_direct),
+        1e-9);
+    }
+  }
+  // the scenes must exercise the gates with a reasonable number of candidate pairs
+  EXPECT_LT(100u, num_edges);
+}
@@ -47,6 +47,7 @@
 
 #include "autoware_costmap_generator/objects_to_costmap.hpp"
 #include "autoware_costmap_generator/points_to_costmap.hpp"
+#include "autoware_costmap_generator/primitives_to_costmap.hpp"
 #include "costmap_generator_node_parameters.hpp"
 
 #include <autoware/universe_utils/ros/processing_time_publisher.hpp>
@@ -106,10 +107,9 @@ private:
   tf2_ros::Buffer tf_buffer_;
   tf2_ros::TransformListener tf_listener_;
 
-  std::vector<std::vector<geometry_msgs::msg::Point>> primitives_points_;
-
   PointsToCostmap points2costmap_;
   ObjectsToCostmap objects2costmap_;
+  PrimitivesToCostmap primitives2costmap_;
 
   tier4_planning_msgs::msg::Scenario::ConstSharedPtr scenario_;
 
@@ -49,6 +49,7 @@
 
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -98,25 +99,26 @@ private:
 
   /// \brief Assign pointcloud to appropriate cell in gridmap
   /// \param[in] in_sensor_points: subscribed pointcloud
-  /// \param[out] grid-x-length x grid-y-length size grid stuffed with point's height in
-  /// corresponding grid cell
-  std::vector<std::vector<std::vector<double>>> assignPoints2GridCell(
-    const pcl::PointCloud<pcl::PointXYZ> & in_sensor_points);
-
-  /// \brief calculate costmap from subscribed pointcloud
   /// \param[in] maximum_height_thres: Maximum height threshold for pointcloud data
   /// \param[in] minimum_height_thres: Minimum height threshold for pointcloud data
+  void assignPoints2GridCell(
+    const pcl::PointCloud<pcl::PointXYZ> & in_sensor_points, const double maximum_height_thres,
+    const double minimum_lidar_height_thres);
+
+  /// \brief calculate costmap from the cell states assigned by assignPoints2GridCell
   /// \param[in] grid_min_value: Minimum cost for costmap
   /// \param[in] grid_max_value: Maximum cost fot costmap
   /// \param[in] gridmap: costmap based on gridmap
   /// \param[in] gridmap_layer_name: gridmap layer name for gridmap
-  /// \param[in] grid_vec: grid-x-length x grid-y-length size grid stuffed with point's height in
-  /// corresponding grid cell \param[out] calculated costmap in grid_map::Matrix format
+  /// \param[out] calculated costmap in grid_map::Matrix format
   grid_map::Matrix calculateCostmap(
-    const double maximum_height_thres, const double minimum_lidar_height_thres,
     const double grid_min_value, const double grid_max_value, const grid_map::GridMap & gridmap,
-    const std::string & gridmap_layer_name,
-    const std::vector<std::vector<std::vector<double>>> grid_vec);
+    const std::string & gridmap_layer_name) const;
+
+  // state of each cell of the grid, in row-major order of x and y indices. The buffer is reused
+  // across cycles instead of allocating the heights of the points in each cell.
+  enum CellState : uint8_t { EMPTY = 0, OUT_OF_HEIGHT_RANGE, IN_HEIGHT_RANGE };
+  std::vector<uint8_t> cell_states_;
 };
 }  // namespace autoware::costmap_generator
 
@@ -0,0 +1,92 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_COSTMAP_GENERATOR__PRIMITIVES_TO_COSTMAP_HPP_
+#define AUTOWARE_COSTMAP_GENERATOR__PRIMITIVES_TO_COSTMAP_HPP_
+
+#include <grid_map_ros/grid_map_ros.hpp>
+#include <opencv2/core/mat.hpp>
+
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/transform.hpp>
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace autoware::costmap_generator
+{
+/// \brief Costmap layer of the map primitives (road lanelets, parking lots and parking spaces)
+///
+/// The primitives are static, so they are rasterized into square tiles on a lattice fixed in the
+/// costmap frame and the tiles are cached. The layer of each cycle is copied from the tiles, which
+/// is exact as long as the gridmap stays on the lattice, i.e. it moves by multiples of the
+/// resolution. Otherwise, the lattice is reset and the tiles are rasterized again.
+class PrimitivesToCostmap
+{
+public:
+  static constexpr int tile_size = 128;  //!< number of cells of a side of a tile
+  static constexpr size_t max_tiles = 64;
+
+  /// \brief set the polygons of the primitives and clear the cached tiles
+  /// \param[in] primitives_points: polygons of the primitives in the map frame
+  void setPrimitives(std::vector<std::vector<geometry_msgs::msg::Point>> primitives_points);
+
+  /// \brief whether the primitives are empty
+  bool empty() const { return primitives_points_.empty(); }
+
+  /// \brief calculate cost from the primitives, where the cells in the primitives are free
+  /// \param[in] gridmap: costmap based on gridmap
+  /// \param[in] map2costmap: transform from the map frame to the frame of the gridmap
+  /// \param[in] grid_min_value: cost in the primitives
+  /// \param[in] grid_max_value: cost out of the primitives
+  /// \param[out] calculated cost in grid_map::Matrix format
+  grid_map::Matrix makeCostmapFromPrimitives(
+    const grid_map::GridMap & gridmap, const geometry_msgs::msg::Transform & map2costmap,
+    const double grid_min_value, const double grid_max_value);
+
+private:
+  struct Bounds
+  {
+    double min_row;
+    double max_row;
+    double min_col;
+    double max_col;
+  };
+
+  std::vector<std::vector<geometry_msgs::msg::Point>> primitives_points_;
+
+  // the lattice on which the tiles are rasterized, and the primitives in the cell coordinates of
+  // the lattice, where rows are along -x and columns are along -y as in grid_map
+  bool has_lattice_{false};
+  double resolution_{0.0};
+  double lattice_x_{0.0};
+  double lattice_y_{0.0};
+  geometry_msgs::msg::Transform map2costmap_;
+  std::vector<std::vector<cv::Point2d>> primitives_cells_;
+  std::vector<Bounds> primitives_bounds_;
+
+  std::map<std::pair<int64_t, int64_t>, cv::Mat> tiles_;  //!< 1 in the primitives
+
+  /// \brief reset the lattice so that the top-left corner of the gridmap is on it
+  void resetLattice(
+    const grid_map::GridMap & gridmap, const geometry_msgs::msg::Transform & map2costmap);
+
+  /// \brief rasterize the primitives into a tile
+  cv::Mat rasterizeTile(const int64_t tile_row, const int64_t tile_col) const;
+};
+}  // namespace autoware::costmap_generator
+
+#endif  // AUTOWARE_COSTMAP_GENERATOR__PRIMITIVES_TO_COSTMAP_HPP_
@@ -43,7 +43,6 @@
  ********************/
 
 #include "autoware_costmap_generator/costmap_generator.hpp"
-#include "autoware_costmap_generator/object_map_utils.hpp"
 
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_lanelet2_extension/utility/query.hpp>
@@ -56,8 +55,10 @@
 #include <tf2/time.h>
 #include <tf2/utils.h>
 
+#include <cmath>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace
@@ -251,13 +252,15 @@ void CostmapGenerator::onLaneletMapBin(
   lanelet_map_ = std::make_shared<lanelet::LaneletMap>();
   lanelet::utils::conversion::fromBinMsg(*msg, lanelet_map_);
 
+  std::vector<std::vector<geometry_msgs::msg::Point>> primitives_points;
   if (param_->use_wayarea) {
-    loadRoadAreasFromLaneletMap(lanelet_map_, &primitives_points_);
+    loadRoadAreasFromLaneletMap(lanelet_map_, &primitives_points);
   }
 
   if (param_->use_parkinglot) {
-    loadParkingAreasFromLaneletMap(lanelet_map_, &primitives_points_);
+    loadParkingAreasFromLaneletMap(lanelet_map_, &primitives_points);
   }
+  primitives2costmap_.setPrimitives(std::move(primitives_points));
 }
 
 void CostmapGenerator::onObjects(
@@ -301,10 +304,15 @@ void CostmapGenerator::onTimer()
   }
   time_keeper_->end_track("lookupTransform");
 
-  // Set grid center
+  // Set grid center, snapped so that the grid moves by multiples of the resolution and the cached
+  // primitives layer can be reused
+  const auto snap = [this](const double position, const double length) {
+    const double resolution = param_->grid_resolution;
+    return std::round((position + length / 2.0) / resolution) * resolution - length / 2.0;
+  };
   grid_map::Position p;
-  p.x() = tf.transform.translation.x;
-  p.y() = tf.transform.translation.y;
+  p.x() = snap(tf.transform.translation.x, costmap_.getLength().x());
+  p.y() = snap(tf.transform.translation.y, costmap_.getLength().y());
   costmap_.setPosition(p);
 
   if ((param_->use_wayarea || param_->use_parkinglot) && lanelet_map_) {
@@ -427,33 +435,30 @@ grid_map::Matrix CostmapGenerator::generateObjectsCostmap(
 
 grid_map::Matrix CostmapGenerator::generatePrimitivesCostmap()
 {
-  grid_map::GridMap lanelet2_costmap = costmap_;
-  if (!primitives_points_.empty()) {
-    object_map::FillPolygonAreas(
-      lanelet2_costmap, primitives_points_, LayerName::primitives, param_->grid_max_value,
-      param_->grid_min_value, param_->grid_min_value, param_->grid_max_value, param_->costmap_frame,
-      param_->map_frame, tf_buffer_);
+  if (primitives2costmap_.empty()) {
+    return costmap_[LayerName::primitives];
   }
-  return lanelet2_costmap[LayerName::primitives];
+
+  geometry_msgs::msg::TransformStamped map2costmap;
+  try {
+    map2costmap =
+      tf_buffer_.lookupTransform(param_->costmap_frame, param_->map_frame, tf2::TimePointZero);
+  } catch (const tf2::TransformException & ex) {
+    RCLCPP_ERROR(rclcpp::get_logger("costmap_generator"), "%s", ex.what());
+    return costmap_[LayerName::primitives];
+  }
+
+  return primitives2costmap_.makeCostmapFromPrimitives(
+    costmap_, map2costmap.transform, param_->grid_min_value, param_->grid_max_value);
 }
 
 grid_map::Matrix CostmapGenerator::generateCombinedCostmap()
 {
   // assuming combined_costmap is calculated by element wise max operation
-  grid_map::GridMap combined_costmap = costmap_;
-
-  combined_costmap[LayerName::combined].setConstant(param_->grid_min_value);
-
-  combined_costmap[LayerName::combined] =
-    combined_costmap[LayerName::combined].cwiseMax(combined_costmap[LayerName::points]);
-
-  combined_costmap[LayerName::combined] =
-    combined_costmap[LayerName::combined].cwiseMax(combined_costmap[LayerName::primitives]);
-
-  combined_costmap[LayerName::combined] =
-    combined_costmap[LayerName::combined].cwiseMax(combined_costmap[LayerName::objects]);
-
-  return combined_costmap[LayerName::combined];
+  return costmap_[LayerName::points]
+    .cwiseMax(costmap_[LayerName::primitives])
+    .cwiseMax(costmap_[LayerName::objects])
+    .cwiseMax(static_cast<float>(param_->grid_min_value));
 }
 
 void CostmapGenerator::publishCostmap(const grid_map::GridMap & costmap)
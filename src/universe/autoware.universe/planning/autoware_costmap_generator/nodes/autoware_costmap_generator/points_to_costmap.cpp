@@ -44,6 +44,7 @@
 
 #include "autoware_costmap_generator/points_to_costmap.hpp"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -88,43 +89,44 @@ grid_map::Index PointsToCostmap::fetchGridIndexFromPoint(const pcl::PointXYZ & p
   return index;
 }
 
-std::vector<std::vector<std::vector<double>>> PointsToCostmap::assignPoints2GridCell(
-  const pcl::PointCloud<pcl::PointXYZ> & in_sensor_points)
+void PointsToCostmap::assignPoints2GridCell(
+  const pcl::PointCloud<pcl::PointXYZ> & in_sensor_points, const double maximum_height_thres,
+  const double minimum_lidar_height_thres)
 {
-  double y_cell_size = std::ceil(grid_length_y_ * (1 / grid_resolution_));
-  double x_cell_size = std::ceil(grid_length_x_ * (1 / grid_resolution_));
-  std::vector<double> z_vec;
-  std::vector<std::vector<double>> vec_y_z(y_cell_size, z_vec);
-  std::vector<std::vector<std::vector<double>>> vec_x_y_z(x_cell_size, vec_y_z);
+  y_cell_size_ = std::ceil(grid_length_y_ * (1 / grid_resolution_));
+  x_cell_size_ = std::ceil(grid_length_x_ * (1 / grid_resolution_));
+  const auto y_cell_size = static_cast<size_t>(y_cell_size_);
+  cell_states_.assign(static_cast<size_t>(x_cell_size_) * y_cell_size, EMPTY);
 
   for (const auto & point : in_sensor_points) {
     grid_map::Index grid_ind = fetchGridIndexFromPoint(point);
-    if (isValidInd(grid_ind)) {
-      vec_x_y_z[grid_ind.x()][grid_ind.y()].push_back(point.z);
+    if (!isValidInd(grid_ind)) {
+      continue;
+    }
+    auto & state = cell_states_[grid_ind.x() * y_cell_size + grid_ind.y()];
+    if (point.z > maximum_height_thres || point.z < minimum_lidar_height_thres) {
+      state = std::max<uint8_t>(state, OUT_OF_HEIGHT_RANGE);
+    } else {
+      state = IN_HEIGHT_RANGE;
     }
   }
-  return vec_x_y_z;
 }
 
 grid_map::Matrix PointsToCostmap::calculateCostmap(
-  const double maximum_height_thres, const double minimum_lidar_height_thres,
   const double grid_min_value, const double grid_max_value, const grid_map::GridMap & gridmap,
-  const std::string & gridmap_layer_name,
-  const std::vector<std::vector<std::vector<double>>> grid_vec)
+  const std::string & gridmap_layer_name) const
 {
   grid_map::Matrix gridmap_data = gridmap[gridmap_layer_name];
-  for (size_t x_ind = 0; x_ind < grid_vec.size(); x_ind++) {
-    for (size_t y_ind = 0; y_ind < grid_vec[0].size(); y_ind++) {
-      if (grid_vec[x_ind][y_ind].size() == 0) {
+  const auto x_cell_size = static_cast<size_t>(x_cell_size_);
+  const auto y_cell_size = static_cast<size_t>(y_cell_size_);
+  for (size_t x_ind = 0; x_ind < x_cell_size; x_ind++) {
+    const uint8_t * states = cell_states_.data() + x_ind * y_cell_size;
+    for (size_t y_ind = 0; y_ind < y_cell_size; y_ind++) {
+      // cells only with points out of the height range keep the current cost
+      if (states[y_ind] == EMPTY) {
         gridmap_data(x_ind, y_ind) = grid_min_value;
-        continue;
-      }
-      for (const auto & z : grid_vec[x_ind][y_ind]) {
-        if (z > maximum_height_thres || z < minimum_lidar_height_thres) {
-          continue;
-        }
+      } else if (states[y_ind] == IN_HEIGHT_RANGE) {
         gridmap_data(x_ind, y_ind) = grid_max_value;
-        break;
       }
     }
   }
@@ -137,11 +139,8 @@ grid_map::Matrix PointsToCostmap::makeCostmapFromPoints(
   const std::string & gridmap_layer_name, const pcl::PointCloud<pcl::PointXYZ> & in_sensor_points)
 {
   initGridmapParam(gridmap);
-  std::vector<std::vector<std::vector<double>>> grid_vec = assignPoints2GridCell(in_sensor_points);
-  grid_map::Matrix costmap = calculateCostmap(
-    maximum_height_thres, minimum_lidar_height_thres, grid_min_value, grid_max_value, gridmap,
-    gridmap_layer_name, grid_vec);
-  return costmap;
+  assignPoints2GridCell(in_sensor_points, maximum_height_thres, minimum_lidar_height_thres);
+  return calculateCostmap(grid_min_value, grid_max_value, gridmap, gridmap_layer_name);
 }
 
 }  // namespace autoware::costmap_generator
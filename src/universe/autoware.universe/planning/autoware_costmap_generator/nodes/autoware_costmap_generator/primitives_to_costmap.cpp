@@ -0,0 +1,174 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_costmap_generator/primitives_to_costmap.hpp"
+
+#include <opencv2/imgproc.hpp>
+#include <tf2_eigen/tf2_eigen.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace autoware::costmap_generator
+{
+namespace
+{
+int64_t floorDiv(const int64_t value, const int64_t divisor)
+{
+  return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+}  // namespace
+
+void PrimitivesToCostmap::setPrimitives(
+  std::vector<std::vector<geometry_msgs::msg::Point>> primitives_points)
+{
+  primitives_points_ = std::move(primitives_points);
+  has_lattice_ = false;
+  tiles_.clear();
+}
+
+void PrimitivesToCostmap::resetLattice(
+  const grid_map::GridMap & gridmap, const geometry_msgs::msg::Transform & map2costmap)
+{
+  has_lattice_ = true;
+  resolution_ = gridmap.getResolution();
+  lattice_x_ = gridmap.getPosition().x() + gridmap.getLength().x() / 2.0;
+  lattice_y_ = gridmap.getPosition().y() + gridmap.getLength().y() / 2.0;
+  map2costmap_ = map2costmap;
+  tiles_.clear();
+
+  const Eigen::Isometry3d transform = tf2::transformToEigen(map2costmap);
+  primitives_cells_.clear();
+  primitives_bounds_.clear();
+  for (const auto & points : primitives_points_) {
+    std::vector<cv::Point2d> cells;
+    Bounds bounds{
+      std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest(),
+      std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()};
+    for (const auto & p : points) {
+      const Eigen::Vector3d transformed = transform * Eigen::Vector3d(p.x, p.y, p.z);
+      const double row = (lattice_x_ - transformed.x()) / resolution_;
+      const double col = (lattice_y_ - transformed.y()) / resolution_;
+      cells.emplace_back(col, row);
+      bounds.min_row = std::min(bounds.min_row, row);
+      bounds.max_row = std::max(bounds.max_row, row);
+      bounds.min_col = std::min(bounds.min_col, col);
+      bounds.max_col = std::max(bounds.max_col, col);
+    }
+    if (cells.empty()) {
+      continue;
+    }
+    primitives_cells_.push_back(std::move(cells));
+    primitives_bounds_.push_back(bounds);
+  }
+}
+
+cv::Mat PrimitivesToCostmap::rasterizeTile(const int64_t tile_row, const int64_t tile_col) const
+{
+  cv::Mat tile(tile_size, tile_size, CV_8UC1, cv::Scalar(0));
+  const double first_row = static_cast<double>(tile_row * tile_size);
+  const double first_col = static_cast<double>(tile_col * tile_size);
+  for (size_t i = 0; i < primitives_cells_.size(); ++i) {
+    const auto & bounds = primitives_bounds_.at(i);
+    if (
+      bounds.max_row < first_row - 1.0 || bounds.min_row > first_row + tile_size + 1.0 ||
+      bounds.max_col < first_col - 1.0 || bounds.min_col > first_col + tile_size + 1.0) {
+      continue;
+    }
+    std::vector<cv::Point> cv_polygon;
+    for (const auto & cell : primitives_cells_.at(i)) {
+      cv_polygon.emplace_back(
+        static_cast<int>(std::floor(cell.x - first_col)),
+        static_cast<int>(std::floor(cell.y - first_row)));
+    }
+    // fill each polygon separately so that overlapping polygons are not cancelled out
+    cv::fillPoly(tile, std::vector<std::vector<cv::Point>>{cv_polygon}, cv::Scalar(1));
+  }
+  return tile;
+}
+
+grid_map::Matrix PrimitivesToCostmap::makeCostmapFromPrimitives(
+  const grid_map::GridMap & gridmap, const geometry_msgs::msg::Transform & map2costmap,
+  const double grid_min_value, const double grid_max_value)
+{
+  const auto & size = gridmap.getSize();
+  grid_map::Matrix costmap(size.x(), size.y());
+  costmap.setConstant(grid_max_value);
+  if (primitives_points_.empty()) {
+    return costmap;
+  }
+
+  const double resolution = gridmap.getResolution();
+  const double corner_x = gridmap.getPosition().x() + gridmap.getLength().x() / 2.0;
+  const double corner_y = gridmap.getPosition().y() + gridmap.getLength().y() / 2.0;
+  const auto is_on_lattice = [&]() {
+    if (!has_lattice_ || resolution != resolution_ || map2costmap != map2costmap_) {
+      return false;
+    }
+    const double row = (lattice_x_ - corner_x) / resolution;
+    const double col = (lattice_y_ - corner_y) / resolution;
+    return std::abs(row - std::round(row)) < 1e-3 && std::abs(col - std::round(col)) < 1e-3;
+  };
+  if (!is_on_lattice()) {
+    resetLattice(gridmap, map2costmap);
+  }
+
+  // copy the overlapping part of each tile
+  const int64_t first_row = std::llround((lattice_x_ - corner_x) / resolution_);
+  const int64_t first_col = std::llround((lattice_y_ - corner_y) / resolution_);
+  const int64_t end_row = first_row + size.x();
+  const int64_t end_col = first_col + size.y();
+  const auto cost_in_primitives = static_cast<float>(grid_min_value - grid_max_value);
+  std::set<std::pair<int64_t, int64_t>> used_tiles;
+  for (int64_t tile_row = floorDiv(first_row, tile_size); tile_row * tile_size < end_row;
+       ++tile_row) {
+    for (int64_t tile_col = floorDiv(first_col, tile_size); tile_col * tile_size < end_col;
+         ++tile_col) {
+      auto & tile = tiles_[{tile_row, tile_col}];
+      if (tile.empty()) {
+        tile = rasterizeTile(tile_row, tile_col);
+      }
+      used_tiles.emplace(tile_row, tile_col);
+
+      const int64_t row_begin = std::max(first_row, tile_row * tile_size);
+      const int64_t row_end = std::min(end_row, (tile_row + 1) * tile_size);
+      const int64_t col_begin = std::max(first_col, tile_col * tile_size);
+      const int64_t col_end = std::min(end_col, (tile_col + 1) * tile_size);
+      const cv::Mat block = tile(
+        cv::Range(row_begin - tile_row * tile_size, row_end - tile_row * tile_size),
+        cv::Range(col_begin - tile_col * tile_size, col_end - tile_col * tile_size));
+      const Eigen::Map<
+        const Eigen::Matrix<uint8_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>, 0,
+        Eigen::OuterStride<>>
+        in_primitives(
+          block.ptr<uint8_t>(), block.rows, block.cols, Eigen::OuterStride<>(block.step1()));
+      costmap.block(row_begin - first_row, col_begin - first_col, block.rows, block.cols) =
+        (in_primitives.cast<float>().array() * cost_in_primitives + grid_max_value).matrix();
+    }
+  }
+
+  // keep the tiles around the gridmap when too many tiles are cached
+  if (tiles_.size() > max_tiles) {
+    for (auto it = tiles_.begin(); it != tiles_.end();) {
+      it = used_tiles.count(it->first) ? std::next(it) : tiles_.erase(it);
+    }
+  }
+  return costmap;
+}
+}  // namespace autoware::costmap_generator
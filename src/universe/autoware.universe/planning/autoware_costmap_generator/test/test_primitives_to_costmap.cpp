@@ -0,0 +1,129 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware_costmap_generator/object_map_utils.hpp>
+#include <autoware_costmap_generator/primitives_to_costmap.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace autoware::costmap_generator
+{
+class PrimitivesToCostmapTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    tf_buffer_ = std::make_shared<tf2_ros::Buffer>(std::make_shared<rclcpp::Clock>());
+
+    // rotated and translated costmap frame
+    transform_.header.frame_id = "costmap";
+    transform_.child_frame_id = "map";
+    transform_.transform.translation.x = -3.0;
+    transform_.transform.translation.y = 2.0;
+    transform_.transform.rotation.z = std::sin(0.15);
+    transform_.transform.rotation.w = std::cos(0.15);
+    tf_buffer_->setTransform(transform_, "test", true);
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> center_distribution(-15.0, 15.0);
+    std::uniform_real_distribution<double> offset_distribution(-4.0, 4.0);
+    for (int i = 0; i < 30; ++i) {
+      const double x = center_distribution(generator);
+      const double y = center_distribution(generator);
+      std::vector<geometry_msgs::msg::Point> polygon;
+      for (int j = 0; j < 5; ++j) {
+        geometry_msgs::msg::Point p;
+        p.x = x + offset_distribution(generator);
+        p.y = y + offset_distribution(generator);
+        polygon.push_back(p);
+      }
+      primitives_points_.push_back(polygon);
+    }
+  }
+
+  ~PrimitivesToCostmapTest() override { rclcpp::shutdown(); }
+
+  grid_map::GridMap construct_gridmap(const double position_x, const double position_y) const
+  {
+    grid_map::GridMap gm;
+    gm.setFrameId("costmap");
+    gm.setGeometry(grid_map::Length(grid_length_, grid_length_), grid_resolution_);
+    gm.setPosition(grid_map::Position(position_x, position_y));
+    gm.add("primitives", grid_min_value_);
+    return gm;
+  }
+
+public:
+  const double grid_resolution_ = 0.2;
+  const double grid_length_ = 80.0;
+  const double grid_min_value_ = 0.0;
+  const double grid_max_value_ = 1.0;
+
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer_;
+  geometry_msgs::msg::TransformStamped transform_;
+  std::vector<std::vector<geometry_msgs::msg::Point>> primitives_points_;
+};
+
+TEST_F(PrimitivesToCostmapTest, TestMakeCostmapFromPrimitives_sameAsFillPolygonAreas)
+{
+  PrimitivesToCostmap primitives2costmap;
+  primitives2costmap.setPrimitives(primitives_points_);
+  ASSERT_FALSE(primitives2costmap.empty());
+
+  // the tiles are reused while the gridmap moves by multiples of the resolution, and rasterized
+  // again when it does not
+  for (const auto & [x, y] : std::vector<std::pair<double, double>>{
+         {0.0, 0.0}, {1.0, -0.4}, {-2.2, 3.0}, {-2.2, 3.0}, {0.13, 0.07}, {5.13, -4.93}}) {
+    auto gridmap = construct_gridmap(x, y);
+    const auto costmap = primitives2costmap.makeCostmapFromPrimitives(
+      gridmap, transform_.transform, grid_min_value_, grid_max_value_);
+
+    object_map::FillPolygonAreas(
+      gridmap, primitives_points_, "primitives", grid_max_value_, grid_min_value_,
+      grid_min_value_, grid_max_value_, "costmap", "map", *tf_buffer_);
+    const grid_map::Matrix & expected = gridmap["primitives"];
+
+    ASSERT_EQ(costmap.rows(), expected.rows());
+    ASSERT_EQ(costmap.cols(), expected.cols());
+    int num_in_primitives = 0;
+    for (int i = 0; i < costmap.rows(); ++i) {
+      for (int j = 0; j < costmap.cols(); ++j) {
+        EXPECT_NEAR(costmap(i, j), expected(i, j), 1e-3) << "(" << i << ", " << j << ")";
+        num_in_primitives += costmap(i, j) == grid_min_value_;
+      }
+    }
+    EXPECT_GT(num_in_primitives, 0);
+  }
+}
+
+TEST_F(PrimitivesToCostmapTest, TestMakeCostmapFromPrimitives_noPrimitives)
+{
+  PrimitivesToCostmap primitives2costmap;
+  EXPECT_TRUE(primitives2costmap.empty());
+
+  const auto gridmap = construct_gridmap(0.0, 0.0);
+  const auto costmap = primitives2costmap.makeCostmapFromPrimitives(
+    gridmap, transform_.transform, grid_min_value_, grid_max_value_);
+  EXPECT_EQ(costmap.rows(), gridmap.getSize().x());
+  EXPECT_EQ(costmap.cols(), gridmap.getSize().y());
+  EXPECT_TRUE((costmap.array() == grid_max_value_).all());
+}
+}  // namespace autoware::costmap_generator
@@ -22,11 +22,13 @@
 #include "autoware/path_optimizer/type_alias.hpp"
 #include "autoware/universe_utils/ros/logger_level_configure.hpp"
 #include "autoware/universe_utils/ros/polling_subscriber.hpp"
+#include "autoware/universe_utils/system/aggregated_time_keeper.hpp"
 #include "autoware/universe_utils/system/stop_watch.hpp"
 #include "autoware/universe_utils/system/time_keeper.hpp"
 #include "autoware_vehicle_info_utils/vehicle_info_utils.hpp"
 
 #include <autoware/universe_utils/ros/published_time_publisher.hpp>
+#include <autoware/universe_utils/system/latency_tracer.hpp>
 #include <rclcpp/publisher.hpp>
 
 #include <algorithm>
@@ -68,6 +70,8 @@ protected:  // for the static_centerline_generator package
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_{};
   mutable std::shared_ptr<DebugData> debug_data_ptr_{nullptr};
   mutable std::shared_ptr<autoware::universe_utils::TimeKeeper> time_keeper_{nullptr};
+  // null unless option.debug.enable_aggregated_processing_time
+  std::unique_ptr<autoware::universe_utils::AggregatedTimeKeeper> aggregated_time_keeper_;
 
   // flags for some functions
   bool enable_pub_debug_marker_;
@@ -102,6 +106,8 @@ protected:  // for the static_centerline_generator package
   rclcpp::Publisher<Float64Stamped>::SharedPtr debug_calculation_time_float_pub_;
   rclcpp::Publisher<autoware::universe_utils::ProcessingTimeDetail>::SharedPtr
     debug_processing_time_detail_pub_;
+  rclcpp::Publisher<autoware::universe_utils::ProcessingTimeDetail>::SharedPtr
+    debug_aggregated_processing_time_detail_pub_;
 
   // parameter callback
   rcl_interfaces::msg::SetParametersResult onParam(
@@ -144,6 +150,7 @@ private:
   std::unique_ptr<autoware::universe_utils::LoggerLevelConfigure> logger_configure_;
 
   std::unique_ptr<autoware::universe_utils::PublishedTimePublisher> published_time_publisher_;
+  std::unique_ptr<autoware::universe_utils::LatencyTraceStage> latency_trace_stage_;
 
   autoware::universe_utils::StopWatch<std::chrono::milliseconds> stop_watch_;
 };
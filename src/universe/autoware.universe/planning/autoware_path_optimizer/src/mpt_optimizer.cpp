@@ -470,7 +470,7 @@ void MPTOptimizer::onParam(const std::vector<rclcpp::Parameter> & parameters)
 
 std::vector<TrajectoryPoint> MPTOptimizer::optimizeTrajectory(const PlannerData & planner_data)
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const auto & p = planner_data;
   const auto & traj_points = p.traj_points;
@@ -543,7 +543,7 @@ std::optional<std::vector<TrajectoryPoint>> MPTOptimizer::getPrevOptimizedTrajec
 std::vector<ReferencePoint> MPTOptimizer::calcReferencePoints(
   const PlannerData & planner_data, const std::vector<TrajectoryPoint> & smoothed_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const auto & p = planner_data;
 
@@ -551,14 +551,13 @@ std::vector<ReferencePoint> MPTOptimizer::calcReferencePoints(
   const double backward_traj_length = traj_param_.output_backward_traj_length;
 
   // 1. resample and convert smoothed points type from trajectory points to reference points
-  time_keeper_->start_track("resampleReferencePoints");
   auto ref_points = [&]() {
+    autoware::universe_utils::ScopedTimeTrack st("resampleReferencePoints", time_keeper_.get());
     const auto resampled_smoothed_points =
       trajectory_utils::resampleTrajectoryPointsWithoutStopPoint(
         smoothed_points, mpt_param_.delta_arc_length);
     return trajectory_utils::convertToReferencePoints(resampled_smoothed_points);
   }();
-  time_keeper_->end_track("resampleReferencePoints");
 
   // 2. crop forward and backward with margin, and calculate spline interpolation
   // NOTE: Margin is added to calculate orientation, curvature, etc precisely.
@@ -639,7 +638,7 @@ void MPTOptimizer::updateCurvature(
 
 void MPTOptimizer::updateFixedPoint(std::vector<ReferencePoint> & ref_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   if (!prev_ref_points_ptr_) {
     // no fixed point
@@ -695,7 +694,7 @@ void MPTOptimizer::updateDeltaArcLength(std::vector<ReferencePoint> & ref_points
 
 void MPTOptimizer::updateExtraPoints(std::vector<ReferencePoint> & ref_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   // alpha
   for (size_t i = 0; i < ref_points.size(); ++i) {
@@ -792,7 +791,7 @@ void MPTOptimizer::updateBounds(
   const std::vector<geometry_msgs::msg::Point> & right_bound,
   const geometry_msgs::msg::Pose & ego_pose, const double ego_vel) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const double soft_road_clearance =
     mpt_param_.soft_clearance_from_road + vehicle_info_.vehicle_width_m / 2.0;
@@ -1098,7 +1097,7 @@ void MPTOptimizer::updateVehicleBounds(
   std::vector<ReferencePoint> & ref_points,
   const autoware::interpolation::SplineInterpolationPoints2d & ref_points_spline) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   for (size_t p_idx = 0; p_idx < ref_points.size(); ++p_idx) {
     const auto & ref_point = ref_points.at(p_idx);
@@ -1161,7 +1160,7 @@ MPTOptimizer::ValueMatrix MPTOptimizer::calcValueMatrix(
   const std::vector<ReferencePoint> & ref_points,
   const std::vector<TrajectoryPoint> & traj_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const size_t D_x = state_equation_generator_.getDimX();
   const size_t D_u = state_equation_generator_.getDimU();
@@ -1227,7 +1226,7 @@ MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
   [[maybe_unused]] const StateEquationGenerator::Matrix & mpt_mat, const ValueMatrix & val_mat,
   const std::vector<ReferencePoint> & ref_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const size_t D_x = state_equation_generator_.getDimX();
   const size_t D_u = state_equation_generator_.getDimU();
@@ -1287,7 +1286,7 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   const StateEquationGenerator::Matrix & mpt_mat,
   const std::vector<ReferencePoint> & ref_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const size_t D_x = state_equation_generator_.getDimX();
   const size_t D_u = state_equation_generator_.getDimU();
@@ -1467,7 +1466,7 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
   const std::vector<ReferencePoint> & ref_points, const ObjectiveMatrix & obj_mat,
   const ConstraintMatrix & const_mat)
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const size_t D_x = state_equation_generator_.getDimX();
   const size_t D_u = state_equation_generator_.getDimU();
@@ -1500,32 +1499,33 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
   const auto lower_bound = toStdVector(updated_const_mat.lower_bound);
 
   // initialize or update solver according to warm start
-  time_keeper_->start_track("initOsqp");
-
-  const autoware::osqp_interface::CSC_Matrix P_csc =
-    autoware::osqp_interface::calCSCMatrixTrapezoidal(H);
-  const autoware::osqp_interface::CSC_Matrix A_csc = autoware::osqp_interface::calCSCMatrix(A);
-  if (
-    prev_solution_status_ == 1 && mpt_param_.enable_warm_start && prev_mat_n_ == H.rows() &&
-    prev_mat_m_ == A.rows()) {
-    RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "warm start");
-    osqp_solver_ptr_->updateCscP(P_csc);
-    osqp_solver_ptr_->updateQ(f);
-    osqp_solver_ptr_->updateCscA(A_csc);
-    osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
-  } else {
-    RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "no warm start");
-    osqp_solver_ptr_ = std::make_unique<autoware::osqp_interface::OSQPInterface>(
-      P_csc, A_csc, f, lower_bound, upper_bound, osqp_epsilon_);
+  {
+    autoware::universe_utils::ScopedTimeTrack st("initOsqp", time_keeper_.get());
+    const autoware::osqp_interface::CSC_Matrix P_csc =
+      autoware::osqp_interface::calCSCMatrixTrapezoidal(H);
+    const autoware::osqp_interface::CSC_Matrix A_csc = autoware::osqp_interface::calCSCMatrix(A);
+    if (
+      prev_solution_status_ == 1 && mpt_param_.enable_warm_start && prev_mat_n_ == H.rows() &&
+      prev_mat_m_ == A.rows()) {
+      RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "warm start");
+      osqp_solver_ptr_->updateCscP(P_csc);
+      osqp_solver_ptr_->updateQ(f);
+      osqp_solver_ptr_->updateCscA(A_csc);
+      osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
+    } else {
+      RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "no warm start");
+      osqp_solver_ptr_ = std::make_unique<autoware::osqp_interface::OSQPInterface>(
+        P_csc, A_csc, f, lower_bound, upper_bound, osqp_epsilon_);
+    }
+    prev_mat_n_ = H.rows();
+    prev_mat_m_ = A.rows();
   }
-  prev_mat_n_ = H.rows();
-  prev_mat_m_ = A.rows();
-  time_keeper_->end_track("initOsqp");
 
   // solve qp
-  time_keeper_->start_track("solveOsqp");
-  const auto result = osqp_solver_ptr_->optimize();
-  time_keeper_->end_track("solveOsqp");
+  const auto result = [&]() {
+    autoware::universe_utils::ScopedTimeTrack st("solveOsqp", time_keeper_.get());
+    return osqp_solver_ptr_->optimize();
+  }();
 
   // check solution status
   const int solution_status = std::get<3>(result);
@@ -1634,7 +1634,7 @@ std::optional<std::vector<TrajectoryPoint>> MPTOptimizer::calcMPTPoints(
   std::vector<ReferencePoint> & ref_points, const Eigen::VectorXd & optimized_variables,
   [[maybe_unused]] const StateEquationGenerator::Matrix & mpt_mat) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const size_t D_x = state_equation_generator_.getDimX();
   const size_t D_u = state_equation_generator_.getDimU();
@@ -1694,7 +1694,7 @@ void MPTOptimizer::publishDebugTrajectories(
   const std_msgs::msg::Header & header, const std::vector<ReferencePoint> & ref_points,
   const std::vector<TrajectoryPoint> & mpt_traj_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   // reference points
   const auto ref_traj = autoware::motion_utils::convertToTrajectory(
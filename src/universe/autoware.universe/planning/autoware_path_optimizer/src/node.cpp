@@ -135,8 +135,23 @@ PathOptimizer::PathOptimizer(const rclcpp::NodeOptions & node_options)
     traj_param_ = TrajectoryParam(this);
   }
 
-  time_keeper_ =
-    std::make_shared<autoware::universe_utils::TimeKeeper>(debug_processing_time_detail_pub_);
+  // NOTE: Only one of time_keeper_ and aggregated_time_keeper_ is created. The core algorithms do
+  // not track the processing time with aggregated_time_keeper_.
+  const auto enable_aggregated_processing_time =
+    declare_parameter<bool>("option.debug.enable_aggregated_processing_time");
+  const auto report_period = std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::duration<double>(
+      declare_parameter<double>("option.debug.aggregated_processing_time_report_period")));
+  if (enable_aggregated_processing_time) {
+    debug_aggregated_processing_time_detail_pub_ =
+      create_publisher<autoware::universe_utils::ProcessingTimeDetail>(
+        "~/debug/aggregated_processing_time_detail_ms", 1);
+    aggregated_time_keeper_ = std::make_unique<autoware::universe_utils::AggregatedTimeKeeper>(
+      report_period, debug_aggregated_processing_time_detail_pub_);
+  } else {
+    time_keeper_ =
+      std::make_shared<autoware::universe_utils::TimeKeeper>(debug_processing_time_detail_pub_);
+  }
 
   // create core algorithm pointers with parameter declaration
   replan_checker_ptr_ = std::make_shared<ReplanChecker>(this, ego_nearest_param_);
@@ -158,6 +173,8 @@ PathOptimizer::PathOptimizer(const rclcpp::NodeOptions & node_options)
   logger_configure_ = std::make_unique<autoware::universe_utils::LoggerLevelConfigure>(this);
   published_time_publisher_ =
     std::make_unique<autoware::universe_utils::PublishedTimePublisher>(this);
+  latency_trace_stage_ =
+    std::make_unique<autoware::universe_utils::LatencyTraceStage>(get_fully_qualified_name());
 }
 
 rcl_interfaces::msg::SetParametersResult PathOptimizer::onParam(
@@ -222,9 +239,14 @@ void PathOptimizer::resetPreviousData()
 
 void PathOptimizer::onPath(const Path::ConstSharedPtr path_ptr)
 {
-  time_keeper_->start_track(__func__);
+  static const autoware::universe_utils::TimeTrackScope scope(__func__);
+  autoware::universe_utils::ScopedSelectedTimeTrack st(
+    scope, time_keeper_.get(), aggregated_time_keeper_.get());
   stop_watch_.tic();
 
+  autoware::universe_utils::LatencyTraceScope trace_scope(*latency_trace_stage_);
+  trace_scope.add_input(path_ptr->header.stamp);
+
   // check if input path is valid
   if (!checkInputPath(*path_ptr, *get_clock())) {
     return;
@@ -251,6 +273,7 @@ void PathOptimizer::onPath(const Path::ConstSharedPtr path_ptr)
       autoware::motion_utils::convertToTrajectory(traj_points, path_ptr->header);
     traj_pub_->publish(output_traj_msg);
     published_time_publisher_->publish_if_subscribed(traj_pub_, output_traj_msg.header.stamp);
+    trace_scope.set_output(output_traj_msg.header.stamp);
     return;
   }
 
@@ -277,8 +300,7 @@ void PathOptimizer::onPath(const Path::ConstSharedPtr path_ptr)
     autoware::motion_utils::convertToTrajectory(full_traj_points, path_ptr->header);
   traj_pub_->publish(output_traj_msg);
   published_time_publisher_->publish_if_subscribed(traj_pub_, output_traj_msg.header.stamp);
-
-  time_keeper_->end_track(__func__);
+  trace_scope.set_output(output_traj_msg.header.stamp);
 }
 
 bool PathOptimizer::checkInputPath(const Path & path, rclcpp::Clock clock) const
@@ -316,7 +338,9 @@ PlannerData PathOptimizer::createPlannerData(
 std::vector<TrajectoryPoint> PathOptimizer::generateOptimizedTrajectory(
   const PlannerData & planner_data)
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  static const autoware::universe_utils::TimeTrackScope scope(__func__);
+  autoware::universe_utils::ScopedSelectedTimeTrack st(
+    scope, time_keeper_.get(), aggregated_time_keeper_.get());
 
   const auto & input_traj_points = planner_data.traj_points;
 
@@ -341,7 +365,9 @@ std::vector<TrajectoryPoint> PathOptimizer::generateOptimizedTrajectory(
 
 std::vector<TrajectoryPoint> PathOptimizer::optimizeTrajectory(const PlannerData & planner_data)
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  static const autoware::universe_utils::TimeTrackScope scope(__func__);
+  autoware::universe_utils::ScopedSelectedTimeTrack st(
+    scope, time_keeper_.get(), aggregated_time_keeper_.get());
   const auto & p = planner_data;
 
   // 1. check if replan (= optimization) is required
@@ -386,7 +412,7 @@ void PathOptimizer::applyInputVelocity(
   const std::vector<TrajectoryPoint> & input_traj_points,
   const geometry_msgs::msg::Pose & ego_pose) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   // crop forward for faster calculation
   const auto forward_cropped_input_traj_points = [&]() {
@@ -486,7 +512,7 @@ void PathOptimizer::applyInputVelocity(
 void PathOptimizer::insertZeroVelocityOutsideDrivableArea(
   const PlannerData & planner_data, std::vector<TrajectoryPoint> & optimized_traj_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   if (optimized_traj_points.empty()) {
     return;
@@ -550,7 +576,7 @@ void PathOptimizer::insertZeroVelocityOutsideDrivableArea(
 
 void PathOptimizer::publishVirtualWall(const geometry_msgs::msg::Pose & stop_pose) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   auto virtual_wall_marker = autoware::motion_utils::createStopVirtualWallMarker(
     stop_pose, "outside drivable area", now(), 0, vehicle_info_.max_longitudinal_offset_m);
@@ -565,28 +591,32 @@ void PathOptimizer::publishVirtualWall(const geometry_msgs::msg::Pose & stop_pos
 void PathOptimizer::publishDebugMarkerOfOptimization(
   const std::vector<TrajectoryPoint> & traj_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   if (!enable_pub_debug_marker_) {
     return;
   }
 
   // debug marker
-  time_keeper_->start_track("getDebugMarker");
-  const auto debug_marker =
-    getDebugMarker(*debug_data_ptr_, traj_points, vehicle_info_, enable_pub_extra_debug_marker_);
-  time_keeper_->end_track("getDebugMarker");
-
-  time_keeper_->start_track("publishDebugMarker");
-  debug_markers_pub_->publish(debug_marker);
-  time_keeper_->end_track("publishDebugMarker");
+  const auto debug_marker = [&]() {
+    autoware::universe_utils::ScopedTimeTrack st("getDebugMarker", time_keeper_.get());
+    return getDebugMarker(
+      *debug_data_ptr_, traj_points, vehicle_info_, enable_pub_extra_debug_marker_);
+  }();
+
+  {
+    autoware::universe_utils::ScopedTimeTrack st("publishDebugMarker", time_keeper_.get());
+    debug_markers_pub_->publish(debug_marker);
+  }
 }
 
 std::vector<TrajectoryPoint> PathOptimizer::extendTrajectory(
   const std::vector<TrajectoryPoint> & traj_points,
   const std::vector<TrajectoryPoint> & optimized_traj_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  static const autoware::universe_utils::TimeTrackScope scope(__func__);
+  autoware::universe_utils::ScopedSelectedTimeTrack st(
+    scope, time_keeper_.get(), aggregated_time_keeper_.get());
 
   const auto & joint_start_pose = optimized_traj_points.back().pose;
 
@@ -647,7 +677,7 @@ std::vector<TrajectoryPoint> PathOptimizer::extendTrajectory(
 
 void PathOptimizer::publishDebugData(const Header & header) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   // publish trajectories
   const auto debug_extended_traj =
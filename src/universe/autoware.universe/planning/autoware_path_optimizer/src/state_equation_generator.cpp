@@ -23,7 +23,7 @@ namespace autoware::path_optimizer
 StateEquationGenerator::Matrix StateEquationGenerator::calcMatrix(
   const std::vector<ReferencePoint> & ref_points) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const size_t D_x = vehicle_model_ptr_->getDimX();
   const size_t D_u = vehicle_model_ptr_->getDimU();
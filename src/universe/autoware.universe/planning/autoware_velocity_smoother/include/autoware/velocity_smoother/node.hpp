@@ -24,6 +24,7 @@
 #include "autoware/universe_utils/ros/polling_subscriber.hpp"
 #include "autoware/universe_utils/ros/self_pose_listener.hpp"
 #include "autoware/universe_utils/system/stop_watch.hpp"
+#include "autoware/universe_utils/system/aggregated_time_keeper.hpp"
 #include "autoware/universe_utils/system/time_keeper.hpp"
 #include "autoware/velocity_smoother/resample.hpp"
 #include "autoware/velocity_smoother/smoother/analytical_jerk_constrained_smoother/analytical_jerk_constrained_smoother.hpp"
@@ -37,6 +38,7 @@
 #include "tf2_ros/transform_listener.h"
 
 #include <autoware/universe_utils/ros/published_time_publisher.hpp>
+#include <autoware/universe_utils/system/latency_tracer.hpp>
 
 #include "autoware_adapi_v1_msgs/msg/operation_mode_state.hpp"
 #include "autoware_planning_msgs/msg/trajectory.hpp"
@@ -266,6 +268,8 @@ private:
   rclcpp::Publisher<Float32Stamped>::SharedPtr debug_closest_max_velocity_;
   rclcpp::Publisher<autoware::universe_utils::ProcessingTimeDetail>::SharedPtr
     debug_processing_time_detail_;
+  rclcpp::Publisher<autoware::universe_utils::ProcessingTimeDetail>::SharedPtr
+    debug_aggregated_processing_time_detail_;
 
   // For Jerk Filtered Algorithm Debug
   rclcpp::Publisher<Trajectory>::SharedPtr pub_forward_filtered_trajectory_;
@@ -281,8 +285,11 @@ private:
 
   std::unique_ptr<autoware::universe_utils::LoggerLevelConfigure> logger_configure_;
   std::unique_ptr<autoware::universe_utils::PublishedTimePublisher> published_time_publisher_;
+  std::unique_ptr<autoware::universe_utils::LatencyTraceStage> latency_trace_stage_;
 
   mutable std::shared_ptr<autoware::universe_utils::TimeKeeper> time_keeper_{nullptr};
+  // null unless enable_aggregated_processing_time
+  std::unique_ptr<autoware::universe_utils::AggregatedTimeKeeper> aggregated_time_keeper_;
 };
 }  // namespace autoware::velocity_smoother
 
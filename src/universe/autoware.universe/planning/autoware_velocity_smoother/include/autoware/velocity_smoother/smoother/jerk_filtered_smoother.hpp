@@ -25,6 +25,9 @@
 
 #include "boost/optional.hpp"
 
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
 #include <memory>
 #include <vector>
 
@@ -58,11 +61,52 @@ public:
   void setParam(const Param & param);
   Param getParam() const;
 
+protected:  // for the tests
+  /**
+   * @brief Sparse QP of the optimization. The sparsity pattern is kept while the number of points
+   * is the same, and only the values and the bounds are updated.
+   */
+  struct OptimizationProblem
+  {
+    size_t N{0};
+    Eigen::SparseMatrix<double> P;
+    Eigen::SparseMatrix<double> A;
+    std::vector<double> q;
+    std::vector<double> lower_bound;
+    std::vector<double> upper_bound;
+
+    // indices in the values of P and A which depend on the trajectory
+    std::vector<Eigen::Index> P_jerk_diag;   // (a[i], a[i])
+    std::vector<Eigen::Index> P_jerk_upper;  // (a[i], a[i+1])
+    std::vector<Eigen::Index> P_jerk_lower;  // (a[i+1], a[i])
+    std::vector<Eigen::Index> P_slack_diag;  // (delta[i], delta[i]), ..., (gamma[i], gamma[i])
+    std::vector<Eigen::Index> A_jerk_a0;     // a[i] in the jerk constraint
+    std::vector<Eigen::Index> A_jerk_a1;     // a[i+1] in the jerk constraint
+    std::vector<Eigen::Index> A_jerk_gamma;  // gamma[i] in the jerk constraint
+    std::vector<Eigen::Index> A_b_a;         // a[i] in the constraint of b' = 2a
+  };
+
+  OptimizationProblem problem_;
+
+  void buildOptimizationPattern(const size_t N);
+  void updateOptimizationProblem(
+    const size_t N, const double v0, const double a0, const std::vector<double> & v_max_arr,
+    const std::vector<double> & interval_dist_arr);
+
 private:
   Param smoother_param_;
   std::shared_ptr<autoware::common::QPInterface> qp_interface_;
   rclcpp::Logger logger_{rclcpp::get_logger("smoother").get_child("jerk_filtered_smoother")};
 
+  // previous solution and its trajectory for the warm start
+  std::vector<double> prev_solution_;
+  TrajectoryPoints prev_optimized_points_;
+  std::vector<double> initial_guess_;
+
+  bool setInitialGuess(
+    const size_t N, const geometry_msgs::msg::Pose & initial_pose,
+    const std::vector<double> & interval_dist_arr);
+
   TrajectoryPoints forwardJerkFilter(
     const double v0, const double a0, const double a_max, const double a_stop, const double j_max,
     const TrajectoryPoints & input) const;
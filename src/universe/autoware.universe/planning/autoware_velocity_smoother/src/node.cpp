@@ -48,10 +48,26 @@ VelocitySmootherNode::VelocitySmootherNode(const rclcpp::NodeOptions & node_opti
 
   // create time_keeper and its publisher
   // NOTE: This has to be called before setupSmoother to pass the time_keeper to the smoother.
-  debug_processing_time_detail_ = create_publisher<autoware::universe_utils::ProcessingTimeDetail>(
-    "~/debug/processing_time_detail_ms", 1);
-  time_keeper_ =
-    std::make_shared<autoware::universe_utils::TimeKeeper>(debug_processing_time_detail_);
+  // NOTE: Only one of time_keeper_ and aggregated_time_keeper_ is created. The smoother does not
+  // track the processing time with aggregated_time_keeper_.
+  const auto enable_aggregated_processing_time =
+    declare_parameter<bool>("enable_aggregated_processing_time");
+  const auto report_period = std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::duration<double>(
+      declare_parameter<double>("aggregated_processing_time_report_period")));
+  if (enable_aggregated_processing_time) {
+    debug_aggregated_processing_time_detail_ =
+      create_publisher<autoware::universe_utils::ProcessingTimeDetail>(
+        "~/debug/aggregated_processing_time_detail_ms", 1);
+    aggregated_time_keeper_ = std::make_unique<autoware::universe_utils::AggregatedTimeKeeper>(
+      report_period, debug_aggregated_processing_time_detail_);
+  } else {
+    debug_processing_time_detail_ =
+      create_publisher<autoware::universe_utils::ProcessingTimeDetail>(
+        "~/debug/processing_time_detail_ms", 1);
+    time_keeper_ =
+      std::make_shared<autoware::universe_utils::TimeKeeper>(debug_processing_time_detail_);
+  }
 
   // create smoother
   setupSmoother(wheelbase_);
@@ -100,6 +116,8 @@ VelocitySmootherNode::VelocitySmootherNode(const rclcpp::NodeOptions & node_opti
   logger_configure_ = std::make_unique<autoware::universe_utils::LoggerLevelConfigure>(this);
   published_time_publisher_ =
     std::make_unique<autoware::universe_utils::PublishedTimePublisher>(this);
+  latency_trace_stage_ =
+    std::make_unique<autoware::universe_utils::LatencyTraceStage>(get_fully_qualified_name());
 }
 
 void VelocitySmootherNode::setupSmoother(const double wheelbase)
@@ -316,7 +334,7 @@ void VelocitySmootherNode::publishTrajectory(const TrajectoryPoints & trajectory
 
 void VelocitySmootherNode::calcExternalVelocityLimit()
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   if (!external_velocity_limit_ptr_) {
     return;
@@ -423,11 +441,16 @@ bool VelocitySmootherNode::checkData() const
 
 void VelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstSharedPtr msg)
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  static const autoware::universe_utils::TimeTrackScope scope(__func__);
+  autoware::universe_utils::ScopedSelectedTimeTrack st(
+    scope, time_keeper_.get(), aggregated_time_keeper_.get());
 
   RCLCPP_DEBUG(get_logger(), "========================= run start =========================");
   stop_watch_.tic();
 
+  autoware::universe_utils::LatencyTraceScope trace_scope(*latency_trace_stage_);
+  trace_scope.add_input(msg->header.stamp);
+
   base_traj_raw_ptr_ = msg;
 
   // receive data
@@ -501,6 +524,7 @@ void VelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstSharedPtr
 
   // publish message
   publishTrajectory(output_resampled);
+  trace_scope.set_output(msg->header.stamp);
 
   // publish debug message
   publishStopDistance(output);
@@ -513,7 +537,7 @@ void VelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstSharedPtr
 
 void VelocitySmootherNode::updateDataForExternalVelocityLimit()
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   if (prev_output_.empty()) {
     return;
@@ -532,7 +556,9 @@ void VelocitySmootherNode::updateDataForExternalVelocityLimit()
 TrajectoryPoints VelocitySmootherNode::calcTrajectoryVelocity(
   const TrajectoryPoints & traj_input) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  static const autoware::universe_utils::TimeTrackScope scope(__func__);
+  autoware::universe_utils::ScopedSelectedTimeTrack st(
+    scope, time_keeper_.get(), aggregated_time_keeper_.get());
 
   TrajectoryPoints output{};  // velocity is optimized by qp solver
 
@@ -581,7 +607,9 @@ bool VelocitySmootherNode::smoothVelocity(
   const TrajectoryPoints & input, const size_t input_closest,
   TrajectoryPoints & traj_smoothed) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  static const autoware::universe_utils::TimeTrackScope scope(__func__);
+  autoware::universe_utils::ScopedSelectedTimeTrack st(
+    scope, time_keeper_.get(), aggregated_time_keeper_.get());
 
   if (input.empty()) {
     return false;  // cannot apply smoothing
@@ -688,7 +716,7 @@ bool VelocitySmootherNode::smoothVelocity(
 void VelocitySmootherNode::insertBehindVelocity(
   const size_t output_closest, const InitializeType type, TrajectoryPoints & output) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const bool keep_closest_vel_for_behind =
     (type == InitializeType::EGO_VELOCITY || type == InitializeType::LARGE_DEVIATION_REPLAN ||
@@ -752,7 +780,7 @@ void VelocitySmootherNode::publishStopDistance(const TrajectoryPoints & trajecto
 std::pair<Motion, VelocitySmootherNode::InitializeType> VelocitySmootherNode::calcInitialMotion(
   const TrajectoryPoints & input_traj, const size_t input_closest) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const double vehicle_speed = std::fabs(current_odometry_ptr_->twist.twist.linear.x);
   const double vehicle_acceleration = current_acceleration_ptr_->accel.accel.linear.x;
@@ -837,7 +865,7 @@ std::pair<Motion, VelocitySmootherNode::InitializeType> VelocitySmootherNode::ca
 void VelocitySmootherNode::overwriteStopPoint(
   const TrajectoryPoints & input, TrajectoryPoints & output) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const auto stop_idx = autoware::motion_utils::searchZeroVelocityIndex(input);
   if (!stop_idx) {
@@ -885,7 +913,7 @@ void VelocitySmootherNode::overwriteStopPoint(
 
 void VelocitySmootherNode::applyExternalVelocityLimit(TrajectoryPoints & traj) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   if (traj.size() < 1) {
     return;
@@ -926,7 +954,7 @@ void VelocitySmootherNode::applyExternalVelocityLimit(TrajectoryPoints & traj) c
 
 void VelocitySmootherNode::applyStopApproachingVelocity(TrajectoryPoints & traj) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   const auto stop_idx = autoware::motion_utils::searchZeroVelocityIndex(traj);
   if (!stop_idx) {
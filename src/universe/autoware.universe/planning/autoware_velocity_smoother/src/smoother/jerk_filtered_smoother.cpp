@@ -41,8 +41,9 @@ JerkFilteredSmoother::JerkFilteredSmoother(
   p.over_j_weight = node.declare_parameter<double>("over_j_weight");
   p.jerk_filter_ds = node.declare_parameter<double>("jerk_filter_ds");
 
+  // The warm start keeps the problem and updates only the values while its size is the same.
   qp_interface_ =
-    std::make_shared<autoware::common::ProxQPInterface>(false, 20000, 1.0e-8, 1.0e-6, false);
+    std::make_shared<autoware::common::ProxQPInterface>(true, 20000, 1.0e-8, 1.0e-6, false);
 }
 
 void JerkFilteredSmoother::setParam(const Param & smoother_param)
@@ -59,7 +60,7 @@ bool JerkFilteredSmoother::apply(
   const double v0, const double a0, const TrajectoryPoints & input, TrajectoryPoints & output,
   std::vector<TrajectoryPoints> & debug_trajectories, const bool publish_debug_trajs)
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   output = input;
 
@@ -87,9 +88,6 @@ bool JerkFilteredSmoother::apply(
   const double a_stop_decel = base_param_.stop_decel;
   const double j_max = base_param_.max_jerk;
   const double j_min = base_param_.min_jerk;
-  const double over_j_weight = smoother_param_.over_j_weight;
-  const double over_v_weight = smoother_param_.over_v_weight;
-  const double over_a_weight = smoother_param_.over_a_weight;
 
   // jerk filter
   const auto forward_filtered =
@@ -104,7 +102,7 @@ bool JerkFilteredSmoother::apply(
   const auto initial_traj_pose = filtered.front().pose;
 
   const auto resample = [&](const auto & trajectory) {
-    autoware::universe_utils::ScopedTimeTrack st("resample", *time_keeper_);
+    autoware::universe_utils::ScopedTimeTrack st("resample", time_keeper_.get());
 
     return resampling::resampleTrajectory(
       trajectory, v0, initial_traj_pose, std::numeric_limits<double>::max(),
@@ -161,7 +159,82 @@ bool JerkFilteredSmoother::apply(
     v_max_arr.at(i) = opt_resampled_trajectory.at(i).longitudinal_velocity_mps;
   }
 
-  time_keeper_->start_track("initOptimization");
+  bool has_initial_guess = false;
+  {
+    autoware::universe_utils::ScopedTimeTrack st("initOptimization", time_keeper_.get());
+    updateOptimizationProblem(N, v0, a0, v_max_arr, interval_dist_arr);
+    has_initial_guess = setInitialGuess(N, initial_traj_pose, interval_dist_arr);
+  }
+
+  const auto t_assembled = std::chrono::system_clock::now();
+
+  // execute optimization
+  const auto optval = [&]() {
+    autoware::universe_utils::ScopedTimeTrack st("optimize", time_keeper_.get());
+    return qp_interface_->optimize(
+      problem_.P, problem_.A, problem_.q, problem_.lower_bound, problem_.upper_bound);
+  }();
+  if (!qp_interface_->isSolved()) {
+    RCLCPP_WARN(logger_, "optimization failed : %s", qp_interface_->getStatus().c_str());
+    prev_optimized_points_.clear();
+    return false;
+  }
+
+  const auto has_nan =
+    std::any_of(optval.begin(), optval.end(), [](const auto v) { return std::isnan(v); });
+  if (has_nan) {
+    RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
+    prev_optimized_points_.clear();
+    return false;
+  }
+
+  const auto tf1 = std::chrono::system_clock::now();
+  const auto to_ms = [](const auto & duration) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() * 1.0e-6;
+  };
+  RCLCPP_DEBUG(
+    logger_,
+    "optimization time = %f [ms] (assembly: %f [ms], solve: %f [ms], iteration: %d, warm start: "
+    "%d)",
+    to_ms(tf1 - ts), to_ms(t_assembled - ts), to_ms(tf1 - t_assembled),
+    qp_interface_->getIterationNumber(), has_initial_guess);
+
+  // get velocity & acceleration
+  for (size_t i = 0; i < N; ++i) {
+    double b = optval.at(IDX_B0 + i);
+    output.at(i).longitudinal_velocity_mps = std::sqrt(std::max(b, 0.0));
+    output.at(i).acceleration_mps2 = optval.at(IDX_A0 + i);
+  }
+  for (size_t i = N; i < output.size(); ++i) {
+    output.at(i).longitudinal_velocity_mps = 0.0;
+    output.at(i).acceleration_mps2 = a_stop_decel;
+  }
+
+  prev_solution_ = optval;
+  prev_optimized_points_.assign(output.begin(), output.begin() + N);
+
+  if (VERBOSE_TRAJECTORY_VELOCITY) {
+    const auto s_output = trajectory_utils::calcArclengthArray(output);
+
+    std::cerr << "\n\n" << std::endl;
+    for (size_t i = 0; i < N; ++i) {
+      const auto v_opt = output.at(i).longitudinal_velocity_mps;
+      const auto a_opt = output.at(i).acceleration_mps2;
+      const auto ds = i < interval_dist_arr.size() ? interval_dist_arr.at(i) : 0.0;
+      const auto v_rs = i < opt_resampled_trajectory.size()
+                          ? opt_resampled_trajectory.at(i).longitudinal_velocity_mps
+                          : 0.0;
+      RCLCPP_INFO(
+        logger_, "i =  %4lu | s: %5f | ds: %5f | rs: %9f | op_v: %10f | op_a: %10f |", i,
+        s_output.at(i), ds, v_rs, v_opt, a_opt);
+    }
+  }
+
+  return true;
+}
+
+void JerkFilteredSmoother::buildOptimizationPattern(const size_t N)
+{
   /*
    * x = [
    *      b[0], b[1], ..., b[N],               : 0~N
@@ -176,23 +249,117 @@ bool JerkFilteredSmoother::apply(
    * sigma : a_min < a[i] - sigma[i] < a_max
    * gamma : jerk_min < pseudo_jerk[i] * ref_vel[i] - gamma[i] < jerk_max
    */
-  const uint32_t IDX_B0 = 0;
-  const uint32_t IDX_A0 = N;
-  const uint32_t IDX_DELTA0 = 2 * N;
-  const uint32_t IDX_SIGMA0 = 3 * N;
-  const uint32_t IDX_GAMMA0 = 4 * N;
-
-  const uint32_t l_variables = 5 * N;
-  const uint32_t l_constraints = 4 * N + 1;
+  const Eigen::Index IDX_B0 = 0;
+  const Eigen::Index IDX_A0 = N;
+  const Eigen::Index IDX_DELTA0 = 2 * N;
+  const Eigen::Index IDX_SIGMA0 = 3 * N;
+  const Eigen::Index IDX_GAMMA0 = 4 * N;
+
+  const Eigen::Index l_variables = 5 * N;
+  const Eigen::Index l_constraints = 4 * N + 1;
+
+  // The values depending on the trajectory are set to zero here and updated for each cycle.
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  P_triplets.reserve(6 * N);
+  for (size_t i = 0; i < N; ++i) {
+    P_triplets.emplace_back(IDX_A0 + i, IDX_A0 + i, 0.0);
+    if (i < N - 1) {
+      P_triplets.emplace_back(IDX_A0 + i, IDX_A0 + i + 1, 0.0);
+      P_triplets.emplace_back(IDX_A0 + i + 1, IDX_A0 + i, 0.0);
+    }
+  }
+  for (Eigen::Index i = IDX_DELTA0; i < l_variables; ++i) {
+    P_triplets.emplace_back(i, i, 0.0);
+  }
 
-  // the matrix size depends on constraint numbers.
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(l_constraints, l_variables);
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  A_triplets.reserve(10 * N);
+  Eigen::Index constr_idx = 0;
+  // Soft Constraint Velocity Limit: 0 < b - delta < v_max^2
+  for (size_t i = 0; i < N; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i, 1.0);       // b_i
+    A_triplets.emplace_back(constr_idx, IDX_DELTA0 + i, -1.0);  // -delta_i
+  }
+  // Soft Constraint Acceleration Limit: a_min < a - sigma < a_max
+  for (size_t i = 0; i < N; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, 1.0);       // a_i
+    A_triplets.emplace_back(constr_idx, IDX_SIGMA0 + i, -1.0);  // -sigma_i
+  }
+  // Soft Constraint Jerk Limit: jerk_min < pseudo_jerk[i] * ref_vel[i] - gamma[i] < jerk_max
+  const Eigen::Index jerk_constr_idx = constr_idx;
+  for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, 0.0);      // -a[i] * ref_vel
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i + 1, 0.0);  //  a[i+1] * ref_vel
+    A_triplets.emplace_back(constr_idx, IDX_GAMMA0 + i, 0.0);  // -gamma[i] * ds
+  }
+  // b' = 2a ... (b(i+1) - b(i)) / ds = 2a(i)
+  const Eigen::Index b_constr_idx = constr_idx;
+  for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i, -1.0);     // b(i)
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i + 1, 1.0);  // b(i+1)
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, 0.0);      // a(i) * ds
+  }
+  // initial condition
+  A_triplets.emplace_back(constr_idx++, IDX_B0, 1.0);  // b0
+  A_triplets.emplace_back(constr_idx++, IDX_A0, 1.0);  // a0
+
+  auto & p = problem_;
+  p.N = N;
+  p.P.resize(l_variables, l_variables);
+  p.P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+  p.A.resize(l_constraints, l_variables);
+  p.A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+  p.q.assign(l_variables, 0.0);
+  p.lower_bound.assign(l_constraints, 0.0);
+  p.upper_bound.assign(l_constraints, 0.0);
+
+  // Find the values in the compressed matrices once.
+  const auto P_index = [&p](const Eigen::Index row, const Eigen::Index col) {
+    return &p.P.coeffRef(row, col) - p.P.valuePtr();
+  };
+  const auto A_index = [&p](const Eigen::Index row, const Eigen::Index col) {
+    return &p.A.coeffRef(row, col) - p.A.valuePtr();
+  };
+  p.P_jerk_diag.resize(N);
+  p.P_jerk_upper.resize(N - 1);
+  p.P_jerk_lower.resize(N - 1);
+  p.P_slack_diag.resize(3 * N);
+  p.A_jerk_a0.resize(N - 1);
+  p.A_jerk_a1.resize(N - 1);
+  p.A_jerk_gamma.resize(N - 1);
+  p.A_b_a.resize(N - 1);
+  for (size_t i = 0; i < N; ++i) {
+    p.P_jerk_diag.at(i) = P_index(IDX_A0 + i, IDX_A0 + i);
+  }
+  for (size_t i = 0; i < N - 1; ++i) {
+    p.P_jerk_upper.at(i) = P_index(IDX_A0 + i, IDX_A0 + i + 1);
+    p.P_jerk_lower.at(i) = P_index(IDX_A0 + i + 1, IDX_A0 + i);
+    p.A_jerk_a0.at(i) = A_index(jerk_constr_idx + i, IDX_A0 + i);
+    p.A_jerk_a1.at(i) = A_index(jerk_constr_idx + i, IDX_A0 + i + 1);
+    p.A_jerk_gamma.at(i) = A_index(jerk_constr_idx + i, IDX_GAMMA0 + i);
+    p.A_b_a.at(i) = A_index(b_constr_idx + i, IDX_A0 + i);
+  }
+  for (size_t i = 0; i < 3 * N; ++i) {
+    p.P_slack_diag.at(i) = P_index(IDX_DELTA0 + i, IDX_DELTA0 + i);
+  }
+}
 
-  std::vector<double> lower_bound(l_constraints, 0.0);
-  std::vector<double> upper_bound(l_constraints, 0.0);
+void JerkFilteredSmoother::updateOptimizationProblem(
+  const size_t N, const double v0, const double a0, const std::vector<double> & v_max_arr,
+  const std::vector<double> & interval_dist_arr)
+{
+  if (problem_.N != N) {
+    buildOptimizationPattern(N);
+  }
+  auto & p = problem_;
+  double * P_values = p.P.valuePtr();
+  double * A_values = p.A.valuePtr();
 
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(l_variables, l_variables);
-  std::vector<double> q(l_variables, 0.0);
+  const double a_max = base_param_.max_accel;
+  const double a_min = base_param_.min_decel;
+  const double a_stop_decel = base_param_.stop_decel;
+  const double j_max = base_param_.max_jerk;
+  const double j_min = base_param_.min_jerk;
 
   /**************************************************************/
   /**************************************************************/
@@ -200,16 +367,20 @@ bool JerkFilteredSmoother::apply(
   /**************************************************************/
   /**************************************************************/
 
+  std::fill(P_values, P_values + p.P.nonZeros(), 0.0);
+  std::fill(p.q.begin(), p.q.end(), 0.0);
+
   // jerk: d(ai)/ds * v_ref -> minimize weight * ((a1 - a0) / ds * v_ref)^2 * ds
   const double smooth_weight = smoother_param_.jerk_weight;
   for (size_t i = 0; i < N - 1; ++i) {
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double interval_dist = std::max(interval_dist_arr.at(i), 0.0001);
     const double w_x_ds_inv = (1.0 / interval_dist) * ref_vel;
-    P(IDX_A0 + i, IDX_A0 + i) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i, IDX_A0 + i + 1) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i + 1) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    const double weight = smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    P_values[p.P_jerk_diag.at(i)] += weight;
+    P_values[p.P_jerk_upper.at(i)] -= weight;
+    P_values[p.P_jerk_lower.at(i)] -= weight;
+    P_values[p.P_jerk_diag.at(i + 1)] += weight;
   }
 
   // |v_max_i^2 - b_i|/v_max^2 -> minimize (-bi) * ds / v_max^2
@@ -220,11 +391,11 @@ bool JerkFilteredSmoother::apply(
       if (i < N - 1) {
         v_weight_term *= std::max(interval_dist_arr.at(i), 0.0001);
       }
-      q.at(IDX_B0 + i) += v_weight_term;
+      p.q.at(i) += v_weight_term;
     }
-    P(IDX_DELTA0 + i, IDX_DELTA0 + i) += over_v_weight;  // over velocity cost
-    P(IDX_SIGMA0 + i, IDX_SIGMA0 + i) += over_a_weight;  // over acceleration cost
-    P(IDX_GAMMA0 + i, IDX_GAMMA0 + i) += over_j_weight;  // over jerk cost
+    P_values[p.P_slack_diag.at(i)] = smoother_param_.over_v_weight;          // over velocity cost
+    P_values[p.P_slack_diag.at(N + i)] = smoother_param_.over_a_weight;      // over acceleration
+    P_values[p.P_slack_diag.at(2 * N + i)] = smoother_param_.over_j_weight;  // over jerk cost
   }
 
   /**************************************************************/
@@ -245,25 +416,20 @@ bool JerkFilteredSmoother::apply(
 
   // Soft Constraint Velocity Limit: 0 < b - delta < v_max^2
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = 1.0;       // b_i
-    A(constr_idx, IDX_DELTA0 + i) = -1.0;  // -delta_i
-    upper_bound[constr_idx] = v_max_arr.at(i) * v_max_arr.at(i);
-    lower_bound[constr_idx] = 0.0;
+    p.upper_bound.at(constr_idx) = v_max_arr.at(i) * v_max_arr.at(i);
+    p.lower_bound.at(constr_idx) = 0.0;
   }
 
   // Soft Constraint Acceleration Limit: a_min < a - sigma < a_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_A0 + i) = 1.0;       // a_i
-    A(constr_idx, IDX_SIGMA0 + i) = -1.0;  // -sigma_i
-
     constexpr double stop_vel = 1e-3;
     if (v_max_arr.at(i) < stop_vel) {
       // Stop Point
-      upper_bound[constr_idx] = a_stop_decel;
-      lower_bound[constr_idx] = a_stop_decel;
+      p.upper_bound.at(constr_idx) = a_stop_decel;
+      p.lower_bound.at(constr_idx) = a_stop_decel;
     } else {
-      upper_bound[constr_idx] = a_max;
-      lower_bound[constr_idx] = a_min;
+      p.upper_bound.at(constr_idx) = a_max;
+      p.lower_bound.at(constr_idx) = a_min;
     }
   }
 
@@ -272,93 +438,77 @@ bool JerkFilteredSmoother::apply(
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double ds = interval_dist_arr.at(i);
-    A(constr_idx, IDX_A0 + i) = -ref_vel;     // -a[i] * ref_vel
-    A(constr_idx, IDX_A0 + i + 1) = ref_vel;  //  a[i+1] * ref_vel
-    A(constr_idx, IDX_GAMMA0 + i) = -ds;      // -gamma[i] * ds
-    upper_bound[constr_idx] = j_max * ds;     //  jerk_max * ds
-    lower_bound[constr_idx] = j_min * ds;     //  jerk_min * ds
+    A_values[p.A_jerk_a0.at(i)] = -ref_vel;    // -a[i] * ref_vel
+    A_values[p.A_jerk_a1.at(i)] = ref_vel;     //  a[i+1] * ref_vel
+    A_values[p.A_jerk_gamma.at(i)] = -ds;      // -gamma[i] * ds
+    p.upper_bound.at(constr_idx) = j_max * ds;  //  jerk_max * ds
+    p.lower_bound.at(constr_idx) = j_min * ds;  //  jerk_min * ds
   }
 
   // b' = 2a ... (b(i+1) - b(i)) / ds = 2a(i)
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = -1.0;                            // b(i)
-    A(constr_idx, IDX_B0 + i + 1) = 1.0;                         // b(i+1)
-    A(constr_idx, IDX_A0 + i) = -2.0 * interval_dist_arr.at(i);  // a(i) * ds
-    upper_bound[constr_idx] = 0.0;
-    lower_bound[constr_idx] = 0.0;
+    A_values[p.A_b_a.at(i)] = -2.0 * interval_dist_arr.at(i);  // a(i) * ds
+    p.upper_bound.at(constr_idx) = 0.0;
+    p.lower_bound.at(constr_idx) = 0.0;
   }
 
   // initial condition
   {
-    A(constr_idx, IDX_B0) = 1.0;  // b0
-    upper_bound[constr_idx] = v0 * v0;
-    lower_bound[constr_idx] = v0 * v0;
+    p.upper_bound.at(constr_idx) = v0 * v0;
+    p.lower_bound.at(constr_idx) = v0 * v0;
     ++constr_idx;
 
-    A(constr_idx, IDX_A0) = 1.0;  // a0
-    upper_bound[constr_idx] = a0;
-    lower_bound[constr_idx] = a0;
+    p.upper_bound.at(constr_idx) = a0;
+    p.lower_bound.at(constr_idx) = a0;
     ++constr_idx;
   }
-  time_keeper_->end_track("initOptimization");
+}
 
-  // execute optimization
-  time_keeper_->start_track("optimize");
-  const auto optval = qp_interface_->optimize(P, A, q, lower_bound, upper_bound);
-  time_keeper_->end_track("optimize");
-  if (!qp_interface_->isSolved()) {
-    RCLCPP_WARN(logger_, "optimization failed : %s", qp_interface_->getStatus().c_str());
+bool JerkFilteredSmoother::setInitialGuess(
+  const size_t N, const geometry_msgs::msg::Pose & initial_pose,
+  const std::vector<double> & interval_dist_arr)
+{
+  const size_t prev_N = prev_optimized_points_.size();
+  if (prev_N < 2 || prev_solution_.size() != 5 * prev_N) {
     return false;
   }
 
-  const auto has_nan =
-    std::any_of(optval.begin(), optval.end(), [](const auto v) { return std::isnan(v); });
-  if (has_nan) {
-    RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
+  // The ego moves along the previous trajectory, so shift the previous solution by the distance.
+  const double travelled_dist =
+    autoware::motion_utils::calcSignedArcLength(prev_optimized_points_, 0, initial_pose.position);
+  const auto prev_arclength_arr = trajectory_utils::calcArclengthArray(prev_optimized_points_);
+  if (travelled_dist < 0.0 || prev_arclength_arr.back() < travelled_dist) {
     return false;
   }
 
-  const auto tf1 = std::chrono::system_clock::now();
-  const double dt_ms1 =
-    std::chrono::duration_cast<std::chrono::nanoseconds>(tf1 - ts).count() * 1.0e-6;
-  RCLCPP_DEBUG(logger_, "optimization time = %f [ms]", dt_ms1);
-
-  // get velocity & acceleration
+  // Interpolate all the variables at the same arc length, where the slack variables are mostly 0.
+  initial_guess_.assign(5 * N, 0.0);
+  double s = travelled_dist;
+  size_t j = 0;
   for (size_t i = 0; i < N; ++i) {
-    double b = optval.at(IDX_B0 + i);
-    output.at(i).longitudinal_velocity_mps = std::sqrt(std::max(b, 0.0));
-    output.at(i).acceleration_mps2 = optval.at(IDX_A0 + i);
-  }
-  for (size_t i = N; i < output.size(); ++i) {
-    output.at(i).longitudinal_velocity_mps = 0.0;
-    output.at(i).acceleration_mps2 = a_stop_decel;
-  }
-
-  if (VERBOSE_TRAJECTORY_VELOCITY) {
-    const auto s_output = trajectory_utils::calcArclengthArray(output);
-
-    std::cerr << "\n\n" << std::endl;
-    for (size_t i = 0; i < N; ++i) {
-      const auto v_opt = output.at(i).longitudinal_velocity_mps;
-      const auto a_opt = output.at(i).acceleration_mps2;
-      const auto ds = i < interval_dist_arr.size() ? interval_dist_arr.at(i) : 0.0;
-      const auto v_rs = i < opt_resampled_trajectory.size()
-                          ? opt_resampled_trajectory.at(i).longitudinal_velocity_mps
-                          : 0.0;
-      RCLCPP_INFO(
-        logger_, "i =  %4lu | s: %5f | ds: %5f | rs: %9f | op_v: %10f | op_a: %10f |", i,
-        s_output.at(i), ds, v_rs, v_opt, a_opt);
+    while (j + 2 < prev_N && prev_arclength_arr.at(j + 1) < s) {
+      ++j;
+    }
+    const double ds = prev_arclength_arr.at(j + 1) - prev_arclength_arr.at(j);
+    const double ratio =
+      ds > 1e-6 ? std::clamp((s - prev_arclength_arr.at(j)) / ds, 0.0, 1.0) : 0.0;
+    for (size_t k = 0; k < 5; ++k) {
+      const double prev_x0 = prev_solution_.at(k * prev_N + j);
+      const double prev_x1 = prev_solution_.at(k * prev_N + j + 1);
+      initial_guess_.at(k * N + i) = prev_x0 + ratio * (prev_x1 - prev_x0);
+    }
+    if (i < N - 1) {
+      s += interval_dist_arr.at(i);
     }
   }
-
-  return true;
+  return qp_interface_->setPrimalVariables(initial_guess_);
 }
 
 TrajectoryPoints JerkFilteredSmoother::forwardJerkFilter(
   const double v0, const double a0, const double a_max, const double a_start, const double j_max,
   const TrajectoryPoints & input) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   auto applyLimits = [&input, &a_start](double & v, double & a, size_t i) {
     double v_lim = input.at(i).longitudinal_velocity_mps;
@@ -412,7 +562,7 @@ TrajectoryPoints JerkFilteredSmoother::backwardJerkFilter(
   const double v0, const double a0, const double a_min, const double a_stop, const double j_min,
   const TrajectoryPoints & input) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   auto input_rev = input;
   std::reverse(input_rev.begin(), input_rev.end());
@@ -429,7 +579,7 @@ TrajectoryPoints JerkFilteredSmoother::mergeFilteredTrajectory(
   const double v0, const double a0, const double a_min, const double j_min,
   const TrajectoryPoints & forward_filtered, const TrajectoryPoints & backward_filtered) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   TrajectoryPoints merged;
   merged = forward_filtered;
@@ -483,7 +633,7 @@ TrajectoryPoints JerkFilteredSmoother::resampleTrajectory(
   const geometry_msgs::msg::Pose & current_pose, const double nearest_dist_threshold,
   const double nearest_yaw_threshold) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   return resampling::resampleTrajectory(
     input, current_pose, nearest_dist_threshold, nearest_yaw_threshold, base_param_.resample_param,
@@ -132,7 +132,7 @@ TrajectoryPoints SmootherBase::applyLateralAccelerationFilter(
   [[maybe_unused]] const double a0, [[maybe_unused]] const bool enable_smooth_limit,
   const bool use_resampling, const double input_points_interval) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   if (input.size() < 3) {
     return input;  // cannot calculate lateral acc. do nothing.
@@ -202,7 +202,7 @@ TrajectoryPoints SmootherBase::applySteeringRateLimit(
   const TrajectoryPoints & input, const bool use_resampling,
   const double input_points_interval) const
 {
-  autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware::universe_utils::ScopedTimeTrack st(__func__, time_keeper_.get());
 
   if (input.size() < 3) {
     return input;  // cannot calculate the desired velocity. do nothing.
@@ -0,0 +1,235 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/velocity_smoother/smoother/jerk_filtered_smoother.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <Eigen/Core>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using autoware::velocity_smoother::JerkFilteredSmoother;
+using autoware::velocity_smoother::SmootherBase;
+
+namespace
+{
+// expose the assembly of the optimization problem
+class JerkFilteredSmootherTest : public JerkFilteredSmoother
+{
+public:
+  using JerkFilteredSmoother::JerkFilteredSmoother;
+  using JerkFilteredSmoother::problem_;
+  using JerkFilteredSmoother::setParam;
+  using JerkFilteredSmoother::updateOptimizationProblem;
+  using SmootherBase::setParam;
+};
+
+struct DenseProblem
+{
+  Eigen::MatrixXd P;
+  Eigen::MatrixXd A;
+  std::vector<double> q;
+  std::vector<double> lower_bound;
+  std::vector<double> upper_bound;
+};
+
+// the problem assembled with dense matrices from scratch, as before the sparsity pattern was kept
+DenseProblem buildDenseProblem(
+  const JerkFilteredSmoother::Param & param, const SmootherBase::BaseParam & base_param,
+  const size_t N, const double v0, const double a0, const std::vector<double> & v_max_arr,
+  const std::vector<double> & interval_dist_arr)
+{
+  const size_t IDX_B0 = 0;
+  const size_t IDX_A0 = N;
+  const size_t IDX_DELTA0 = 2 * N;
+  const size_t IDX_SIGMA0 = 3 * N;
+  const size_t IDX_GAMMA0 = 4 * N;
+  const size_t l_variables = 5 * N;
+  const size_t l_constraints = 4 * N + 1;
+
+  DenseProblem p;
+  p.P = Eigen::MatrixXd::Zero(l_variables, l_variables);
+  p.A = Eigen::MatrixXd::Zero(l_constraints, l_variables);
+  p.q.assign(l_variables, 0.0);
+  p.lower_bound.assign(l_constraints, 0.0);
+  p.upper_bound.assign(l_constraints, 0.0);
+
+  for (size_t i = 0; i < N - 1; ++i) {
+    const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
+    const double interval_dist = std::max(interval_dist_arr.at(i), 0.0001);
+    const double w_x_ds_inv = (1.0 / interval_dist) * ref_vel;
+    const double weight = param.jerk_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    p.P(IDX_A0 + i, IDX_A0 + i) += weight;
+    p.P(IDX_A0 + i, IDX_A0 + i + 1) -= weight;
+    p.P(IDX_A0 + i + 1, IDX_A0 + i) -= weight;
+    p.P(IDX_A0 + i + 1, IDX_A0 + i + 1) += weight;
+  }
+  for (size_t i = 0; i < N; ++i) {
+    if (v_max_arr.at(i) > 0.01) {
+      double v_weight_term = -1.0 / (v_max_arr.at(i) * v_max_arr.at(i));
+      if (i < N - 1) {
+        v_weight_term *= std::max(interval_dist_arr.at(i), 0.0001);
+      }
+      p.q.at(IDX_B0 + i) += v_weight_term;
+    }
+    p.P(IDX_DELTA0 + i, IDX_DELTA0 + i) += param.over_v_weight;
+    p.P(IDX_SIGMA0 + i, IDX_SIGMA0 + i) += param.over_a_weight;
+    p.P(IDX_GAMMA0 + i, IDX_GAMMA0 + i) += param.over_j_weight;
+  }
+
+  size_t constr_idx = 0;
+  for (size_t i = 0; i < N; ++i, ++constr_idx) {
+    p.A(constr_idx, IDX_B0 + i) = 1.0;
+    p.A(constr_idx, IDX_DELTA0 + i) = -1.0;
+    p.upper_bound.at(constr_idx) = v_max_arr.at(i) * v_max_arr.at(i);
+    p.lower_bound.at(constr_idx) = 0.0;
+  }
+  for (size_t i = 0; i < N; ++i, ++constr_idx) {
+    p.A(constr_idx, IDX_A0 + i) = 1.0;
+    p.A(constr_idx, IDX_SIGMA0 + i) = -1.0;
+    if (v_max_arr.at(i) < 1e-3) {
+      p.upper_bound.at(constr_idx) = base_param.stop_decel;
+      p.lower_bound.at(constr_idx) = base_param.stop_decel;
+    } else {
+      p.upper_bound.at(constr_idx) = base_param.max_accel;
+      p.lower_bound.at(constr_idx) = base_param.min_decel;
+    }
+  }
+  for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
+    const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
+    const double ds = interval_dist_arr.at(i);
+    p.A(constr_idx, IDX_A0 + i) = -ref_vel;
+    p.A(constr_idx, IDX_A0 + i + 1) = ref_vel;
+    p.A(constr_idx, IDX_GAMMA0 + i) = -ds;
+    p.upper_bound.at(constr_idx) = base_param.max_jerk * ds;
+    p.lower_bound.at(constr_idx) = base_param.min_jerk * ds;
+  }
+  for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
+    p.A(constr_idx, IDX_B0 + i) = -1.0;
+    p.A(constr_idx, IDX_B0 + i + 1) = 1.0;
+    p.A(constr_idx, IDX_A0 + i) = -2.0 * interval_dist_arr.at(i);
+    p.upper_bound.at(constr_idx) = 0.0;
+    p.lower_bound.at(constr_idx) = 0.0;
+  }
+  p.A(constr_idx, IDX_B0) = 1.0;
+  p.upper_bound.at(constr_idx) = v0 * v0;
+  p.lower_bound.at(constr_idx) = v0 * v0;
+  ++constr_idx;
+  p.A(constr_idx, IDX_A0) = 1.0;
+  p.upper_bound.at(constr_idx) = a0;
+  p.lower_bound.at(constr_idx) = a0;
+  return p;
+}
+
+std::shared_ptr<rclcpp::Node> generateNode()
+{
+  rclcpp::NodeOptions node_options;
+  const auto velocity_smoother_dir =
+    ament_index_cpp::get_package_share_directory("autoware_velocity_smoother");
+  node_options.arguments(
+    {"--ros-args", "--params-file",
+     velocity_smoother_dir + "/config/default_velocity_smoother.param.yaml", "--params-file",
+     velocity_smoother_dir + "/config/default_common.param.yaml", "--params-file",
+     velocity_smoother_dir + "/config/JerkFiltered.param.yaml"});
+  return std::make_shared<rclcpp::Node>("test_jerk_filtered_smoother", node_options);
+}
+}  // namespace
+
+TEST(TestJerkFilteredSmoother, IncrementalProblemMatchesDenseProblem)
+{
+  rclcpp::init(0, nullptr);
+  auto node = generateNode();
+  JerkFilteredSmootherTest smoother(
+    *node, std::make_shared<autoware::universe_utils::TimeKeeper>());
+
+  // non-zero stop deceleration to tell the bounds of the stop points from the others
+  auto base_param = smoother.getBaseParam();
+  base_param.stop_decel = -0.5;
+  smoother.setParam(base_param);
+  const auto param = smoother.getParam();
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> velocity_dist(0.0, 15.0);
+  std::uniform_real_distribution<double> interval_dist(0.0, 2.0);
+  std::uniform_real_distribution<double> acceleration_dist(-1.0, 1.0);
+  std::uniform_real_distribution<double> probability_dist(0.0, 1.0);
+
+  // the same size several times in a row reuses the pattern, and a new size rebuilds it
+  for (const size_t N : std::vector<size_t>{2, 50, 50, 50, 120, 3, 120, 120, 2, 2, 200, 50}) {
+    std::vector<double> v_max_arr(N);
+    std::vector<double> interval_dist_arr(N - 1);
+    for (auto & v_max : v_max_arr) {
+      // stop points and tiny velocities take the other branches of the cost and the bounds
+      const double probability = probability_dist(engine);
+      v_max = probability < 0.1 ? 0.0 : probability < 0.15 ? 0.005 : velocity_dist(engine);
+    }
+    v_max_arr.back() = 0.0;
+    for (auto & interval : interval_dist_arr) {
+      interval = probability_dist(engine) < 0.05 ? 0.0 : interval_dist(engine);
+    }
+    const double v0 = velocity_dist(engine);
+    const double a0 = acceleration_dist(engine);
+
+    smoother.updateOptimizationProblem(N, v0, a0, v_max_arr, interval_dist_arr);
+    const auto expected =
+      buildDenseProblem(param, base_param, N, v0, a0, v_max_arr, interval_dist_arr);
+
+    const auto & problem = smoother.problem_;
+    ASSERT_EQ(problem.N, N);
+    // the values are updated in place, so the pattern must not grow
+    EXPECT_TRUE(problem.P.isCompressed());
+    EXPECT_TRUE(problem.A.isCompressed());
+    EXPECT_EQ(problem.P.nonZeros(), static_cast<Eigen::Index>(6 * N - 2)) << "N = " << N;
+    EXPECT_EQ(problem.A.nonZeros(), static_cast<Eigen::Index>(10 * N - 4)) << "N = " << N;
+
+    const Eigen::MatrixXd P = problem.P;
+    const Eigen::MatrixXd A = problem.A;
+    ASSERT_EQ(P.rows(), expected.P.rows());
+    ASSERT_EQ(P.cols(), expected.P.cols());
+    ASSERT_EQ(A.rows(), expected.A.rows());
+    ASSERT_EQ(A.cols(), expected.A.cols());
+    for (Eigen::Index i = 0; i < P.rows(); ++i) {
+      for (Eigen::Index j = 0; j < P.cols(); ++j) {
+        EXPECT_DOUBLE_EQ(P(i, j), expected.P(i, j)) << "P(" << i << ", " << j << "), N = " << N;
+      }
+    }
+    for (Eigen::Index i = 0; i < A.rows(); ++i) {
+      for (Eigen::Index j = 0; j < A.cols(); ++j) {
+        EXPECT_DOUBLE_EQ(A(i, j), expected.A(i, j)) << "A(" << i << ", " << j << "), N = " << N;
+      }
+    }
+    ASSERT_EQ(problem.q.size(), expected.q.size());
+    for (size_t i = 0; i < problem.q.size(); ++i) {
+      EXPECT_DOUBLE_EQ(problem.q.at(i), expected.q.at(i)) << "q[" << i << "], N = " << N;
+    }
+    ASSERT_EQ(problem.lower_bound.size(), expected.lower_bound.size());
+    ASSERT_EQ(problem.upper_bound.size(), expected.upper_bound.size());
+    for (size_t i = 0; i < problem.lower_bound.size(); ++i) {
+      EXPECT_DOUBLE_EQ(problem.lower_bound.at(i), expected.lower_bound.at(i))
+        << "lower_bound[" << i << "], N = " << N;
+      EXPECT_DOUBLE_EQ(problem.upper_bound.at(i), expected.upper_bound.at(i))
+        << "upper_bound[" << i << "], N = " << N;
+    }
+  }
+
+  rclcpp::shutdown();
+}
@@ -127,6 +127,8 @@ BehaviorPathPlannerNode::BehaviorPathPlannerNode(const rclcpp::NodeOptions & nod
   logger_configure_ = std::make_unique<autoware::universe_utils::LoggerLevelConfigure>(this);
   published_time_publisher_ =
     std::make_unique<autoware::universe_utils::PublishedTimePublisher>(this);
+  latency_trace_stage_ =
+    std::make_unique<autoware::universe_utils::LatencyTraceStage>(get_fully_qualified_name());
 }
 
 std::vector<std::string> BehaviorPathPlannerNode::getWaitingApprovalModules()
@@ -302,6 +304,9 @@ void BehaviorPathPlannerNode::run()
     return;
   }
 
+  autoware::universe_utils::LatencyTraceScope trace_scope(*latency_trace_stage_);
+  trace_scope.add_input(planner_data_->dynamic_object->header.stamp);
+
   RCLCPP_DEBUG(get_logger(), "----- BehaviorPathPlannerNode start -----");
 
   // behavior_path_planner runs only in LANE DRIVING scenario.
@@ -394,6 +399,7 @@ void BehaviorPathPlannerNode::run()
     if (!path->points.empty()) {
       path_publisher_->publish(*path);
       published_time_publisher_->publish_if_subscribed(path_publisher_, path->header.stamp);
+      trace_scope.set_output(path->header.stamp);
     } else {
       RCLCPP_ERROR_THROTTLE(
         get_logger(), *get_clock(), 5000, "behavior path output is empty! Stop publish.");
@@ -0,0 +1,248 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/occluded_crosswalk.hpp"
+
+#include <autoware/behavior_velocity_occlusion_spot_module/grid_utils.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using autoware::behavior_velocity_planner::CrosswalkModule;
+using autoware::behavior_velocity_planner::is_crosswalk_occluded;
+using autoware::behavior_velocity_planner::LazyVisibilityGrid;
+using autoware::behavior_velocity_planner::Point2d;
+using autoware::behavior_velocity_planner::Polygon2d;
+namespace grid_utils = autoware::behavior_velocity_planner::grid_utils;
+
+namespace
+{
+constexpr double resolution = 0.5;
+constexpr int nb_crosswalks = 3;
+constexpr int nb_iterations = 20;
+// default parameters of the occlusion spot module
+constexpr double min_occlusion_spot_size = 1.0;
+constexpr double slice_length = 10.0;
+constexpr double pedestrian_radius = 0.3;
+constexpr double max_lateral_distance = 5.0;
+// lateral distance from the path to the sides of ego
+constexpr double ego_half_width = 1.0;
+
+// ego centered grid with random blobs of unknown and occupied cells
+nav_msgs::msg::OccupancyGrid::ConstSharedPtr create_occupancy_grid(const int size)
+{
+  auto grid = std::make_shared<nav_msgs::msg::OccupancyGrid>();
+  grid->info.width = size;
+  grid->info.height = size;
+  grid->info.resolution = resolution;
+  grid->info.origin.position.x = -size * resolution / 2.0;
+  grid->info.origin.position.y = -size * resolution / 2.0;
+  grid->info.origin.orientation.w = 1.0;
+  grid->data.assign(size * size, 0);
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<int> cell_dist(0, size - 1);
+  std::uniform_int_distribution<int> value_dist(0, 1);
+  for (int i = 0; i < size; ++i) {
+    const int cx = cell_dist(engine);
+    const int cy = cell_dist(engine);
+    const int8_t value = value_dist(engine) == 0 ? 50 : 100;
+    for (int y = std::max(0, cy - 3); y < std::min(size, cy + 3); ++y) {
+      for (int x = std::max(0, cx - 3); x < std::min(size, cx + 3); ++x) {
+        grid->data[y * size + x] = value;
+      }
+    }
+  }
+  return grid;
+}
+
+lanelet::BasicPolygon2d create_rectangle(
+  const lanelet::BasicPoint2d & center, const double half_length, const double half_width)
+{
+  lanelet::BasicPolygon2d polygon;
+  polygon.push_back(center + lanelet::BasicPoint2d(-half_length, -half_width));
+  polygon.push_back(center + lanelet::BasicPoint2d(half_length, -half_width));
+  polygon.push_back(center + lanelet::BasicPoint2d(half_length, half_width));
+  polygon.push_back(center + lanelet::BasicPoint2d(-half_length, half_width));
+  return polygon;
+}
+
+// a crosswalk around ego with the detection areas extended on both sides of it
+std::vector<std::vector<lanelet::BasicPolygon2d>> create_detection_areas(const int size)
+{
+  std::vector<std::vector<lanelet::BasicPolygon2d>> crosswalks;
+  const double range = size * resolution / 2.0;
+  for (int i = 0; i < nb_crosswalks; ++i) {
+    const double angle = 2.0 * M_PI * i / nb_crosswalks;
+    const lanelet::BasicPoint2d center(
+      0.5 * range * std::cos(angle), 0.5 * range * std::sin(angle));
+    crosswalks.push_back(
+      {create_rectangle(center, 8.0, 2.0),
+       create_rectangle(center + lanelet::BasicPoint2d(0.0, -6.0), 8.0, 4.0),
+       create_rectangle(center + lanelet::BasicPoint2d(0.0, 6.0), 8.0, 4.0)});
+  }
+  return crosswalks;
+}
+
+// detection area slices of the occlusion spot module on both sides of a path along the x axis
+std::vector<Polygon2d> create_detection_area_slices(const int size)
+{
+  std::vector<Polygon2d> slices;
+  const double range = size * resolution / 2.0;
+  for (double x = -range; x + slice_length <= range; x += slice_length) {
+    for (const double side : {1.0, -1.0}) {
+      Polygon2d slice;
+      slice.outer() = {
+        {x, side * ego_half_width},
+        {x + slice_length, side * ego_half_width},
+        {x + slice_length, side * max_lateral_distance},
+        {x, side * max_lateral_distance}};
+      boost::geometry::correct(slice);
+      slices.push_back(slice);
+    }
+  }
+  return slices;
+}
+
+// closest occlusion spot of each slice from which a pedestrian can reach the side of ego, as in
+// generatePossibleCollisionsFromGridMap
+template <class Grid>
+int count_possible_collisions(const Grid & grid, const std::vector<Polygon2d> & slices)
+{
+  int nb_possible_collisions = 0;
+  for (const auto & slice : slices) {
+    std::vector<grid_map::Position> occlusion_spot_positions;
+    grid_utils::findOcclusionSpots(occlusion_spot_positions, grid, slice, min_occlusion_spot_size);
+    const Point2d base_point = slice.outer().at(0);
+    double distance_lower_bound = std::numeric_limits<double>::max();
+    bool has_collision = false;
+    for (const auto & position : occlusion_spot_positions) {
+      const double dist = std::hypot(base_point.x() - position.x(), base_point.y() - position.y());
+      if (distance_lower_bound < dist) continue;
+      const grid_map::Position collision_point(
+        position.x(), std::copysign(ego_half_width, position.y()));
+      if (!grid_utils::isCollisionFree(grid, position, collision_point, pedestrian_radius))
+        continue;
+      distance_lower_bound = dist;
+      has_collision = true;
+    }
+    nb_possible_collisions += has_collision;
+  }
+  return nb_possible_collisions;
+}
+
+CrosswalkModule::PlannerParam create_params(const bool ignore_behind_predicted_objects)
+{
+  CrosswalkModule::PlannerParam params{};
+  params.occlusion_min_size = 1.0;
+  params.occlusion_free_space_max = 43;
+  params.occlusion_occupied_min = 58;
+  params.occlusion_ignore_behind_predicted_objects = ignore_behind_predicted_objects;
+  params.occlusion_ignore_velocity_thresholds.assign(8, 0.5);
+  params.occlusion_extra_objects_size = 0.5;
+  return params;
+}
+
+template <class Run>
+double measure_ms(Run run)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nb_iterations; ++i) {
+    run();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() / nb_iterations;
+}
+}  // namespace
+
+int main()
+{
+  // time of one planning cycle in which every crosswalk module checks its occlusions and the
+  // occlusion spot module searches the occlusion spots, with the occupancy grid converted by each
+  // module or shared by the modules
+  std::printf(
+    "#grid_size  ignore_behind_objects  crosswalk[ms]  crosswalk_shared[ms]  occlusion_spot[ms]  "
+    "occlusion_spot_shared[ms]  combined[ms]  combined_shared[ms]  speedup  nb_occluded  "
+    "nb_collisions  nb_collisions_shared\n");
+  const std::vector<autoware_perception_msgs::msg::PredictedObject> no_objects;
+  const grid_utils::GridParam grid_param{43, 57};
+  for (const int size : {200, 300, 400, 600}) {
+    const auto occupancy_grid = create_occupancy_grid(size);
+    const auto crosswalks = create_detection_areas(size);
+    const auto slices = create_detection_area_slices(size);
+    for (const bool ignore_behind_predicted_objects : {false, true}) {
+      const auto params = create_params(ignore_behind_predicted_objects);
+
+      int nb_occluded = 0;
+      const auto run_crosswalks =
+        [&](const std::shared_ptr<const LazyVisibilityGrid> & visibility_grid) {
+          int nb_occluded_crosswalks = 0;
+          for (const auto & detection_areas : crosswalks) {
+            nb_occluded_crosswalks += is_crosswalk_occluded(
+              *occupancy_grid, visibility_grid, detection_areas, no_objects, params);
+          }
+          return nb_occluded_crosswalks;
+        };
+      int nb_collisions = 0;
+      const auto run_occlusion_spot = [&]() {
+        grid_map::GridMap grid_map;
+        const int num_iter =
+          static_cast<int>((min_occlusion_spot_size / occupancy_grid->info.resolution) - 1);
+        grid_utils::denoiseOccupancyGridCV(
+          occupancy_grid, {}, {}, grid_map, grid_param, false, num_iter, false, false);
+        nb_collisions = count_possible_collisions(grid_map, slices);
+      };
+      int nb_collisions_shared = 0;
+      const auto run_occlusion_spot_shared = [&](const LazyVisibilityGrid & visibility_grid) {
+        const grid_utils::SharedGrid grid{
+          grid_utils::getVisibilityGrid(visibility_grid, grid_param), {}};
+        nb_collisions_shared = count_possible_collisions(grid, slices);
+      };
+
+      const double crosswalk_ms = measure_ms([&]() { nb_occluded = run_crosswalks(nullptr); });
+      const double crosswalk_shared_ms = measure_ms([&]() {
+        if (run_crosswalks(std::make_shared<const LazyVisibilityGrid>(occupancy_grid)) !=
+            nb_occluded) {
+          std::printf("the results with the grid map and the shared grid differ\n");
+          std::exit(1);
+        }
+      });
+      const double occlusion_spot_ms = measure_ms(run_occlusion_spot);
+      const double occlusion_spot_shared_ms =
+        measure_ms([&]() { run_occlusion_spot_shared(LazyVisibilityGrid(occupancy_grid)); });
+      const double combined_ms = measure_ms([&]() {
+        run_crosswalks(nullptr);
+        run_occlusion_spot();
+      });
+      // one shared grid for the cycle, converted once for each pair of thresholds
+      const double combined_shared_ms = measure_ms([&]() {
+        const auto visibility_grid = std::make_shared<const LazyVisibilityGrid>(occupancy_grid);
+        run_crosswalks(visibility_grid);
+        run_occlusion_spot_shared(*visibility_grid);
+      });
+      std::printf(
+        "%10d  %21d  %13.3f  %20.3f  %18.3f  %25.3f  %12.3f  %19.3f  %7.1f  %11d  %13d  %20d\n",
+        size, ignore_behind_predicted_objects, crosswalk_ms, crosswalk_shared_ms,
+        occlusion_spot_ms, occlusion_spot_shared_ms, combined_ms, combined_shared_ms,
+        combined_ms / combined_shared_ms, nb_occluded, nb_collisions, nb_collisions_shared);
+    }
+  }
+  return 0;
+}
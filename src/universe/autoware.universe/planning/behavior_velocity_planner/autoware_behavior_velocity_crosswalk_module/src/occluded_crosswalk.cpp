@@ -136,12 +136,39 @@ void clear_occlusions_behind_objects(
   }
 }
 
+bool is_crosswalk_occluded(
+  const VisibilityGrid & visibility_grid,
+  const std::vector<lanelet::BasicPolygon2d> & detection_areas,
+  const autoware::behavior_velocity_planner::CrosswalkModule::PlannerParam & params)
+{
+  const int min_nb_of_cells = std::ceil(params.occlusion_min_size / visibility_grid.resolution());
+  // the indices of the grid map are reversed from the ones of the occupancy grid, so the square
+  // checked by is_occluded extends toward the lower indices of the occupancy grid
+  const auto is_occluded_index = [&](const VisibilityGrid::Index & index) {
+    return visibility_grid.isAllUnknown(
+      {index.x - min_nb_of_cells + 1, index.y - min_nb_of_cells + 1}, index);
+  };
+  for (const auto & detection_area : detection_areas)
+    if (visibility_grid.anyOfCellsInPolygon(detection_area, is_occluded_index)) return true;
+  return false;
+}
+
 bool is_crosswalk_occluded(
   const nav_msgs::msg::OccupancyGrid & occupancy_grid,
+  const std::shared_ptr<const LazyVisibilityGrid> & visibility_grid,
   const std::vector<lanelet::BasicPolygon2d> & detection_areas,
   const std::vector<autoware_perception_msgs::msg::PredictedObject> & dynamic_objects,
   const autoware::behavior_velocity_planner::CrosswalkModule::PlannerParam & params)
 {
+  // clearing the occlusions behind the objects only removes occlusions, so the grid map is only
+  // needed when the shared grid finds an occlusion that may be behind an object
+  if (visibility_grid) {
+    const auto is_occluded = is_crosswalk_occluded(
+      visibility_grid->get(params.occlusion_free_space_max, params.occlusion_occupied_min),
+      detection_areas, params);
+    if (!is_occluded || !params.occlusion_ignore_behind_predicted_objects) return is_occluded;
+  }
+
   grid_map::GridMap grid_map;
   grid_map::GridMapRosConverter::fromOccupancyGrid(occupancy_grid, "layer", grid_map);
 
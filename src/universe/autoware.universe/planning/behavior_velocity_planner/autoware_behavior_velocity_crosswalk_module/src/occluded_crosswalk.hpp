@@ -17,6 +17,7 @@
 
 #include "scene_crosswalk.hpp"
 
+#include <autoware/behavior_velocity_planner_common/utilization/visibility_grid.hpp>
 #include <grid_map_core/GridMap.hpp>
 #include <rclcpp/time.hpp>
 
@@ -26,6 +27,7 @@
 #include <lanelet2_core/primitives/Lanelet.h>
 #include <lanelet2_core/primitives/Point.h>
 
+#include <memory>
 #include <vector>
 
 namespace autoware::behavior_velocity_planner
@@ -48,14 +50,26 @@ bool is_occluded(
 lanelet::BasicPoint2d interpolate_point(
   const lanelet::BasicSegment2d & segment, const double extra_distance);
 
+/// @brief check if the crosswalk is occluded in the visibility grid shared by the modules
+/// @param visibility_grid visibility grid with the same thresholds as the parameters
+/// @param detection_areas areas to check for occlusions
+/// @param params parameters
+/// @return true if the crosswalk is occluded, without ignoring the occlusions behind objects
+bool is_crosswalk_occluded(
+  const VisibilityGrid & visibility_grid,
+  const std::vector<lanelet::BasicPolygon2d> & detection_areas,
+  const autoware::behavior_velocity_planner::CrosswalkModule::PlannerParam & params);
+
 /// @brief check if the crosswalk is occluded
 /// @param occupancy_grid occupancy grid with the occlusion information
+/// @param visibility_grid visibility grid shared by the modules, nullptr to only use the grid map
 /// @param detection_areas areas to check for occlusions
 /// @param dynamic_objects dynamic objects
 /// @param params parameters
 /// @return true if the crosswalk is occluded
 bool is_crosswalk_occluded(
   const nav_msgs::msg::OccupancyGrid & occupancy_grid,
+  const std::shared_ptr<const LazyVisibilityGrid> & visibility_grid,
   const std::vector<lanelet::BasicPolygon2d> & detection_areas,
   const std::vector<autoware_perception_msgs::msg::PredictedObject> & dynamic_objects,
   const autoware::behavior_velocity_planner::CrosswalkModule::PlannerParam & params);
@@ -955,7 +955,8 @@ void CrosswalkModule::applySlowDownByOcclusion(
   debug_data_.occlusion_detection_areas = detection_areas;
   debug_data_.crosswalk_origin = first_path_point_on_crosswalk;
   if (is_crosswalk_occluded(
-        *planner_data_->occupancy_grid, detection_areas, objects_ptr->objects, planner_param_)) {
+        *planner_data_->occupancy_grid, planner_data_->visibility_grid, detection_areas,
+        objects_ptr->objects, planner_param_)) {
     if (!current_initial_occlusion_time_) {
       current_initial_occlusion_time_ = now;
     }
@@ -25,8 +25,10 @@
 #include <autoware/behavior_velocity_planner_common/scene_module_interface.hpp>
 #include <autoware/behavior_velocity_planner_common/utilization/state_machine.hpp>
 #include <autoware/motion_utils/marker/virtual_wall_marker_creator.hpp>
+#include <opencv2/core/mat.hpp>
 #include <rclcpp/rclcpp.hpp>
 
+#include <nav_msgs/msg/occupancy_grid.hpp>
 #include <tier4_debug_msgs/msg/float64_multi_array_stamped.hpp>
 #include <tier4_planning_msgs/msg/path_with_lane_id.hpp>
 
@@ -381,6 +383,20 @@ private:
   std::optional<std::vector<lanelet::ConstLineString3d>> occlusion_attention_divisions_{
     std::nullopt};
 
+  //! occlusion attention area excluding the adjacent lanes rasterized on the lattice of the
+  //! occupancy grid, in which the row 0 is the top
+  struct OcclusionAttentionMask
+  {
+    cv::Mat mask;
+    double origin_x{0.0};
+    double origin_y{0.0};
+    double resolution{0.0};
+  };
+
+  //! cache the rasterized occlusion attention area, which is rebuilt only if the lattice of the
+  //! occupancy grid changes
+  mutable std::optional<OcclusionAttentionMask> occlusion_attention_mask_{std::nullopt};
+
   //! save the time when ego observed green traffic light before entering the intersection
   std::optional<rclcpp::Time> initial_green_light_observed_time_{std::nullopt};
   /** @}*/
@@ -702,6 +718,13 @@ private:
    * intersection_lanelets.first_attention_area(), occlusion_attention_divisions_
    */
   OcclusionType detectOcclusion(const InterpolatedPathInfo & interpolated_path_info) const;
+
+  /**
+   * @brief get the mask of occlusion_attention_area excluding adjacent lanes in the frame of
+   * the occupancy grid, which is cropped from occlusion_attention_mask_
+   * @attention this function has access to value() of intersection_lanelets_
+   */
+  cv::Mat getOcclusionAttentionMask(const nav_msgs::msg::OccupancyGrid & occ_grid) const;
   /** @} */
 
 private:
@@ -23,7 +23,11 @@
 
 #include <lanelet2_core/geometry/Polygon.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <tuple>
+#include <vector>
 
 namespace autoware::behavior_velocity_planner
 {
@@ -98,12 +102,102 @@ IntersectionModule::getOcclusionStatus(
   return {occlusion_status, is_occlusion_cleared_with_margin, is_occlusion_state};
 }
 
+cv::Mat IntersectionModule::getOcclusionAttentionMask(
+  const nav_msgs::msg::OccupancyGrid & occ_grid) const
+{
+  const int width = occ_grid.info.width;
+  const int height = occ_grid.info.height;
+  const double resolution = occ_grid.info.resolution;
+  const auto & origin = occ_grid.info.origin.position;
+
+  // the occupancy grid moves by whole cells, so the cache is valid while it is on the same lattice
+  const auto is_on_lattice = [&](const OcclusionAttentionMask & cache) {
+    if (std::abs(cache.resolution - resolution) > 1e-6 * resolution) {
+      return false;
+    }
+    const double offset_x = (origin.x - cache.origin_x) / resolution;
+    const double offset_y = (origin.y - cache.origin_y) / resolution;
+    return std::abs(offset_x - std::round(offset_x)) < 1e-3 &&
+           std::abs(offset_y - std::round(offset_y)) < 1e-3;
+  };
+  if (!occlusion_attention_mask_ || !is_on_lattice(occlusion_attention_mask_.value())) {
+    const auto & intersection_lanelets = intersection_lanelets_.value();
+    std::vector<lanelet::BasicPolygon2d> attention_areas;
+    for (const auto & attention_area : intersection_lanelets.occlusion_attention_area()) {
+      attention_areas.push_back(lanelet::utils::to2D(attention_area).basicPolygon());
+    }
+    double min_x = std::numeric_limits<double>::infinity();
+    double min_y = std::numeric_limits<double>::infinity();
+    double max_x = -std::numeric_limits<double>::infinity();
+    double max_y = -std::numeric_limits<double>::infinity();
+    for (const auto & area2d : attention_areas) {
+      for (const auto & p : area2d) {
+        min_x = std::min(min_x, p.x());
+        min_y = std::min(min_y, p.y());
+        max_x = std::max(max_x, p.x());
+        max_y = std::max(max_y, p.y());
+      }
+    }
+
+    OcclusionAttentionMask cache;
+    cache.resolution = resolution;
+    if (min_x <= max_x && min_y <= max_y) {
+      // margin for the anti-aliased edges
+      constexpr int margin = 2;
+      cache.origin_x =
+        origin.x + (std::floor((min_x - origin.x) / resolution) - margin) * resolution;
+      cache.origin_y =
+        origin.y + (std::floor((min_y - origin.y) / resolution) - margin) * resolution;
+      const int cache_width = static_cast<int>((max_x - cache.origin_x) / resolution) + 1 + margin;
+      const int cache_height = static_cast<int>((max_y - cache.origin_y) / resolution) + 1 + margin;
+      cache.mask = cv::Mat(cache_height, cache_width, CV_8UC1, cv::Scalar(0));
+      const auto toCvPolygon = [&](const auto & area2d) {
+        std::vector<cv::Point> cv_polygon;
+        for (const auto & p : area2d) {
+          const int idx_x = static_cast<int>(std::floor((p.x() - cache.origin_x) / resolution));
+          const int idx_y = static_cast<int>(std::floor((p.y() - cache.origin_y) / resolution));
+          cv_polygon.emplace_back(idx_x, cache_height - 1 - idx_y);
+        }
+        return cv_polygon;
+      };
+      for (const auto & area2d : attention_areas) {
+        cv::fillPoly(cache.mask, toCvPolygon(area2d), cv::Scalar(255), cv::LINE_AA);
+      }
+      // reset adjacent_lanelets area to 0
+      for (const auto & adjacent_lanelet : intersection_lanelets.adjacent()) {
+        cv::fillPoly(
+          cache.mask, toCvPolygon(adjacent_lanelet.polygon2d().basicPolygon()), cv::Scalar(0),
+          cv::LINE_AA);
+      }
+    } else {
+      cache.origin_x = origin.x;
+      cache.origin_y = origin.y;
+    }
+    occlusion_attention_mask_ = cache;
+  }
+
+  // copy the overlapping part of the cache into the grid frame
+  const auto & cache = occlusion_attention_mask_.value();
+  cv::Mat attention_mask(height, width, CV_8UC1, cv::Scalar(0));
+  if (cache.mask.empty()) {
+    return attention_mask;
+  }
+  const int offset_x = static_cast<int>(std::round((cache.origin_x - origin.x) / resolution));
+  const int offset_y = static_cast<int>(std::round((cache.origin_y - origin.y) / resolution));
+  const cv::Rect cache_rect_in_grid(
+    offset_x, height - offset_y - cache.mask.rows, cache.mask.cols, cache.mask.rows);
+  const cv::Rect common_rect = cache_rect_in_grid & cv::Rect(0, 0, width, height);
+  if (common_rect.empty()) {
+    return attention_mask;
+  }
+  cache.mask(common_rect - cache_rect_in_grid.tl()).copyTo(attention_mask(common_rect));
+  return attention_mask;
+}
+
 IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   const InterpolatedPathInfo & interpolated_path_info) const
 {
   const auto & intersection_lanelets = intersection_lanelets_.value();
-  const auto & adjacent_lanelets = intersection_lanelets.adjacent();
-  const auto & attention_areas = intersection_lanelets.occlusion_attention_area();
   const auto first_attention_area = intersection_lanelets.first_attention_area().value();
   const auto & lane_divisions = occlusion_attention_divisions_.value();
 
@@ -181,43 +275,25 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   // attention: 255
   // non-attention: 0
   // NOTE: interesting area is set to 255 for later masking
-  cv::Mat attention_mask(width, height, CV_8UC1, cv::Scalar(0));
-  std::vector<std::vector<cv::Point>> attention_area_cv_polygons;
-  for (const auto & attention_area : attention_areas) {
-    const auto area2d = lanelet::utils::to2D(attention_area);
-    findCommonCvPolygons(area2d, attention_area_cv_polygons);
-  }
-  for (const auto & poly : attention_area_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(255), cv::LINE_AA);
-  }
-  // (1.1)
-  // reset adjacent_lanelets area to 0 on attention_mask
-  std::vector<std::vector<cv::Point>> adjacent_lane_cv_polygons;
-  for (const auto & adjacent_lanelet : adjacent_lanelets) {
-    const auto area2d = adjacent_lanelet.polygon2d().basicPolygon();
-    findCommonCvPolygons(area2d, adjacent_lane_cv_polygons);
-  }
-  for (const auto & poly : adjacent_lane_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(0), cv::LINE_AA);
+  // NOTE: the lanelets are static, so they are rasterized once and only cropped for each grid
+  if (occ_grid.data.size() != static_cast<size_t>(width) * static_cast<size_t>(height)) {
+    return NotOccluded{};
   }
+  cv::Mat attention_mask = getOcclusionAttentionMask(occ_grid);
 
   // (2) prepare unknown mask
   // In OpenCV the pixel at (X=x, Y=y) (with left-upper origin) is accessed by img[y, x]
   // unknown: 255
   // not-unknown: 0
-  cv::Mat unknown_mask_raw(width, height, CV_8UC1, cv::Scalar(0));
-  cv::Mat unknown_mask(width, height, CV_8UC1, cv::Scalar(0));
-  for (int x = 0; x < width; x++) {
-    for (int y = 0; y < height; y++) {
-      const int idx = y * width + x;
-      const unsigned char intensity = occ_grid.data.at(idx);
-      if (
-        planner_param_.occlusion.free_space_max <= intensity &&
-        intensity < planner_param_.occlusion.occupied_min) {
-        unknown_mask_raw.at<unsigned char>(height - 1 - y, x) = 255;
-      }
-    }
-  }
+  // NOTE: the cells of occupancy grid are read as unsigned char and flipped upside down
+  const cv::Mat occ_grid_mat(
+    height, width, CV_8UC1, const_cast<int8_t *>(occ_grid.data.data()));  // NOLINT
+  cv::Mat unknown_mask_raw;
+  cv::inRange(
+    occ_grid_mat, cv::Scalar(planner_param_.occlusion.free_space_max),
+    cv::Scalar(planner_param_.occlusion.occupied_min - 1), unknown_mask_raw);
+  cv::flip(unknown_mask_raw, unknown_mask_raw, 0);
+  cv::Mat unknown_mask(height, width, CV_8UC1, cv::Scalar(0));
   // (2.1) apply morphologyEx
   const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
   cv::morphologyEx(
@@ -227,10 +303,10 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   // (3) occlusion mask
   static constexpr unsigned char OCCLUDED = 255;
   static constexpr unsigned char BLOCKED = 127;
-  cv::Mat occlusion_mask(width, height, CV_8UC1, cv::Scalar(0));
+  cv::Mat occlusion_mask(height, width, CV_8UC1, cv::Scalar(0));
   cv::bitwise_and(attention_mask, unknown_mask, occlusion_mask);
   // re-use attention_mask
-  attention_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
+  attention_mask = cv::Mat(height, width, CV_8UC1, cv::Scalar(0));
   // (3.1) draw all cells on attention_mask behind blocking vehicles as not occluded
   const auto & blocking_attention_objects = object_info_manager_.parkedObjects();
   for (const auto & blocking_attention_object_info : blocking_attention_objects) {
@@ -304,7 +380,7 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     debug_data_.occlusion_polygons.push_back(polygon_msg);
   }
   // (4.1) re-draw occluded cells using valid_contours
-  occlusion_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
+  occlusion_mask = cv::Mat(height, width, CV_8UC1, cv::Scalar(0));
   for (const auto & valid_contour : valid_contours) {
     // NOTE: drawContour does not work well
     cv::fillPoly(occlusion_mask, valid_contour, cv::Scalar(OCCLUDED), cv::LINE_AA);
@@ -12,11 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#ifndef GRID_UTILS_HPP_
-#define GRID_UTILS_HPP_
+#ifndef AUTOWARE__BEHAVIOR_VELOCITY_OCCLUSION_SPOT_MODULE__GRID_UTILS_HPP_
+#define AUTOWARE__BEHAVIOR_VELOCITY_OCCLUSION_SPOT_MODULE__GRID_UTILS_HPP_
 
 #include <autoware/behavior_velocity_planner_common/utilization/boost_geometry_helper.hpp>
 #include <autoware/behavior_velocity_planner_common/utilization/util.hpp>
+#include <autoware/behavior_velocity_planner_common/utilization/visibility_grid.hpp>
 #include <autoware/universe_utils/geometry/geometry.hpp>
 #include <autoware/universe_utils/math/normalization.hpp>
 #include <autoware_grid_map_utils/polygon_iterator.hpp>
@@ -95,6 +96,22 @@ struct GridParam
   int occupied_min;    // minimum value of an occupied cell in the occupancy grid
 };
 
+//!< @brief visibility grid shared by the modules and polygons of the objects occupying it
+struct SharedGrid
+{
+  const VisibilityGrid & visibility_grid;
+  Polygons2d object_polygons;
+};
+
+//!< @brief get the shared grid with the same cell states as the quantized image
+//!< @details the values in ]free_space_max, occupied_min[ are unknown, and -1 (which the
+//!< probabilistic occupancy grid does not publish) is unknown instead of occupied
+inline const VisibilityGrid & getVisibilityGrid(
+  const LazyVisibilityGrid & visibility_grid, const GridParam & param)
+{
+  return visibility_grid.get(param.free_space_max + 1, param.occupied_min - 1);
+}
+
 //!< @brief Find all occlusion spots inside the given lanelet
 void findOcclusionSpots(
   std::vector<grid_map::Position> & occlusion_spot_positions, const grid_map::GridMap & grid,
@@ -103,6 +120,21 @@ void findOcclusionSpots(
 bool isCollisionFree(
   const grid_map::GridMap & grid, const grid_map::Position & p1, const grid_map::Position & p2,
   const double radius);
+//!< @brief Find all occlusion spots of at least min_size inside the given lanelet
+void findOcclusionSpots(
+  std::vector<grid_map::Position> & occlusion_spot_positions, const SharedGrid & grid,
+  const Polygon2d & polygon, const double min_size);
+//!< @brief Return true if no object nor occupied cell is within the radius of the path between
+//!< the two given points
+bool isCollisionFree(
+  const SharedGrid & grid, const grid_map::Position & p1, const grid_map::Position & p2,
+  const double radius);
+//!< @brief generate the polygons of the stuck vehicles and of the areas hidden by the moving
+//!< vehicles
+Polygons2d generateObjectPolygons(
+  const MapMetaData & info, const Polygons2d & stuck_vehicle_foot_prints,
+  const Polygons2d & moving_vehicle_foot_prints, const bool use_object_foot_print,
+  const bool use_object_raycast);
 std::optional<Polygon2d> generateOccupiedPolygon(
   const Polygon2d & occupancy_poly, const Polygons2d & stuck_vehicle_foot_prints,
   const Polygons2d & moving_vehicle_foot_prints, const Point & position);
@@ -124,4 +156,4 @@ void denoiseOccupancyGridCV(
 }  // namespace grid_utils
 }  // namespace autoware::behavior_velocity_planner
 
-#endif  // GRID_UTILS_HPP_
+#endif  // AUTOWARE__BEHAVIOR_VELOCITY_OCCLUSION_SPOT_MODULE__GRID_UTILS_HPP_
@@ -12,9 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "grid_utils.hpp"
+#include "autoware/behavior_velocity_occlusion_spot_module/grid_utils.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <stdexcept>
 #include <utility>
@@ -91,6 +92,55 @@ bool isCollisionFree(
   return true;
 }
 
+void findOcclusionSpots(
+  std::vector<grid_map::Position> & occlusion_spot_positions, const SharedGrid & grid,
+  const Polygon2d & polygon, const double min_size)
+{
+  const VisibilityGrid & visibility_grid = grid.visibility_grid;
+  // same filter as the erosion of denoiseOccupancyGridCV: the square of num_iter cells after the
+  // occlusion spot must be unknown too
+  const int num_iter = std::max(0, static_cast<int>((min_size / visibility_grid.resolution()) - 1));
+  visibility_grid.anyOfCellsInPolygon(polygon.outer(), [&](const VisibilityGrid::Index & index) {
+    if (!visibility_grid.isAllUnknown(index, {index.x + num_iter, index.y + num_iter})) {
+      return false;
+    }
+    const auto position = visibility_grid.toPosition(index);
+    const Point2d point(position.x, position.y);
+    for (const auto & object_polygon : grid.object_polygons) {
+      if (boost::geometry::within(point, object_polygon)) {
+        return false;
+      }
+    }
+    occlusion_spot_positions.emplace_back(position.x, position.y);
+    return false;
+  });
+}
+
+bool isCollisionFree(
+  const SharedGrid & grid, const grid_map::Position & p1, const grid_map::Position & p2,
+  const double radius)
+{
+  const Polygon2d polygon = pointsToPoly({p1.x(), p1.y()}, {p2.x(), p2.y()}, radius);
+  for (const auto & object_polygon : grid.object_polygons) {
+    if (boost::geometry::intersects(polygon, object_polygon)) {
+      return false;
+    }
+  }
+  // the cells along the path between the two points must be farther than the radius from the
+  // occupied cells
+  const VisibilityGrid & visibility_grid = grid.visibility_grid;
+  const int nb_steps = static_cast<int>(std::ceil((p2 - p1).norm() / visibility_grid.resolution()));
+  for (int i = 0; i <= nb_steps; ++i) {
+    const double ratio = nb_steps == 0 ? 0.0 : static_cast<double>(i) / nb_steps;
+    const grid_map::Position p = p1 + ratio * (p2 - p1);
+    const auto index = visibility_grid.toIndex(p.x(), p.y());
+    if (index && visibility_grid.distanceToOccupied(*index) <= radius) {
+      return false;
+    }
+  }
+  return true;
+}
+
 std::optional<Polygon2d> generateOcclusionPolygon(
   const Polygon2d & occupancy_poly, const Point2d & origin, const Point2d & min_theta_pos,
   const Point2d & max_theta_pos, const double ray_max_length = 100.0)
@@ -190,19 +240,45 @@ Point transformFromMap2Grid(const TransformStamped & geom_tf_map2grid, const Poi
   return transformed_geom_pt;
 }
 
+Polygons2d generateObjectPolygons(
+  const MapMetaData & info, const Polygons2d & stuck_vehicle_foot_prints,
+  const Polygons2d & moving_vehicle_foot_prints, const bool use_object_foot_print,
+  const bool use_object_raycast)
+{
+  Polygons2d object_polygons;
+  if (use_object_raycast) {
+    // the moving vehicles hide the area behind them from the center of the grid
+    MapMetaData grid_info = info;
+    grid_info.origin = Pose();
+    grid_info.origin.position.x = info.origin.position.x;
+    grid_info.origin.position.y = info.origin.position.y;
+    const Polygon2d occupancy_poly = generateOccupancyPolygon(grid_info);
+    Point scan_origin = grid_info.origin.position;
+    scan_origin.x += 0.5 * info.width * info.resolution;
+    scan_origin.y += 0.5 * info.height * info.resolution;
+    for (const auto & foot_print : moving_vehicle_foot_prints) {
+      // calculate occlusion polygon from moving vehicle
+      const auto polys = generateOccupiedPolygon(occupancy_poly, foot_print, scan_origin);
+      if (polys == std::nullopt) continue;
+      object_polygons.push_back(polys.value());
+    }
+  }
+  if (use_object_foot_print) {
+    object_polygons.insert(
+      object_polygons.end(), stuck_vehicle_foot_prints.begin(), stuck_vehicle_foot_prints.end());
+  }
+  return object_polygons;
+}
+
 void generateOccupiedImage(
   const OccupancyGrid & occ_grid, cv::Mat & inout_image,
   const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
   const bool use_object_foot_print, const bool use_object_raycast)
 {
   const auto & occ = occ_grid;
-  OccupancyGrid occupancy_grid;
   PoseStamped grid_origin;
   const double width = occ.info.width * occ.info.resolution;
   const double height = occ.info.height * occ.info.resolution;
-  Point scan_origin = occ.info.origin.position;
-  scan_origin.x += 0.5 * width;
-  scan_origin.y += 0.5 * height;
 
   // calculate grid origin
   {
@@ -212,21 +288,6 @@ void generateOccupiedImage(
     grid_origin.pose.position.z = 0.0;  // same z as foot print polygon
   }
 
-  // header
-  {
-    occupancy_grid.header.stamp = occ.header.stamp;
-    occupancy_grid.header.frame_id = "map";
-  }
-
-  // info
-  {
-    occupancy_grid.info.map_load_time = occ.header.stamp;
-    occupancy_grid.info.resolution = occ.info.resolution;
-    occupancy_grid.info.width = occ.info.width;
-    occupancy_grid.info.height = occ.info.height;
-    occupancy_grid.info.origin = grid_origin.pose;
-  }
-
   constexpr uint8_t occupied_space = occlusion_cost_value::OCCUPIED_IMAGE;
   // get transform
   tf2::Stamped<tf2::Transform> tf_grid2map;
@@ -236,40 +297,20 @@ void generateOccupiedImage(
   const auto geom_tf_map2grid = tf2::toMsg(tf_map2grid);
 
   // create not Detection Area using opencv
-  std::vector<std::vector<cv::Point>> cv_polygons;
   std::vector<cv::Point> cv_polygon;
-  Polygon2d occupancy_poly = generateOccupancyPolygon(occupancy_grid.info);
-  if (use_object_raycast) {
-    for (const auto & foot_print : moving_vehicle_foot_prints) {
-      // calculate occlusion polygon from moving vehicle
-      const auto polys = generateOccupiedPolygon(occupancy_poly, foot_print, scan_origin);
-      if (polys == std::nullopt) continue;
-      // transform to cv point and stuck it to cv polygon
-      for (const auto & p : polys.value().outer()) {
-        const Point transformed_geom_pt = transformFromMap2Grid(geom_tf_map2grid, p);
-        cv_polygon.emplace_back(
-          toCVPoint(transformed_geom_pt, width, height, occupancy_grid.info.resolution));
-      }
-      cv_polygons.push_back(cv_polygon);
-      // clear previously added points
-      cv_polygon.clear();
-    }
-  }
-  if (use_object_foot_print) {
-    for (const auto & foot_print : stuck_vehicle_foot_prints) {
-      for (const auto & p : foot_print.outer()) {
-        const Point transformed_geom_pt = transformFromMap2Grid(geom_tf_map2grid, p);
-        cv_polygon.emplace_back(
-          toCVPoint(transformed_geom_pt, width, height, occupancy_grid.info.resolution));
-      }
-      cv_polygons.push_back(cv_polygon);
-      // clear previously added points
-      cv_polygon.clear();
+  const Polygons2d object_polygons = generateObjectPolygons(
+    occ.info, stuck_vehicle_foot_prints, moving_vehicle_foot_prints, use_object_foot_print,
+    use_object_raycast);
+  for (const auto & polygon : object_polygons) {
+    // transform to cv point and stuck it to cv polygon
+    for (const auto & p : polygon.outer()) {
+      const Point transformed_geom_pt = transformFromMap2Grid(geom_tf_map2grid, p);
+      cv_polygon.emplace_back(toCVPoint(transformed_geom_pt, width, height, occ.info.resolution));
     }
-  }
-  for (const auto & p : cv_polygons) {
     // fill in occlusion area and copy to occupancy grid
-    cv::fillConvexPoly(inout_image, p, cv::Scalar(occupied_space));
+    cv::fillConvexPoly(inout_image, cv_polygon, cv::Scalar(occupied_space));
+    // clear previously added points
+    cv_polygon.clear();
   }
 }
 
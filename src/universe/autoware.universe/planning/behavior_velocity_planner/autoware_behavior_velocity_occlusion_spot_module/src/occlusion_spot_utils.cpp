@@ -385,8 +385,9 @@ std::vector<PredictedObject> filterVehiclesByDetectionArea(
   return filtered_obj;
 }
 
+template <class Grid>
 bool generatePossibleCollisionsFromGridMap(
-  std::vector<PossibleCollisionInfo> & possible_collisions, const grid_map::GridMap & grid,
+  std::vector<PossibleCollisionInfo> & possible_collisions, const Grid & grid,
   const PathWithLaneId & path, const double offset_from_start_to_ego, const PlannerParam & param,
   DebugData & debug_data)
 {
@@ -431,8 +432,9 @@ bool isBlockedByPartition(const LineString2d & direction, const BasicPolygons2d
   return false;
 }
 
+template <class Grid>
 std::optional<PossibleCollisionInfo> generateOneNotableCollisionFromOcclusionSpot(
-  const grid_map::GridMap & grid, const std::vector<grid_map::Position> & occlusion_spot_positions,
+  const Grid & grid, const std::vector<grid_map::Position> & occlusion_spot_positions,
   const double offset_from_start_to_ego, const Point2d base_point,
   const lanelet::ConstLanelet & path_lanelet, const PlannerParam & param,
   const DebugData & debug_data)
@@ -485,5 +487,26 @@ std::optional<PossibleCollisionInfo> generateOneNotableCollisionFromOcclusionSpo
   return std::nullopt;
 }
 
+template std::optional<PossibleCollisionInfo>
+generateOneNotableCollisionFromOcclusionSpot<grid_map::GridMap>(
+  const grid_map::GridMap & grid, const std::vector<grid_map::Position> & occlusion_spot_positions,
+  const double offset_from_start_to_ego, const Point2d base_point,
+  const lanelet::ConstLanelet & path_lanelet, const PlannerParam & param,
+  const DebugData & debug_data);
+template std::optional<PossibleCollisionInfo>
+generateOneNotableCollisionFromOcclusionSpot<grid_utils::SharedGrid>(
+  const grid_utils::SharedGrid & grid,
+  const std::vector<grid_map::Position> & occlusion_spot_positions,
+  const double offset_from_start_to_ego, const Point2d base_point,
+  const lanelet::ConstLanelet & path_lanelet, const PlannerParam & param,
+  const DebugData & debug_data);
+template bool generatePossibleCollisionsFromGridMap<grid_map::GridMap>(
+  std::vector<PossibleCollisionInfo> & possible_collisions, const grid_map::GridMap & grid,
+  const PathWithLaneId & path, const double offset_from_start_to_ego, const PlannerParam & param,
+  DebugData & debug_data);
+template bool generatePossibleCollisionsFromGridMap<grid_utils::SharedGrid>(
+  std::vector<PossibleCollisionInfo> & possible_collisions, const grid_utils::SharedGrid & grid,
+  const PathWithLaneId & path, const double offset_from_start_to_ego, const PlannerParam & param,
+  DebugData & debug_data);
 }  // namespace occlusion_spot_utils
 }  // namespace autoware::behavior_velocity_planner
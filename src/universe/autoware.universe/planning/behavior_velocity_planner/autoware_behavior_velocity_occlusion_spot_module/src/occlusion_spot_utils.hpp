@@ -15,7 +15,7 @@
 #ifndef OCCLUSION_SPOT_UTILS_HPP_
 #define OCCLUSION_SPOT_UTILS_HPP_
 
-#include "grid_utils.hpp"
+#include "autoware/behavior_velocity_occlusion_spot_module/grid_utils.hpp"
 
 #include <autoware/behavior_velocity_planner_common/utilization/util.hpp>
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
@@ -241,14 +241,18 @@ void calcSlowDownPointsForPossibleCollision(
   const int closest_idx, const PathWithLaneId & path, const double offset,
   std::vector<PossibleCollisionInfo> & possible_collisions);
 //!< @brief convert a set of occlusion spots found on detection_area slice
+//!< @details Grid is either the denoised grid_map::GridMap or the grid_utils::SharedGrid
+template <class Grid>
 std::optional<PossibleCollisionInfo> generateOneNotableCollisionFromOcclusionSpot(
-  const grid_map::GridMap & grid, const std::vector<grid_map::Position> & occlusion_spot_positions,
+  const Grid & grid, const std::vector<grid_map::Position> & occlusion_spot_positions,
   const double offset_from_start_to_ego, const Point2d base_point,
   const lanelet::ConstLanelet & path_lanelet, const PlannerParam & param,
   const DebugData & debug_data);
 //!< @brief generate possible collisions coming from occlusion spots on the side of the path
+//!< @details Grid is either the denoised grid_map::GridMap or the grid_utils::SharedGrid
+template <class Grid>
 bool generatePossibleCollisionsFromGridMap(
-  std::vector<PossibleCollisionInfo> & possible_collisions, const grid_map::GridMap & grid,
+  std::vector<PossibleCollisionInfo> & possible_collisions, const Grid & grid,
   const PathWithLaneId & path, const double offset_from_start_to_ego, const PlannerParam & param,
   DebugData & debug_data);
 
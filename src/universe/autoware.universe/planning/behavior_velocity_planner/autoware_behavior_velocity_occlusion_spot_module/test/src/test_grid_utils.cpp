@@ -12,7 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "grid_utils.hpp"
+#include "autoware/behavior_velocity_occlusion_spot_module/grid_utils.hpp"
 #include "utils.hpp"
 
 #include <autoware/behavior_velocity_planner_common/utilization/boost_geometry_helper.hpp>
@@ -20,8 +20,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
+#include <memory>
+#include <random>
 #include <unordered_set>
+#include <vector>
 
 struct indexHash
 {
@@ -38,9 +42,13 @@ struct indexEq
   }
 };
 
+using autoware::behavior_velocity_planner::LazyVisibilityGrid;
 using autoware::behavior_velocity_planner::LineString2d;
 using autoware::behavior_velocity_planner::Point2d;
 using autoware::behavior_velocity_planner::Polygon2d;
+using autoware::behavior_velocity_planner::Polygons2d;
+using autoware::behavior_velocity_planner::grid_utils::GridParam;
+using autoware::behavior_velocity_planner::grid_utils::SharedGrid;
 using autoware::behavior_velocity_planner::grid_utils::occlusion_cost_value::OCCUPIED;
 using autoware::behavior_velocity_planner::grid_utils::occlusion_cost_value::UNKNOWN;
 namespace bg = boost::geometry;
@@ -178,3 +186,136 @@ TEST(test, erode_with_custom_kernel)
   // cv::imshow("erode", cv_image);
   // cv::waitKey(5000);
 }
+
+namespace
+{
+nav_msgs::msg::OccupancyGrid::ConstSharedPtr generateOccupancyGrid(
+  const int width, const int height, const int8_t value)
+{
+  auto grid = std::make_shared<nav_msgs::msg::OccupancyGrid>();
+  grid->info.width = width;
+  grid->info.height = height;
+  grid->info.resolution = 0.5;
+  grid->info.origin.position.x = -10.0;
+  grid->info.origin.position.y = -5.0;
+  grid->info.origin.orientation.w = 1.0;
+  grid->data.assign(width * height, value);
+  return grid;
+}
+
+Polygon2d generatePolygon(const std::vector<Point2d> & points)
+{
+  Polygon2d polygon;
+  polygon.outer().assign(points.begin(), points.end());
+  bg::correct(polygon);
+  return polygon;
+}
+
+void sortPositions(std::vector<grid_map::Position> & positions)
+{
+  std::sort(positions.begin(), positions.end(), [](const auto & p1, const auto & p2) {
+    return p1.x() < p2.x() || (p1.x() == p2.x() && p1.y() < p2.y());
+  });
+}
+}  // namespace
+
+TEST(findOcclusionSpots, shared_grid_matches_denoised_grid)
+{
+  // random blobs of unknown and occupied cells
+  auto occupancy_grid =
+    std::make_shared<nav_msgs::msg::OccupancyGrid>(*generateOccupancyGrid(60, 40, 0));
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<int> x_dist(0, 59);
+  std::uniform_int_distribution<int> y_dist(0, 39);
+  std::uniform_int_distribution<int> size_dist(1, 4);
+  for (int i = 0; i < 40; ++i) {
+    const int cx = x_dist(engine);
+    const int cy = y_dist(engine);
+    const int size = size_dist(engine);
+    const int8_t value = i % 3 == 0 ? 100 : 50;
+    for (int y = std::max(0, cy - size); y < std::min(40, cy + size); ++y) {
+      for (int x = std::max(0, cx - size); x < std::min(60, cx + size); ++x) {
+        occupancy_grid->data[y * 60 + x] = value;
+      }
+    }
+  }
+  const GridParam param{43, 57};
+  const Polygon2d slice = generatePolygon({{-7.1, -2.3}, {12.3, -3.1}, {13.7, 9.2}, {-6.2, 8.4}});
+
+  for (const double min_size : {0.5, 1.0, 1.5}) {
+    grid_map::GridMap grid_map;
+    const int num_iter = static_cast<int>((min_size / occupancy_grid->info.resolution) - 1);
+    autoware::behavior_velocity_planner::grid_utils::denoiseOccupancyGridCV(
+      occupancy_grid, {}, {}, grid_map, param, false, num_iter, false, false);
+    std::vector<grid_map::Position> expected;
+    autoware::behavior_velocity_planner::grid_utils::findOcclusionSpots(
+      expected, grid_map, slice, min_size);
+
+    const LazyVisibilityGrid visibility_grid(occupancy_grid);
+    const SharedGrid shared_grid{
+      autoware::behavior_velocity_planner::grid_utils::getVisibilityGrid(visibility_grid, param),
+      {}};
+    std::vector<grid_map::Position> positions;
+    autoware::behavior_velocity_planner::grid_utils::findOcclusionSpots(
+      positions, shared_grid, slice, min_size);
+
+    EXPECT_FALSE(expected.empty());
+    sortPositions(expected);
+    sortPositions(positions);
+    ASSERT_EQ(positions.size(), expected.size()) << "min_size = " << min_size;
+    for (size_t i = 0; i < positions.size(); ++i) {
+      EXPECT_NEAR(positions[i].x(), expected[i].x(), 1e-6);
+      EXPECT_NEAR(positions[i].y(), expected[i].y(), 1e-6);
+    }
+  }
+}
+
+TEST(findOcclusionSpots, shared_grid_ignores_objects)
+{
+  const LazyVisibilityGrid visibility_grid(generateOccupancyGrid(20, 20, 50));
+  const GridParam param{43, 57};
+  const Polygon2d slice = generatePolygon({{-9.9, -4.9}, {-0.1, -4.9}, {-0.1, 4.9}, {-9.9, 4.9}});
+  std::vector<grid_map::Position> positions;
+  const SharedGrid unknown_grid{
+    autoware::behavior_velocity_planner::grid_utils::getVisibilityGrid(visibility_grid, param),
+    {}};
+  autoware::behavior_velocity_planner::grid_utils::findOcclusionSpots(
+    positions, unknown_grid, slice, 0.5);
+  EXPECT_EQ(positions.size(), 400U);
+
+  // the cells of a stuck vehicle are not occlusion spots
+  const SharedGrid grid_with_object{
+    unknown_grid.visibility_grid,
+    {generatePolygon({{-8.0, -3.0}, {-6.0, -3.0}, {-6.0, -2.0}, {-8.0, -2.0}})}};
+  positions.clear();
+  autoware::behavior_velocity_planner::grid_utils::findOcclusionSpots(
+    positions, grid_with_object, slice, 0.5);
+  EXPECT_EQ(positions.size(), 392U);
+}
+
+TEST(isCollisionFree, shared_grid)
+{
+  auto occupancy_grid =
+    std::make_shared<nav_msgs::msg::OccupancyGrid>(*generateOccupancyGrid(40, 20, 0));
+  // occupied cell centered at (0.25, 0.25)
+  occupancy_grid->data[10 * 40 + 20] = 100;
+  const LazyVisibilityGrid visibility_grid(occupancy_grid);
+  const GridParam param{43, 57};
+  const SharedGrid grid{
+    autoware::behavior_velocity_planner::grid_utils::getVisibilityGrid(visibility_grid, param),
+    {}};
+  using autoware::behavior_velocity_planner::grid_utils::isCollisionFree;
+
+  EXPECT_TRUE(isCollisionFree(grid, {-8.0, 3.25}, {8.0, 3.25}, 1.0));
+  EXPECT_FALSE(isCollisionFree(grid, {-8.0, 1.25}, {8.0, 1.25}, 1.0));
+  EXPECT_TRUE(isCollisionFree(grid, {-8.0, 1.25}, {8.0, 1.25}, 0.5));
+  // the segment is partially out of the grid
+  EXPECT_FALSE(isCollisionFree(grid, {0.25, -8.0}, {0.25, 2.0}, 0.5));
+
+  // a stuck vehicle on the path
+  const SharedGrid grid_with_object{
+    grid.visibility_grid,
+    {generatePolygon({{-5.0, 3.0}, {-3.0, 3.0}, {-3.0, 4.0}, {-5.0, 4.0}})}};
+  EXPECT_FALSE(isCollisionFree(grid_with_object, {-8.0, 3.25}, {8.0, 3.25}, 1.0));
+  EXPECT_TRUE(isCollisionFree(grid_with_object, {-8.0, 1.75}, {8.0, 1.75}, 0.5));
+}
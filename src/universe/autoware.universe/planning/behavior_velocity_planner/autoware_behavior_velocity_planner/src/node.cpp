@@ -133,6 +133,8 @@ BehaviorVelocityPlannerNode::BehaviorVelocityPlannerNode(const rclcpp::NodeOptio
   logger_configure_ = std::make_unique<autoware::universe_utils::LoggerLevelConfigure>(this);
   published_time_publisher_ =
     std::make_unique<autoware::universe_utils::PublishedTimePublisher>(this);
+  latency_trace_stage_ =
+    std::make_unique<autoware::universe_utils::LatencyTraceStage>(get_fully_qualified_name());
 }
 
 void BehaviorVelocityPlannerNode::onLoadPlugin(
@@ -342,6 +344,10 @@ void BehaviorVelocityPlannerNode::onTrigger(
     return;
   }
 
+  autoware::universe_utils::LatencyTraceScope trace_scope(*latency_trace_stage_);
+  trace_scope.add_input(input_path_msg->header.stamp);
+  trace_scope.add_input(planner_data_.predicted_objects->header.stamp);
+
   // Load map and check route handler
   if (has_received_map_) {
     planner_data_.route_handler_ = std::make_shared<route_handler::RouteHandler>(*map_ptr_);
@@ -358,6 +364,12 @@ void BehaviorVelocityPlannerNode::onTrigger(
     return;
   }
 
+  // the occupancy grid is converted when a module requests it first
+  planner_data_.visibility_grid =
+    planner_data_.occupancy_grid
+      ? std::make_shared<const LazyVisibilityGrid>(planner_data_.occupancy_grid)
+      : nullptr;
+
   const autoware_planning_msgs::msg::Path output_path_msg =
     generatePath(input_path_msg, planner_data_);
 
@@ -365,6 +377,7 @@ void BehaviorVelocityPlannerNode::onTrigger(
 
   path_pub_->publish(output_path_msg);
   published_time_publisher_->publish_if_subscribed(path_pub_, output_path_msg.header.stamp);
+  trace_scope.set_output(output_path_msg.header.stamp);
   stop_reason_diag_pub_->publish(planner_manager_.getStopReasonDiag());
 
   if (debug_viz_pub_->get_subscription_count() > 0) {
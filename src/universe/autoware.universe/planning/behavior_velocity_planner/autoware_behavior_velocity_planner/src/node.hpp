@@ -21,6 +21,7 @@
 
 #include <autoware/behavior_velocity_planner_common/planner_data.hpp>
 #include <autoware/universe_utils/ros/published_time_publisher.hpp>
+#include <autoware/universe_utils/system/latency_tracer.hpp>
 #include <autoware_behavior_velocity_planner/srv/load_plugin.hpp>
 #include <autoware_behavior_velocity_planner/srv/unload_plugin.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -146,6 +147,7 @@ private:
   std::unique_ptr<autoware::universe_utils::LoggerLevelConfigure> logger_configure_;
 
   std::unique_ptr<autoware::universe_utils::PublishedTimePublisher> published_time_publisher_;
+  std::unique_ptr<autoware::universe_utils::LatencyTraceStage> latency_trace_stage_;
 
   static constexpr int logger_throttle_interval = 3000;
 };
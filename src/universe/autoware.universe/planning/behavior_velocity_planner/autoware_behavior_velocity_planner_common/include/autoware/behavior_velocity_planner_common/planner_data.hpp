@@ -18,6 +18,7 @@
 #include "autoware/route_handler/route_handler.hpp"
 
 #include <autoware/behavior_velocity_planner_common/utilization/util.hpp>
+#include <autoware/behavior_velocity_planner_common/utilization/visibility_grid.hpp>
 #include <autoware/velocity_smoother/smoother/smoother_base.hpp>
 #include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
 
@@ -73,6 +74,8 @@ struct PlannerData
   pcl::PointCloud<pcl::PointXYZ>::ConstPtr no_ground_pointcloud;
   // occupancy grid
   nav_msgs::msg::OccupancyGrid::ConstSharedPtr occupancy_grid;
+  // occupancy grid converted at most once per cycle for the occlusion checks of the modules
+  std::shared_ptr<const LazyVisibilityGrid> visibility_grid;
 
   // nearest search
   double ego_nearest_dist_threshold;
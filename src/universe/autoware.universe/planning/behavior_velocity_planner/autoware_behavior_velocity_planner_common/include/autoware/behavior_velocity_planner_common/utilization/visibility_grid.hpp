@@ -0,0 +1,193 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__VISIBILITY_GRID_HPP_
+#define AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__VISIBILITY_GRID_HPP_
+
+#include <geometry_msgs/msg/point.hpp>
+#include <nav_msgs/msg/occupancy_grid.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+/**
+ * @brief occupancy grid converted once per cycle and shared by the modules through PlannerData
+ * @details the cells are classified into free / occupied / unknown bitmaps packed in 64 bit words.
+ * The indices are the ones of nav_msgs::msg::OccupancyGrid, x along the width and y along the
+ * height.
+ */
+class VisibilityGrid
+{
+public:
+  enum class CellState : uint8_t { FREE = 0, OCCUPIED, UNKNOWN };
+
+  struct Index
+  {
+    int x;
+    int y;
+  };
+
+  /**
+   * @brief cells with a value lower than free_space_max are free, cells with a value higher than
+   * occupied_min are occupied, and other cells (including -1) are unknown
+   */
+  VisibilityGrid(
+    const nav_msgs::msg::OccupancyGrid & occupancy_grid, const int free_space_max,
+    const int occupied_min);
+
+  int width() const { return width_; }
+  int height() const { return height_; }
+  double resolution() const { return resolution_; }
+  int free_space_max() const { return free_space_max_; }
+  int occupied_min() const { return occupied_min_; }
+
+  bool isInside(const Index & index) const
+  {
+    return index.x >= 0 && index.x < width_ && index.y >= 0 && index.y < height_;
+  }
+
+  std::optional<Index> toIndex(const double x, const double y) const;
+
+  /**
+   * @brief position of the center of the cell
+   */
+  geometry_msgs::msg::Point toPosition(const Index & index) const;
+
+  CellState state(const Index & index) const;
+
+  /**
+   * @brief whether all the cells in [min_index, max_index] are unknown, ignoring the cells out of
+   * the grid
+   */
+  bool isAllUnknown(const Index & min_index, const Index & max_index) const;
+
+  /**
+   * @brief distance [m] between the centers of the cell and of the closest occupied cell, or
+   * infinity if no cell is occupied
+   * @details the distance transform of the grid is computed at the first call
+   */
+  double distanceToOccupied(const Index & index) const;
+
+  /**
+   * @brief whether the predicate is true for any of the cells whose center is in the polygon
+   * @details the cells are scanned row by row and the scan stops at the first true predicate
+   */
+  template <class Polygon, class Predicate>
+  bool anyOfCellsInPolygon(const Polygon & polygon, Predicate && predicate) const
+  {
+    // polygon in the cell coordinates of the grid
+    std::vector<double> xs;
+    std::vector<double> ys;
+    for (const auto & p : polygon) {
+      const double dx = p.x() - origin_x_;
+      const double dy = p.y() - origin_y_;
+      xs.push_back((cos_yaw_ * dx + sin_yaw_ * dy) / resolution_);
+      ys.push_back((-sin_yaw_ * dx + cos_yaw_ * dy) / resolution_);
+    }
+    if (xs.size() < 3) {
+      return false;
+    }
+    const auto [min_y, max_y] = std::minmax_element(ys.begin(), ys.end());
+    const int first_row = std::max(0, static_cast<int>(std::ceil(*min_y - 0.5)));
+    const int last_row = std::min(height_ - 1, static_cast<int>(std::floor(*max_y - 0.5)));
+    std::vector<double> crossings;
+    for (int y = first_row; y <= last_row; ++y) {
+      const double center_y = y + 0.5;
+      crossings.clear();
+      for (size_t i = 0, j = xs.size() - 1; i < xs.size(); j = i++) {
+        if ((ys[i] > center_y) != (ys[j] > center_y)) {
+          crossings.push_back(xs[i] + (center_y - ys[i]) / (ys[j] - ys[i]) * (xs[j] - xs[i]));
+        }
+      }
+      std::sort(crossings.begin(), crossings.end());
+      for (size_t i = 0; i + 1 < crossings.size(); i += 2) {
+        const int first_col = std::max(0, static_cast<int>(std::ceil(crossings[i] - 0.5)));
+        const int last_col =
+          std::min(width_ - 1, static_cast<int>(std::floor(crossings[i + 1] - 0.5)));
+        for (int x = first_col; x <= last_col; ++x) {
+          if (predicate(Index{x, y})) {
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+private:
+  int width_;
+  int height_;
+  double resolution_;
+  double origin_x_;
+  double origin_y_;
+  double cos_yaw_;
+  double sin_yaw_;
+  int free_space_max_;
+  int occupied_min_;
+
+  // bitmaps with words_per_row_ words per row
+  size_t words_per_row_;
+  std::vector<uint64_t> occupied_bits_;
+  std::vector<uint64_t> unknown_bits_;
+
+  // distances to the closest occupied cell, row by row
+  mutable std::once_flag distance_transform_flag_;
+  mutable std::vector<float> distance_to_occupied_;
+
+  void computeDistanceTransform() const;
+
+  static bool testBit(const std::vector<uint64_t> & bits, const size_t word, const int bit)
+  {
+    return (bits[word] >> bit) & 1U;
+  }
+
+  size_t wordIndex(const Index & index) const
+  {
+    return static_cast<size_t>(index.y) * words_per_row_ + static_cast<size_t>(index.x) / 64;
+  }
+};
+
+/**
+ * @brief VisibilityGrids of a cycle converted at the first request, so that the cycles in which no
+ * module checks the occlusions do not convert the occupancy grid
+ * @details the occupancy grid is converted once for each pair of thresholds, and the modules with
+ * the same thresholds share the same grid
+ */
+class LazyVisibilityGrid
+{
+public:
+  explicit LazyVisibilityGrid(nav_msgs::msg::OccupancyGrid::ConstSharedPtr occupancy_grid);
+
+  /**
+   * @brief get the grid with the given thresholds, which is converted from the occupancy grid at
+   * the first call with these thresholds
+   */
+  const VisibilityGrid & get(const int free_space_max, const int occupied_min) const;
+
+private:
+  nav_msgs::msg::OccupancyGrid::ConstSharedPtr occupancy_grid_;
+  mutable std::mutex mutex_;
+  mutable std::map<std::pair<int, int>, VisibilityGrid> grids_;
+};
+}  // namespace autoware::behavior_velocity_planner
+
+#endif  // AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__VISIBILITY_GRID_HPP_
@@ -0,0 +1,227 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/behavior_velocity_planner_common/utilization/visibility_grid.hpp>
+
+#include <tf2/utils.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+namespace
+{
+// squared euclidean distance transform of one line (Felzenszwalb and Huttenlocher)
+void distanceTransform1d(
+  const std::vector<float> & f, std::vector<float> & d, std::vector<int> & v,
+  std::vector<float> & z)
+{
+  const int n = static_cast<int>(f.size());
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  int k = -1;
+  for (int q = 0; q < n; ++q) {
+    if (f[q] == inf) {
+      continue;
+    }
+    while (k >= 0) {
+      const int p = v[k];
+      const float s = ((f[q] + q * q) - (f[p] + p * p)) / (2.0f * (q - p));
+      if (s > z[k]) {
+        break;
+      }
+      --k;
+    }
+    ++k;
+    v[k] = q;
+    z[k] = k == 0 ? -inf : ((f[q] + q * q) - (f[v[k - 1]] + v[k - 1] * v[k - 1])) /
+                             (2.0f * (q - v[k - 1]));
+    z[k + 1] = inf;
+  }
+  if (k < 0) {
+    std::fill(d.begin(), d.end(), inf);
+    return;
+  }
+  int j = 0;
+  for (int q = 0; q < n; ++q) {
+    while (z[j + 1] < q) {
+      ++j;
+    }
+    d[q] = static_cast<float>((q - v[j]) * (q - v[j])) + f[v[j]];
+  }
+}
+}  // namespace
+
+VisibilityGrid::VisibilityGrid(
+  const nav_msgs::msg::OccupancyGrid & occupancy_grid, const int free_space_max,
+  const int occupied_min)
+: width_(static_cast<int>(occupancy_grid.info.width)),
+  height_(static_cast<int>(occupancy_grid.info.height)),
+  resolution_(occupancy_grid.info.resolution),
+  origin_x_(occupancy_grid.info.origin.position.x),
+  origin_y_(occupancy_grid.info.origin.position.y),
+  cos_yaw_(std::cos(tf2::getYaw(occupancy_grid.info.origin.orientation))),
+  sin_yaw_(std::sin(tf2::getYaw(occupancy_grid.info.origin.orientation))),
+  free_space_max_(free_space_max),
+  occupied_min_(occupied_min),
+  words_per_row_((static_cast<size_t>(width_) + 63) / 64),
+  occupied_bits_(words_per_row_ * height_, 0),
+  unknown_bits_(words_per_row_ * height_, 0)
+{
+  // cells missing in the data are unknown
+  const auto & data = occupancy_grid.data;
+  for (int y = 0; y < height_; ++y) {
+    for (int x = 0; x < width_; ++x) {
+      const size_t i = static_cast<size_t>(y) * width_ + x;
+      const int value = i < data.size() ? data[i] : -1;
+      const Index index{x, y};
+      if (value > occupied_min_) {
+        occupied_bits_[wordIndex(index)] |= uint64_t{1} << (x % 64);
+      } else if (value < 0 || value >= free_space_max_) {
+        unknown_bits_[wordIndex(index)] |= uint64_t{1} << (x % 64);
+      }
+    }
+  }
+}
+
+std::optional<VisibilityGrid::Index> VisibilityGrid::toIndex(const double x, const double y) const
+{
+  const double dx = x - origin_x_;
+  const double dy = y - origin_y_;
+  const Index index{
+    static_cast<int>(std::floor((cos_yaw_ * dx + sin_yaw_ * dy) / resolution_)),
+    static_cast<int>(std::floor((-sin_yaw_ * dx + cos_yaw_ * dy) / resolution_))};
+  if (!isInside(index)) {
+    return std::nullopt;
+  }
+  return index;
+}
+
+geometry_msgs::msg::Point VisibilityGrid::toPosition(const Index & index) const
+{
+  const double x = (index.x + 0.5) * resolution_;
+  const double y = (index.y + 0.5) * resolution_;
+  geometry_msgs::msg::Point position;
+  position.x = origin_x_ + cos_yaw_ * x - sin_yaw_ * y;
+  position.y = origin_y_ + sin_yaw_ * x + cos_yaw_ * y;
+  return position;
+}
+
+VisibilityGrid::CellState VisibilityGrid::state(const Index & index) const
+{
+  if (testBit(occupied_bits_, wordIndex(index), index.x % 64)) {
+    return CellState::OCCUPIED;
+  }
+  if (testBit(unknown_bits_, wordIndex(index), index.x % 64)) {
+    return CellState::UNKNOWN;
+  }
+  return CellState::FREE;
+}
+
+bool VisibilityGrid::isAllUnknown(const Index & min_index, const Index & max_index) const
+{
+  const int first_x = std::max(0, min_index.x);
+  const int last_x = std::min(width_ - 1, max_index.x);
+  const int first_y = std::max(0, min_index.y);
+  const int last_y = std::min(height_ - 1, max_index.y);
+  if (first_x > last_x) {
+    return true;
+  }
+  // compare whole words of the rows
+  const size_t first_word = static_cast<size_t>(first_x) / 64;
+  const size_t last_word = static_cast<size_t>(last_x) / 64;
+  for (int y = first_y; y <= last_y; ++y) {
+    const size_t row = static_cast<size_t>(y) * words_per_row_;
+    for (size_t w = first_word; w <= last_word; ++w) {
+      uint64_t mask = ~uint64_t{0};
+      if (w == first_word) {
+        mask &= ~uint64_t{0} << (first_x % 64);
+      }
+      if (w == last_word) {
+        mask &= ~uint64_t{0} >> (63 - last_x % 64);
+      }
+      if ((unknown_bits_[row + w] & mask) != mask) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+double VisibilityGrid::distanceToOccupied(const Index & index) const
+{
+  std::call_once(distance_transform_flag_, [this]() { computeDistanceTransform(); });
+  return distance_to_occupied_[static_cast<size_t>(index.y) * width_ + index.x];
+}
+
+void VisibilityGrid::computeDistanceTransform() const
+{
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  distance_to_occupied_.assign(static_cast<size_t>(width_) * height_, inf);
+
+  // vertical distances by a forward and a backward sweep over the rows
+  for (int y = 0; y < height_; ++y) {
+    float * row = distance_to_occupied_.data() + static_cast<size_t>(y) * width_;
+    const float * previous_row = y > 0 ? row - width_ : nullptr;
+    for (int x = 0; x < width_; ++x) {
+      if (testBit(occupied_bits_, wordIndex(Index{x, y}), x % 64)) {
+        row[x] = 0.0f;
+      } else if (previous_row) {
+        row[x] = previous_row[x] + 1.0f;
+      }
+    }
+  }
+  for (int y = height_ - 2; y >= 0; --y) {
+    float * row = distance_to_occupied_.data() + static_cast<size_t>(y) * width_;
+    const float * next_row = row + width_;
+    for (int x = 0; x < width_; ++x) {
+      row[x] = std::min(row[x], next_row[x] + 1.0f);
+    }
+  }
+
+  // exact squared distances along the rows
+  std::vector<float> f(width_);
+  std::vector<float> d(width_);
+  std::vector<int> v(width_);
+  std::vector<float> z(width_ + 1);
+  for (int y = 0; y < height_; ++y) {
+    float * row = distance_to_occupied_.data() + static_cast<size_t>(y) * width_;
+    for (int x = 0; x < width_; ++x) {
+      f[x] = row[x] * row[x];
+    }
+    distanceTransform1d(f, d, v, z);
+    for (int x = 0; x < width_; ++x) {
+      row[x] = std::sqrt(d[x]) * static_cast<float>(resolution_);
+    }
+  }
+}
+
+LazyVisibilityGrid::LazyVisibilityGrid(nav_msgs::msg::OccupancyGrid::ConstSharedPtr occupancy_grid)
+: occupancy_grid_(std::move(occupancy_grid))
+{
+}
+
+const VisibilityGrid & LazyVisibilityGrid::get(
+  const int free_space_max, const int occupied_min) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  // the grids are stored in a map so that the references stay valid after other insertions
+  return grids_
+    .try_emplace(
+      std::make_pair(free_space_max, occupied_min), *occupancy_grid_, free_space_max, occupied_min)
+    .first->second;
+}
+}  // namespace autoware::behavior_velocity_planner
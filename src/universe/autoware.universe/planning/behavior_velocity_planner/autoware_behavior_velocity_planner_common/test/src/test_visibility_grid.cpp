@@ -0,0 +1,176 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/behavior_velocity_planner_common/utilization/visibility_grid.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using autoware::behavior_velocity_planner::LazyVisibilityGrid;
+using autoware::behavior_velocity_planner::VisibilityGrid;
+
+nav_msgs::msg::OccupancyGrid generateOccupancyGrid(const int width, const int height)
+{
+  nav_msgs::msg::OccupancyGrid grid;
+  grid.info.width = width;
+  grid.info.height = height;
+  grid.info.resolution = 0.5;
+  grid.info.origin.position.x = -10.0;
+  grid.info.origin.position.y = 5.0;
+  grid.info.origin.orientation.w = 1.0;
+  grid.data.assign(width * height, 0);
+  return grid;
+}
+
+struct Point2d
+{
+  double x_;
+  double y_;
+  double x() const { return x_; }
+  double y() const { return y_; }
+};
+}  // namespace
+
+TEST(VisibilityGrid, cellStates)
+{
+  auto grid = generateOccupancyGrid(100, 70);
+  grid.data[0] = 42;
+  grid.data[1] = 43;
+  grid.data[2] = 58;
+  grid.data[3] = 59;
+  grid.data[4] = -1;
+  grid.data.resize(100 * 70 - 1);
+  const VisibilityGrid visibility_grid(grid, 43, 58);
+
+  using CellState = VisibilityGrid::CellState;
+  EXPECT_EQ(visibility_grid.state({0, 0}), CellState::FREE);
+  EXPECT_EQ(visibility_grid.state({1, 0}), CellState::UNKNOWN);
+  EXPECT_EQ(visibility_grid.state({2, 0}), CellState::UNKNOWN);
+  EXPECT_EQ(visibility_grid.state({3, 0}), CellState::OCCUPIED);
+  EXPECT_EQ(visibility_grid.state({4, 0}), CellState::UNKNOWN);
+  EXPECT_EQ(visibility_grid.state({99, 69}), CellState::UNKNOWN);
+
+  const auto index = visibility_grid.toIndex(-9.2, 5.6);
+  ASSERT_TRUE(index);
+  EXPECT_EQ(index->x, 1);
+  EXPECT_EQ(index->y, 1);
+  EXPECT_FALSE(visibility_grid.toIndex(-10.1, 6.0));
+  EXPECT_FALSE(visibility_grid.toIndex(40.1, 6.0));
+  const auto position = visibility_grid.toPosition({1, 1});
+  EXPECT_DOUBLE_EQ(position.x, -9.25);
+  EXPECT_DOUBLE_EQ(position.y, 5.75);
+}
+
+TEST(VisibilityGrid, isAllUnknown)
+{
+  auto grid = generateOccupancyGrid(150, 20);
+  for (int y = 5; y < 10; ++y) {
+    for (int x = 60; x < 135; ++x) {
+      grid.data[y * 150 + x] = 50;
+    }
+  }
+  const VisibilityGrid visibility_grid(grid, 43, 58);
+
+  EXPECT_TRUE(visibility_grid.isAllUnknown({60, 5}, {134, 9}));
+  EXPECT_TRUE(visibility_grid.isAllUnknown({63, 6}, {64, 7}));
+  EXPECT_FALSE(visibility_grid.isAllUnknown({59, 5}, {134, 9}));
+  EXPECT_FALSE(visibility_grid.isAllUnknown({60, 5}, {135, 9}));
+  EXPECT_FALSE(visibility_grid.isAllUnknown({60, 4}, {134, 9}));
+  // the cells out of the grid are ignored
+  grid.data.assign(grid.data.size(), 50);
+  const VisibilityGrid unknown_grid(grid, 43, 58);
+  EXPECT_TRUE(unknown_grid.isAllUnknown({-5, -5}, {200, 30}));
+}
+
+TEST(VisibilityGrid, anyOfCellsInPolygon)
+{
+  const auto grid = generateOccupancyGrid(40, 40);
+  const VisibilityGrid visibility_grid(grid, 43, 58);
+
+  // square from cell (4, 2) to cell (7, 5)
+  const std::vector<Point2d> polygon = {{-8.0, 6.0}, {-6.0, 6.0}, {-6.0, 8.0}, {-8.0, 8.0}};
+  int count = 0;
+  EXPECT_FALSE(visibility_grid.anyOfCellsInPolygon(polygon, [&](const auto & index) {
+    EXPECT_GE(index.x, 4);
+    EXPECT_LE(index.x, 7);
+    EXPECT_GE(index.y, 2);
+    EXPECT_LE(index.y, 5);
+    ++count;
+    return false;
+  }));
+  EXPECT_EQ(count, 16);
+  EXPECT_TRUE(visibility_grid.anyOfCellsInPolygon(
+    polygon, [](const auto & index) { return index.x == 5 && index.y == 3; }));
+
+  // polygon partially out of the grid
+  const std::vector<Point2d> outside = {{-20.0, 0.0}, {-9.0, 0.0}, {-9.0, 5.9}, {-20.0, 5.9}};
+  count = 0;
+  visibility_grid.anyOfCellsInPolygon(outside, [&](const auto &) {
+    ++count;
+    return false;
+  });
+  EXPECT_EQ(count, 4);
+}
+
+TEST(VisibilityGrid, distanceToOccupied)
+{
+  auto grid = generateOccupancyGrid(30, 20);
+  const VisibilityGrid free_grid(grid, 43, 58);
+  EXPECT_EQ(free_grid.distanceToOccupied({3, 4}), std::numeric_limits<double>::infinity());
+
+  grid.data[2 * 30 + 5] = 100;
+  grid.data[15 * 30 + 25] = 100;
+  const VisibilityGrid visibility_grid(grid, 43, 58);
+  // brute force distances to the two occupied cells
+  for (int y = 0; y < 20; ++y) {
+    for (int x = 0; x < 30; ++x) {
+      const double expected =
+        0.5 * std::min(std::hypot(x - 5, y - 2), std::hypot(x - 25, y - 15));
+      EXPECT_NEAR(visibility_grid.distanceToOccupied({x, y}), expected, 1e-5)
+        << "x = " << x << ", y = " << y;
+    }
+  }
+}
+
+TEST(VisibilityGrid, LazyVisibilityGrid)
+{
+  auto grid = generateOccupancyGrid(40, 30);
+  grid.data[0] = 50;
+  grid.data[1] = 100;
+  const LazyVisibilityGrid lazy_grid(std::make_shared<const nav_msgs::msg::OccupancyGrid>(grid));
+
+  const auto & visibility_grid = lazy_grid.get(30, 70);
+  EXPECT_EQ(&visibility_grid, &lazy_grid.get(30, 70));
+  EXPECT_EQ(visibility_grid.width(), 40);
+  EXPECT_EQ(visibility_grid.height(), 30);
+  EXPECT_EQ(visibility_grid.free_space_max(), 30);
+  EXPECT_EQ(visibility_grid.occupied_min(), 70);
+  EXPECT_EQ(visibility_grid.state({0, 0}), VisibilityGrid::CellState::UNKNOWN);
+  EXPECT_EQ(visibility_grid.state({1, 0}), VisibilityGrid::CellState::OCCUPIED);
+  EXPECT_EQ(visibility_grid.state({2, 0}), VisibilityGrid::CellState::FREE);
+
+  // other thresholds convert another grid
+  const auto & other_grid = lazy_grid.get(60, 99);
+  EXPECT_NE(&other_grid, &visibility_grid);
+  EXPECT_EQ(&other_grid, &lazy_grid.get(60, 99));
+  EXPECT_EQ(other_grid.state({0, 0}), VisibilityGrid::CellState::FREE);
+  EXPECT_EQ(other_grid.state({1, 0}), VisibilityGrid::CellState::OCCUPIED);
+  EXPECT_EQ(&visibility_grid, &lazy_grid.get(30, 70));
+}
@@ -272,6 +272,8 @@ void MotionVelocityPlannerNode::on_trajectory(
   autoware::universe_utils::StopWatch<std::chrono::milliseconds> stop_watch;
   std::map<std::string, double> processing_times;
   stop_watch.tic("Total");
+  autoware::universe_utils::LatencyTraceScope trace_scope(latency_trace_stage_);
+  trace_scope.add_input(input_trajectory_msg->header.stamp);
 
   if (!update_planner_data(processing_times)) {
     return;
@@ -300,6 +302,7 @@ void MotionVelocityPlannerNode::on_trajectory(
   trajectory_pub_->publish(output_trajectory_msg);
   published_time_publisher_.publish_if_subscribed(
     trajectory_pub_, output_trajectory_msg.header.stamp);
+  trace_scope.set_output(output_trajectory_msg.header.stamp);
   processing_times["Total"] = stop_watch.toc("Total");
   processing_diag_publisher_.publish(processing_times);
   tier4_debug_msgs::msg::Float64Stamped processing_time_msg;
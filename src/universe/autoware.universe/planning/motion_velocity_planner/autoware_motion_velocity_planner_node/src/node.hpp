@@ -21,6 +21,7 @@
 #include <autoware/universe_utils/ros/logger_level_configure.hpp>
 #include <autoware/universe_utils/ros/polling_subscriber.hpp>
 #include <autoware/universe_utils/ros/published_time_publisher.hpp>
+#include <autoware/universe_utils/system/latency_tracer.hpp>
 #include <autoware_motion_velocity_planner_node/srv/load_plugin.hpp>
 #include <autoware_motion_velocity_planner_node/srv/unload_plugin.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -104,6 +105,7 @@ private:
     this, "~/debug/processing_time_ms_diag"};
   rclcpp::Publisher<tier4_debug_msgs::msg::Float64Stamped>::SharedPtr processing_time_publisher_;
   autoware::universe_utils::PublishedTimePublisher published_time_publisher_{this};
+  autoware::universe_utils::LatencyTraceStage latency_trace_stage_{get_fully_qualified_name()};
   rclcpp::Publisher<DiagnosticArray>::SharedPtr diagnostics_pub_;
 
   //  parameters
@@ -27,6 +27,7 @@
 
 #include <boost/geometry/algorithms/distance.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <limits>
 
@@ -121,6 +122,7 @@ PathSampler::PathSampler(const rclcpp::NodeOptions & node_options)
       declare_parameter<bool>("preprocessing.force_zero_initial_heading");
     params_.preprocessing.smooth_reference =
       declare_parameter<bool>("preprocessing.smooth_reference_trajectory");
+    omp_num_threads_ = std::max(declare_parameter<int>("omp_params.num_threads"), 1);
     params_.constraints.ego_footprint = vehicle_info_.createFootprint();
     params_.constraints.ego_width = vehicle_info_.vehicle_width_m;
     params_.constraints.ego_length = vehicle_info_.vehicle_length_m;
@@ -193,6 +195,9 @@ rcl_interfaces::msg::SetParametersResult PathSampler::onParam(
   updateParam(
     parameters, "preprocessing.smooth_reference_trajectory",
     params_.preprocessing.smooth_reference);
+  if (updateParam(parameters, "omp_params.num_threads", omp_num_threads_)) {
+    omp_num_threads_ = std::max(omp_num_threads_, 1);
+  }
   updateParam(
     parameters, "debug.enable_calculation_time_info",
     time_keeper_ptr_->enable_calculation_time_info);
@@ -475,11 +480,14 @@ autoware::sampler_common::Path PathSampler::generatePath(const PlannerData & pla
     generateCandidatesFromPreviousPath(planner_data, path_spline);
   candidate_paths.insert(
     candidate_paths.end(), candidates_from_prev_path.begin(), candidates_from_prev_path.end());
-  debug_data_.footprints.clear();
-  for (auto & path : candidate_paths) {
-    const auto footprint =
+  // candidates are evaluated independently and keep their order, so the selection does not depend
+  // on the number of threads
+  debug_data_.footprints.assign(candidate_paths.size(), {});
+#pragma omp parallel for num_threads(omp_num_threads_) schedule(dynamic)
+  for (size_t i = 0; i < candidate_paths.size(); ++i) {
+    auto & path = candidate_paths[i];
+    debug_data_.footprints[i] =
       autoware::sampler_common::constraints::checkHardConstraints(path, params_.constraints);
-    debug_data_.footprints.push_back(footprint);
     autoware::sampler_common::constraints::calculateCost(path, params_.constraints, path_spline);
   }
   const auto best_path_idx = [](const auto & paths) {
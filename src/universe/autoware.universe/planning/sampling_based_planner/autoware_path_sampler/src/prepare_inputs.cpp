@@ -17,6 +17,7 @@
 #include "autoware/universe_utils/geometry/boost_polygon_utils.hpp"
 #include "autoware_frenet_planner/structures.hpp"
 #include "autoware_path_sampler/utils/geometry_utils.hpp"
+#include "autoware_sampler_common/constraints/hard_constraint.hpp"
 #include "autoware_sampler_common/structures.hpp"
 #include "autoware_sampler_common/transform/spline_transform.hpp"
 
@@ -50,6 +51,13 @@ void prepareConstraints(
     drivable_area_polygon.outer().emplace_back(it->x, it->y);
   drivable_area_polygon.outer().push_back(drivable_area_polygon.outer().front());
   constraints.drivable_polygons = {drivable_area_polygon};
+
+  // broad phase shared by all the candidate paths
+  constexpr auto drivable_area_raster_resolution = 0.5;  // [m]
+  constraints.rtree =
+    autoware::sampler_common::constraints::buildObstacleRtree(constraints.obstacle_polygons);
+  constraints.drivable_area_raster = autoware::sampler_common::constraints::buildDrivableAreaRaster(
+    constraints.drivable_polygons, drivable_area_raster_resolution);
 }
 
 autoware::frenet_planner::SamplingParameters prepareSamplingParameters(
@@ -20,11 +20,27 @@
 #include <vector>
 namespace autoware::sampler_common::constraints
 {
-/// @brief Check if the path satisfies the hard constraints
+/// @brief check the hard constraints of a path, using the rtree and the drivable area raster of
+/// the constraints when they are prepared
 MultiPoint2d checkHardConstraints(Path & path, const Constraints & constraints);
 bool has_collision(
   const MultiPoint2d & footprint, const MultiPolygon2d & obstacles,
   const double min_distance = 0.0);
+/// @brief same result as has_collision, computing the distance only to the obstacles of the rtree
+/// near the footprint
+bool has_collision(
+  const MultiPoint2d & footprint, const MultiPolygon2d & obstacles, const Rtree & rtree,
+  const double min_distance = 0.0);
+/// @brief same result as boost::geometry::within, running the exact geometry only for the points
+/// in the cells crossed by the boundary of the drivable area
+bool is_within_drivable_area(
+  const MultiPoint2d & footprint, const MultiPolygon2d & drivable_polygons,
+  const DrivableAreaRaster & raster);
+/// @brief build the rtree of the bounding boxes of the obstacles
+Rtree buildObstacleRtree(const MultiPolygon2d & obstacles);
+/// @brief rasterize the drivable area, the cells are enlarged if the raster is too large
+DrivableAreaRaster buildDrivableAreaRaster(
+  const MultiPolygon2d & drivable_polygons, const double resolution);
 bool satisfyMinMax(const std::vector<double> & values, const double min, const double max);
 
 }  // namespace autoware::sampler_common::constraints
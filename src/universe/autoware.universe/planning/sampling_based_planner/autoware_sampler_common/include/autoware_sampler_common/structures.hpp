@@ -29,6 +29,8 @@
 #include <boost/geometry/index/rtree.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <numeric>
@@ -340,6 +342,32 @@ struct DynamicObstacle
   double time_step;  // [s] time step between each footprint
 };
 
+/// @brief drivable area rasterized into cells which are inside, outside, or crossed by its boundary
+struct DrivableAreaRaster
+{
+  enum Cell : uint8_t { OUTSIDE = 0, INSIDE, BOUNDARY };
+
+  double resolution{};  // [m] size of a cell
+  Point2d origin;       // corner of the cell (0, 0) with the lowest coordinates
+  size_t width{};
+  size_t height{};
+  std::vector<uint8_t> cells;  // row-major cells, where rows are along the y axis
+
+  [[nodiscard]] bool empty() const { return cells.empty(); }
+
+  /// @brief get the cell of a point, points beyond the raster are outside the drivable area
+  [[nodiscard]] Cell at(const Point2d & p) const
+  {
+    const auto x = std::floor((p.x() - origin.x()) / resolution);
+    const auto y = std::floor((p.y() - origin.y()) / resolution);
+    if (
+      !(x >= 0.0 && y >= 0.0 && x < static_cast<double>(width) &&
+        y < static_cast<double>(height)))
+      return OUTSIDE;
+    return static_cast<Cell>(cells[static_cast<size_t>(y) * width + static_cast<size_t>(x)]);
+  }
+};
+
 struct Constraints
 {
   struct
@@ -362,7 +390,8 @@ struct Constraints
   MultiPolygon2d obstacle_polygons;
   MultiPolygon2d drivable_polygons;
   std::vector<DynamicObstacle> dynamic_obstacles;
-  Rtree rtree;
+  Rtree rtree;  // boxes of the obstacle_polygons with their indexes
+  DrivableAreaRaster drivable_area_raster;
 };
 
 struct ReusableTrajectory
@@ -19,10 +19,55 @@
 #include <boost/geometry.hpp>
 #include <boost/geometry/algorithms/within.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 namespace autoware::sampler_common::constraints
 {
+namespace
+{
+constexpr size_t max_raster_cells = 1UL << 22;
+
+size_t toIndex(const double value, const double origin, const double resolution, const size_t size)
+{
+  const auto index = std::floor((value - origin) / resolution);
+  return static_cast<size_t>(std::clamp(index, 0.0, static_cast<double>(size - 1)));
+}
+
+/// @brief mark the cells crossed by the segment ab, where cells are enlarged by margin
+void markBoundaryCells(
+  DrivableAreaRaster & raster, const Point2d & a, const Point2d & b, const double margin)
+{
+  const auto resolution = raster.resolution;
+  const auto dx = b.x() - a.x();
+  const auto dy = b.y() - a.y();
+  const auto min_x = std::min(a.x(), b.x()) - margin;
+  const auto max_x = std::max(a.x(), b.x()) + margin;
+  const auto first_col = toIndex(min_x, raster.origin.x(), resolution, raster.width);
+  const auto last_col = toIndex(max_x, raster.origin.x(), resolution, raster.width);
+  for (auto col = first_col; col <= last_col; ++col) {
+    // part of the segment over the column
+    const auto col_min_x = raster.origin.x() + static_cast<double>(col) * resolution - margin;
+    const auto col_max_x = col_min_x + resolution + 2.0 * margin;
+    auto t0 = 0.0;
+    auto t1 = 1.0;
+    if (std::abs(dx) > 1e-12) {
+      t0 = std::clamp((col_min_x - a.x()) / dx, 0.0, 1.0);
+      t1 = std::clamp((col_max_x - a.x()) / dx, 0.0, 1.0);
+    }
+    const auto y0 = a.y() + std::min(t0, t1) * dy;
+    const auto y1 = a.y() + std::max(t0, t1) * dy;
+    const auto first_row =
+      toIndex(std::min(y0, y1) - margin, raster.origin.y(), resolution, raster.height);
+    const auto last_row =
+      toIndex(std::max(y0, y1) + margin, raster.origin.y(), resolution, raster.height);
+    for (auto row = first_row; row <= last_row; ++row)
+      raster.cells[row * raster.width + col] = DrivableAreaRaster::BOUNDARY;
+  }
+}
+}  // namespace
+
 bool satisfyMinMax(const std::vector<double> & values, const double min, const double max)
 {
   for (const auto value : values) {
@@ -40,15 +85,147 @@ bool has_collision(
   return false;
 }
 
+bool has_collision(
+  const MultiPoint2d & footprint, const MultiPolygon2d & obstacles, const Rtree & rtree,
+  const double min_distance)
+{
+  if (footprint.empty()) return false;
+  // a point outside of the box of an obstacle expanded by min_distance is farther than
+  // min_distance from the obstacle
+  autoware::universe_utils::Box2d search_box;
+  boost::geometry::envelope(footprint, search_box);
+  search_box.min_corner().x() -= min_distance;
+  search_box.min_corner().y() -= min_distance;
+  search_box.max_corner().x() += min_distance;
+  search_box.max_corner().y() += min_distance;
+  for (auto it = rtree.qbegin(boost::geometry::index::intersects(search_box)); it != rtree.qend();
+       ++it) {
+    const auto & obstacle = obstacles[it->second];
+    auto obstacle_box = it->first;
+    obstacle_box.min_corner().x() -= min_distance;
+    obstacle_box.min_corner().y() -= min_distance;
+    obstacle_box.max_corner().x() += min_distance;
+    obstacle_box.max_corner().y() += min_distance;
+    for (const auto & p : footprint)
+      if (
+        boost::geometry::covered_by(p, obstacle_box) &&
+        boost::geometry::distance(obstacle, p) <= min_distance)
+        return true;
+  }
+  return false;
+}
+
+bool is_within_drivable_area(
+  const MultiPoint2d & footprint, const MultiPolygon2d & drivable_polygons,
+  const DrivableAreaRaster & raster)
+{
+  if (raster.empty()) return boost::geometry::within(footprint, drivable_polygons);
+  // the footprint is within if no point is in the exterior and at least one is in the interior
+  bool has_interior_point = false;
+  bool has_boundary_cell_point = false;
+  for (const auto & p : footprint) {
+    switch (raster.at(p)) {
+      case DrivableAreaRaster::OUTSIDE:
+        return false;
+      case DrivableAreaRaster::INSIDE:
+        has_interior_point = true;
+        break;
+      case DrivableAreaRaster::BOUNDARY:
+        if (!boost::geometry::covered_by(p, drivable_polygons)) return false;
+        has_boundary_cell_point = true;
+        break;
+    }
+  }
+  if (has_interior_point || !has_boundary_cell_point) return has_interior_point;
+  return std::any_of(footprint.begin(), footprint.end(), [&](const auto & p) {
+    return boost::geometry::within(p, drivable_polygons);
+  });
+}
+
+Rtree buildObstacleRtree(const MultiPolygon2d & obstacles)
+{
+  std::vector<BoxIndexPair> nodes;
+  nodes.reserve(obstacles.size());
+  for (size_t i = 0; i < obstacles.size(); ++i)
+    nodes.emplace_back(
+      boost::geometry::return_envelope<autoware::universe_utils::Box2d>(obstacles[i]), i);
+  return Rtree(nodes);
+}
+
+DrivableAreaRaster buildDrivableAreaRaster(
+  const MultiPolygon2d & drivable_polygons, const double resolution)
+{
+  DrivableAreaRaster raster;
+  if (drivable_polygons.empty() || resolution <= 0.0) return raster;
+  autoware::universe_utils::Box2d box;
+  boost::geometry::envelope(drivable_polygons, box);
+  const auto size_x = box.max_corner().x() - box.min_corner().x();
+  const auto size_y = box.max_corner().y() - box.min_corner().y();
+  if (!std::isfinite(size_x) || !std::isfinite(size_y)) return raster;
+
+  // one cell of padding keeps the points on the edges of the area inside of the raster
+  raster.resolution = std::max(
+    resolution, std::sqrt(size_x * size_y / static_cast<double>(max_raster_cells)) + 1e-3);
+  raster.width = static_cast<size_t>(std::floor(size_x / raster.resolution)) + 3;
+  raster.height = static_cast<size_t>(std::floor(size_y / raster.resolution)) + 3;
+  raster.origin = Point2d(
+    box.min_corner().x() - raster.resolution, box.min_corner().y() - raster.resolution);
+  raster.cells.assign(raster.width * raster.height, DrivableAreaRaster::OUTSIDE);
+
+  // cells near the boundary are enlarged by a margin against the rounding in DrivableAreaRaster::at
+  const auto margin = 1e-2 * raster.resolution;
+  const auto for_each_ring = [&](const auto & function) {
+    for (const auto & polygon : drivable_polygons) {
+      function(polygon.outer());
+      for (const auto & inner : polygon.inners()) function(inner);
+    }
+  };
+  for_each_ring([&](const auto & ring) {
+    for (size_t i = 0; i + 1 < ring.size(); ++i)
+      markBoundaryCells(raster, ring[i], ring[i + 1], margin);
+  });
+
+  // the other cells do not touch the boundary, so the crossings at the cell centers decide them
+  std::vector<double> crossings;
+  for (size_t row = 0; row < raster.height; ++row) {
+    const auto y = raster.origin.y() + (static_cast<double>(row) + 0.5) * raster.resolution;
+    crossings.clear();
+    for_each_ring([&](const auto & ring) {
+      for (size_t i = 0; i + 1 < ring.size(); ++i) {
+        const auto & a = ring[i];
+        const auto & b = ring[i + 1];
+        if ((a.y() <= y) != (b.y() <= y))
+          crossings.push_back(a.x() + (y - a.y()) * (b.x() - a.x()) / (b.y() - a.y()));
+      }
+    });
+    std::sort(crossings.begin(), crossings.end());
+    size_t nb_crossings = 0;
+    for (size_t col = 0; col < raster.width; ++col) {
+      const auto x = raster.origin.x() + (static_cast<double>(col) + 0.5) * raster.resolution;
+      while (nb_crossings < crossings.size() && crossings[nb_crossings] < x) ++nb_crossings;
+      auto & cell = raster.cells[row * raster.width + col];
+      if (cell != DrivableAreaRaster::BOUNDARY && nb_crossings % 2 == 1)
+        cell = DrivableAreaRaster::INSIDE;
+    }
+  }
+  return raster;
+}
+
 MultiPoint2d checkHardConstraints(Path & path, const Constraints & constraints)
 {
   const auto footprint = buildFootprintPoints(path, constraints);
   if (!footprint.empty()) {
     if (constraints.hard.limit_footprint_inside_drivable_area)
-      path.constraint_results.inside_drivable_area =
-        boost::geometry::within(footprint, constraints.drivable_polygons);
-    path.constraint_results.collision_free = !has_collision(
-      footprint, constraints.obstacle_polygons, constraints.hard.min_dist_from_obstacles);
+      path.constraint_results.inside_drivable_area = is_within_drivable_area(
+        footprint, constraints.drivable_polygons, constraints.drivable_area_raster);
+    // fall back to checking every obstacle when the rtree was not prepared
+    path.constraint_results.collision_free =
+      constraints.rtree.size() == constraints.obstacle_polygons.size()
+        ? !has_collision(
+            footprint, constraints.obstacle_polygons, constraints.rtree,
+            constraints.hard.min_dist_from_obstacles)
+        : !has_collision(
+            footprint, constraints.obstacle_polygons, constraints.hard.min_dist_from_obstacles);
   }
   if (!satisfyMinMax(
         path.curvatures, constraints.hard.min_curvature, constraints.hard.max_curvature)) {
@@ -0,0 +1,119 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware_sampler_common/constraints/hard_constraint.hpp>
+#include <autoware_sampler_common/structures.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+namespace
+{
+using autoware::sampler_common::MultiPoint2d;
+using autoware::sampler_common::MultiPolygon2d;
+using autoware::sampler_common::Polygon2d;
+
+// curved road between two bounds, with a hole
+MultiPolygon2d makeDrivableArea()
+{
+  Polygon2d polygon;
+  for (double x = 0.0; x <= 50.0; x += 2.5) polygon.outer().emplace_back(x, std::sin(x / 10.0));
+  for (double x = 50.0; x >= 0.0; x -= 2.5)
+    polygon.outer().emplace_back(x, 6.0 + std::sin(x / 10.0));
+  polygon.outer().push_back(polygon.outer().front());
+  polygon.inners().emplace_back();
+  polygon.inners().back() = {{20.0, 3.0}, {22.0, 3.0}, {22.0, 4.0}, {20.0, 4.0}, {20.0, 3.0}};
+  boost::geometry::correct(polygon);
+  return {polygon};
+}
+
+MultiPoint2d makeFootprint(std::mt19937 & generator)
+{
+  std::uniform_real_distribution<double> x_distribution(-5.0, 55.0);
+  std::uniform_real_distribution<double> y_distribution(-2.0, 8.0);
+  std::uniform_real_distribution<double> offset_distribution(-1.0, 1.0);
+  const double x = x_distribution(generator);
+  const double y = y_distribution(generator);
+  MultiPoint2d footprint;
+  for (int i = 0; i < 4; ++i)
+    footprint.emplace_back(x + offset_distribution(generator), y + offset_distribution(generator));
+  return footprint;
+}
+}  // namespace
+
+TEST(HardConstraints, withinDrivableArea)
+{
+  using autoware::sampler_common::DrivableAreaRaster;
+  using autoware::sampler_common::constraints::buildDrivableAreaRaster;
+  using autoware::sampler_common::constraints::is_within_drivable_area;
+
+  const auto drivable_area = makeDrivableArea();
+  const auto raster = buildDrivableAreaRaster(drivable_area, 0.5);
+  ASSERT_FALSE(raster.empty());
+  EXPECT_EQ(raster.at({10.0, 3.0}), DrivableAreaRaster::INSIDE);
+  EXPECT_EQ(raster.at({21.0, 3.5}), DrivableAreaRaster::BOUNDARY);
+  EXPECT_EQ(raster.at({10.0, -3.0}), DrivableAreaRaster::OUTSIDE);
+  EXPECT_EQ(raster.at({100.0, 3.0}), DrivableAreaRaster::OUTSIDE);
+
+  std::mt19937 generator(0);
+  for (int i = 0; i < 5000; ++i) {
+    const auto footprint = makeFootprint(generator);
+    EXPECT_EQ(
+      is_within_drivable_area(footprint, drivable_area, raster),
+      boost::geometry::within(footprint, drivable_area));
+  }
+  // points on the boundary are not in the interior
+  const MultiPoint2d on_boundary = {{0.0, 0.0}, {0.0, 6.0}};
+  EXPECT_EQ(
+    is_within_drivable_area(on_boundary, drivable_area, raster),
+    boost::geometry::within(on_boundary, drivable_area));
+  // a too large raster is coarsened
+  EXPECT_GT(buildDrivableAreaRaster(drivable_area, 1e-4).resolution, 1e-4);
+}
+
+TEST(HardConstraints, collisionWithRtree)
+{
+  using autoware::sampler_common::constraints::buildObstacleRtree;
+  using autoware::sampler_common::constraints::has_collision;
+
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> x_distribution(-5.0, 55.0);
+  std::uniform_real_distribution<double> y_distribution(-2.0, 8.0);
+  MultiPolygon2d obstacles;
+  for (int i = 0; i < 20; ++i) {
+    const double x = x_distribution(generator);
+    const double y = y_distribution(generator);
+    Polygon2d obstacle;
+    obstacle.outer() = {{x, y}, {x + 1.0, y}, {x + 1.0, y + 0.5}, {x, y + 0.5}, {x, y}};
+    boost::geometry::correct(obstacle);
+    obstacles.push_back(obstacle);
+  }
+  const auto rtree = buildObstacleRtree(obstacles);
+  ASSERT_EQ(rtree.size(), obstacles.size());
+
+  for (const auto min_distance : {0.0, 0.5, 2.0}) {
+    for (int i = 0; i < 2000; ++i) {
+      const auto footprint = makeFootprint(generator);
+      EXPECT_EQ(
+        has_collision(footprint, obstacles, rtree, min_distance),
+        has_collision(footprint, obstacles, min_distance));
+    }
+  }
+  EXPECT_FALSE(has_collision(MultiPoint2d{}, obstacles, rtree));
+}
@@ -109,6 +109,8 @@ autoware::pointcloud_preprocessor::Filter::Filter(
 
   published_time_publisher_ =
     std::make_unique<autoware::universe_utils::PublishedTimePublisher>(this);
+  latency_trace_stage_ =
+    std::make_unique<autoware::universe_utils::LatencyTraceStage>(get_fully_qualified_name());
   RCLCPP_DEBUG(this->get_logger(), "[Filter Constructor] successfully created.");
 }
 
@@ -196,6 +198,9 @@ void autoware::pointcloud_preprocessor::Filter::unsubscribe()
 void autoware::pointcloud_preprocessor::Filter::computePublish(
   const PointCloud2ConstPtr & input, const IndicesPtr & indices)
 {
+  autoware::universe_utils::LatencyTraceScope trace_scope(*latency_trace_stage_);
+  trace_scope.add_input(input->header.stamp);
+
   auto output = std::make_unique<PointCloud2>();
 
   // Call the virtual method in the child
@@ -209,6 +214,7 @@ void autoware::pointcloud_preprocessor::Filter::computePublish(
   // Publish a boost shared ptr
   pub_output_->publish(std::move(output));
   published_time_publisher_->publish_if_subscribed(pub_output_, input->header.stamp);
+  trace_scope.set_output(input->header.stamp);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////
@@ -369,6 +375,9 @@ bool autoware::pointcloud_preprocessor::Filter::convert_output_costly(
 void autoware::pointcloud_preprocessor::Filter::faster_input_indices_callback(
   const PointCloud2ConstPtr cloud, const PointIndicesConstPtr indices)
 {
+  autoware::universe_utils::LatencyTraceScope trace_scope(*latency_trace_stage_);
+  trace_scope.add_input(cloud->header.stamp);
+
   if (
     !utils::is_data_layout_compatible_with_point_xyzircaedt(*cloud) &&
     !utils::is_data_layout_compatible_with_point_xyzirc(*cloud)) {
@@ -444,6 +453,7 @@ void autoware::pointcloud_preprocessor::Filter::faster_input_indices_callback(
   output->header.stamp = cloud->header.stamp;
   pub_output_->publish(std::move(output));
   published_time_publisher_->publish_if_subscribed(pub_output_, cloud->header.stamp);
+  trace_scope.set_output(cloud->header.stamp);
 }
 
 // TODO(sykwer): Temporary Implementation: Remove this interface when all the filter nodes conform
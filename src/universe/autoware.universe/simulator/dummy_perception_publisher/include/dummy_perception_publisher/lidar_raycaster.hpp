@@ -0,0 +1,99 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DUMMY_PERCEPTION_PUBLISHER__LIDAR_RAYCASTER_HPP_
+#define DUMMY_PERCEPTION_PUBLISHER__LIDAR_RAYCASTER_HPP_
+
+#include <tf2/LinearMath/Transform.h>
+#include <tf2/LinearMath/Vector3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lidar_raycaster
+{
+
+enum class Shape { BOX, CYLINDER };
+
+// box or vertical cylinder centered at the origin of its frame, where the length of a cylinder is
+// its diameter as in autoware_perception_msgs::msg::Shape
+struct Target
+{
+  Shape shape;
+  tf2::Transform tf_base_link2target;
+  double length;
+  double width;
+  double height;
+};
+
+// index of Scan::target_indices for the rays without any return and the rays hitting the ground
+constexpr int32_t no_target = -1;
+constexpr int32_t ground_target = -2;
+
+// range and index of the hit target of each ray, where the ray of a channel in a column is
+// column * channels + channel
+struct Scan
+{
+  std::vector<float> ranges;
+  std::vector<int32_t> target_indices;
+};
+
+/**
+ * @brief rotating lidar firing all the channels at each of the columns, i.e. the azimuth steps
+ * @details the rays are intersected analytically with the targets and the ground plane z = 0 in
+ * base_link. Each target is only intersected with the columns in the azimuth range of its
+ * bounding sphere, in loops over the rays of the columns without branches which the compiler can
+ * vectorize.
+ */
+class LidarRaycaster
+{
+public:
+  /**
+   * @param elevations [rad] elevation of the beams in the order of the channels
+   * @param azimuth_steps number of columns in a rotation starting at the azimuth -pi
+   * @param tf_base_link2sensor mounting of the sensor
+   * @param min_range [m] minimum range of the returns
+   * @param max_range [m] maximum range of the returns
+   */
+  LidarRaycaster(
+    const std::vector<double> & elevations, const size_t azimuth_steps,
+    const tf2::Transform & tf_base_link2sensor, const double min_range, const double max_range);
+
+  size_t channels() const { return elevations_.size(); }
+  size_t azimuth_steps() const { return azimuth_steps_; }
+  double elevation(const size_t channel) const { return elevations_.at(channel); }
+  double azimuth(const size_t column) const;
+
+  // point of the ray at the range in base_link
+  tf2::Vector3 getPoint(const size_t ray, const double range) const;
+
+  void raycast(const std::vector<Target> & targets, Scan & scan) const;
+
+private:
+  std::vector<double> elevations_;
+  size_t azimuth_steps_;
+  tf2::Transform tf_sensor2base_link_;
+  float min_range_;
+  float max_range_;
+  // origin and unit directions of the rays in base_link
+  tf2::Vector3 origin_;
+  std::vector<float> direction_x_;
+  std::vector<float> direction_y_;
+  std::vector<float> direction_z_;
+};
+
+}  // namespace lidar_raycaster
+
+#endif  // DUMMY_PERCEPTION_PUBLISHER__LIDAR_RAYCASTER_HPP_
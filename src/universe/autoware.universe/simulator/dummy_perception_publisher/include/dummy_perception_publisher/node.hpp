@@ -15,6 +15,8 @@
 #ifndef DUMMY_PERCEPTION_PUBLISHER__NODE_HPP_
 #define DUMMY_PERCEPTION_PUBLISHER__NODE_HPP_
 
+#include "dummy_perception_publisher/lidar_raycaster.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_perception_msgs/msg/detected_objects.hpp>
@@ -39,6 +41,7 @@
 
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 struct ObjectInfo
@@ -48,6 +51,7 @@ struct ObjectInfo
   double length;
   double width;
   double height;
+  uint8_t shape_type;
   double std_dev_x;
   double std_dev_y;
   double std_dev_z;
@@ -107,6 +111,27 @@ private:
   double visible_range_;
 };
 
+class LidarPointCloudCreator
+{
+public:
+  LidarPointCloudCreator(lidar_raycaster::LidarRaycaster raycaster, bool add_ground_points)
+  : raycaster_(std::move(raycaster)), add_ground_points_(add_ground_points)
+  {
+  }
+
+  // scan of the objects in the point layout of the lidar drivers, and the points of each object
+  std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> create_pointcloud(
+    const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
+    std::mt19937 & random_generator, sensor_msgs::msg::PointCloud2 & pointcloud);
+
+private:
+  lidar_raycaster::LidarRaycaster raycaster_;
+  bool add_ground_points_;
+  // buffers reused over the scans
+  std::vector<lidar_raycaster::Target> targets_;
+  lidar_raycaster::Scan scan_;
+};
+
 class DummyPerceptionPublisherNode : public rclcpp::Node
 {
 private:
@@ -128,6 +153,7 @@ private:
   bool use_base_link_z_;
   bool publish_ground_truth_objects_;
   std::unique_ptr<PointCloudCreator> pointcloud_creator_;
+  std::unique_ptr<LidarPointCloudCreator> lidar_pointcloud_creator_;
 
   double angle_increment_;
 
@@ -0,0 +1,87 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dummy_perception_publisher/node.hpp"
+
+#include <autoware_point_types/types.hpp>
+#include <point_cloud_msg_wrapper/point_cloud_msg_wrapper.hpp>
+
+#include <autoware_perception_msgs/msg/shape.hpp>
+
+#include <cmath>
+#include <vector>
+
+using autoware_point_types::PointXYZIRCAEDT;
+using autoware_point_types::PointXYZIRCAEDTGenerator;
+using point_cloud_msg_wrapper::PointCloud2Modifier;
+
+std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> LidarPointCloudCreator::create_pointcloud(
+  const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
+  std::mt19937 & random_generator, sensor_msgs::msg::PointCloud2 & pointcloud)
+{
+  targets_.clear();
+  std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> pointclouds;
+  for (const auto & obj_info : obj_infos) {
+    // the polygons are approximated by their bounding boxes
+    const auto shape = obj_info.shape_type == autoware_perception_msgs::msg::Shape::CYLINDER
+                         ? lidar_raycaster::Shape::CYLINDER
+                         : lidar_raycaster::Shape::BOX;
+    targets_.push_back(lidar_raycaster::Target{
+      shape, tf_base_link2map * obj_info.tf_map2moved_object, obj_info.length, obj_info.width,
+      obj_info.height});
+    pointclouds.push_back(pcl::PointCloud<pcl::PointXYZ>::Ptr(new pcl::PointCloud<pcl::PointXYZ>));
+  }
+  raycaster_.raycast(targets_, scan_);
+
+  PointCloud2Modifier<PointXYZIRCAEDT, PointXYZIRCAEDTGenerator> modifier{pointcloud, "base_link"};
+  modifier.reserve(scan_.ranges.size());
+  const size_t channels = raycaster_.channels();
+  for (size_t column = 0; column < raycaster_.azimuth_steps(); ++column) {
+    for (size_t channel = 0; channel < channels; ++channel) {
+      const size_t ray = column * channels + channel;
+      const int32_t target_index = scan_.target_indices[ray];
+      if (
+        target_index == lidar_raycaster::no_target ||
+        (target_index == lidar_raycaster::ground_target && !add_ground_points_)) {
+        continue;
+      }
+
+      auto point = raycaster_.getPoint(ray, scan_.ranges[ray]);
+      if (target_index >= 0) {
+        const auto object_index = static_cast<size_t>(target_index);
+        const auto & obj_info = obj_infos.at(object_index);
+        std::normal_distribution<> x_random(0.0, obj_info.std_dev_x);
+        std::normal_distribution<> y_random(0.0, obj_info.std_dev_y);
+        std::normal_distribution<> z_random(0.0, obj_info.std_dev_z);
+        point += tf2::Vector3(
+          x_random(random_generator), y_random(random_generator), z_random(random_generator));
+        pointclouds.at(object_index)->push_back(pcl::PointXYZ(point.x(), point.y(), point.z()));
+      }
+
+      PointXYZIRCAEDT lidar_point;
+      lidar_point.x = static_cast<float>(point.x());
+      lidar_point.y = static_cast<float>(point.y());
+      lidar_point.z = static_cast<float>(point.z());
+      lidar_point.return_type = autoware_point_types::ReturnType::SINGLE_STRONGEST;
+      lidar_point.channel = static_cast<uint16_t>(channel);
+      lidar_point.azimuth = static_cast<float>(raycaster_.azimuth(column));
+      lidar_point.elevation = static_cast<float>(raycaster_.elevation(channel));
+      lidar_point.distance = scan_.ranges[ray];
+      // the whole scan is raycast with the poses at the stamp, so all the points are at the stamp
+      lidar_point.time_stamp = 0;
+      modifier.push_back(lidar_point);
+    }
+  }
+  return pointclouds;
+}
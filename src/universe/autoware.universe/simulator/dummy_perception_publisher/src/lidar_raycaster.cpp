@@ -0,0 +1,248 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dummy_perception_publisher/lidar_raycaster.hpp"
+
+#include <tf2/LinearMath/Matrix3x3.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace lidar_raycaster
+{
+namespace
+{
+// origin of the rays and rotation of their directions in the frame of a target
+struct LocalFrame
+{
+  float origin[3];
+  float rotation[3][3];
+};
+
+// rays [begin, end) of the structure of arrays of the directions in base_link
+struct Rays
+{
+  const float * direction_x;
+  const float * direction_y;
+  const float * direction_z;
+  size_t begin;
+  size_t end;
+};
+
+LocalFrame toLocalFrame(const tf2::Transform & tf_base_link2target, const tf2::Vector3 & origin)
+{
+  const auto tf_target2base_link = tf_base_link2target.inverse();
+  const auto local_origin = tf_target2base_link(origin);
+  LocalFrame frame{};
+  for (int i = 0; i < 3; ++i) {
+    frame.origin[i] = static_cast<float>(local_origin[i]);
+    for (int j = 0; j < 3; ++j) {
+      frame.rotation[i][j] = static_cast<float>(tf_target2base_link.getBasis()[i][j]);
+    }
+  }
+  return frame;
+}
+
+// slab method on the box [-half_size, half_size]
+void intersectBox(
+  const LocalFrame & frame, const float half_size[3], const float min_range,
+  const int32_t target_index, const Rays & rays, float * ranges, int32_t * target_indices)
+{
+  const auto & r = frame.rotation;
+  const float ox = frame.origin[0];
+  const float oy = frame.origin[1];
+  const float oz = frame.origin[2];
+  for (size_t i = rays.begin; i < rays.end; ++i) {
+    const float x = rays.direction_x[i];
+    const float y = rays.direction_y[i];
+    const float z = rays.direction_z[i];
+    const float inv_dx = 1.0f / (r[0][0] * x + r[0][1] * y + r[0][2] * z);
+    const float inv_dy = 1.0f / (r[1][0] * x + r[1][1] * y + r[1][2] * z);
+    const float inv_dz = 1.0f / (r[2][0] * x + r[2][1] * y + r[2][2] * z);
+    const float tx1 = (-half_size[0] - ox) * inv_dx;
+    const float tx2 = (half_size[0] - ox) * inv_dx;
+    const float ty1 = (-half_size[1] - oy) * inv_dy;
+    const float ty2 = (half_size[1] - oy) * inv_dy;
+    const float tz1 = (-half_size[2] - oz) * inv_dz;
+    const float tz2 = (half_size[2] - oz) * inv_dz;
+    const float t_near =
+      std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::min(tz1, tz2));
+    const float t_far =
+      std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::max(tz1, tz2));
+    const bool is_hit = (min_range <= t_near) & (t_near <= t_far) & (t_near < ranges[i]);
+    ranges[i] = is_hit ? t_near : ranges[i];
+    target_indices[i] = is_hit ? target_index : target_indices[i];
+  }
+}
+
+// side and cap of the cylinder x^2 + y^2 <= radius^2, |z| <= half_height
+void intersectCylinder(
+  const LocalFrame & frame, const float radius, const float half_height, const float min_range,
+  const int32_t target_index, const Rays & rays, float * ranges, int32_t * target_indices)
+{
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  const auto & r = frame.rotation;
+  const float ox = frame.origin[0];
+  const float oy = frame.origin[1];
+  const float oz = frame.origin[2];
+  const float c = ox * ox + oy * oy - radius * radius;
+  // only the cap on the side of the origin can be hit first
+  const float cap_z = 0.0f < oz ? half_height : -half_height;
+  for (size_t i = rays.begin; i < rays.end; ++i) {
+    const float x = rays.direction_x[i];
+    const float y = rays.direction_y[i];
+    const float z = rays.direction_z[i];
+    const float dx = r[0][0] * x + r[0][1] * y + r[0][2] * z;
+    const float dy = r[1][0] * x + r[1][1] * y + r[1][2] * z;
+    const float dz = r[2][0] * x + r[2][1] * y + r[2][2] * z;
+
+    const float a = dx * dx + dy * dy;
+    const float b = ox * dx + oy * dy;
+    const float discriminant = b * b - a * c;
+    const float t_side = (-b - std::sqrt(discriminant)) / a;
+    const bool is_side_hit = (0.0f <= discriminant) & (min_range <= t_side) &
+                             (std::abs(oz + t_side * dz) <= half_height);
+
+    const float t_cap = (cap_z - oz) / dz;
+    const float x_cap = ox + t_cap * dx;
+    const float y_cap = oy + t_cap * dy;
+    const bool is_cap_hit =
+      (min_range <= t_cap) & (x_cap * x_cap + y_cap * y_cap <= radius * radius);
+
+    const float t = std::min(is_side_hit ? t_side : inf, is_cap_hit ? t_cap : inf);
+    const bool is_hit = t < ranges[i];
+    ranges[i] = std::min(t, ranges[i]);
+    target_indices[i] = is_hit ? target_index : target_indices[i];
+  }
+}
+}  // namespace
+
+LidarRaycaster::LidarRaycaster(
+  const std::vector<double> & elevations, const size_t azimuth_steps,
+  const tf2::Transform & tf_base_link2sensor, const double min_range, const double max_range)
+: elevations_(elevations),
+  azimuth_steps_(azimuth_steps),
+  tf_sensor2base_link_(tf_base_link2sensor.inverse()),
+  min_range_(static_cast<float>(min_range)),
+  max_range_(static_cast<float>(max_range)),
+  origin_(tf_base_link2sensor.getOrigin())
+{
+  if (elevations_.empty() || azimuth_steps_ == 0) {
+    throw std::invalid_argument("the lidar must have at least one channel and one azimuth step");
+  }
+  if (!(0.0 <= min_range && min_range < max_range)) {
+    throw std::invalid_argument("the range of the lidar must be 0 <= min_range < max_range");
+  }
+
+  const size_t rays = azimuth_steps_ * channels();
+  direction_x_.reserve(rays);
+  direction_y_.reserve(rays);
+  direction_z_.reserve(rays);
+  for (size_t column = 0; column < azimuth_steps_; ++column) {
+    for (const double elevation : elevations_) {
+      const tf2::Vector3 direction_wrt_sensor(
+        std::cos(elevation) * std::cos(azimuth(column)),
+        std::cos(elevation) * std::sin(azimuth(column)), std::sin(elevation));
+      const auto direction = tf_base_link2sensor.getBasis() * direction_wrt_sensor;
+      direction_x_.push_back(static_cast<float>(direction.x()));
+      direction_y_.push_back(static_cast<float>(direction.y()));
+      direction_z_.push_back(static_cast<float>(direction.z()));
+    }
+  }
+}
+
+double LidarRaycaster::azimuth(const size_t column) const
+{
+  return -M_PI + 2.0 * M_PI * static_cast<double>(column) / static_cast<double>(azimuth_steps_);
+}
+
+tf2::Vector3 LidarRaycaster::getPoint(const size_t ray, const double range) const
+{
+  return origin_ + range * tf2::Vector3(direction_x_[ray], direction_y_[ray], direction_z_[ray]);
+}
+
+void LidarRaycaster::raycast(const std::vector<Target> & targets, Scan & scan) const
+{
+  const size_t rays = direction_x_.size();
+  scan.ranges.resize(rays);
+  scan.target_indices.resize(rays);
+  float * ranges = scan.ranges.data();
+  int32_t * target_indices = scan.target_indices.data();
+
+  // ground
+  const float origin_z = static_cast<float>(origin_.z());
+  for (size_t i = 0; i < rays; ++i) {
+    const float t = -origin_z / direction_z_[i];
+    const bool is_hit = (0.0f < origin_z) & (min_range_ <= t) & (t < max_range_);
+    ranges[i] = is_hit ? t : max_range_;
+    target_indices[i] = is_hit ? ground_target : no_target;
+  }
+
+  const double azimuth_step = 2.0 * M_PI / static_cast<double>(azimuth_steps_);
+  for (size_t target_index = 0; target_index < targets.size(); ++target_index) {
+    const auto & target = targets[target_index];
+
+    // columns in the azimuth range of the bounding sphere
+    const auto center = tf_sensor2base_link_(target.tf_base_link2target.getOrigin());
+    const double radius =
+      0.5 * std::sqrt(
+              target.length * target.length + target.width * target.width +
+              target.height * target.height);
+    if (center.length() - radius >= max_range_) {
+      continue;
+    }
+    const double horizontal_distance = std::hypot(center.x(), center.y());
+    size_t first_column = 0;
+    size_t columns = azimuth_steps_;
+    if (radius < horizontal_distance) {
+      const double center_azimuth = std::atan2(center.y(), center.x());
+      const double half_width = std::asin(radius / horizontal_distance);
+      const auto first = static_cast<int64_t>(
+        std::floor((center_azimuth - half_width + M_PI) / azimuth_step));
+      const auto last = static_cast<int64_t>(
+        std::ceil((center_azimuth + half_width + M_PI) / azimuth_step));
+      const auto steps = static_cast<int64_t>(azimuth_steps_);
+      first_column = static_cast<size_t>((first % steps + steps) % steps);
+      columns = std::min(azimuth_steps_, static_cast<size_t>(last - first + 1));
+    }
+
+    const auto frame = toLocalFrame(target.tf_base_link2target, origin_);
+    const auto intersect = [&](const size_t begin_column, const size_t end_column) {
+      const Rays target_rays{
+        direction_x_.data(), direction_y_.data(), direction_z_.data(), begin_column * channels(),
+        end_column * channels()};
+      const auto index = static_cast<int32_t>(target_index);
+      if (target.shape == Shape::CYLINDER) {
+        intersectCylinder(
+          frame, static_cast<float>(0.5 * target.length), static_cast<float>(0.5 * target.height),
+          min_range_, index, target_rays, ranges, target_indices);
+      } else {
+        const float half_size[3] = {
+          static_cast<float>(0.5 * target.length), static_cast<float>(0.5 * target.width),
+          static_cast<float>(0.5 * target.height)};
+        intersectBox(frame, half_size, min_range_, index, target_rays, ranges, target_indices);
+      }
+    };
+    // the columns wrap around at the azimuth pi
+    const size_t end_column = first_column + columns;
+    intersect(first_column, std::min(end_column, azimuth_steps_));
+    if (azimuth_steps_ < end_column) {
+      intersect(0, end_column - azimuth_steps_);
+    }
+  }
+}
+
+}  // namespace lidar_raycaster
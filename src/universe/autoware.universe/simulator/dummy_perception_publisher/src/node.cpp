@@ -26,6 +26,9 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -36,11 +39,18 @@
 using autoware_perception_msgs::msg::TrackedObject;
 using autoware_perception_msgs::msg::TrackedObjects;
 
+namespace
+{
+// period of the output, i.e. the scan period of the lidar
+constexpr std::chrono::milliseconds timer_period{100};
+}  // namespace
+
 ObjectInfo::ObjectInfo(
   const tier4_simulation_msgs::msg::DummyObject & object, const rclcpp::Time & current_time)
 : length(object.shape.dimensions.x),
   width(object.shape.dimensions.y),
   height(object.shape.dimensions.z),
+  shape_type(object.shape.type),
   std_dev_x(std::sqrt(object.initial_state.pose_covariance.covariance[0])),
   std_dev_y(std::sqrt(object.initial_state.pose_covariance.covariance[7])),
   std_dev_z(std::sqrt(object.initial_state.pose_covariance.covariance[14])),
@@ -150,6 +160,40 @@ DummyPerceptionPublisherNode::DummyPerceptionPublisherNode()
   // parameters for vehicle centric point cloud generation
   angle_increment_ = this->declare_parameter("angle_increment", 0.25 * M_PI / 180.0);
 
+  // parameters for the point cloud of a lidar by raycasting
+  if (this->declare_parameter("use_lidar_raycasting", false)) {
+    const int channels = this->declare_parameter("lidar.channels", 32);
+    const double min_elevation =
+      this->declare_parameter("lidar.min_elevation", -25.0) * M_PI / 180.0;
+    const double max_elevation =
+      this->declare_parameter("lidar.max_elevation", 15.0) * M_PI / 180.0;
+    const double horizontal_resolution =
+      this->declare_parameter("lidar.horizontal_resolution", 0.2) * M_PI / 180.0;
+    const double min_range = this->declare_parameter("lidar.min_range", 0.5);
+    const bool add_ground_points = this->declare_parameter("lidar.add_ground_points", true);
+    const double mount_x = this->declare_parameter("lidar.mount_x", 0.0);
+    const double mount_y = this->declare_parameter("lidar.mount_y", 0.0);
+    const double mount_z = this->declare_parameter("lidar.mount_z", 2.0);
+    const double mount_yaw = this->declare_parameter("lidar.mount_yaw", 0.0);
+    tf2::Quaternion mount_quat;
+    mount_quat.setRPY(0.0, 0.0, mount_yaw);
+    const tf2::Transform tf_base_link2lidar(mount_quat, tf2::Vector3(mount_x, mount_y, mount_z));
+
+    // channels at even elevations from the lowest one
+    const double elevation_step =
+      channels > 1 ? (max_elevation - min_elevation) / static_cast<double>(channels - 1) : 0.0;
+    std::vector<double> elevations;
+    for (int channel = 0; channel < channels; ++channel) {
+      elevations.push_back(min_elevation + elevation_step * static_cast<double>(channel));
+    }
+    const auto azimuth_steps =
+      static_cast<size_t>(std::max(std::round(2.0 * M_PI / horizontal_resolution), 1.0));
+    lidar_pointcloud_creator_ = std::make_unique<LidarPointCloudCreator>(
+      lidar_raycaster::LidarRaycaster(
+        elevations, azimuth_steps, tf_base_link2lidar, min_range, visible_range_),
+      add_ground_points);
+  }
+
   if (use_fixed_random_seed) {
     random_generator_.seed(random_seed);
   } else {
@@ -175,9 +219,9 @@ DummyPerceptionPublisherNode::DummyPerceptionPublisherNode()
         "~/output/debug/ground_truth_objects", qos);
   }
 
-  using std::chrono_literals::operator""ms;
   timer_ = rclcpp::create_timer(
-    this, get_clock(), 100ms, std::bind(&DummyPerceptionPublisherNode::timerCallback, this));
+    this, get_clock(), timer_period,
+    std::bind(&DummyPerceptionPublisherNode::timerCallback, this));
 }
 
 void DummyPerceptionPublisherNode::timerCallback()
@@ -241,7 +285,11 @@ void DummyPerceptionPublisherNode::timerCallback()
   pcl::PointCloud<pcl::PointXYZ>::Ptr detected_merged_pointcloud_ptr(
     new pcl::PointCloud<pcl::PointXYZ>);
 
-  if (objects_.empty()) {
+  std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> lidar_pointclouds;
+  if (lidar_pointcloud_creator_) {
+    lidar_pointclouds = lidar_pointcloud_creator_->create_pointcloud(
+      obj_infos, tf_base_link2map, random_generator_, output_pointcloud_msg);
+  } else if (objects_.empty()) {
     pcl::toROSMsg(*merged_pointcloud_ptr, output_pointcloud_msg);
   } else {
     pointcloud_creator_->create_pointclouds(
@@ -256,8 +304,16 @@ void DummyPerceptionPublisherNode::timerCallback()
       detected_obj_infos.push_back(detected_obj_info);
     }
 
-    const auto pointclouds = pointcloud_creator_->create_pointclouds(
-      detected_obj_infos, tf_base_link2map, random_generator_, detected_merged_pointcloud_ptr);
+    std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> pointclouds;
+    if (lidar_pointcloud_creator_) {
+      // the clusters are taken from the scan of all the objects instead of another scan
+      for (const auto selected_idx : selected_indices) {
+        pointclouds.push_back(lidar_pointclouds.at(selected_idx));
+      }
+    } else {
+      pointclouds = pointcloud_creator_->create_pointclouds(
+        detected_obj_infos, tf_base_link2map, random_generator_, detected_merged_pointcloud_ptr);
+    }
 
     std::vector<size_t> delete_idxs;
     for (size_t i = 0; i < selected_indices.size(); ++i) {
@@ -0,0 +1,141 @@
+// Copyright 2024 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dummy_perception_publisher/lidar_raycaster.hpp"
+
+#include <gtest/gtest.h>
+#include <tf2/LinearMath/Quaternion.h>
+#include <tf2/LinearMath/Transform.h>
+#include <tf2/LinearMath/Vector3.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace lr = lidar_raycaster;
+
+namespace
+{
+// 360 columns of 1 degree, i.e. the column 180 looks along the x axis of the sensor
+constexpr size_t azimuth_steps = 360;
+constexpr size_t forward_column = 180;
+constexpr double eps = 1e-3;
+
+tf2::Transform createTransform(const double x, const double y, const double z, const double yaw)
+{
+  return tf2::Transform(tf2::Quaternion(tf2::Vector3(0.0, 0.0, 1.0), yaw), tf2::Vector3(x, y, z));
+}
+
+lr::LidarRaycaster createRaycaster(const std::vector<double> & elevations, const double z)
+{
+  return lr::LidarRaycaster(
+    elevations, azimuth_steps, createTransform(0.0, 0.0, z, 0.0), 0.5, 100.0);
+}
+
+lr::Target createTarget(
+  const lr::Shape shape, const double x, const double y, const double yaw, const double size)
+{
+  return lr::Target{shape, createTransform(x, y, 0.5 * size, yaw), size, size, size};
+}
+}  // namespace
+
+TEST(LidarRaycasterTest, Ground)
+{
+  const double elevation = -10.0 * M_PI / 180.0;
+  const auto raycaster = createRaycaster({elevation, 0.0}, 2.0);
+  lr::Scan scan;
+  raycaster.raycast({}, scan);
+  ASSERT_EQ(scan.ranges.size(), azimuth_steps * 2);
+  for (size_t column = 0; column < azimuth_steps; ++column) {
+    EXPECT_EQ(scan.target_indices.at(column * 2), lr::ground_target);
+    EXPECT_NEAR(scan.ranges.at(column * 2), 2.0 / std::sin(-elevation), eps);
+    EXPECT_NEAR(raycaster.getPoint(column * 2, scan.ranges.at(column * 2)).z(), 0.0, eps);
+    EXPECT_EQ(scan.target_indices.at(column * 2 + 1), lr::no_target);
+  }
+}
+
+TEST(LidarRaycasterTest, Box)
+{
+  const auto raycaster = createRaycaster({0.0}, 1.0);
+  lr::Scan scan;
+
+  // face, corner of a rotated box, and box behind the sensor at the azimuth -pi = pi
+  raycaster.raycast({createTarget(lr::Shape::BOX, 10.0, 0.0, 0.0, 2.0)}, scan);
+  EXPECT_EQ(scan.target_indices.at(forward_column), 0);
+  EXPECT_NEAR(scan.ranges.at(forward_column), 9.0, eps);
+  EXPECT_EQ(scan.target_indices.at(forward_column + 90), lr::no_target);
+
+  raycaster.raycast({createTarget(lr::Shape::BOX, 10.0, 0.0, M_PI / 4.0, 2.0)}, scan);
+  EXPECT_EQ(scan.target_indices.at(forward_column), 0);
+  EXPECT_NEAR(scan.ranges.at(forward_column), 10.0 - std::sqrt(2.0), eps);
+
+  raycaster.raycast({createTarget(lr::Shape::BOX, -10.0, 0.0, 0.0, 2.0)}, scan);
+  EXPECT_EQ(scan.target_indices.at(0), 0);
+  EXPECT_NEAR(scan.ranges.at(0), 9.0, eps);
+  EXPECT_EQ(scan.target_indices.at(1), 0);
+  EXPECT_EQ(scan.target_indices.at(azimuth_steps - 1), 0);
+  EXPECT_EQ(scan.target_indices.at(forward_column), lr::no_target);
+}
+
+TEST(LidarRaycasterTest, Cylinder)
+{
+  const auto raycaster = createRaycaster({0.0, -M_PI / 2.0}, 3.0);
+  lr::Scan scan;
+
+  // side at the height of the sensor
+  raycaster.raycast({createTarget(lr::Shape::CYLINDER, 10.0, 0.0, 0.0, 4.0)}, scan);
+  EXPECT_EQ(scan.target_indices.at(forward_column * 2), 0);
+  EXPECT_NEAR(scan.ranges.at(forward_column * 2), 8.0, eps);
+  // ray at the azimuth 10 [deg] crossing the circle of radius 2 centered at (10, 0)
+  const double azimuth = 10.0 * M_PI / 180.0;
+  const double b = 10.0 * std::cos(azimuth);
+  const double expected_range = b - std::sqrt(b * b - (100.0 - 4.0));
+  EXPECT_EQ(scan.target_indices.at((forward_column + 10) * 2), 0);
+  EXPECT_NEAR(scan.ranges.at((forward_column + 10) * 2), expected_range, eps);
+
+  // top cap below the sensor
+  raycaster.raycast({createTarget(lr::Shape::CYLINDER, 0.5, 0.0, 0.0, 2.0)}, scan);
+  EXPECT_EQ(scan.target_indices.at(forward_column * 2 + 1), 0);
+  EXPECT_NEAR(scan.ranges.at(forward_column * 2 + 1), 1.0, eps);
+}
+
+TEST(LidarRaycasterTest, Occlusion)
+{
+  const auto raycaster = createRaycaster({0.0, -M_PI / 6.0}, 1.0);
+  lr::Scan scan;
+  raycaster.raycast(
+    {createTarget(lr::Shape::BOX, 20.0, 0.0, 0.0, 2.0),
+     createTarget(lr::Shape::CYLINDER, 10.0, 0.0, 0.0, 2.0)},
+    scan);
+  EXPECT_EQ(scan.target_indices.at(forward_column * 2), 1);
+  EXPECT_NEAR(scan.ranges.at(forward_column * 2), 9.0, eps);
+  // the ground before the targets
+  EXPECT_EQ(scan.target_indices.at(forward_column * 2 + 1), lr::ground_target);
+  EXPECT_NEAR(scan.ranges.at(forward_column * 2 + 1), 2.0, eps);
+
+  // out of the range
+  raycaster.raycast({createTarget(lr::Shape::BOX, 200.0, 0.0, 0.0, 2.0)}, scan);
+  EXPECT_EQ(scan.target_indices.at(forward_column * 2), lr::no_target);
+}
+
+TEST(LidarRaycasterTest, InvalidPattern)
+{
+  EXPECT_THROW(createRaycaster({}, 1.0), std::invalid_argument);
+  EXPECT_THROW(
+    lr::LidarRaycaster({0.0}, 0, createTransform(0.0, 0.0, 1.0, 0.0), 0.5, 100.0),
+    std::invalid_argument);
+  EXPECT_THROW(
+    lr::LidarRaycaster({0.0}, 360, createTransform(0.0, 0.0, 1.0, 0.0), 10.0, 1.0),
+    std::invalid_argument);
+}
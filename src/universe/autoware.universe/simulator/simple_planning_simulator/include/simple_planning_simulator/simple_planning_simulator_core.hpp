@@ -42,6 +42,7 @@
 #include "geometry_msgs/msg/twist.hpp"
 #include "geometry_msgs/msg/twist_stamped.hpp"
 #include "nav_msgs/msg/odometry.hpp"
+#include "rosgraph_msgs/msg/clock.hpp"
 #include "sensor_msgs/msg/imu.hpp"
 #include "tier4_external_api_msgs/srv/initialize_pose.hpp"
 #include "tier4_vehicle_msgs/msg/actuation_command_stamped.hpp"
@@ -51,7 +52,9 @@
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <random>
 #include <string>
 #include <variant>
@@ -84,6 +87,7 @@ using geometry_msgs::msg::TransformStamped;
 using geometry_msgs::msg::Twist;
 using geometry_msgs::msg::TwistStamped;
 using nav_msgs::msg::Odometry;
+using rosgraph_msgs::msg::Clock;
 using sensor_msgs::msg::Imu;
 using tier4_external_api_msgs::srv::InitializePose;
 using tier4_vehicle_msgs::msg::ActuationCommandStamped;
@@ -141,6 +145,7 @@ private:
   rclcpp::Publisher<tf2_msgs::msg::TFMessage>::SharedPtr pub_tf_;
   rclcpp::Publisher<PoseWithCovarianceStamped>::SharedPtr pub_current_pose_;
   rclcpp::Publisher<ActuationStatusStamped>::SharedPtr pub_actuation_status_;
+  rclcpp::Publisher<Clock>::SharedPtr pub_clock_;
 
   rclcpp::Subscription<GearCommand>::SharedPtr sub_gear_cmd_;
   rclcpp::Subscription<GearCommand>::SharedPtr sub_manual_gear_cmd_;
@@ -165,6 +170,13 @@ private:
   uint32_t timer_sampling_time_ms_;        //!< @brief timer sampling time
   rclcpp::TimerBase::SharedPtr on_timer_;  //!< @brief timer for simulation
 
+  /* lockstep */
+  bool enable_lockstep_ = false;  //!< @brief flag to step the simulation with the control commands
+  std::chrono::milliseconds lockstep_command_timeout_{};  //!< @brief wall time to wait a command
+  rclcpp::Time lockstep_time_{0, 0, RCL_ROS_TIME};  //!< @brief simulation time published to /clock
+  std::optional<rclcpp::Time> last_command_stamp_{};  //!< @brief stamp of the last command
+  std::chrono::steady_clock::time_point last_lockstep_wall_time_{};  //!< @brief wall time of step
+
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
   rcl_interfaces::msg::SetParametersResult on_parameter(
     const std::vector<rclcpp::Parameter> & parameters);
@@ -314,6 +326,28 @@ private:
    */
   void on_timer();
 
+  /**
+   * @brief time of the simulation, i.e. the time published to /clock in the lockstep mode
+   */
+  rclcpp::Time get_current_time();
+
+  /**
+   * @brief record the stamp of an autonomous control command and advance the lockstep simulation
+   * @param [in] stamp stamp of the command
+   */
+  void on_command_stamp(const rclcpp::Time & stamp);
+
+  /**
+   * @brief advance the lockstep simulation by one step if the command of the current step has
+   * arrived or the wait for it has timed out, or in real time before the first command
+   */
+  void advance_lockstep_if_ready();
+
+  /**
+   * @brief simulate one step of timer_sampling_time_ms and publish the new time to /clock
+   */
+  void advance_lockstep();
+
   /**
    * @brief initialize vehicle_model_ptr
    */
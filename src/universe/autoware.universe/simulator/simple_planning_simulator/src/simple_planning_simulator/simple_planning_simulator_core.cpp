@@ -151,12 +151,17 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
     current_input_command_ = ActuationCommandStamped();
     sub_actuation_cmd_ = create_subscription<ActuationCommandStamped>(
       "input/actuation_command", QoS{1},
-      [this](const ActuationCommandStamped::ConstSharedPtr msg) { current_input_command_ = *msg; });
+      [this](const ActuationCommandStamped::ConstSharedPtr msg) {
+        current_input_command_ = *msg;
+        on_command_stamp(msg->header.stamp);
+      });
   } else {  // default command type is ACKERMANN
     current_input_command_ = Control();
     sub_ackermann_cmd_ = create_subscription<Control>(
-      "input/ackermann_control_command", QoS{1},
-      [this](const Control::ConstSharedPtr msg) { current_input_command_ = *msg; });
+      "input/ackermann_control_command", QoS{1}, [this](const Control::ConstSharedPtr msg) {
+        current_input_command_ = *msg;
+        on_command_stamp(msg->stamp);
+      });
   }
 
   pub_control_mode_report_ =
@@ -183,9 +188,21 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
     std::bind(&SimplePlanningSimulator::on_parameter, this, _1));
 
   timer_sampling_time_ms_ = static_cast<uint32_t>(declare_parameter("timer_sampling_time_ms", 25));
-  on_timer_ = rclcpp::create_timer(
-    this, get_clock(), std::chrono::milliseconds(timer_sampling_time_ms_),
-    std::bind(&SimplePlanningSimulator::on_timer, this));
+  enable_lockstep_ = declare_parameter("enable_lockstep", false);
+  if (enable_lockstep_) {
+    // the simulator owns /clock and the other nodes are expected to use the simulation time
+    lockstep_command_timeout_ =
+      std::chrono::milliseconds(declare_parameter("lockstep_command_timeout_ms", 100));
+    lockstep_time_ = rclcpp::Time(rclcpp::Clock(RCL_SYSTEM_TIME).now().nanoseconds(), RCL_ROS_TIME);
+    last_lockstep_wall_time_ = std::chrono::steady_clock::now();
+    pub_clock_ = create_publisher<Clock>("/clock", rclcpp::ClockQoS());
+    on_timer_ = create_wall_timer(
+      1ms, std::bind(&SimplePlanningSimulator::advance_lockstep_if_ready, this));
+  } else {
+    on_timer_ = rclcpp::create_timer(
+      this, get_clock(), std::chrono::milliseconds(timer_sampling_time_ms_),
+      std::bind(&SimplePlanningSimulator::on_timer, this));
+  }
 
   tier4_api_utils::ServiceProxyNodeInterface proxy(this);
   group_api_service_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
@@ -432,7 +449,7 @@ void SimplePlanningSimulator::on_timer()
 
   // update vehicle dynamics
   {
-    const double dt = delta_time_.get_dt(get_clock()->now());
+    const double dt = delta_time_.get_dt(get_current_time());
 
     if (current_control_mode_.mode == ControlModeReport::AUTONOMOUS) {
       vehicle_model_ptr_->setGear(current_gear_cmd_.command);
@@ -489,6 +506,53 @@ void SimplePlanningSimulator::on_timer()
   }
 }
 
+rclcpp::Time SimplePlanningSimulator::get_current_time()
+{
+  return enable_lockstep_ ? lockstep_time_ : get_clock()->now();
+}
+
+void SimplePlanningSimulator::on_command_stamp(const rclcpp::Time & stamp)
+{
+  if (!enable_lockstep_) {
+    return;
+  }
+  last_command_stamp_ = stamp;
+  advance_lockstep_if_ready();
+}
+
+void SimplePlanningSimulator::advance_lockstep_if_ready()
+{
+  const auto elapsed_wall_time = std::chrono::steady_clock::now() - last_lockstep_wall_time_;
+  if (!last_command_stamp_) {
+    // the controller is not running yet, so that the other nodes start up in real time
+    if (elapsed_wall_time < std::chrono::milliseconds(timer_sampling_time_ms_)) {
+      return;
+    }
+  } else if (*last_command_stamp_ < lockstep_time_) {
+    // wait for the command calculated with the state of the current step
+    if (elapsed_wall_time < lockstep_command_timeout_) {
+      return;
+    }
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 5000,
+      "control command of the step at %.3f [s] timed out, the last command is used",
+      lockstep_time_.seconds());
+  }
+  advance_lockstep();
+}
+
+void SimplePlanningSimulator::advance_lockstep()
+{
+  lockstep_time_ += rclcpp::Duration(std::chrono::milliseconds(timer_sampling_time_ms_));
+  on_timer();
+
+  // publish the time after the state so that the nodes triggered by the time see the new state
+  Clock clock;
+  clock.clock = lockstep_time_;
+  pub_clock_->publish(clock);
+  last_lockstep_wall_time_ = std::chrono::steady_clock::now();
+}
+
 void SimplePlanningSimulator::on_map(const LaneletMapBin::ConstSharedPtr msg)
 {
   auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
@@ -768,7 +832,7 @@ TransformStamped SimplePlanningSimulator::get_transform_msg(
 void SimplePlanningSimulator::publish_velocity(const VelocityReport & velocity)
 {
   VelocityReport msg = velocity;
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   msg.header.frame_id = simulated_frame_id_;
   pub_velocity_->publish(msg);
 }
@@ -777,7 +841,7 @@ void SimplePlanningSimulator::publish_odometry(const Odometry & odometry)
 {
   Odometry msg = odometry;
   msg.header.frame_id = origin_frame_id_;
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   msg.child_frame_id = simulated_frame_id_;
   pub_odom_->publish(msg);
 }
@@ -798,14 +862,14 @@ void SimplePlanningSimulator::publish_pose(const Odometry & odometry)
   msg.pose.covariance.at(COV_IDX::YAW_YAW) = COV_ANGLE;
 
   msg.header.frame_id = origin_frame_id_;
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   pub_current_pose_->publish(msg);
 }
 
 void SimplePlanningSimulator::publish_steering(const SteeringReport & steer)
 {
   SteeringReport msg = steer;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   pub_steer_->publish(msg);
 }
 
@@ -813,7 +877,7 @@ void SimplePlanningSimulator::publish_acceleration()
 {
   AccelWithCovarianceStamped msg;
   msg.header.frame_id = "/base_link";
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   msg.accel.accel.linear.x = vehicle_model_ptr_->getAx();
   msg.accel.accel.linear.y = vehicle_model_ptr_->getWz() * vehicle_model_ptr_->getVx();
 
@@ -834,7 +898,7 @@ void SimplePlanningSimulator::publish_imu()
 
   sensor_msgs::msg::Imu imu;
   imu.header.frame_id = "base_link";
-  imu.header.stamp = now();
+  imu.header.stamp = get_current_time();
   imu.linear_acceleration.x = vehicle_model_ptr_->getAx();
   imu.linear_acceleration.y = vehicle_model_ptr_->getWz() * vehicle_model_ptr_->getVx();
   constexpr auto COV = 0.001;
@@ -854,14 +918,14 @@ void SimplePlanningSimulator::publish_imu()
 
 void SimplePlanningSimulator::publish_control_mode_report()
 {
-  current_control_mode_.stamp = get_clock()->now();
+  current_control_mode_.stamp = get_current_time();
   pub_control_mode_report_->publish(current_control_mode_);
 }
 
 void SimplePlanningSimulator::publish_gear_report()
 {
   GearReport msg;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   msg.report = vehicle_model_ptr_->getGear();
   pub_gear_report_->publish(msg);
 }
@@ -872,7 +936,7 @@ void SimplePlanningSimulator::publish_turn_indicators_report()
     return;
   }
   TurnIndicatorsReport msg;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   msg.report = current_turn_indicators_cmd_ptr_->command;
   pub_turn_indicators_report_->publish(msg);
 }
@@ -883,7 +947,7 @@ void SimplePlanningSimulator::publish_hazard_lights_report()
     return;
   }
   HazardLightsReport msg;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   msg.report = current_hazard_lights_cmd_ptr_->command;
   pub_hazard_lights_report_->publish(msg);
 }
@@ -891,7 +955,7 @@ void SimplePlanningSimulator::publish_hazard_lights_report()
 void SimplePlanningSimulator::publish_tf(const Odometry & odometry)
 {
   TransformStamped tf;
-  tf.header.stamp = get_clock()->now();
+  tf.header.stamp = get_current_time();
   tf.header.frame_id = origin_frame_id_;
   tf.child_frame_id = simulated_frame_id_;
   tf.transform.translation.x = odometry.pose.pose.position.x;
@@ -911,7 +975,7 @@ void SimplePlanningSimulator::publish_actuation_status()
     return;
   }
 
-  actuation_status.value().header.stamp = get_clock()->now();
+  actuation_status.value().header.stamp = get_current_time();
   actuation_status.value().header.frame_id = simulated_frame_id_;
   pub_actuation_status_->publish(actuation_status.value());
 }
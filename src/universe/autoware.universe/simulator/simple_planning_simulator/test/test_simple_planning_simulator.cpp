@@ -25,7 +25,11 @@
 #include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
 #endif
 
+#include "rosgraph_msgs/msg/clock.hpp"
+
+#include <chrono>
 #include <memory>
+#include <thread>
 
 using autoware_control_msgs::msg::Control;
 using autoware_vehicle_msgs::msg::GearCommand;
@@ -445,3 +449,61 @@ INSTANTIATE_TEST_SUITE_P(
     /* Actuation type */
     std::make_tuple(CommandType::Actuation, "ACTUATION_CMD", "steer_map"),
     std::make_tuple(CommandType::Actuation, "ACTUATION_CMD", "vgr")));
+
+// Send a control command for each step of the lockstep simulation.
+// Then check if the simulation time advances only at the commands.
+TEST(TestSimplePlanningSimulatorLockstep, TestAdvanceAtCommand)
+{
+  rclcpp::init(0, nullptr);
+
+  constexpr int sampling_time_ms = 25;
+  rclcpp::NodeOptions node_options;
+  node_options.append_parameter_override("initialize_source", "ORIGIN");
+  node_options.append_parameter_override("vehicle_model_type", "IDEAL_STEER_VEL");
+  node_options.append_parameter_override("initial_engage_state", true);
+  node_options.append_parameter_override("add_measurement_noise", false);
+  node_options.append_parameter_override("timer_sampling_time_ms", sampling_time_ms);
+  node_options.append_parameter_override("enable_lockstep", true);
+  node_options.append_parameter_override("lockstep_command_timeout_ms", 10000);
+  declareVehicleInfoParams(node_options);
+  const auto sim_node = std::make_shared<SimplePlanningSimulator>(node_options);
+
+  const auto pub_sub_node = std::make_shared<PubSubNode>();
+  rosgraph_msgs::msg::Clock::ConstSharedPtr current_clock;
+  const auto clock_sub = pub_sub_node->create_subscription<rosgraph_msgs::msg::Clock>(
+    "/clock", rclcpp::ClockQoS(),
+    [&current_clock](const rosgraph_msgs::msg::Clock::ConstSharedPtr msg) { current_clock = msg; });
+
+  const auto spin_for = [&](const std::chrono::milliseconds duration) {
+    const auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+      rclcpp::spin_some(sim_node);
+      rclcpp::spin_some(pub_sub_node);
+      std::this_thread::sleep_for(std::chrono::milliseconds{1LL});
+    }
+  };
+
+  // the simulation runs in real time until the first command
+  spin_for(std::chrono::milliseconds{500LL});
+  ASSERT_TRUE(current_clock);
+  ASSERT_TRUE(pub_sub_node->current_odom_);
+
+  // the first command stops the real time steps, and may be older than the step at its arrival
+  pub_sub_node->pub_ackermann_command_->publish(
+    ackermannCmdGen(current_clock->clock, Ackermann{0.0, 0.0, 1.0, 1.0, 0.0}));
+  spin_for(std::chrono::milliseconds{100LL});
+
+  const rclcpp::Duration sampling_time(std::chrono::milliseconds(sampling_time_ms));
+  for (int i = 0; i < 10; ++i) {
+    const rclcpp::Time step_time(current_clock->clock);
+    pub_sub_node->pub_ackermann_command_->publish(
+      ackermannCmdGen(current_clock->clock, Ackermann{0.0, 0.0, 1.0, 1.0, 0.0}));
+    spin_for(std::chrono::milliseconds{100LL});
+
+    // one step at the command and no step without the next command
+    EXPECT_EQ(rclcpp::Time(current_clock->clock), step_time + sampling_time);
+    EXPECT_EQ(rclcpp::Time(pub_sub_node->current_odom_->header.stamp), step_time + sampling_time);
+  }
+
+  rclcpp::shutdown();
+}
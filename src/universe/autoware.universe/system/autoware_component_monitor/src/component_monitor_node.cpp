@@ -20,53 +20,44 @@
 
 #include <autoware_internal_msgs/msg/resource_usage_report.hpp>
 
-#include <boost/process.hpp>
+#include <unistd.h>
 
-#include <cctype>
+#include <algorithm>
 #include <cstdint>
 #include <exception>
-#include <functional>
-#include <sstream>
+#include <stdexcept>
 #include <string>
-#include <unordered_map>
-#include <utility>
-#include <vector>
 
 namespace autoware::component_monitor
 {
 ComponentMonitor::ComponentMonitor(const rclcpp::NodeOptions & node_options)
-: Node("component_monitor", node_options), publish_rate_(declare_parameter<double>("publish_rate"))
+: Node("component_monitor", node_options),
+  publish_rate_(declare_parameter<double>("publish_rate")),
+  process_sampler_(getpid()),
+  num_cpus_(std::max<std::int64_t>(sysconf(_SC_NPROCESSORS_ONLN), 1))
 {
   usage_pub_ =
     create_publisher<ResourceUsageReport>("~/component_system_usage", rclcpp::SensorDataQoS());
 
-  // Make sure top ins installed and is in path
-  const auto path_top = boost::process::search_path("top");
-  if (path_top.empty()) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Couldn't find 'top' in path.");
-    rclcpp::shutdown();
+  // Take the first sample of the CPU time
+  try {
+    create_report();
+  } catch (std::exception & e) {
+    RCLCPP_ERROR(get_logger(), "%s", e.what());
   }
 
-  // Get the PID of the current process
-  int pid = getpid();
-
-  environment_ = boost::this_process::environment();
-  environment_["LC_NUMERIC"] = "en_US.UTF-8";
-
-  on_timer_tick_wrapped_ = std::bind(&ComponentMonitor::on_timer_tick, this, pid);
-
   timer_ = rclcpp::create_timer(
-    this, get_clock(), rclcpp::Rate(publish_rate_).period(), on_timer_tick_wrapped_);
+    this, get_clock(), rclcpp::Rate(publish_rate_).period(), [this]() { on_timer_tick(); });
 }
 
-void ComponentMonitor::on_timer_tick(const int pid) const
+void ComponentMonitor::on_timer_tick()
 {
   if (usage_pub_->get_subscription_count() == 0) return;
 
   try {
-    auto usage_msg = pid_to_report(pid);
+    auto usage_msg = create_report();
     usage_msg.header.stamp = this->now();
-    usage_msg.pid = pid;
+    usage_msg.pid = process_sampler_.pid();
     usage_pub_->publish(usage_msg);
   } catch (std::exception & e) {
     RCLCPP_ERROR(get_logger(), "%s", e.what());
@@ -75,100 +66,38 @@ void ComponentMonitor::on_timer_tick(const int pid) const
   }
 }
 
-ComponentMonitor::ResourceUsageReport ComponentMonitor::pid_to_report(const pid_t & pid) const
+ComponentMonitor::ResourceUsageReport ComponentMonitor::create_report()
 {
-  const auto std_out = run_system_command("top -b -n 1 -E k -p " + std::to_string(pid));
-
-  const auto fields = parse_lines_into_words(std_out);
-
-  ResourceUsageReport report;
-  report.cpu_cores_utilized = std::stof(fields.back().at(8)) / 100.0f;
-  report.total_memory_bytes = unit_conversions::kib_to_bytes(std::stoul(fields.at(3).at(3)));
-  report.free_memory_bytes = unit_conversions::kib_to_bytes(std::stoul(fields.at(3).at(5)));
-  report.process_memory_bytes = parse_memory_res(fields.back().at(5));
-
-  return report;
-}
-
-std::stringstream ComponentMonitor::run_system_command(const std::string & cmd) const
-{
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Error setting flags on out_fd");
+  universe_utils::ProcessStat process_stat;
+  universe_utils::ProcessMemory process_memory;
+  universe_utils::CpuTimes cpu_times;
+  universe_utils::MemoryInfo memory_info;
+  if (!process_sampler_.read_stat(process_stat) || !process_sampler_.read_memory(process_memory)) {
+    throw std::runtime_error("Failed to read /proc/" + std::to_string(process_sampler_.pid()));
   }
-  boost::process::pipe out_pipe{out_fd[0], out_fd[1]};
-  boost::process::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Error setting flags on err_fd");
+  if (!system_sampler_.read_cpu_times(cpu_times)) {
+    throw std::runtime_error("Failed to read /proc/stat");
   }
-  boost::process::pipe err_pipe{err_fd[0], err_fd[1]};
-  boost::process::ipstream is_err{std::move(err_pipe)};
-
-  boost::process::child c(
-    cmd, environment_, boost::process::std_out > is_out, boost::process::std_err > is_err);
-  c.wait();
-
-  if (c.exit_code() != 0) {
-    std::ostringstream os;
-    is_err >> os.rdbuf();
-    RCLCPP_ERROR_STREAM(get_logger(), "Error running command: " << os.str());
+  if (!system_sampler_.read_memory_info(memory_info)) {
+    throw std::runtime_error("Failed to read /proc/meminfo");
   }
 
-  std::stringstream sstream;
-  sstream << is_out.rdbuf();
-  return sstream;
-}
-
-ComponentMonitor::VecVecStr ComponentMonitor::parse_lines_into_words(
-  const std::stringstream & std_out)
-{
-  VecVecStr fields;
-  std::string line;
-  std::istringstream input{std_out.str()};
-
-  while (std::getline(input, line)) {
-    std::istringstream iss_line{line};
-    std::string word;
-    std::vector<std::string> words;
-
-    while (iss_line >> word) {
-      words.push_back(word);
-    }
-
-    fields.push_back(words);
-  }
-
-  return fields;
-}
-
-std::uint64_t ComponentMonitor::parse_memory_res(const std::string & mem_res)
-{
-  // example 1: 12.3g
-  // example 2: 123 (without suffix, just bytes)
-  static const std::unordered_map<char, std::function<std::uint64_t(double)>> unit_map{
-    {'k', unit_conversions::kib_to_bytes<double>}, {'m', unit_conversions::mib_to_bytes<double>},
-    {'g', unit_conversions::gib_to_bytes<double>}, {'t', unit_conversions::tib_to_bytes<double>},
-    {'p', unit_conversions::pib_to_bytes<double>}, {'e', unit_conversions::eib_to_bytes<double>}};
-
-  if (std::isdigit(mem_res.back())) {
-    return std::stoull(mem_res);  // Handle plain bytes without any suffix
-  }
+  // Elapsed time in clock ticks of one CPU
+  const auto process_ticks = process_stat.cpu_ticks() - last_process_ticks_;
+  const auto elapsed_ticks =
+    static_cast<double>(cpu_times.total() - last_total_ticks_) / static_cast<double>(num_cpus_);
+  last_process_ticks_ = process_stat.cpu_ticks();
+  last_total_ticks_ = cpu_times.total();
 
-  // Extract the numeric part and the unit suffix
-  double value = std::stod(mem_res.substr(0, mem_res.size() - 1));
-  char suffix = mem_res.back();
-
-  // Find the appropriate function from the map
-  auto it = unit_map.find(suffix);
-  if (it != unit_map.end()) {
-    const auto & conversion_function = it->second;
-    return conversion_function(value);
-  }
+  ResourceUsageReport report;
+  report.cpu_cores_utilized =
+    0.0 < elapsed_ticks ? static_cast<float>(process_ticks / elapsed_ticks) : 0.0f;
+  report.total_memory_bytes = unit_conversions::kib_to_bytes(memory_info.total_kib);
+  report.free_memory_bytes = unit_conversions::kib_to_bytes(memory_info.free_kib);
+  report.process_memory_bytes =
+    process_memory.resident_pages * static_cast<std::uint64_t>(universe_utils::page_size_bytes());
 
-  // Throw an exception or handle the error as needed if the suffix is not recognized
-  throw std::runtime_error("Unsupported unit suffix: " + std::string(1, suffix));
+  return report;
 }
 
 }  // namespace autoware::component_monitor
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 TIER IV, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Reconstruct the end-to-end latency of each sensor frame from latency trace files.
+
+The trace files are written by autoware::universe_utils::LatencyTracer when the environment
+variable AUTOWARE_LATENCY_TRACE_DIR is set. Each line is one execution of a stage which consumed
+the message input_id and produced the message output_id, where the ids are header stamps.
+A message is available to its consumers from publish_ns, which is before the end of the execution
+when the node does more work after publishing, e.g. publishes debug topics.
+"""
+
+import argparse
+import bisect
+from collections import defaultdict
+import csv
+import glob
+import os
+
+
+class Execution:
+    def __init__(self, stage, output_id, start_ns, publish_ns):
+        self.stage = stage
+        self.output_id = output_id
+        self.start_ns = start_ns
+        self.publish_ns = publish_ns
+        self.input_ids = []
+        # The newest source frame this execution depends on, and the producer on the way to it.
+        self.frame = None
+        self.parent = None
+
+
+def load_executions(paths):
+    executions = {}
+    for path in paths:
+        with open(path) as f:
+            for row in csv.DictReader(f):
+                key = (row["stage"], row["output_id"], row["start_ns"], row["publish_ns"], path)
+                if key not in executions:
+                    executions[key] = Execution(
+                        row["stage"],
+                        int(row["output_id"]),
+                        int(row["start_ns"]),
+                        int(row["publish_ns"]),
+                    )
+                executions[key].input_ids.append(int(row["input_id"]))
+    return sorted(executions.values(), key=lambda e: e.publish_ns)
+
+
+class ProducerIndex:
+    """Find the execution which produced a message before it was consumed."""
+
+    def __init__(self, executions):
+        self.producers = defaultdict(list)
+        for execution in executions:
+            self.producers[execution.output_id].append(execution)
+        self.publish_times = {
+            output_id: [e.publish_ns for e in producers]
+            for output_id, producers in self.producers.items()
+        }
+
+    def find(self, input_id, consumer):
+        # Nodes which keep the stamp produce the same id, so take the latest one of another stage
+        # which published before the consumer started.
+        producers = self.producers.get(input_id, [])
+        index = bisect.bisect_right(self.publish_times.get(input_id, []), consumer.start_ns)
+        for producer in reversed(producers[:index]):
+            if producer.stage != consumer.stage:
+                return producer
+        return None
+
+
+def link_frames(executions, index, source):
+    # The executions are sorted by the publish time, so the producers are visited first.
+    for execution in executions:
+        for input_id in execution.input_ids:
+            if execution.stage == source:
+                producer, frame = None, input_id
+            else:
+                producer = index.find(input_id, execution)
+                if producer is not None:
+                    frame = producer.frame
+                else:
+                    frame = input_id if source is None else None
+            if frame is not None and (execution.frame is None or execution.frame < frame):
+                execution.frame = frame
+                execution.parent = producer
+
+
+def critical_path(sink_execution):
+    path = []
+    execution = sink_execution
+    while execution is not None:
+        path.append(execution)
+        execution = execution.parent
+    return list(reversed(path))
+
+
+def percentile(values, ratio):
+    if not values:
+        return float("nan")
+    values = sorted(values)
+    return values[min(len(values) - 1, max(0, int(round(ratio * len(values))) - 1))]
+
+
+def format_ms(ns):
+    return f"{ns / 1e6:9.3f}"
+
+
+def print_table(title, rows):
+    print(title)
+    name_width = max([len("stage")] + [len(name) for name, _ in rows])
+    print(f"  {'stage':<{name_width}}  {'count':>7}  {'p50':>9}  {'p99':>9}  {'p99.9':>9}  [ms]")
+    for name, values in rows:
+        print(
+            f"  {name:<{name_width}}  {len(values):>7}  {format_ms(percentile(values, 0.5))}  "
+            f"{format_ms(percentile(values, 0.99))}  {format_ms(percentile(values, 0.999))}"
+        )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("traces", nargs="+", help="trace files or directories of them")
+    parser.add_argument("--source", help="first stage, e.g. the crop box filter of the lidar")
+    parser.add_argument("--sink", help="last stage, e.g. /control/trajectory_follower/controller")
+    parser.add_argument("--worst", type=int, default=5, help="number of worst frames to show")
+    parser.add_argument(
+        "--from-stamp",
+        action="store_true",
+        help="measure from the stamp of the source message, which must be the system time",
+    )
+    args = parser.parse_args()
+
+    paths = []
+    for trace in args.traces:
+        if os.path.isdir(trace):
+            paths += sorted(glob.glob(os.path.join(trace, "latency_trace_*.csv")))
+        else:
+            paths.append(trace)
+    executions = load_executions(paths)
+    if not executions:
+        print("No events are found.")
+        return
+
+    index = ProducerIndex(executions)
+    link_frames(executions, index, args.source)
+
+    # By default, the sink is the stages whose outputs are not consumed by any traced stage.
+    consumed_stages = {e.parent.stage for e in executions if e.parent is not None}
+    if args.sink:
+        sinks = [e for e in executions if e.stage == args.sink]
+    else:
+        sinks = [e for e in executions if e.stage not in consumed_stages]
+
+    # A frame reaches the sink when the first sink execution depends on it.
+    frames = {}
+    for execution in sinks:
+        if execution.frame is not None and execution.frame not in frames:
+            frames[execution.frame] = critical_path(execution)
+    if not frames:
+        print("No frame reaches the sink. Check --source and --sink.")
+        return
+
+    stage_order = []
+    processing = defaultdict(list)
+    latency = defaultdict(list)
+    end_to_end = []
+    for frame, path in frames.items():
+        origin = frame if args.from_stamp else path[0].start_ns
+        previous_publish = origin
+        for execution in path:
+            if execution.stage not in processing:
+                stage_order.append(execution.stage)
+            processing[execution.stage].append(execution.publish_ns - execution.start_ns)
+            latency[execution.stage].append(execution.publish_ns - previous_publish)
+            previous_publish = execution.publish_ns
+        end_to_end.append((path[-1].publish_ns - origin, frame))
+
+    print(f"{len(executions)} executions, {len(frames)} frames\n")
+    print_table(
+        "Processing time of each stage on the critical path:",
+        [(stage, processing[stage]) for stage in stage_order],
+    )
+    print()
+    print_table(
+        "Latency of each stage including the wait for the previous stage:",
+        [(stage, latency[stage]) for stage in stage_order],
+    )
+    print()
+    print_table("End-to-end latency:", [("total", [total for total, _ in end_to_end])])
+
+    # Find the stage which exceeds its median the most in each frame above the 99th percentile.
+    threshold = percentile([total for total, _ in end_to_end], 0.99)
+    medians = {stage: percentile(latency[stage], 0.5) for stage in stage_order}
+    culprits = defaultdict(int)
+    for total, frame in end_to_end:
+        if total < threshold:
+            continue
+        path = frames[frame]
+        excess = []
+        previous_publish = frame if args.from_stamp else path[0].start_ns
+        for execution in path:
+            excess.append(
+                (execution.publish_ns - previous_publish - medians[execution.stage], execution)
+            )
+            previous_publish = execution.publish_ns
+        culprits[max(excess, key=lambda item: item[0])[1].stage] += 1
+    print("\nStage exceeding its median the most in frames above p99:")
+    for stage, count in sorted(culprits.items(), key=lambda item: -item[1]):
+        print(f"  {stage}: {count}")
+
+    print(f"\nCritical paths of the {args.worst} worst frames:")
+    for total, frame in sorted(end_to_end, reverse=True)[: args.worst]:
+        print(f"  frame {frame}: {total / 1e6:.3f} ms")
+        previous_publish = frame if args.from_stamp else frames[frame][0].start_ns
+        for execution in frames[frame]:
+            wait_ns = execution.start_ns - previous_publish
+            processing_ns = execution.publish_ns - execution.start_ns
+            print(
+                f"    {execution.stage}: wait {wait_ns / 1e6:.3f} ms, "
+                f"processing {processing_ns / 1e6:.3f} ms"
+            )
+            previous_publish = execution.publish_ns
+
+
+if __name__ == "__main__":
+    main()
@@ -19,6 +19,8 @@
 #include "loader.hpp"
 #include "units.hpp"
 
+#include <algorithm>
+#include <optional>
 #include <unordered_map>
 
 namespace diagnostic_graph_aggregator
@@ -35,21 +37,117 @@ void Graph::create(const std::string & file, const std::string & id)
   for (const auto & diag : diags_) units_.push_back(diag.get());
 
   id_ = id;
+
+  // Rank the nodes by the longest path to the leaves. The graph is known to be acyclic here.
+  std::vector<std::optional<size_t>> ranks(nodes_.size());
+  const std::function<size_t(const BaseUnit *)> rank = [&](const BaseUnit * unit) -> size_t {
+    if (unit->is_leaf()) return 0;
+    auto & result = ranks.at(unit->index());
+    if (!result) {
+      size_t max_child_rank = 0;
+      for (const auto & link : unit->child_links()) {
+        max_child_rank = std::max(max_child_rank, rank(link->child()) + 1);
+      }
+      result = max_child_rank;
+    }
+    return result.value();
+  };
+  size_t max_rank = 0;
+  for (const auto & node : nodes_) {
+    node_ranks_.push_back(rank(node.get()));
+    max_rank = std::max(max_rank, node_ranks_.back());
+  }
+  dirty_nodes_.resize(max_rank + 1);
+  is_node_dirty_.resize(nodes_.size(), false);
+  is_node_changed_.resize(nodes_.size(), false);
+  is_diag_changed_.resize(diags_.size(), false);
+  is_diag_queued_.resize(diags_.size(), false);
+
+  // Evaluate all nodes once.
+  for (const auto & node : nodes_) {
+    is_node_dirty_[node->index()] = true;
+    dirty_nodes_[node_ranks_[node->index()]].push_back(node.get());
+  }
+  evaluate_dirty_nodes();
 }
 
 void Graph::update(const rclcpp::Time & stamp)
 {
-  for (const auto & diag : diags_) diag->on_time(stamp);
+  // Check only the diags whose deadline has passed instead of all diags.
+  const auto nanoseconds = stamp.nanoseconds();
+  while (!deadlines_.empty() && deadlines_.top().first < nanoseconds) {
+    const auto diag = diags_[deadlines_.top().second].get();
+    deadlines_.pop();
+    is_diag_queued_[diag->index()] = false;
+    if (diag->on_time(stamp)) {
+      on_diag_changed(diag);
+    } else {
+      // The diag has been updated after the deadline was queued.
+      queue_deadline(diag, nanoseconds + 1);
+    }
+  }
 }
 
 bool Graph::update(const rclcpp::Time & stamp, const DiagnosticStatus & status)
 {
   const auto iter = names_.find(status.name);
   if (iter == names_.end()) return false;
-  iter->second->on_diag(stamp, status);
+  const auto diag = iter->second;
+  if (diag->on_diag(stamp, status)) {
+    on_diag_changed(diag);
+  }
+  queue_deadline(diag, 0);
   return true;
 }
 
+void Graph::on_diag_changed(DiagUnit * diag)
+{
+  if (!is_diag_changed_[diag->index()]) {
+    is_diag_changed_[diag->index()] = true;
+    changed_diags_.push_back(diag->index());
+  }
+  if (diag->update()) {
+    mark_parents_dirty(diag);
+    evaluate_dirty_nodes();
+  }
+}
+
+void Graph::mark_parents_dirty(const BaseUnit * unit)
+{
+  for (const auto & link : unit->parent_links()) {
+    const auto index = link->parent()->index();
+    if (is_node_dirty_[index]) continue;
+    is_node_dirty_[index] = true;
+    dirty_nodes_[node_ranks_[index]].push_back(nodes_[index].get());
+  }
+}
+
+void Graph::evaluate_dirty_nodes()
+{
+  // The parents have higher ranks, so the current rank is not extended while iterating.
+  for (auto & nodes : dirty_nodes_) {
+    for (const auto node : nodes) {
+      is_node_dirty_[node->index()] = false;
+      if (!node->update()) continue;
+      if (!is_node_changed_[node->index()]) {
+        is_node_changed_[node->index()] = true;
+        changed_nodes_.push_back(node->index());
+      }
+      mark_parents_dirty(node);
+    }
+    nodes.clear();
+  }
+}
+
+void Graph::queue_deadline(DiagUnit * diag, int64_t min_nanoseconds)
+{
+  if (is_diag_queued_[diag->index()]) return;
+  const auto deadline = diag->deadline();
+  if (!deadline) return;
+  is_diag_queued_[diag->index()] = true;
+  deadlines_.emplace(std::max(deadline->nanoseconds(), min_nanoseconds), diag->index());
+}
+
 DiagGraphStruct Graph::create_struct(const rclcpp::Time & stamp) const
 {
   DiagGraphStruct msg;
@@ -72,6 +170,34 @@ DiagGraphStatus Graph::create_status(const rclcpp::Time & stamp) const
   return msg;
 }
 
+DiagGraphStatusDelta Graph::create_delta(const rclcpp::Time & stamp)
+{
+  // Note: the link status is not included since it does not change at runtime.
+  DiagGraphStatusDelta msg;
+  msg.stamp = stamp;
+  msg.base_stamp = delta_base_stamp_;
+  msg.id = id_;
+  for (const auto index : changed_nodes_) {
+    msg.node_indices.push_back(index);
+    msg.nodes.push_back(nodes_[index]->create_status());
+  }
+  for (const auto index : changed_diags_) {
+    msg.diag_indices.push_back(index);
+    msg.diags.push_back(diags_[index]->create_status());
+  }
+  clear_delta(stamp);
+  return msg;
+}
+
+void Graph::clear_delta(const rclcpp::Time & stamp)
+{
+  for (const auto index : changed_nodes_) is_node_changed_[index] = false;
+  for (const auto index : changed_diags_) is_diag_changed_[index] = false;
+  changed_nodes_.clear();
+  changed_diags_.clear();
+  delta_base_stamp_ = stamp;
+}
+
 // For unique_ptr members.
 Graph::Graph() = default;
 Graph::~Graph() = default;
@@ -19,9 +19,13 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <queue>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace diagnostic_graph_aggregator
@@ -37,6 +41,8 @@ public:
   const auto & units() const { return units_; }
   DiagGraphStruct create_struct(const rclcpp::Time & stamp) const;
   DiagGraphStatus create_status(const rclcpp::Time & stamp) const;
+  DiagGraphStatusDelta create_delta(const rclcpp::Time & stamp);
+  void clear_delta(const rclcpp::Time & stamp);
 
   Graph();   // For unique_ptr members.
   ~Graph();  // For unique_ptr members.
@@ -49,6 +55,28 @@ private:
   std::vector<BaseUnit *> units_;
   std::unordered_map<std::string, DiagUnit *> names_;
   std::string id_;
+
+  // Incremental evaluation. The nodes whose children have changed are evaluated in the order of
+  // their rank, which is larger than the ranks of all their children.
+  void on_diag_changed(DiagUnit * diag);
+  void mark_parents_dirty(const BaseUnit * unit);
+  void evaluate_dirty_nodes();
+  void queue_deadline(DiagUnit * diag, int64_t min_nanoseconds);
+  std::vector<size_t> node_ranks_;
+  std::vector<std::vector<NodeUnit *>> dirty_nodes_;
+  std::vector<bool> is_node_dirty_;
+
+  // Units changed since the last status or delta message.
+  std::vector<size_t> changed_nodes_;
+  std::vector<size_t> changed_diags_;
+  std::vector<bool> is_node_changed_;
+  std::vector<bool> is_diag_changed_;
+  builtin_interfaces::msg::Time delta_base_stamp_;
+
+  // Timeout of the diags, at most one entry of (deadline, diag index) per diag.
+  using Deadline = std::pair<int64_t, size_t>;
+  std::priority_queue<Deadline, std::vector<Deadline>, std::greater<Deadline>> deadlines_;
+  std::vector<bool> is_diag_queued_;
 };
 
 }  // namespace diagnostic_graph_aggregator
@@ -18,6 +18,7 @@
 #include <diagnostic_msgs/msg/diagnostic_array.hpp>
 #include <diagnostic_msgs/msg/diagnostic_status.hpp>
 #include <tier4_system_msgs/msg/diag_graph_status.hpp>
+#include <tier4_system_msgs/msg/diag_graph_status_delta.hpp>
 #include <tier4_system_msgs/msg/diag_graph_struct.hpp>
 #include <tier4_system_msgs/msg/diag_leaf_status.hpp>
 #include <tier4_system_msgs/msg/diag_leaf_struct.hpp>
@@ -37,6 +38,7 @@ namespace diagnostic_graph_aggregator
 using diagnostic_msgs::msg::DiagnosticArray;
 using diagnostic_msgs::msg::DiagnosticStatus;
 using tier4_system_msgs::msg::DiagGraphStatus;
+using tier4_system_msgs::msg::DiagGraphStatusDelta;
 using tier4_system_msgs::msg::DiagGraphStruct;
 using tier4_system_msgs::msg::DiagLeafStatus;
 using tier4_system_msgs::msg::DiagLeafStruct;
@@ -53,17 +53,11 @@ bool BaseUnit::update()
   update_status();
 
   // If the level does not change, it will not affect the parents.
+  // Otherwise the graph updates the parents in topological order.
   const auto curr_level = level();
   if (curr_level == prev_level_) return false;
   prev_level_ = curr_level;
-
-  // If the level changes, the parents also need to be updated.
-  bool result = false;
-  for (const auto & link : parents_) {
-    const auto unit = link->parent();
-    result = result || unit->update();
-  }
-  return result;
+  return true;
 }
 
 NodeUnit::NodeUnit(const UnitLoader & unit) : BaseUnit(unit)
@@ -115,16 +109,20 @@ void DiagUnit::update_status()
 
 bool DiagUnit::on_diag(const rclcpp::Time & stamp, const DiagnosticStatus & status)
 {
+  // Return whether the status has changed, the level is propagated by update.
+  const bool changed = status_.level != status.level || status_.message != status.message ||
+                       status_.hardware_id != status.hardware_id || status_.values != status.values;
   last_updated_time_ = stamp;
   status_.level = status.level;
   status_.message = status.message;
   status_.hardware_id = status.hardware_id;
   status_.values = status.values;
-  return update();
+  return changed;
 }
 
 bool DiagUnit::on_time(const rclcpp::Time & stamp)
 {
+  // Return whether the status has changed, the level is propagated by update.
   if (last_updated_time_) {
     const auto updated = last_updated_time_.value();
     const auto elapsed = (stamp - updated).seconds();
@@ -132,9 +130,16 @@ bool DiagUnit::on_time(const rclcpp::Time & stamp)
       last_updated_time_ = std::nullopt;
       status_ = DiagLeafStatus();
       status_.level = DiagnosticStatus::STALE;
+      return true;
     }
   }
-  return update();
+  return false;
+}
+
+std::optional<rclcpp::Time> DiagUnit::deadline() const
+{
+  if (!last_updated_time_) return std::nullopt;
+  return last_updated_time_.value() + rclcpp::Duration::from_seconds(timeout_);
 }
 
 MaxUnit::MaxUnit(const UnitLoader & unit) : NodeUnit(unit)
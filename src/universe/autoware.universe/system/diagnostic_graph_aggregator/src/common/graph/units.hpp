@@ -59,8 +59,7 @@ public:
   virtual bool is_leaf() const = 0;
   size_t index() const { return index_; }
   size_t parent_size() const { return parents_.size(); }
-
-protected:
+  const std::vector<UnitLink *> & parent_links() const { return parents_; }
   bool update();
 
 private:
@@ -113,6 +112,7 @@ public:
   std::vector<UnitLink *> child_links() const override { return {}; }
   bool on_time(const rclcpp::Time & stamp);
   bool on_diag(const rclcpp::Time & stamp, const DiagnosticStatus & status);
+  std::optional<rclcpp::Time> deadline() const;
 
 private:
   void update_status() override;
@@ -50,6 +50,14 @@ AggregatorNode::AggregatorNode(const rclcpp::NodeOptions & options) : Node("aggr
     pub_struct_ = create_publisher<DiagGraphStruct>("/diagnostics_graph/struct", qos_struct);
     pub_status_ = create_publisher<DiagGraphStatus>("/diagnostics_graph/status", qos_status);
 
+    // Publish only the changed units and a periodic snapshot for late joiners.
+    use_status_delta_ = declare_parameter<bool>("use_status_delta");
+    status_snapshot_period_ = declare_parameter<double>("status_snapshot_period");
+    if (use_status_delta_) {
+      pub_delta_ =
+        create_publisher<DiagGraphStatusDelta>("/diagnostics_graph/status_delta", qos_status);
+    }
+
     const auto rate = rclcpp::Rate(declare_parameter<double>("rate"));
     timer_ = rclcpp::create_timer(this, get_clock(), rate.period(), [this]() { on_timer(); });
   }
@@ -78,7 +86,21 @@ void AggregatorNode::on_timer()
   graph_.update(stamp);
 
   // Publish status.
-  pub_status_->publish(graph_.create_status(stamp));
+  if (!use_status_delta_) {
+    pub_status_->publish(graph_.create_status(stamp));
+  } else {
+    const auto is_snapshot_time = [this](const rclcpp::Time & stamp) {
+      if (!last_snapshot_stamp_) return true;
+      return status_snapshot_period_ <= (stamp - last_snapshot_stamp_.value()).seconds();
+    };
+    if (is_snapshot_time(stamp)) {
+      pub_status_->publish(graph_.create_status(stamp));
+      graph_.clear_delta(stamp);
+      last_snapshot_stamp_ = stamp;
+    } else {
+      pub_delta_->publish(graph_.create_delta(stamp));
+    }
+  }
   pub_unknown_->publish(create_unknown_diags(stamp));
   if (modes_) modes_->update(stamp);
 }
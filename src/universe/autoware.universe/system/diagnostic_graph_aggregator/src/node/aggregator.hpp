@@ -21,6 +21,7 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -41,6 +42,10 @@ private:
   rclcpp::Publisher<DiagnosticArray>::SharedPtr pub_unknown_;
   rclcpp::Publisher<DiagGraphStruct>::SharedPtr pub_struct_;
   rclcpp::Publisher<DiagGraphStatus>::SharedPtr pub_status_;
+  rclcpp::Publisher<DiagGraphStatusDelta>::SharedPtr pub_delta_;
+  bool use_status_delta_;
+  double status_snapshot_period_;
+  std::optional<rclcpp::Time> last_snapshot_stamp_;
   DiagnosticArray create_unknown_diags(const rclcpp::Time & stamp);
   void on_timer();
   void on_diag(const DiagnosticArray & msg);
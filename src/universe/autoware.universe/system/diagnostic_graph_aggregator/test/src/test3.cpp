@@ -0,0 +1,151 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "graph/graph.hpp"
+#include "utils.hpp"
+
+#include <diagnostic_msgs/msg/diagnostic_status.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace diagnostic_graph_aggregator;  // NOLINT(build/namespaces)
+
+using diagnostic_msgs::msg::DiagnosticStatus;
+
+constexpr auto OK = DiagnosticStatus::OK;
+constexpr auto WARN = DiagnosticStatus::WARN;
+constexpr auto ERROR = DiagnosticStatus::ERROR;
+constexpr auto STALE = DiagnosticStatus::STALE;
+
+DiagnosticStatus create_status(size_t index, uint8_t level, const std::string & message = "")
+{
+  DiagnosticStatus status;
+  status.level = level;
+  status.name = "test: input-" + std::to_string(index);
+  status.message = message;
+  return status;
+}
+
+uint8_t get_level(const Graph & graph, const rclcpp::Time & stamp, size_t index)
+{
+  const auto name = "test: input-" + std::to_string(index);
+  const auto structure = graph.create_struct(stamp);
+  const auto status = graph.create_status(stamp);
+  for (size_t i = 0; i < structure.diags.size(); ++i) {
+    if (structure.diags[i].name == name) return status.diags[i].level;
+  }
+  throw std::runtime_error("unknown diag: " + name);
+}
+
+void apply_delta(DiagGraphStatus & status, const DiagGraphStatusDelta & delta)
+{
+  EXPECT_EQ(delta.base_stamp, status.stamp);
+  status.stamp = delta.stamp;
+  for (size_t i = 0; i < delta.nodes.size(); ++i) {
+    status.nodes[delta.node_indices[i]] = delta.nodes[i];
+  }
+  for (size_t i = 0; i < delta.diags.size(); ++i) {
+    status.diags[delta.diag_indices[i]] = delta.diags[i];
+  }
+}
+
+TEST(GraphIncremental, SameAsFullEvaluation)
+{
+  const auto stamp = rclcpp::Clock().now();
+  const std::vector<uint8_t> levels = {OK, WARN, ERROR, STALE};
+  std::mt19937 engine(0);
+
+  Graph graph;
+  graph.create(resource("test3/delta.yaml"));
+  std::vector<uint8_t> inputs = {STALE, STALE, STALE};
+  for (int i = 0; i < 200; ++i) {
+    const size_t index = engine() % inputs.size();
+    inputs[index] = levels[engine() % levels.size()];
+    graph.update(stamp, create_status(index, inputs[index]));
+
+    // Evaluate all units from scratch.
+    Graph expected;
+    expected.create(resource("test3/delta.yaml"));
+    for (size_t k = 0; k < inputs.size(); ++k) expected.update(stamp, create_status(k, inputs[k]));
+    EXPECT_EQ(graph.create_status(stamp), expected.create_status(stamp)) << "step " << i;
+  }
+}
+
+TEST(GraphIncremental, Delta)
+{
+  const auto stamp1 = rclcpp::Time(1, 0);
+  const auto stamp2 = rclcpp::Time(1, 100000000);
+  const auto stamp3 = rclcpp::Time(1, 200000000);
+  const auto stamp4 = rclcpp::Time(1, 300000000);
+
+  Graph graph;
+  graph.create(resource("test3/delta.yaml"));
+  for (size_t k = 0; k < 3; ++k) graph.update(stamp1, create_status(k, OK));
+  auto snapshot = graph.create_status(stamp1);
+  graph.clear_delta(stamp1);
+
+  // Nothing has changed.
+  graph.update(stamp2, create_status(0, OK));
+  const auto delta1 = graph.create_delta(stamp2);
+  EXPECT_TRUE(delta1.nodes.empty());
+  EXPECT_TRUE(delta1.diags.empty());
+  apply_delta(snapshot, delta1);
+
+  // The message of a diag has changed, but not the level.
+  graph.update(stamp3, create_status(0, OK, "message"));
+  const auto delta2 = graph.create_delta(stamp3);
+  EXPECT_TRUE(delta2.nodes.empty());
+  ASSERT_EQ(delta2.diags.size(), 1u);
+  EXPECT_EQ(delta2.diags[0].message, "message");
+  apply_delta(snapshot, delta2);
+
+  // Only the ancestors of the diag whose level changed are included, once each.
+  graph.update(stamp4, create_status(2, WARN));
+  graph.update(stamp4, create_status(2, ERROR));
+  const auto delta3 = graph.create_delta(stamp4);
+  EXPECT_EQ(delta3.diag_indices.size(), 1u);
+  EXPECT_EQ(delta3.node_indices.size(), 3u);  // output, branch-1 and remap
+  apply_delta(snapshot, delta3);
+  EXPECT_EQ(snapshot, graph.create_status(stamp4));
+}
+
+TEST(GraphIncremental, Timeout)
+{
+  const auto stamp = rclcpp::Time(10, 0);
+  Graph graph;
+  graph.create(resource("test3/delta.yaml"));
+  for (size_t k = 0; k < 3; ++k) graph.update(stamp, create_status(k, OK));
+  graph.clear_delta(stamp);
+
+  // The default timeout is 1 second. Keep input-0 alive.
+  graph.update(stamp + rclcpp::Duration::from_seconds(0.5));
+  graph.update(stamp + rclcpp::Duration::from_seconds(0.8), create_status(0, OK));
+  EXPECT_TRUE(graph.create_delta(stamp + rclcpp::Duration::from_seconds(0.8)).diags.empty());
+
+  const auto stamp_timeout = stamp + rclcpp::Duration::from_seconds(1.5);
+  graph.update(stamp_timeout);
+  EXPECT_EQ(get_level(graph, stamp_timeout, 0), OK);
+  EXPECT_EQ(get_level(graph, stamp_timeout, 1), STALE);
+  EXPECT_EQ(get_level(graph, stamp_timeout, 2), STALE);
+  EXPECT_EQ(graph.create_delta(stamp_timeout).diags.size(), 2u);
+
+  const auto stamp_timeout_all = stamp + rclcpp::Duration::from_seconds(2.0);
+  graph.update(stamp_timeout_all);
+  EXPECT_EQ(get_level(graph, stamp_timeout_all, 0), STALE);
+}
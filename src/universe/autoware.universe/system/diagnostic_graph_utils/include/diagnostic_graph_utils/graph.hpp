@@ -19,6 +19,7 @@
 
 #include <diagnostic_msgs/msg/diagnostic_status.hpp>
 #include <tier4_system_msgs/msg/diag_graph_status.hpp>
+#include <tier4_system_msgs/msg/diag_graph_status_delta.hpp>
 #include <tier4_system_msgs/msg/diag_graph_struct.hpp>
 
 #include <memory>
@@ -116,10 +117,12 @@ class DiagGraph
 public:
   using DiagGraphStruct = tier4_system_msgs::msg::DiagGraphStruct;
   using DiagGraphStatus = tier4_system_msgs::msg::DiagGraphStatus;
+  using DiagGraphStatusDelta = tier4_system_msgs::msg::DiagGraphStatusDelta;
   using SharedPtr = std::shared_ptr<DiagGraph>;
   using ConstSharedPtr = std::shared_ptr<const DiagGraph>;
   void create(const DiagGraphStruct & msg);
   bool update(const DiagGraphStatus & msg);
+  bool update(const DiagGraphStatusDelta & msg);
   rclcpp::Time created_stamp() const { return created_stamp_; }
   rclcpp::Time updated_stamp() const { return updated_stamp_; }
   std::string id() const { return id_; }
@@ -20,6 +20,7 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <tier4_system_msgs/msg/diag_graph_status.hpp>
+#include <tier4_system_msgs/msg/diag_graph_status_delta.hpp>
 #include <tier4_system_msgs/msg/diag_graph_struct.hpp>
 
 namespace diagnostic_graph_utils
@@ -38,10 +39,13 @@ public:
 private:
   using DiagGraphStruct = tier4_system_msgs::msg::DiagGraphStruct;
   using DiagGraphStatus = tier4_system_msgs::msg::DiagGraphStatus;
+  using DiagGraphStatusDelta = tier4_system_msgs::msg::DiagGraphStatusDelta;
   void on_struct(const DiagGraphStruct & msg);
   void on_status(const DiagGraphStatus & msg);
+  void on_delta(const DiagGraphStatusDelta & msg);
   rclcpp::Subscription<DiagGraphStruct>::SharedPtr sub_struct_;
   rclcpp::Subscription<DiagGraphStatus>::SharedPtr sub_status_;
+  rclcpp::Subscription<DiagGraphStatusDelta>::SharedPtr sub_delta_;
 
   DiagGraph::SharedPtr graph_;
   CallbackType create_callback_;
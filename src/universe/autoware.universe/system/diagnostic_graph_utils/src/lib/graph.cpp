@@ -69,6 +69,21 @@ bool DiagGraph::update(const DiagGraphStatus & msg)
   return true;
 }
 
+bool DiagGraph::update(const DiagGraphStatusDelta & msg)
+{
+  // The delta is only valid on top of the message it is based on.
+  if (id_ != msg.id) return false;
+  if (rclcpp::Time(msg.base_stamp).nanoseconds() != updated_stamp_.nanoseconds()) return false;
+  updated_stamp_ = msg.stamp;
+  for (size_t i = 0; i < msg.nodes.size(); ++i) {
+    nodes_.at(msg.node_indices.at(i))->update(msg.nodes[i]);
+  }
+  for (size_t i = 0; i < msg.diags.size(); ++i) {
+    diags_.at(msg.diag_indices.at(i))->update(msg.diags[i]);
+  }
+  return true;
+}
+
 template <class T, class U>
 void extend_ptrs(std::vector<T *> & result, const std::vector<std::unique_ptr<U>> & list)
 {
@@ -39,6 +39,9 @@ void DiagGraphSubscription::subscribe(rclcpp::Node & node, size_t depth)
   sub_status_ = node.create_subscription<DiagGraphStatus>(
     "/diagnostics_graph/status", qos_status,
     std::bind(&DiagGraphSubscription::on_status, this, std::placeholders::_1));
+  sub_delta_ = node.create_subscription<DiagGraphStatusDelta>(
+    "/diagnostics_graph/status_delta", qos_status,
+    std::bind(&DiagGraphSubscription::on_delta, this, std::placeholders::_1));
 }
 
 void DiagGraphSubscription::register_create_callback(const CallbackType & callback)
@@ -64,4 +67,11 @@ void DiagGraphSubscription::on_status(const DiagGraphStatus & msg)
   }
 }
 
+void DiagGraphSubscription::on_delta(const DiagGraphStatusDelta & msg)
+{
+  if (graph_->update(msg)) {
+    if (update_callback_) update_callback_(graph_);
+  }
+}
+
 }  // namespace diagnostic_graph_utils
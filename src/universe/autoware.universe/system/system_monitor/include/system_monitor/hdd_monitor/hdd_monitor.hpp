@@ -22,11 +22,13 @@
 
 #include "system_monitor/hdd_reader/hdd_reader.hpp"
 
+#include <autoware/universe_utils/system/proc_sampler.hpp>
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
 #include <climits>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 /**
@@ -265,12 +267,25 @@ protected:
   void getHddParams();
 
   /**
-   * @brief get device name from mount point
+   * @brief read the devices and the mount points of /proc/self/mounts
+   * @return pairs of device name and mount point in the order of mounts
+   */
+  std::vector<std::pair<std::string, std::string>> readMounts();
+
+  /**
+   * @brief get device name from mount point using /proc/self/mounts
    * @param [in] mount_point mount point
    * @return device name
    */
   std::string getDeviceFromMountPoint(const std::string & mount_point);
 
+  /**
+   * @brief get the mounts of the devices whose names start with the device name
+   * @param [in] device device name
+   * @return pairs of device name and mount point, the first one for each device
+   */
+  std::vector<std::pair<std::string, std::string>> getMountsOfDevice(const std::string & device);
+
   /**
    * @brief timer callback
    */
@@ -302,12 +317,12 @@ protected:
     uint64_t cur_val, uint64_t last_val, double duration_sec);
 
   /**
-   * @brief read stats for current whole device using /sys/block/ directory
+   * @brief read stats for current whole device using /proc/diskstats
    * @param [in] device device name
    * @param [out] sysfs_dev_stat statistics of sysfs device
    * @return result of success or failure
    */
-  int readSysfsDeviceStat(const std::string & device, SysfsDevStat & sysfs_dev_stat);
+  int readDeviceStat(const std::string & device, SysfsDevStat & sysfs_dev_stat);
 
   /**
    * @brief update HDD connections
@@ -338,6 +353,10 @@ protected:
   HddInfoList hdd_info_list_;               //!< @brief list of HDD information
   rclcpp::Time last_hdd_stat_update_time_;  //!< @brief last HDD statistics update time
 
+  autoware::universe_utils::ProcFile mounts_file_;  //!< @brief /proc/self/mounts
+  autoware::universe_utils::SystemSampler
+    system_sampler_;  //!< @brief sampler of /proc/diskstats
+
   /**
    * @brief HDD SMART status messages
    */
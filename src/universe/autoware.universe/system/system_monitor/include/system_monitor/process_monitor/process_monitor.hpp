@@ -22,17 +22,19 @@
 
 #include "system_monitor/process_monitor/diag_task.hpp"
 
+#include <autoware/universe_utils/system/proc_sampler.hpp>
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
-#include <boost/process.hpp>
+#include <sys/types.h>
 
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
-namespace bp = boost::process;
-
 class ProcessMonitor : public rclcpp::Node
 {
 public:
@@ -45,6 +47,28 @@ public:
 protected:
   using DiagStatus = diagnostic_msgs::msg::DiagnosticStatus;
 
+  /**
+   * @brief Number of tasks by state, same as the summary of top command
+   */
+  struct TasksSummary
+  {
+    int total = 0;
+    int running = 0;
+    int sleeping = 0;
+    int stopped = 0;
+    int zombie = 0;
+  };
+
+  /**
+   * @brief Process sampled from /proc/[pid]/stat
+   */
+  struct ProcessSample
+  {
+    pid_t pid;
+    autoware::universe_utils::ProcessStat stat;
+    double cpu_usage;  //!< @brief CPU usage in percent of one CPU since the previous sample
+  };
+
   /**
    * @brief monitor processes
    * @param [out] stat diagnostic message passed directly to diagnostic publish calls
@@ -55,38 +79,33 @@ protected:
     diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
 
   /**
-   * @brief get task summary
-   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
-   * @param [in] output top command output
-   * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
-   * to pass diagnostic message updated in this function to diagnostic publish calls.
+   * @brief read /proc/[pid]/stat of all processes and compute CPU usage since the previous call
+   * @param [out] summary number of tasks by state
+   * @return false if /proc cannot be read
    */
-  void getTasksSummary(
-    diagnostic_updater::DiagnosticStatusWrapper & stat,
-    const std::string & output);  // NOLINT(runtime/references)
+  bool sampleProcesses(TasksSummary & summary);
 
   /**
-   * @brief remove header
-   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
-   * @param [in] output top command output
-   * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
-   * to pass diagnostic message updated in this function to diagnostic publish calls.
+   * @brief get top-rated processes of the latest sample
+   * @param [in] compare function to sort processes in descending order of the rate
+   * @param [out] infos process information of top-rated processes
    */
-  void removeHeader(
-    diagnostic_updater::DiagnosticStatusWrapper & stat,
-    std::string & output);  // NOLINT(runtime/references)
+  template <typename Compare>
+  void getTopratedProcesses(const Compare & compare, std::vector<ProcessInfo> & infos);
 
   /**
-   * @brief get high load processes
-   * @param [in] output top command output
+   * @brief create process information in the same format as top command
+   * @param [in] sample sampled process
+   * @return process information
    */
-  void getHighLoadProcesses(const std::string & output);
+  ProcessInfo createProcessInformation(const ProcessSample & sample);
 
   /**
-   * @brief get high memory processes
-   * @param [in] output top command output
+   * @brief get user name of the process owner
+   * @param [in] pid process id
+   * @return user name, or user id if the name is not found
    */
-  void getHighMemoryProcesses(const std::string & output);
+  std::string getUserName(pid_t pid);
 
   /**
    * @brief get command line from process id
@@ -97,11 +116,12 @@ protected:
   bool getCommandLineFromPiD(const std::string & pid, std::string & command);
 
   /**
-   * @brief get top-rated processes
+   * @brief set process information to diagnostics tasks
    * @param [in] tasks list of diagnostics tasks for high load procs
-   * @param [in] output top command output
+   * @param [in] infos process information of top-rated processes
    */
-  void getTopratedProcesses(std::vector<std::shared_ptr<DiagTask>> * tasks, bp::pipe * p);
+  void setProcessInformation(
+    std::vector<std::shared_ptr<DiagTask>> * tasks, const std::vector<ProcessInfo> & infos);
 
   /**
    * @brief get top-rated processes
@@ -115,7 +135,7 @@ protected:
     const std::string & error_command, const std::string & content);
 
   /**
-   * @brief timer callback to execute top command
+   * @brief timer callback to sample processes
    */
   void onTimer();
 
@@ -128,12 +148,26 @@ protected:
     load_tasks_;  //!< @brief list of diagnostics tasks for high load procs
   std::vector<std::shared_ptr<DiagTask>>
     memory_tasks_;                      //!< @brief list of diagnostics tasks for high memory procs
-  rclcpp::TimerBase::SharedPtr timer_;  //!< @brief timer to execute top command
-  std::string top_output_;              //!< @brief output from top command
-  bool is_top_error_;                   //!< @brief flag if an top error occurs
-  bool is_pipe2_error_;                 //!< @brief flag if an pipe2 error occurs
-  double elapsed_ms_;                   //!< @brief Execution time of top command
-  std::mutex mutex_;                    //!< @brief mutex for output from top command
+  rclcpp::TimerBase::SharedPtr timer_;  //!< @brief timer to sample processes
+
+  autoware::universe_utils::SystemSampler system_sampler_;  //!< @brief /proc/stat, /proc/meminfo
+  autoware::universe_utils::ProcFile process_file_;         //!< @brief /proc/[pid]/stat being read
+  std::vector<ProcessSample> samples_;                   //!< @brief processes of the latest sample
+  std::vector<std::pair<pid_t, uint64_t>> last_ticks_;   //!< @brief CPU time sorted by process id
+  std::vector<std::pair<pid_t, uint64_t>> curr_ticks_;   //!< @brief buffer of the next last_ticks_
+  std::vector<const ProcessSample *> ranking_;           //!< @brief buffer to sort processes
+  uint64_t last_total_ticks_;                            //!< @brief total CPU time of /proc/stat
+  uint64_t memory_total_kib_;                            //!< @brief MemTotal of /proc/meminfo
+  int64_t num_cpus_;                                     //!< @brief number of online CPUs
+  std::map<uid_t, std::string> user_names_;              //!< @brief cache of user names
+
+  TasksSummary tasks_summary_;             //!< @brief number of tasks by state
+  std::vector<ProcessInfo> load_infos_;    //!< @brief high load processes
+  std::vector<ProcessInfo> memory_infos_;  //!< @brief high memory processes
+  bool is_started_;                        //!< @brief flag if CPU usage has been sampled
+  std::string proc_error_;                 //!< @brief error message if /proc cannot be read
+  double elapsed_ms_;                      //!< @brief Execution time of sampling
+  std::mutex mutex_;                       //!< @brief mutex for the sampled processes
   rclcpp::CallbackGroup::SharedPtr timer_callback_group_;  //!< @brief Callback Group
 };
 
@@ -20,6 +20,7 @@
 #ifndef SYSTEM_MONITOR__VOLTAGE_MONITOR__VOLTAGE_MONITOR_HPP_
 #define SYSTEM_MONITOR__VOLTAGE_MONITOR__VOLTAGE_MONITOR_HPP_
 
+#include <autoware/universe_utils/system/proc_sampler.hpp>
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
 #include <climits>
@@ -47,13 +48,29 @@ protected:
   char hostname_[HOST_NAME_MAX + 1];  //!< @brief host name
 
   /**
-   * @brief check CMOS battery
+   * @brief check CMOS battery with the input of hwmon
    * @param [out] stat diagnostic message passed directly to diagnostic publish calls
    * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
    * to pass diagnostic message updated in this function to diagnostic publish calls.
    */
   void checkVoltage(
     diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
+  /**
+   * @brief check CMOS battery with the output of sensors
+   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
+   * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
+   * to pass diagnostic message updated in this function to diagnostic publish calls.
+   */
+  void checkVoltageWithSensors(
+    diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
+  /**
+   * @brief add the voltage of CMOS battery and its level
+   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
+   * @param [in] voltage voltage of CMOS battery
+   */
+  void addVoltage(
+    diagnostic_updater::DiagnosticStatusWrapper & stat,  // NOLINT(runtime/references)
+    const float voltage) const;
   /**
    * @brief check CMOS battery
    * @param [out] stat diagnostic message passed directly to diagnostic publish calls
@@ -67,6 +84,8 @@ protected:
   float voltage_error_;
   std::string voltage_string_;
   std::regex voltage_regex_;
+  autoware::universe_utils::HwmonSensor voltage_sensor_;  //!< @brief hwmon input of the battery
+  autoware::universe_utils::ProcFile rtc_file_;           //!< @brief /proc/driver/rtc
 };
 
 #endif  // SYSTEM_MONITOR__VOLTAGE_MONITOR__VOLTAGE_MONITOR_HPP_
@@ -25,19 +25,23 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
-#include <boost/process.hpp>
 #include <boost/serialization/vector.hpp>
 
 #include <fmt/format.h>
-#include <stdio.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
 
 #include <algorithm>
+#include <cctype>
 #include <filesystem>
+#include <regex>
+#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
-namespace bp = boost::process;
-
 HddMonitor::HddMonitor(const rclcpp::NodeOptions & options)
 : Node("hdd_monitor", options),
   updater_(this),
@@ -250,96 +254,48 @@ void HddMonitor::checkUsage(diagnostic_updater::DiagnosticStatusWrapper & stat)
       continue;
     }
 
-    // Get summary of disk space usage of ext4
-
-    // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-    // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      error_str = "pipe2 error";
-      stat.add(fmt::format("HDD {}: status", hdd_index), "pipe2 error");
-      stat.add(fmt::format("HDD {}: name", hdd_index), itr->first.c_str());
-      stat.add(fmt::format("HDD {}: pipe2", hdd_index), strerror(errno));
-      continue;
+    // Get summary of disk space usage of the file systems on the device and its partitions
+    auto mounts = getMountsOfDevice(itr->second.part_device_);
+    if (mounts.empty()) {
+      mounts.emplace_back(itr->second.part_device_, itr->first);
     }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
-
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      error_str = "pipe2 error";
-      stat.add(fmt::format("HDD {}: status", hdd_index), "pipe2 error");
-      stat.add(fmt::format("HDD {}: name", hdd_index), itr->first.c_str());
-      stat.add(fmt::format("HDD {}: pipe2", hdd_index), strerror(errno));
-      continue;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    // Invoke shell to use shell wildcard expansion
-    bp::child c(
-      "/bin/sh", "-c", fmt::format("df -Pm {}*", itr->second.part_device_.c_str()),
-      bp::std_out > is_out, bp::std_err > is_err);
-    c.wait();
-
-    if (c.exit_code() != 0) {
-      std::ostringstream os;
-      is_err >> os.rdbuf();
-      error_str = "df error";
-      stat.add(fmt::format("HDD {}: status", hdd_index), "df error");
-      stat.add(fmt::format("HDD {}: name", hdd_index), itr->second.part_device_.c_str());
-      stat.add(fmt::format("HDD {}: df", hdd_index), os.str().c_str());
-      continue;
-    }
-
-    int level = DiagStatus::OK;
-    std::string line;
-    int index = 0;
-    std::vector<std::string> list;
-    int avail;
-
-    while (std::getline(is_out, line) && !line.empty()) {
-      // Skip header
-      if (index <= 0) {
-        ++index;
+    for (const auto & [device, mount_point] : mounts) {
+      struct statvfs buf;
+      if (statvfs(mount_point.c_str(), &buf) != 0) {
+        error_str = "statvfs error";
+        stat.add(fmt::format("HDD {}: status", hdd_index), "statvfs error");
+        stat.add(fmt::format("HDD {}: name", hdd_index), mount_point.c_str());
+        stat.add(fmt::format("HDD {}: statvfs", hdd_index), strerror(errno));
         continue;
       }
 
-      boost::split(list, line, boost::is_space(), boost::token_compress_on);
-
-      try {
-        avail = std::stoi(list[3].c_str());
-      } catch (std::exception & e) {
-        avail = -1;
-        error_str = e.what();
-        stat.add(fmt::format("HDD {}: status", hdd_index), "avail string error");
-      }
-
+      // Round up to MiB in the same way as df -Pm
+      const auto to_mib = [&buf](uint64_t blocks) {
+        constexpr uint64_t mib = 1024 * 1024;
+        return (blocks * buf.f_frsize + mib - 1) / mib;
+      };
+      const int64_t size = to_mib(buf.f_blocks);
+      const int64_t used = to_mib(buf.f_blocks - buf.f_bfree);
+      const int64_t avail = to_mib(buf.f_bavail);
+      const int64_t use =
+        (used + avail > 0) ? (used * 100 + used + avail - 1) / (used + avail) : 0;
+
+      int level = DiagStatus::OK;
       if (avail <= itr->second.free_error_) {
         level = DiagStatus::ERROR;
       } else if (avail <= itr->second.free_warn_) {
         level = DiagStatus::WARN;
-      } else {
-        level = DiagStatus::OK;
       }
 
       stat.add(fmt::format("HDD {}: status", hdd_index), usage_dict_.at(level));
-      stat.add(fmt::format("HDD {}: filesystem", hdd_index), list[0].c_str());
-      stat.add(fmt::format("HDD {}: size", hdd_index), (list[1] + " MiB").c_str());
-      stat.add(fmt::format("HDD {}: used", hdd_index), (list[2] + " MiB").c_str());
-      stat.add(fmt::format("HDD {}: avail", hdd_index), (list[3] + " MiB").c_str());
-      stat.add(fmt::format("HDD {}: use", hdd_index), list[4].c_str());
-      std::string mounted_ = list[5];
-      if (list.size() > 6) {
-        std::string::size_type pos = line.find("% /");
-        if (pos != std::string::npos) {
-          mounted_ = line.substr(pos + 2);  // 2 is "% " length
-        }
-      }
-      stat.add(fmt::format("HDD {}: mounted on", hdd_index), mounted_.c_str());
+      stat.add(fmt::format("HDD {}: filesystem", hdd_index), device.c_str());
+      stat.add(fmt::format("HDD {}: size", hdd_index), fmt::format("{} MiB", size));
+      stat.add(fmt::format("HDD {}: used", hdd_index), fmt::format("{} MiB", used));
+      stat.add(fmt::format("HDD {}: avail", hdd_index), fmt::format("{} MiB", avail));
+      stat.add(fmt::format("HDD {}: use", hdd_index), fmt::format("{}%", use));
+      stat.add(fmt::format("HDD {}: mounted on", hdd_index), mount_point.c_str());
 
       whole_level = std::max(whole_level, level);
-      ++index;
     }
   }
 
@@ -536,43 +492,79 @@ void HddMonitor::getHddParams()
   }
 }
 
+std::vector<std::pair<std::string, std::string>> HddMonitor::readMounts()
+{
+  std::vector<std::pair<std::string, std::string>> mounts;
+  if (!mounts_file_.is_open() && !mounts_file_.open("/proc/self/mounts")) {
+    RCLCPP_ERROR(get_logger(), "Failed to open /proc/self/mounts. %s", strerror(errno));
+    return mounts;
+  }
+  const auto content = mounts_file_.read();
+  if (!content) {
+    RCLCPP_ERROR(get_logger(), "Failed to read /proc/self/mounts. %s", strerror(errno));
+    return mounts;
+  }
+
+  // Spaces and some other characters of the fields are escaped as octal like \040
+  const auto unescape = [](std::string_view field) {
+    std::string ret;
+    for (size_t i = 0; i < field.size(); ++i) {
+      const bool is_escaped = field[i] == '\\' && i + 3 < field.size() &&
+                              std::isdigit(static_cast<unsigned char>(field[i + 1]));
+      if (is_escaped) {
+        ret += static_cast<char>(std::stoi(std::string(field.substr(i + 1, 3)), nullptr, 8));
+        i += 3;
+      } else {
+        ret += field[i];
+      }
+    }
+    return ret;
+  };
+
+  std::string_view lines = *content;
+  while (!lines.empty()) {
+    const auto end = std::min(lines.find('\n'), lines.size());
+    const auto line = lines.substr(0, end);
+    lines.remove_prefix(std::min(end + 1, lines.size()));
+
+    const auto source_end = line.find(' ');
+    if (source_end == std::string_view::npos) continue;
+    const auto target_end = std::min(line.find(' ', source_end + 1), line.size());
+    mounts.emplace_back(
+      unescape(line.substr(0, source_end)),
+      unescape(line.substr(source_end + 1, target_end - source_end - 1)));
+  }
+  return mounts;
+}
+
 std::string HddMonitor::getDeviceFromMountPoint(const std::string & mount_point)
 {
+  // The last mount on the same mount point hides the previous ones as findmnt shows
   std::string ret;
-
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR(get_logger(), "Failed to execute pipe2. %s", strerror(errno));
-    return "";
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR(get_logger(), "Failed to execute pipe2. %s", strerror(errno));
-    return "";
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  bp::child c(
-    "/bin/sh", "-c", fmt::format("findmnt -n -o SOURCE {}", mount_point.c_str()),
-    bp::std_out > is_out, bp::std_err > is_err);
-  c.wait();
-
-  if (c.exit_code() != 0) {
-    RCLCPP_ERROR(get_logger(), "Failed to execute findmnt. %s", mount_point.c_str());
-    return "";
+  for (const auto & [device, target] : readMounts()) {
+    if (target == mount_point) {
+      ret = device;
+    }
   }
 
-  if (!std::getline(is_out, ret)) {
+  if (ret.empty()) {
     RCLCPP_ERROR(get_logger(), "Failed to find device name. %s", mount_point.c_str());
-    return "";
   }
+  return ret;
+}
 
+std::vector<std::pair<std::string, std::string>> HddMonitor::getMountsOfDevice(
+  const std::string & device)
+{
+  // The devices starting with the name such as the partitions of a disk, as df {device}* shows
+  std::vector<std::pair<std::string, std::string>> ret;
+  for (const auto & mount : readMounts()) {
+    if (!boost::starts_with(mount.first, device)) continue;
+    const auto is_same_device = [&mount](const auto & other) { return other.first == mount.first; };
+    if (std::none_of(ret.begin(), ret.end(), is_same_device)) {
+      ret.push_back(mount);
+    }
+  }
   return ret;
 }
 
@@ -703,7 +695,7 @@ void HddMonitor::startHddTransferMeasurement()
     }
 
     SysfsDevStat sysfs_dev_stat;
-    if (readSysfsDeviceStat(hdd_stat.second.device_, sysfs_dev_stat)) {
+    if (readDeviceStat(hdd_stat.second.device_, sysfs_dev_stat)) {
       hdd_stat.second.error_str_ = "stat file read error";
       continue;
     }
@@ -725,7 +717,7 @@ void HddMonitor::updateHddStatistics()
     }
 
     SysfsDevStat sysfs_dev_stat;
-    if (readSysfsDeviceStat(hdd_stat.second.device_, sysfs_dev_stat)) {
+    if (readDeviceStat(hdd_stat.second.device_, sysfs_dev_stat)) {
       hdd_stat.second.error_str_ = "stat file read error";
       continue;
     }
@@ -758,36 +750,18 @@ double HddMonitor::getIncreaseSysfsDeviceStatValuePerSec(
   return 0.0;
 }
 
-int HddMonitor::readSysfsDeviceStat(const std::string & device, SysfsDevStat & sysfs_dev_stat)
+int HddMonitor::readDeviceStat(const std::string & device, SysfsDevStat & sysfs_dev_stat)
 {
-  int ret = -1;
-  unsigned int ios_pgr, tot_ticks, rq_ticks, wr_ticks;
-  uint64_t rd_ios, rd_merges_or_rd_sec, wr_ios, wr_merges;
-  uint64_t rd_sec_or_wr_ios, wr_sec, rd_ticks_or_wr_sec;
-  uint64_t dc_ios, dc_merges, dc_sec, dc_ticks;
-
-  std::string filename("/sys/block/");
-  filename += device + "/stat";
-  FILE * fp = fopen(filename.c_str(), "r");
-  if (fp == NULL) {
-    return ret;
-  }
-
-  int i = fscanf(
-    fp, "%lu %lu %lu %lu %lu %lu %lu %u %u %u %u %lu %lu %lu %lu", &rd_ios, &rd_merges_or_rd_sec,
-    &rd_sec_or_wr_ios, &rd_ticks_or_wr_sec, &wr_ios, &wr_merges, &wr_sec, &wr_ticks, &ios_pgr,
-    &tot_ticks, &rq_ticks, &dc_ios, &dc_merges, &dc_sec, &dc_ticks);
-
-  if (i >= 7) {
-    sysfs_dev_stat.rd_ios_ = rd_ios;
-    sysfs_dev_stat.rd_sectors_ = rd_sec_or_wr_ios;
-    sysfs_dev_stat.wr_ios_ = wr_ios;
-    sysfs_dev_stat.wr_sectors_ = wr_sec;
-    ret = 0;
+  autoware::universe_utils::DiskStat disk_stat;
+  if (!system_sampler_.read_disk_stat(device, disk_stat)) {
+    return -1;
   }
 
-  fclose(fp);
-  return ret;
+  sysfs_dev_stat.rd_ios_ = disk_stat.read_ios;
+  sysfs_dev_stat.rd_sectors_ = disk_stat.read_sectors;
+  sysfs_dev_stat.wr_ios_ = disk_stat.write_ios;
+  sysfs_dev_stat.wr_sectors_ = disk_stat.write_sectors;
+  return 0;
 }
 
 void HddMonitor::updateHddConnections()
@@ -23,10 +23,18 @@
 
 #include <autoware/universe_utils/system/stop_watch.hpp>
 
+#include <dirent.h>
 #include <fmt/format.h>
-
+#include <pwd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
 #include <memory>
-#include <regex>
 #include <string>
 #include <vector>
 
@@ -34,8 +42,11 @@ ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
 : Node("process_monitor", options),
   updater_(this),
   num_of_procs_(declare_parameter<int>("num_of_procs", 5)),
-  is_top_error_(false),
-  is_pipe2_error_(false)
+  last_total_ticks_(0),
+  memory_total_kib_(0),
+  num_cpus_(std::max<int64_t>(sysconf(_SC_NPROCESSORS_ONLN), 1)),
+  is_started_(false),
+  elapsed_ms_(0.0)
 {
   using namespace std::literals::chrono_literals;
 
@@ -57,7 +68,8 @@ ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
     updater_.add(*task);
   }
 
-  // Start timer to execute top command
+  // Start timer to sample processes. The processes are read from /proc in this node instead of
+  // running top, since forking and executing commands periodically is expensive.
   timer_callback_group_ = this->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
   timer_ = rclcpp::create_timer(
     this, get_clock(), 1s, std::bind(&ProcessMonitor::onTimer, this), timer_callback_group_);
@@ -66,351 +78,210 @@ ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
 void ProcessMonitor::monitorProcesses(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
   // thread-safe read
-  std::string str;
-  bool is_top_error;
-  bool is_pipe2_error;
+  TasksSummary summary;
+  std::vector<ProcessInfo> load_infos;
+  std::vector<ProcessInfo> memory_infos;
+  bool is_started;
+  std::string proc_error;
   double elapsed_ms;
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    str = top_output_;
-    is_top_error = is_top_error_;
-    is_pipe2_error = is_pipe2_error_;
+    summary = tasks_summary_;
+    load_infos = load_infos_;
+    memory_infos = memory_infos_;
+    is_started = is_started_;
+    proc_error = proc_error_;
     elapsed_ms = elapsed_ms_;
   }
 
-  if (is_pipe2_error) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", str);
-    setErrorContent(&load_tasks_, "pipe2 error", "pipe2", str);
-    setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", str);
-    return;
-  }
-  if (is_top_error) {
-    stat.summary(DiagStatus::ERROR, "top error");
-    stat.add("top", str);
-    setErrorContent(&load_tasks_, "top error", "top", str);
-    setErrorContent(&memory_tasks_, "top error", "top", str);
+  if (!proc_error.empty()) {
+    stat.summary(DiagStatus::ERROR, "proc error");
+    stat.add("proc", proc_error);
+    setErrorContent(&load_tasks_, "proc error", "proc", proc_error);
+    setErrorContent(&memory_tasks_, "proc error", "proc", proc_error);
     return;
   }
 
-  // If top still not running
-  if (str.empty()) {
+  // If CPU usage is not sampled yet
+  if (!is_started) {
     // Send OK tentatively
     stat.summary(DiagStatus::OK, "starting up");
     return;
   }
 
   // Get task summary
-  getTasksSummary(stat, str);
-  // Remove header
-  removeHeader(stat, str);
+  stat.add("total", std::to_string(summary.total));
+  stat.add("running", std::to_string(summary.running));
+  stat.add("sleeping", std::to_string(summary.sleeping));
+  stat.add("stopped", std::to_string(summary.stopped));
+  stat.add("zombie", std::to_string(summary.zombie));
+  stat.summary(DiagStatus::OK, "OK");
 
   // Get high load processes
-  getHighLoadProcesses(str);
+  setProcessInformation(&load_tasks_, load_infos);
 
   // Get high memory processes
-  getHighMemoryProcesses(str);
+  setProcessInformation(&memory_tasks_, memory_infos);
 
   stat.addf("execution time", "%f ms", elapsed_ms);
 }
 
-void ProcessMonitor::getTasksSummary(
-  diagnostic_updater::DiagnosticStatusWrapper & stat, const std::string & output)
+bool ProcessMonitor::sampleProcesses(TasksSummary & summary)
 {
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int p_fd[2];
-  if (pipe2(p_fd, O_CLOEXEC) != 0) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
+  autoware::universe_utils::CpuTimes cpu_times;
+  autoware::universe_utils::MemoryInfo memory_info;
+  if (
+    !system_sampler_.read_cpu_times(cpu_times) ||
+    !system_sampler_.read_memory_info(memory_info)) {
+    return false;
   }
-  bp::pipe p{p_fd[0], p_fd[1]};
 
-  // Echo output for grep
-  {
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
-
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c(fmt::format("echo {}", output), bp::std_out > p, bp::std_err > is_err);
-    c.wait();
-    if (c.exit_code() != 0) {
-      std::ostringstream os;
-      is_err >> os.rdbuf();
-      stat.summary(DiagStatus::ERROR, "echo error");
-      stat.add("echo", os.str().c_str());
-      return;
-    }
+  DIR * dir = opendir("/proc");
+  if (dir == nullptr) {
+    return false;
   }
-  // Find matching pattern of summary
-  {
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
-
-    bp::child c("grep Tasks:", bp::std_out > is_out, bp::std_in < p);
-    c.wait();
-    // no matching line
-    if (c.exit_code() != 0) {
-      stat.summary(DiagStatus::ERROR, "matching pattern not found");
-      stat.add("name", "Tasks:");
-      return;
-    }
 
-    std::string line;
-    std::getline(is_out, line);
-    std::cmatch match;
-    const std::regex filter(
-      "^Tasks: (\\d+) total,\\s+(\\d+) running,\\s+(\\d+) sleeping,\\s+(\\d+) stopped,\\s+(\\d+) "
-      "zombie");
-
-    if (std::regex_match(line.c_str(), match, filter)) {
-      stat.add("total", match[1].str());
-      stat.add("running", match[2].str());
-      stat.add("sleeping", match[3].str());
-      stat.add("stopped", match[4].str());
-      stat.add("zombie", match[5].str());
-      stat.summary(DiagStatus::OK, "OK");
-    } else {
-      stat.summary(DiagStatus::ERROR, "invalid format");
+  // Elapsed time in clock ticks of one CPU, the same unit as the CPU time of processes
+  const double elapsed_ticks =
+    static_cast<double>(cpu_times.total() - last_total_ticks_) / static_cast<double>(num_cpus_);
+  last_total_ticks_ = cpu_times.total();
+  memory_total_kib_ = memory_info.total_kib;
+
+  samples_.clear();
+  curr_ticks_.clear();
+  char path[64];
+  while (const auto * entry = readdir(dir)) {
+    char * end;
+    const auto pid = static_cast<pid_t>(strtol(entry->d_name, &end, 10));
+    if (*end != '\0' || pid <= 0) {
+      continue;
     }
-  }
-}
-
-void ProcessMonitor::removeHeader(
-  diagnostic_updater::DiagnosticStatusWrapper & stat, std::string & output)
-{
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int p1_fd[2];
-  if (pipe2(p1_fd, O_CLOEXEC) != 0) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe p1{p1_fd[0], p1_fd[1]};
-
-  int p2_fd[2];
-  if (pipe2(p2_fd, O_CLOEXEC) != 0) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe p2{p2_fd[0], p2_fd[1]};
-
-  std::ostringstream os;
 
-  // Echo output for sed
-  {
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c(fmt::format("echo {}", output), bp::std_out > p1, bp::std_err > is_err);
-    c.wait();
-    if (c.exit_code() != 0) {
-      is_err >> os.rdbuf();
-      stat.summary(DiagStatus::ERROR, "echo error");
-      stat.add("echo", os.str().c_str());
-      return;
-    }
-  }
-  // Remove %Cpu section
-  {
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
+    // The process may exit at any time
+    snprintf(path, sizeof(path), "/proc/%d/stat", pid);
+    if (!process_file_.open(path)) {
+      continue;
     }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c("sed \"/^%Cpu/d\"", bp::std_out > p2, bp::std_err > is_err, bp::std_in < p1);
-    c.wait();
-    // no matching line
-    if (c.exit_code() != 0) {
-      stat.summary(DiagStatus::ERROR, "sed error");
-      stat.add("sed", "Failed to remove header");
-      return;
+    const auto content = process_file_.read();
+    ProcessSample sample{pid, {}, 0.0};
+    if (!content || !autoware::universe_utils::parse_process_stat(*content, sample.stat)) {
+      continue;
     }
-  }
-  // Remove header
-  {
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
-
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
+
+    // A process which is not in the previous sample has been started since then
+    const auto ticks = sample.stat.cpu_ticks();
+    const auto last = std::lower_bound(
+      last_ticks_.begin(), last_ticks_.end(), std::make_pair(pid, uint64_t{0}));
+    const auto last_ticks = (last != last_ticks_.end() && last->first == pid) ? last->second : 0;
+    if (0.0 < elapsed_ticks && last_ticks <= ticks) {
+      sample.cpu_usage = static_cast<double>(ticks - last_ticks) / elapsed_ticks * 100.0;
     }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c("sed \"1,6d\"", bp::std_out > is_out, bp::std_err > is_err, bp::std_in < p2);
-    c.wait();
-    // no matching line
-    if (c.exit_code() != 0) {
-      stat.summary(DiagStatus::ERROR, "sed error");
-      stat.add("sed", "Failed to remove header");
-      return;
+    curr_ticks_.emplace_back(pid, ticks);
+    samples_.push_back(sample);
+
+    ++summary.total;
+    switch (sample.stat.state) {
+      case 'R':
+        ++summary.running;
+        break;
+      case 'T':
+      case 't':
+        ++summary.stopped;
+        break;
+      case 'Z':
+        ++summary.zombie;
+        break;
+      default:
+        ++summary.sleeping;
+        break;
     }
-    // overwrite
-    is_out >> os.rdbuf();
-    output = os.str();
   }
+  closedir(dir);
+  process_file_.close();
+
+  std::sort(curr_ticks_.begin(), curr_ticks_.end());
+  last_ticks_.swap(curr_ticks_);
+  return true;
 }
 
-void ProcessMonitor::getHighLoadProcesses(const std::string & output)
+template <typename Compare>
+void ProcessMonitor::getTopratedProcesses(const Compare & compare, std::vector<ProcessInfo> & infos)
 {
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int p_fd[2];
-  if (pipe2(p_fd, O_CLOEXEC) != 0) {
-    setErrorContent(&load_tasks_, "pipe2 error", "pipe2", strerror(errno));
-    return;
+  ranking_.clear();
+  for (const auto & sample : samples_) {
+    ranking_.push_back(&sample);
   }
-  bp::pipe p{p_fd[0], p_fd[1]};
+  const auto size = std::min(ranking_.size(), static_cast<size_t>(std::max(num_of_procs_, 0)));
+  std::partial_sort(
+    ranking_.begin(), ranking_.begin() + size, ranking_.end(),
+    [&compare](const auto * a, const auto * b) { return compare(*a, *b); });
 
-  std::ostringstream os;
-
-  // Echo output for sed
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    setErrorContent(&load_tasks_, "pipe2 error", "pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    setErrorContent(&load_tasks_, "pipe2 error", "pipe2", strerror(errno));
-    return;
+  infos.clear();
+  for (size_t index = 0; index < size; ++index) {
+    infos.push_back(createProcessInformation(*ranking_[index]));
   }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  bp::child c(fmt::format("echo {}", output), bp::std_out > p, bp::std_err > is_err);
-  c.wait();
-  if (c.exit_code() != 0) {
-    is_err >> os.rdbuf();
-    setErrorContent(&load_tasks_, "echo error", "echo", os.str().c_str());
-    return;
-  }
-
-  // Get top-rated
-  getTopratedProcesses(&load_tasks_, &p);
 }
 
-void ProcessMonitor::getHighMemoryProcesses(const std::string & output)
+ProcessInfo ProcessMonitor::createProcessInformation(const ProcessSample & sample)
 {
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int p1_fd[2];
-  if (pipe2(p1_fd, O_CLOEXEC) != 0) {
-    setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe p1{p1_fd[0], p1_fd[1]};
+  const auto & stat = sample.stat;
+  const auto page_kib = autoware::universe_utils::page_size_bytes() / 1024;
+  const auto resident_kib = stat.resident_pages * page_kib;
+
+  // The shared memory is only in /proc/[pid]/statm
+  autoware::universe_utils::ProcessMemory memory;
+  std::string shared_kib = "0";
+  if (autoware::universe_utils::ProcessSampler(sample.pid).read_memory(memory)) {
+    shared_kib = std::to_string(memory.shared_pages * page_kib);
+  }
+
+  // Same format as TIME+ of top, minutes:seconds.hundredths
+  const auto centiseconds =
+    stat.cpu_ticks() * 100 / autoware::universe_utils::clock_ticks_per_second();
+
+  ProcessInfo info;
+  info.processId = std::to_string(sample.pid);
+  info.userName = getUserName(sample.pid);
+  info.priority = stat.priority == -100 ? "rt" : std::to_string(stat.priority);
+  info.niceValue = std::to_string(stat.nice);
+  info.virtualImage = std::to_string(stat.virtual_bytes / 1024);
+  info.residentSize = std::to_string(resident_kib);
+  info.sharedMemSize = shared_kib;
+  info.processStatus = std::string(1, stat.state);
+  info.cpuUsage = fmt::format("{:.1f}", sample.cpu_usage);
+  info.memoryUsage = fmt::format(
+    "{:.1f}", memory_total_kib_ == 0 ? 0.0 : 100.0 * resident_kib / memory_total_kib_);
+  info.cpuTime = fmt::format(
+    "{}:{:02}.{:02}", centiseconds / 6000, centiseconds / 100 % 60, centiseconds % 100);
+
+  // if command line is not found, use program name instead
+  if (!getCommandLineFromPiD(info.processId, info.commandName)) {
+    info.commandName = stat.command.data();
+  }
+  return info;
+}
 
-  int p2_fd[2];
-  if (pipe2(p2_fd, O_CLOEXEC) != 0) {
-    setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-    return;
+std::string ProcessMonitor::getUserName(pid_t pid)
+{
+  struct stat dir_stat;
+  if (stat(fmt::format("/proc/{}", pid).c_str(), &dir_stat) != 0) {
+    return "";
   }
-  bp::pipe p2{p2_fd[0], p2_fd[1]};
-
-  std::ostringstream os;
-
-  // Echo output for sed
-  {
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
 
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c(fmt::format("echo {}", output), bp::std_out > p1, bp::std_err > is_err);
-    c.wait();
-    if (c.exit_code() != 0) {
-      is_err >> os.rdbuf();
-      setErrorContent(&memory_tasks_, "echo error", "echo", os.str().c_str());
-      return;
-    }
+  const auto iter = user_names_.find(dir_stat.st_uid);
+  if (iter != user_names_.end()) {
+    return iter->second;
   }
-  // Sort by memory usage
-  {
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
 
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c("sort -r -k 10 -n", bp::std_out > p2, bp::std_err > is_err, bp::std_in < p1);
-    c.wait();
-    if (c.exit_code() != 0) {
-      is_err >> os.rdbuf();
-      setErrorContent(&memory_tasks_, "sort error", "sort", os.str().c_str());
-      return;
-    }
+  struct passwd pwd;
+  struct passwd * result = nullptr;
+  char buffer[1024];
+  std::string name = std::to_string(dir_stat.st_uid);
+  if (getpwuid_r(dir_stat.st_uid, &pwd, buffer, sizeof(buffer), &result) == 0 && result) {
+    name = result->pw_name;
   }
-
-  // Get top-rated
-  getTopratedProcesses(&memory_tasks_, &p2);
+  user_names_[dir_stat.st_uid] = name;
+  return name;
 }
 
 bool ProcessMonitor::getCommandLineFromPiD(const std::string & pid, std::string & command)
@@ -434,66 +305,16 @@ bool ProcessMonitor::getCommandLineFromPiD(const std::string & pid, std::string
   }
 }
 
-void ProcessMonitor::getTopratedProcesses(
-  std::vector<std::shared_ptr<DiagTask>> * tasks, bp::pipe * p)
+void ProcessMonitor::setProcessInformation(
+  std::vector<std::shared_ptr<DiagTask>> * tasks, const std::vector<ProcessInfo> & infos)
 {
-  if (tasks == nullptr || p == nullptr) {
-    return;
-  }
-
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    setErrorContent(tasks, "pipe2 error", "pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    setErrorContent(tasks, "pipe2 error", "pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  std::ostringstream os;
-
-  bp::child c(
-    fmt::format("sed -n \"1,{} p\"", num_of_procs_), bp::std_out > is_out, bp::std_err > is_err,
-    bp::std_in < *p);
-
-  c.wait();
-  // Failed to modify line
-  if (c.exit_code() != 0) {
-    is_err >> os.rdbuf();
-    setErrorContent(tasks, "sed error", "sed", os.str().c_str());
+  if (tasks == nullptr) {
     return;
   }
 
-  std::string line;
-  int index = 0;
-
-  while (std::getline(is_out, line) && !line.empty()) {
-    std::istringstream stream(line);
-
-    ProcessInfo info;
-    stream >> info.processId >> info.userName >> info.priority >> info.niceValue >>
-      info.virtualImage >> info.residentSize >> info.sharedMemSize >> info.processStatus >>
-      info.cpuUsage >> info.memoryUsage >> info.cpuTime;
-
-    std::string program_name;
-    std::getline(stream, program_name);
-
-    bool flag_find_command_line = getCommandLineFromPiD(info.processId, info.commandName);
-
-    if (!flag_find_command_line) {
-      info.commandName = program_name;  // if command line is not found, use program name instead
-    }
-
+  for (size_t index = 0; index < infos.size() && index < tasks->size(); ++index) {
     tasks->at(index)->setDiagnosticsStatus(DiagStatus::OK, "OK");
-    tasks->at(index)->setProcessInformation(info);
-    ++index;
+    tasks->at(index)->setProcessInformation(infos[index]);
   }
 }
 
@@ -513,43 +334,30 @@ void ProcessMonitor::setErrorContent(
 
 void ProcessMonitor::onTimer()
 {
-  bool is_top_error = false;
-
   // Start to measure elapsed time
   autoware::universe_utils::StopWatch<std::chrono::milliseconds> stop_watch;
   stop_watch.tic("execution_time");
 
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    top_output_ = std::string(strerror(errno));
-    is_pipe2_error_ = true;
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    top_output_ = std::string(strerror(errno));
-    is_pipe2_error_ = true;
-    return;
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  std::ostringstream os;
-
-  // Get processes
-  bp::child c("top -bn1 -o %CPU -w 128", bp::std_out > is_out, bp::std_err > is_err);
-  c.wait();
-
-  if (c.exit_code() != 0) {
-    is_top_error = true;
-    is_err >> os.rdbuf();
-  } else {
-    is_out >> os.rdbuf();
+  TasksSummary summary;
+  std::vector<ProcessInfo> load_infos;
+  std::vector<ProcessInfo> memory_infos;
+  std::string proc_error;
+  bool is_started = false;
+
+  // The CPU usage of the first sample is not valid, since there is no previous sample
+  const bool has_last_sample = last_total_ticks_ != 0;
+  if (!sampleProcesses(summary)) {
+    proc_error = "failed to read /proc";
+  } else if (has_last_sample) {
+    is_started = true;
+    getTopratedProcesses(
+      [](const ProcessSample & a, const ProcessSample & b) { return a.cpu_usage > b.cpu_usage; },
+      load_infos);
+    getTopratedProcesses(
+      [](const ProcessSample & a, const ProcessSample & b) {
+        return a.stat.resident_pages > b.stat.resident_pages;
+      },
+      memory_infos);
   }
 
   const double elapsed_ms = stop_watch.toc("execution_time");
@@ -557,9 +365,11 @@ void ProcessMonitor::onTimer()
   // thread-safe copy
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    top_output_ = os.str();
-    is_top_error_ = is_top_error;
-    is_pipe2_error_ = false;
+    tasks_summary_ = summary;
+    load_infos_ = std::move(load_infos);
+    memory_infos_ = std::move(memory_infos);
+    is_started_ = is_started;
+    proc_error_ = proc_error;
     elapsed_ms_ = elapsed_ms;
   }
 }
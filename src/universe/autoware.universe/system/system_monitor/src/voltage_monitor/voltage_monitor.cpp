@@ -19,22 +19,18 @@
 
 #include "system_monitor/voltage_monitor/voltage_monitor.hpp"
 
-#include "system_monitor/msr_reader/msr_reader.hpp"
 #include "system_monitor/system_monitor_utility.hpp"
 
-#include <boost/algorithm/string.hpp>
-#include <boost/archive/text_iarchive.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/process.hpp>
 
 #include <fmt/format.h>
-#include <netinet/in.h>
-#include <sys/socket.h>
 
 #include <algorithm>
 #include <regex>
+#include <sstream>
 #include <string>
-#include <vector>
+#include <string_view>
 
 namespace bp = boost::process;
 
@@ -44,38 +40,54 @@ VoltageMonitor::VoltageMonitor(const rclcpp::NodeOptions & options)
   gethostname(hostname_, sizeof(hostname_));
 
   updater_.setHardwareID(hostname_);
-  // Publisher
-  rclcpp::QoS durable_qos{1};
-  durable_qos.transient_local();
 
   voltage_string_ = declare_parameter<std::string>("cmos_battery_label", "");
   voltage_warn_ = declare_parameter<float>("cmos_battery_warn", 2.95);
   voltage_error_ = declare_parameter<float>("cmos_battery_error", 2.75);
-  bool sensors_exists = false;
-  if (voltage_string_ == "") {
-    sensors_exists = false;
-  } else {
-    // Check if command exists
-    fs::path p = bp::search_path("sensors");
-    sensors_exists = (p.empty()) ? false : true;
-  }
-  gethostname(hostname_, sizeof(hostname_));
+  const bool use_sensors = declare_parameter<bool>("cmos_battery_use_sensors", false);
+
+  // Read the raw voltage from hwmon instead of running sensors, unless sensors.conf has to be
+  // applied or renames the input so that the label is only shown by sensors.
   auto callback = &VoltageMonitor::checkBatteryStatus;
-  if (sensors_exists) {
-    try {
-      std::regex re(R"((\d+).(\d+))");
-      voltage_regex_ = re;
-    } catch (std::regex_error & e) {
-      // never comes here.
-      RCLCPP_WARN(get_logger(), "std::regex_error %d", e.code());
-      return;
+  if (voltage_string_ != "") {
+    if (!use_sensors && voltage_sensor_.find("in", voltage_string_)) {
+      callback = &VoltageMonitor::checkVoltage;
+    } else if (!bp::search_path("sensors").empty()) {
+      callback = &VoltageMonitor::checkVoltageWithSensors;
+      voltage_regex_ = std::regex(R"((\d+).(\d+))");
+    } else {
+      RCLCPP_WARN(
+        get_logger(),
+        "hwmon input labeled '%s' not found and sensors is not installed, use the RTC battery "
+        "status instead.",
+        voltage_string_.c_str());
     }
-    callback = &VoltageMonitor::checkVoltage;
+  }
+  if (callback == &VoltageMonitor::checkBatteryStatus) {
+    rtc_file_.open("/proc/driver/rtc");
   }
   updater_.add("CMOS Battery Status", this, callback);
 }
 
 void VoltageMonitor::checkVoltage(diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  // Remember start time to measure elapsed time
+  const auto t_start = SystemMonitorUtility::startMeasurement();
+
+  const auto millivolts = voltage_sensor_.read();
+  if (RCUTILS_UNLIKELY(!millivolts)) {
+    stat.summary(DiagStatus::ERROR, "hwmon error");
+    stat.add("hwmon", fmt::format("failed to read {}", voltage_sensor_.path()));
+    return;
+  }
+  const float voltage = static_cast<float>(millivolts.value()) / 1000.0f;
+  addVoltage(stat, voltage);
+
+  // Measure elapsed time since start time and report
+  SystemMonitorUtility::stopMeasurement(t_start, stat);
+}
+
+void VoltageMonitor::checkVoltageWithSensors(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
   // Remember start time to measure elapsed time
   const auto t_start = SystemMonitorUtility::startMeasurement();
@@ -126,6 +138,15 @@ void VoltageMonitor::checkVoltage(diagnostic_updater::DiagnosticStatusWrapper &
       break;
     }
   }
+  addVoltage(stat, voltage);
+
+  // Measure elapsed time since start time and report
+  SystemMonitorUtility::stopMeasurement(t_start, stat);
+}
+
+void VoltageMonitor::addVoltage(
+  diagnostic_updater::DiagnosticStatusWrapper & stat, const float voltage) const
+{
   stat.add("CMOS battery voltage", fmt::format("{}", voltage));
   if (voltage < voltage_error_) {
     stat.summary(DiagStatus::WARN, "Battery Died");
@@ -134,9 +155,6 @@ void VoltageMonitor::checkVoltage(diagnostic_updater::DiagnosticStatusWrapper &
   } else {
     stat.summary(DiagStatus::OK, "OK");
   }
-
-  // Measure elapsed time since start time and report
-  SystemMonitorUtility::stopMeasurement(t_start, stat);
 }
 
 void VoltageMonitor::checkBatteryStatus(diagnostic_updater::DiagnosticStatusWrapper & stat)
@@ -145,45 +163,22 @@ void VoltageMonitor::checkBatteryStatus(diagnostic_updater::DiagnosticStatusWrap
   const auto t_start = SystemMonitorUtility::startMeasurement();
 
   // Get status of RTC
-  int out_fd[2];
-  if (RCUTILS_UNLIKELY(pipe2(out_fd, O_CLOEXEC) != 0)) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (RCUTILS_UNLIKELY(pipe2(err_fd, O_CLOEXEC) != 0)) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  bp::child c("cat /proc/driver/rtc", bp::std_out > is_out, bp::std_err > is_err);
-  c.wait();
-
-  if (RCUTILS_UNLIKELY(c.exit_code() != 0)) {
-    std::ostringstream os;
-    is_err >> os.rdbuf();
+  const auto content = rtc_file_.read();
+  if (RCUTILS_UNLIKELY(!content)) {
     stat.summary(DiagStatus::ERROR, "rtc error");
-    stat.add("rtc", os.str().c_str());
+    stat.add("rtc", "failed to read /proc/driver/rtc");
     return;
   }
 
-  std::string line;
   bool status = false;
-  while (std::getline(is_out, line)) {
-    auto batStatusLine = line.find("batt_status");
-    if (batStatusLine != std::string::npos) {
-      auto batStatus = line.find("okay");
-      if (batStatus != std::string::npos) {
-        status = true;
-        break;
-      }
+  std::string_view rest = content.value();
+  while (!rest.empty()) {
+    const auto end = std::min(rest.find('\n'), rest.size());
+    const auto line = rest.substr(0, end);
+    rest.remove_prefix(std::min(end + 1, rest.size()));
+    if (line.find("batt_status") != std::string_view::npos) {
+      status = line.find("okay") != std::string_view::npos;
+      break;
     }
   }
 
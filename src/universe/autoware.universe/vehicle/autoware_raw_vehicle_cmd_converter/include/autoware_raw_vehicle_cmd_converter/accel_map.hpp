@@ -16,6 +16,7 @@
 #define AUTOWARE_RAW_VEHICLE_CMD_CONVERTER__ACCEL_MAP_HPP_
 
 #include "autoware_raw_vehicle_cmd_converter/csv_loader.hpp"
+#include "autoware_raw_vehicle_cmd_converter/precompiled_map.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -32,6 +33,10 @@ public:
   bool readAccelMapFromCSV(const std::string & csv_path, const bool validation = false);
   bool getThrottle(const double acc, const double vel, double & throttle) const;
   bool getAcceleration(const double throttle, const double vel, double & acc) const;
+  // batched getAcceleration, reusing the capacity of acc
+  bool getAcceleration(
+    const std::vector<double> & throttle, const std::vector<double> & vel,
+    std::vector<double> & acc) const;
   std::vector<double> getVelIdx() const { return vel_index_; }
   std::vector<double> getThrottleIdx() const { return throttle_index_; }
   std::vector<std::vector<double>> getAccelMap() const { return accel_map_; }
@@ -44,6 +49,7 @@ private:
   std::vector<double> vel_index_;
   std::vector<double> throttle_index_;
   std::vector<std::vector<double>> accel_map_;
+  PrecompiledMap precompiled_map_;
 };
 }  // namespace autoware::raw_vehicle_cmd_converter
 
@@ -16,6 +16,7 @@
 #define AUTOWARE_RAW_VEHICLE_CMD_CONVERTER__BRAKE_MAP_HPP_
 
 #include "autoware_raw_vehicle_cmd_converter/csv_loader.hpp"
+#include "autoware_raw_vehicle_cmd_converter/precompiled_map.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -32,6 +33,10 @@ public:
   bool readBrakeMapFromCSV(const std::string & csv_path, const bool validation = false);
   bool getBrake(const double acc, const double vel, double & brake);
   bool getAcceleration(const double brake, const double vel, double & acc) const;
+  // batched getAcceleration, reusing the capacity of acc
+  bool getAcceleration(
+    const std::vector<double> & brake, const std::vector<double> & vel,
+    std::vector<double> & acc) const;
   std::vector<double> getVelIdx() const { return vel_index_; }
   std::vector<double> getBrakeIdx() const { return brake_index_; }
   std::vector<std::vector<double>> getBrakeMap() const { return brake_map_; }
@@ -43,8 +48,8 @@ private:
   std::string vehicle_name_;
   std::vector<double> vel_index_;
   std::vector<double> brake_index_;
-  std::vector<double> brake_index_rev_;
   std::vector<std::vector<double>> brake_map_;
+  PrecompiledMap precompiled_map_;
 };
 }  // namespace autoware::raw_vehicle_cmd_converter
 
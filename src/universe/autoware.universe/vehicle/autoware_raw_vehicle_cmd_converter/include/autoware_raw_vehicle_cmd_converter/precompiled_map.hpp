@@ -0,0 +1,120 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_RAW_VEHICLE_CMD_CONVERTER__PRECOMPILED_MAP_HPP_
+#define AUTOWARE_RAW_VEHICLE_CMD_CONVERTER__PRECOMPILED_MAP_HPP_
+
+#include "autoware_raw_vehicle_cmd_converter/csv_loader.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware::raw_vehicle_cmd_converter
+{
+/**
+ * @brief (row key, column key) -> value map prepared once at load for lookups without allocation
+ * @details the segment of a key is found in O(1) on a uniform index and by binary search
+ * otherwise, and the bilinear coefficients of the cells and the monotonicity of the columns are
+ * precomputed. The results are the same as interpolating each row at the column key and then the
+ * interpolated values at the row key with autoware::interpolation::lerp, and the lookups throw
+ * std::invalid_argument in the cases where lerp would throw.
+ */
+class PrecompiledMap
+{
+public:
+  enum class Monotonicity : uint8_t { NONE = 0, INCREASING, DECREASING };
+
+  // segment [index, index + 1] of an index and ratio of a key in the segment
+  struct Segment
+  {
+    size_t index;
+    double ratio;
+  };
+
+  /**
+   * @brief the map interpolated at a column key, i.e. the (row key -> value) table at the key
+   */
+  class Column
+  {
+  public:
+    Column(const PrecompiledMap & map, const Segment & segment) : map_(map), segment_(segment) {}
+
+    size_t size() const;
+    double value(const size_t row) const;
+    double front() const { return value(0); }
+    double back() const { return value(size() - 1); }
+    Monotonicity monotonicity() const;
+
+    /**
+     * @brief row key of the value by linear interpolation of the values of the rows
+     * @details the values must be strictly increasing or decreasing and contain the value
+     */
+    double getRowKey(const double value) const;
+
+  private:
+    const PrecompiledMap & map_;
+    Segment segment_;
+  };
+
+  PrecompiledMap() = default;
+  PrecompiledMap(std::vector<double> row_index, std::vector<double> col_index, const Map & map);
+
+  /**
+   * @brief bilinear interpolation of the map, with the keys in the ranges of the indices
+   */
+  double getValue(const double row_key, const double col_key) const;
+
+  /**
+   * @brief the map interpolated at the column key, which is in the range of the column index
+   */
+  Column getColumn(const double col_key) const;
+
+private:
+  class Index
+  {
+  public:
+    Index() = default;
+    explicit Index(std::vector<double> keys);
+
+    bool isValid() const { return is_increasing_; }
+    const std::vector<double> & keys() const { return keys_; }
+    // same segment as autoware::interpolation::lerp, i.e. the left one for a key on a boundary
+    Segment findSegment(const double key) const;
+
+  private:
+    std::vector<double> keys_;
+    bool is_increasing_{false};
+    bool is_uniform_{false};
+    double inverse_step_{0.0};
+  };
+
+  Index row_index_;
+  Index col_index_;
+  bool is_map_valid_{false};
+  // values_[row * cols + col]
+  std::vector<double> values_;
+  // coefficients of the cells, i.e. a(r, c), a(r, c + 1) - a(r, c), a(r + 1, c) and
+  // a(r + 1, c + 1) - a(r + 1, c), in the same order as values_ without the last row and column
+  std::vector<std::array<double, 4>> cell_coefficients_;
+  // monotonicity of the values along the rows between the columns c and c + 1
+  std::vector<Monotonicity> segment_monotonicity_;
+
+  size_t cols() const { return col_index_.keys().size(); }
+  void validateColumnIndex() const;
+};
+}  // namespace autoware::raw_vehicle_cmd_converter
+
+#endif  // AUTOWARE_RAW_VEHICLE_CMD_CONVERTER__PRECOMPILED_MAP_HPP_
@@ -14,8 +14,7 @@
 
 #include "autoware_raw_vehicle_cmd_converter/accel_map.hpp"
 
-#include "autoware/interpolation/linear_interpolation.hpp"
-
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -34,50 +33,59 @@ bool AccelMap::readAccelMapFromCSV(const std::string & csv_path, const bool vali
   vel_index_ = CSVLoader::getColumnIndex(table);
   throttle_index_ = CSVLoader::getRowIndex(table);
   accel_map_ = CSVLoader::getMap(table);
+  precompiled_map_ = PrecompiledMap(throttle_index_, vel_index_, accel_map_);
   return !validation || CSVLoader::validateMap(accel_map_, true);
 }
 
 bool AccelMap::getThrottle(const double acc, double vel, double & throttle) const
 {
-  std::vector<double> interpolated_acc_vec;
-  const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "throttle: vel");
+  const double clamped_vel =
+    CSVLoader::clampValue(vel, vel_index_.front(), vel_index_.back(), "throttle: vel");
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  interpolated_acc_vec.reserve(accel_map_.size());
-  for (const std::vector<double> & accelerations : accel_map_) {
-    interpolated_acc_vec.push_back(
-      autoware::interpolation::lerp(vel_index_, accelerations, clamped_vel));
-  }
+  const auto interpolated_acc = precompiled_map_.getColumn(clamped_vel);
   // calculate throttle
   // When the desired acceleration is smaller than the throttle area, return false => brake sequence
   // When the desired acceleration is greater than the throttle area, return max throttle
-  if (acc < interpolated_acc_vec.front()) {
+  if (acc < interpolated_acc.front()) {
     return false;
   }
-  if (interpolated_acc_vec.back() < acc) {
+  if (interpolated_acc.back() < acc) {
     throttle = throttle_index_.back();
     return true;
   }
-  throttle = autoware::interpolation::lerp(interpolated_acc_vec, throttle_index_, acc);
+  if (interpolated_acc.monotonicity() != PrecompiledMap::Monotonicity::INCREASING) {
+    throw std::invalid_argument("The accelerations of the throttle map are not increasing.");
+  }
+  throttle = interpolated_acc.getRowKey(acc);
   return true;
 }
 
 bool AccelMap::getAcceleration(const double throttle, const double vel, double & acc) const
 {
-  std::vector<double> interpolated_acc_vec;
-  const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "throttle: vel");
-
-  // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  interpolated_acc_vec.reserve(accel_map_.size());
-  for (const auto & acc_vec : accel_map_) {
-    interpolated_acc_vec.push_back(autoware::interpolation::lerp(vel_index_, acc_vec, clamped_vel));
-  }
+  const double clamped_vel =
+    CSVLoader::clampValue(vel, vel_index_.front(), vel_index_.back(), "throttle: vel");
 
   // calculate throttle
   // When the desired acceleration is smaller than the throttle area, return min acc
   // When the desired acceleration is greater than the throttle area, return max acc
-  const double clamped_throttle = CSVLoader::clampValue(throttle, throttle_index_, "throttle: acc");
-  acc = autoware::interpolation::lerp(throttle_index_, interpolated_acc_vec, clamped_throttle);
+  const double clamped_throttle = CSVLoader::clampValue(
+    throttle, throttle_index_.front(), throttle_index_.back(), "throttle: acc");
+  acc = precompiled_map_.getValue(clamped_throttle, clamped_vel);
 
   return true;
 }
+
+bool AccelMap::getAcceleration(
+  const std::vector<double> & throttle, const std::vector<double> & vel,
+  std::vector<double> & acc) const
+{
+  if (throttle.size() != vel.size()) {
+    return false;
+  }
+  acc.resize(throttle.size());
+  for (size_t i = 0; i < throttle.size(); ++i) {
+    getAcceleration(throttle[i], vel[i], acc[i]);
+  }
+  return true;
+}
 }  // namespace autoware::raw_vehicle_cmd_converter
@@ -14,9 +14,7 @@
 
 #include "autoware_raw_vehicle_cmd_converter/brake_map.hpp"
 
-#include "autoware/interpolation/linear_interpolation.hpp"
-
-#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -35,67 +33,69 @@ bool BrakeMap::readBrakeMapFromCSV(const std::string & csv_path, const bool vali
   vel_index_ = CSVLoader::getColumnIndex(table);
   brake_index_ = CSVLoader::getRowIndex(table);
   brake_map_ = CSVLoader::getMap(table);
-  brake_index_rev_ = brake_index_;
-  if (validation && !CSVLoader::validateMap(brake_map_, false)) {
-    return false;
-  }
-  std::reverse(std::begin(brake_index_rev_), std::end(brake_index_rev_));
-
-  return true;
+  precompiled_map_ = PrecompiledMap(brake_index_, vel_index_, brake_map_);
+  return !validation || CSVLoader::validateMap(brake_map_, false);
 }
 
 bool BrakeMap::getBrake(const double acc, const double vel, double & brake)
 {
-  std::vector<double> interpolated_acc_vec;
-  const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "brake: vel");
+  const double clamped_vel =
+    CSVLoader::clampValue(vel, vel_index_.front(), vel_index_.back(), "brake: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  interpolated_acc_vec.reserve(brake_map_.size());
-  for (const std::vector<double> & accelerations : brake_map_) {
-    interpolated_acc_vec.push_back(
-      autoware::interpolation::lerp(vel_index_, accelerations, clamped_vel));
-  }
+  const auto interpolated_acc = precompiled_map_.getColumn(clamped_vel);
 
   // calculate brake
   // When the desired acceleration is smaller than the brake area, return max brake on the map
   // When the desired acceleration is greater than the brake area, return min brake on the map
-  if (acc < interpolated_acc_vec.back()) {
+  if (acc < interpolated_acc.back()) {
     RCLCPP_WARN_SKIPFIRST_THROTTLE(
       logger_, clock_, 1000,
       "Exceeding the acc range. Desired acc: %f < min acc on map: %f. return max "
       "value.",
-      acc, interpolated_acc_vec.back());
+      acc, interpolated_acc.back());
     brake = brake_index_.back();
     return true;
   }
-  if (interpolated_acc_vec.front() < acc) {
+  if (interpolated_acc.front() < acc) {
     brake = brake_index_.front();
     return true;
   }
 
-  std::reverse(std::begin(interpolated_acc_vec), std::end(interpolated_acc_vec));
-  brake = autoware::interpolation::lerp(interpolated_acc_vec, brake_index_rev_, acc);
+  if (interpolated_acc.monotonicity() != PrecompiledMap::Monotonicity::DECREASING) {
+    throw std::invalid_argument("The accelerations of the brake map are not decreasing.");
+  }
+  brake = interpolated_acc.getRowKey(acc);
 
   return true;
 }
 
 bool BrakeMap::getAcceleration(const double brake, const double vel, double & acc) const
 {
-  std::vector<double> interpolated_acc_vec;
-  const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "brake: vel");
-
-  // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  interpolated_acc_vec.reserve(brake_map_.size());
-  for (const auto & acc_vec : brake_map_) {
-    interpolated_acc_vec.push_back(autoware::interpolation::lerp(vel_index_, acc_vec, clamped_vel));
-  }
+  const double clamped_vel =
+    CSVLoader::clampValue(vel, vel_index_.front(), vel_index_.back(), "brake: vel");
 
   // calculate brake
   // When the desired acceleration is smaller than the brake area, return min acc
   // When the desired acceleration is greater than the brake area, return min acc
-  const double clamped_brake = CSVLoader::clampValue(brake, brake_index_, "brake: acc");
-  acc = autoware::interpolation::lerp(brake_index_, interpolated_acc_vec, clamped_brake);
+  const double clamped_brake =
+    CSVLoader::clampValue(brake, brake_index_.front(), brake_index_.back(), "brake: acc");
+  acc = precompiled_map_.getValue(clamped_brake, clamped_vel);
+
+  return true;
+}
 
+bool BrakeMap::getAcceleration(
+  const std::vector<double> & brake, const std::vector<double> & vel,
+  std::vector<double> & acc) const
+{
+  if (brake.size() != vel.size()) {
+    return false;
+  }
+  acc.resize(brake.size());
+  for (size_t i = 0; i < brake.size(); ++i) {
+    getAcceleration(brake[i], vel[i], acc[i]);
+  }
   return true;
 }
 }  // namespace autoware::raw_vehicle_cmd_converter
@@ -138,6 +138,12 @@ double CSVLoader::clampValue(
 {
   const double max_value = *std::max_element(ranges.begin(), ranges.end());
   const double min_value = *std::min_element(ranges.begin(), ranges.end());
+  return clampValue(val, min_value, max_value, name.c_str());
+}
+
+double CSVLoader::clampValue(
+  const double val, const double min_value, const double max_value, const char * name)
+{
   if (val < min_value || max_value < val) {
     std::cerr << "Input " << name << ": " << val << " is out of range. use closest value."
               << std::endl;
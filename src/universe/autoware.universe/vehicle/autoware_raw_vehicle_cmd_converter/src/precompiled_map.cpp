@@ -0,0 +1,214 @@
+//  Copyright 2024 Tier IV, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include "autoware_raw_vehicle_cmd_converter/precompiled_map.hpp"
+
+#include "autoware/interpolation/linear_interpolation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace autoware::raw_vehicle_cmd_converter
+{
+namespace
+{
+// same tolerance as autoware::interpolation::validateKeys
+constexpr double query_tolerance = 1e-3;
+}  // namespace
+
+PrecompiledMap::Index::Index(std::vector<double> keys) : keys_(std::move(keys))
+{
+  is_increasing_ = keys_.size() >= 2;
+  for (size_t i = 1; i < keys_.size(); ++i) {
+    is_increasing_ = is_increasing_ && keys_.at(i - 1) < keys_.at(i);
+  }
+  if (!is_increasing_) {
+    return;
+  }
+  // nearly uniform indices such as the velocities rounded in the csv files are also uniform since
+  // the segment from the uniform step is corrected by the neighboring keys
+  const double step = (keys_.back() - keys_.front()) / static_cast<double>(keys_.size() - 1);
+  is_uniform_ = true;
+  for (size_t i = 0; i < keys_.size(); ++i) {
+    const double uniform_key = keys_.front() + step * static_cast<double>(i);
+    is_uniform_ = is_uniform_ && std::abs(keys_.at(i) - uniform_key) <= 0.1 * step;
+  }
+  inverse_step_ = 1.0 / step;
+}
+
+PrecompiledMap::Segment PrecompiledMap::Index::findSegment(const double key) const
+{
+  const double cropped_key = std::clamp(key, keys_.front(), keys_.back());
+  const size_t last_segment = keys_.size() - 2;
+  size_t index = 0;
+  if (is_uniform_) {
+    // the guess is at most one segment away since the keys are close to the uniform ones
+    const double guess = (cropped_key - keys_.front()) * inverse_step_;
+    index = std::min(static_cast<size_t>(std::max(guess, 0.0)), last_segment);
+    while (index > 0 && cropped_key <= keys_[index]) {
+      --index;
+    }
+    while (index < last_segment && keys_[index + 1] < cropped_key) {
+      ++index;
+    }
+  } else {
+    index = static_cast<size_t>(
+      std::lower_bound(keys_.begin() + 1, keys_.end() - 1, cropped_key) - keys_.begin() - 1);
+  }
+  return {index, (cropped_key - keys_[index]) / (keys_[index + 1] - keys_[index])};
+}
+
+PrecompiledMap::PrecompiledMap(
+  std::vector<double> row_index, std::vector<double> col_index, const Map & map)
+: row_index_(std::move(row_index)), col_index_(std::move(col_index))
+{
+  const size_t rows = row_index_.keys().size();
+  is_map_valid_ = col_index_.isValid() && rows >= 2 && map.size() == rows;
+  for (const auto & row : map) {
+    is_map_valid_ = is_map_valid_ && row.size() == cols();
+  }
+  if (!is_map_valid_) {
+    return;
+  }
+
+  values_.reserve(rows * cols());
+  for (const auto & row : map) {
+    values_.insert(values_.end(), row.begin(), row.end());
+  }
+
+  cell_coefficients_.reserve((rows - 1) * (cols() - 1));
+  for (size_t r = 0; r + 1 < rows; ++r) {
+    for (size_t c = 0; c + 1 < cols(); ++c) {
+      const double a00 = values_[r * cols() + c];
+      const double a01 = values_[r * cols() + c + 1];
+      const double a10 = values_[(r + 1) * cols() + c];
+      const double a11 = values_[(r + 1) * cols() + c + 1];
+      cell_coefficients_.push_back({a00, a01 - a00, a10, a11 - a10});
+    }
+  }
+
+  // the interpolation of two strictly monotone columns is strictly monotone
+  const auto column_monotonicity = [&](const size_t c) {
+    bool is_increasing = true;
+    bool is_decreasing = true;
+    for (size_t r = 1; r < rows; ++r) {
+      is_increasing = is_increasing && values_[(r - 1) * cols() + c] < values_[r * cols() + c];
+      is_decreasing = is_decreasing && values_[(r - 1) * cols() + c] > values_[r * cols() + c];
+    }
+    return is_increasing   ? Monotonicity::INCREASING
+           : is_decreasing ? Monotonicity::DECREASING
+                           : Monotonicity::NONE;
+  };
+  segment_monotonicity_.reserve(cols() - 1);
+  for (size_t c = 0; c + 1 < cols(); ++c) {
+    const auto monotonicity = column_monotonicity(c);
+    segment_monotonicity_.push_back(
+      monotonicity == column_monotonicity(c + 1) ? monotonicity : Monotonicity::NONE);
+  }
+}
+
+void PrecompiledMap::validateColumnIndex() const
+{
+  if (!is_map_valid_) {
+    throw std::invalid_argument(
+      "The column index is not sorted or the size of the map does not match the indices.");
+  }
+}
+
+double PrecompiledMap::getValue(const double row_key, const double col_key) const
+{
+  validateColumnIndex();
+  if (!row_index_.isValid()) {
+    throw std::invalid_argument("The row index is not sorted.");
+  }
+  const auto row = row_index_.findSegment(row_key);
+  const auto col = col_index_.findSegment(col_key);
+  const auto & c = cell_coefficients_[row.index * (cols() - 1) + col.index];
+  return autoware::interpolation::lerp(
+    c[0] + c[1] * col.ratio, c[2] + c[3] * col.ratio, row.ratio);
+}
+
+PrecompiledMap::Column PrecompiledMap::getColumn(const double col_key) const
+{
+  validateColumnIndex();
+  return Column(*this, col_index_.findSegment(col_key));
+}
+
+size_t PrecompiledMap::Column::size() const
+{
+  return map_.row_index_.keys().size();
+}
+
+double PrecompiledMap::Column::value(const size_t row) const
+{
+  const size_t i = row * map_.cols() + segment_.index;
+  return autoware::interpolation::lerp(map_.values_[i], map_.values_[i + 1], segment_.ratio);
+}
+
+PrecompiledMap::Monotonicity PrecompiledMap::Column::monotonicity() const
+{
+  const auto monotonicity = map_.segment_monotonicity_[segment_.index];
+  if (monotonicity != Monotonicity::NONE) {
+    return monotonicity;
+  }
+  // the interpolated values can still be monotone, e.g. on the boundary of the segment
+  bool is_increasing = true;
+  bool is_decreasing = true;
+  for (size_t r = 1; r < size(); ++r) {
+    is_increasing = is_increasing && value(r - 1) < value(r);
+    is_decreasing = is_decreasing && value(r - 1) > value(r);
+  }
+  return is_increasing   ? Monotonicity::INCREASING
+         : is_decreasing ? Monotonicity::DECREASING
+                         : Monotonicity::NONE;
+}
+
+double PrecompiledMap::Column::getRowKey(const double value) const
+{
+  const auto monotonicity = this->monotonicity();
+  if (monotonicity == Monotonicity::NONE) {
+    throw std::invalid_argument("The values of the column are not sorted.");
+  }
+
+  // the values in increasing order, i.e. the rows in reverse order for decreasing values
+  const bool is_reversed = monotonicity == Monotonicity::DECREASING;
+  const size_t last = size() - 1;
+  const auto row_at = [&](const size_t i) { return is_reversed ? last - i : i; };
+  const auto value_at = [&](const size_t i) { return this->value(row_at(i)); };
+  if (value < value_at(0) - query_tolerance || value_at(last) + query_tolerance < value) {
+    throw std::invalid_argument("The value is out of the values of the column.");
+  }
+  const double cropped_value = std::clamp(value, value_at(0), value_at(last));
+
+  // first segment whose end is not less than the value
+  size_t lower = 0;
+  size_t upper = last - 1;
+  while (lower < upper) {
+    const size_t middle = (lower + upper) / 2;
+    if (value_at(middle + 1) < cropped_value) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  const double src_value = value_at(lower);
+  const double ratio = (cropped_value - src_value) / (value_at(lower + 1) - src_value);
+  const auto & row_keys = map_.row_index_.keys();
+  return autoware::interpolation::lerp(
+    row_keys[row_at(lower)], row_keys[row_at(lower + 1)], ratio);
+}
+}  // namespace autoware::raw_vehicle_cmd_converter
@@ -14,8 +14,7 @@
 
 #include "autoware_raw_vehicle_cmd_converter/steer_map.hpp"
 
-#include "autoware/interpolation/linear_interpolation.hpp"
-
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -35,21 +34,21 @@ bool SteerMap::readSteerMapFromCSV(const std::string & csv_path, const bool vali
   steer_index_ = CSVLoader::getColumnIndex(table);
   output_index_ = CSVLoader::getRowIndex(table);
   steer_map_ = CSVLoader::getMap(table);
+  precompiled_map_ = PrecompiledMap(output_index_, steer_index_, steer_map_);
   return !validation || CSVLoader::validateMap(steer_map_, true);
 }
 
 void SteerMap::getSteer(const double steer_rate, const double steer, double & output) const
 {
-  const double clamped_steer = CSVLoader::clampValue(steer, steer_index_, "steer: steer");
-  std::vector<double> steer_rate_interp = {};
-  steer_rate_interp.reserve(steer_map_.size());
-  for (const auto & steer_rate_vec : steer_map_) {
-    steer_rate_interp.push_back(
-      autoware::interpolation::lerp(steer_index_, steer_rate_vec, clamped_steer));
+  const double clamped_steer =
+    CSVLoader::clampValue(steer, steer_index_.front(), steer_index_.back(), "steer: steer");
+  const auto steer_rate_interp = precompiled_map_.getColumn(clamped_steer);
+  if (steer_rate_interp.monotonicity() != PrecompiledMap::Monotonicity::INCREASING) {
+    throw std::invalid_argument("The steer rates of the steer map are not increasing.");
   }
 
-  const double clamped_steer_rate =
-    CSVLoader::clampValue(steer_rate, steer_rate_interp, "steer: steer_rate");
-  output = autoware::interpolation::lerp(steer_rate_interp, output_index_, clamped_steer_rate);
+  const double clamped_steer_rate = CSVLoader::clampValue(
+    steer_rate, steer_rate_interp.front(), steer_rate_interp.back(), "steer: steer_rate");
+  output = steer_rate_interp.getRowKey(clamped_steer_rate);
 }
 }  // namespace autoware::raw_vehicle_cmd_converter
@@ -15,12 +15,17 @@
 #include "ament_index_cpp/get_package_share_directory.hpp"
 #include "autoware_raw_vehicle_cmd_converter/accel_map.hpp"
 #include "autoware_raw_vehicle_cmd_converter/brake_map.hpp"
+#include "autoware/interpolation/linear_interpolation.hpp"
 #include "autoware_raw_vehicle_cmd_converter/pid.hpp"
+#include "autoware_raw_vehicle_cmd_converter/precompiled_map.hpp"
 #include "autoware_raw_vehicle_cmd_converter/steer_map.hpp"
 #include "autoware_raw_vehicle_cmd_converter/vgr.hpp"
 #include "gtest/gtest.h"
 
 #include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
 
 /*
  * Throttle data: (vel, throttle -> acc)
@@ -51,6 +56,7 @@
 using autoware::raw_vehicle_cmd_converter::AccelMap;
 using autoware::raw_vehicle_cmd_converter::BrakeMap;
 using autoware::raw_vehicle_cmd_converter::PIDController;
+using autoware::raw_vehicle_cmd_converter::PrecompiledMap;
 using autoware::raw_vehicle_cmd_converter::SteerMap;
 using autoware::raw_vehicle_cmd_converter::VGR;
 double epsilon = 1e-4;
@@ -261,6 +267,113 @@ TEST(ConverterTests, SteerMapCalculation)
   EXPECT_DOUBLE_EQ(calcSteer(5.0, 5.0), 5.0);
 }
 
+TEST(ConverterTests, BatchedAccelerationCalculation)
+{
+  AccelMap accel_map;
+  BrakeMap brake_map;
+  loadAccelMapData(accel_map);
+  loadBrakeMapData(brake_map);
+
+  const std::vector<double> pedals = {0.0, 0.75, 1.1, 0.5};
+  const std::vector<double> velocities = {10.0, 5.0, 0.0, 12.0};
+  std::vector<double> accelerations;
+  ASSERT_TRUE(accel_map.getAcceleration(pedals, velocities, accelerations));
+  ASSERT_EQ(accelerations.size(), pedals.size());
+  for (size_t i = 0; i < pedals.size(); ++i) {
+    double expected = 0.0;
+    accel_map.getAcceleration(pedals.at(i), velocities.at(i), expected);
+    EXPECT_DOUBLE_EQ(accelerations.at(i), expected);
+  }
+  ASSERT_TRUE(brake_map.getAcceleration(pedals, velocities, accelerations));
+  for (size_t i = 0; i < pedals.size(); ++i) {
+    double expected = 0.0;
+    brake_map.getAcceleration(pedals.at(i), velocities.at(i), expected);
+    EXPECT_DOUBLE_EQ(accelerations.at(i), expected);
+  }
+
+  // for inconsistent sizes
+  EXPECT_FALSE(accel_map.getAcceleration(pedals, {0.0}, accelerations));
+  EXPECT_FALSE(brake_map.getAcceleration(pedals, {0.0}, accelerations));
+}
+
+TEST(PrecompiledMapTests, sameAsLerp)
+{
+  // non-uniform rows and nearly uniform columns
+  const std::vector<double> row_index = {0.0, 0.1, 0.35, 0.4, 1.0};
+  const std::vector<double> col_index = {0.0, 1.39, 2.78, 4.17, 5.56, 6.94};
+  std::vector<std::vector<double>> map;
+  for (size_t i = 0; i < row_index.size(); ++i) {
+    std::vector<double> row;
+    for (size_t j = 0; j < col_index.size(); ++j) {
+      row.push_back(3.0 * row_index.at(i) - 0.1 * col_index.at(j) + 0.01 * static_cast<double>(j));
+    }
+    map.push_back(row);
+  }
+  const PrecompiledMap precompiled_map(row_index, col_index, map);
+
+  const auto interpolate_column = [&](const double col_key) {
+    std::vector<double> values;
+    for (const auto & row : map) {
+      values.push_back(autoware::interpolation::lerp(col_index, row, col_key));
+    }
+    return values;
+  };
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> row_distribution(0.0, 1.0);
+  std::uniform_real_distribution<double> col_distribution(0.0, 6.94);
+  std::vector<double> col_keys = col_index;
+  for (int i = 0; i < 100; ++i) {
+    col_keys.push_back(col_distribution(generator));
+  }
+  for (const double col_key : col_keys) {
+    const auto values = interpolate_column(col_key);
+    const auto column = precompiled_map.getColumn(col_key);
+    ASSERT_EQ(column.size(), values.size());
+    EXPECT_EQ(column.monotonicity(), PrecompiledMap::Monotonicity::INCREASING);
+    for (size_t i = 0; i < values.size(); ++i) {
+      EXPECT_DOUBLE_EQ(column.value(i), values.at(i));
+    }
+    for (const double row_key : {0.0, 0.1, 0.2, 0.37, 1.0, row_distribution(generator)}) {
+      const double value = autoware::interpolation::lerp(row_index, values, row_key);
+      EXPECT_DOUBLE_EQ(precompiled_map.getValue(row_key, col_key), value);
+      EXPECT_NEAR(column.getRowKey(value), row_key, epsilon);
+    }
+  }
+
+  // decreasing values
+  for (auto & row : map) {
+    for (auto & value : row) {
+      value = -value;
+    }
+  }
+  const PrecompiledMap decreasing_map(row_index, col_index, map);
+  const auto column = decreasing_map.getColumn(3.0);
+  EXPECT_EQ(column.monotonicity(), PrecompiledMap::Monotonicity::DECREASING);
+  EXPECT_NEAR(column.getRowKey(decreasing_map.getValue(0.2, 3.0)), 0.2, epsilon);
+}
+
+TEST(PrecompiledMapTests, invalidMap)
+{
+  // not interpolatable along the rows between the first and the second columns
+  const PrecompiledMap map({0.0, 0.5, 1.0}, {0.0, 10.0, 20.0}, {{1.0, 2.0}, {0.9, 3.0}});
+  EXPECT_THROW(map.getColumn(5.0), std::invalid_argument);
+  const PrecompiledMap not_monotone_map(
+    {0.0, 0.5, 1.0}, {0.0, 10.0, 20.0}, {{1.0, 11.0, 21.0}, {0.9, 22.0, 42.0}, {3.0, 46.0, 42.0}});
+  EXPECT_EQ(
+    not_monotone_map.getColumn(5.0).monotonicity(), PrecompiledMap::Monotonicity::INCREASING);
+  EXPECT_EQ(not_monotone_map.getColumn(0.0).monotonicity(), PrecompiledMap::Monotonicity::NONE);
+  EXPECT_THROW(not_monotone_map.getColumn(0.0).getRowKey(2.0), std::invalid_argument);
+
+  // unsorted indices
+  EXPECT_THROW(
+    PrecompiledMap({0.0, 1.0}, {1.0, 0.0}, {{0.0, 1.0}, {1.0, 2.0}}).getColumn(0.5),
+    std::invalid_argument);
+  EXPECT_THROW(
+    PrecompiledMap({1.0, 0.0}, {0.0, 1.0}, {{0.0, 1.0}, {1.0, 2.0}}).getValue(0.5, 0.5),
+    std::invalid_argument);
+}
+
 TEST(PIDTests, calculateFB)
 {
   PIDController steer_pid;